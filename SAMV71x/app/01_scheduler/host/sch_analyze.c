@@ -0,0 +1,246 @@
+/****************************************************************************************************/
+/**
+\file       sch_analyze.c
+\brief      Offline schedulability analysis of the time triggered task table.
+            The task table is taken from app_scheduler_cfg.h at build time; worst case execution
+            times (declared or measured, e.g. u32Max of u8Scheduler_GetTaskStats) are given per
+            task list. For every 500us slot of the hyperperiod the tool computes load, utilization
+            and headroom, and for every task list its worst case response time within the slot.
+            Slots that would overrun are reported with the TASK_SCHEDULER_OVERLOAD_xx status the
+            scheduler would raise.
+            Usage: sch_analyze [-f wcet.txt] [-w TASK_ID=wcet_us]... [-i isr_us] [-q]
+            wcet.txt holds one "TASK_ID wcet_us" pair per line, '#' starts a comment.
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+/** Scheduler task table */
+#include "app_scheduler.h"
+
+/*****************************************************************************************************
+* Definition of module wide MACROs / #DEFINE-CONSTANTs
+*****************************************************************************************************/
+
+/* Time slice of one scheduler tick, in us */
+#define ANALYZE_SLOT_US         ( 1000000.0 / (double)TASK_SCHEDULER_BASE_FREQ )
+
+#define ANALYZE_CFG_TASK( Arg, TaskId, TaskList, Priority, Period, Offset )    \
+                { #TaskId, Period, Offset },
+
+/*****************************************************************************************************
+* Declaration of module wide TYPEs
+*****************************************************************************************************/
+
+typedef struct
+{
+    const char *    Name;
+    uint16_t        u16Period;
+    uint16_t        u16Offset;
+}tAnalyzeTask;
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs -
+*****************************************************************************************************/
+
+static const tAnalyzeTask Analyze_Tasks[TASK_SCH_MAX_NUMBER_TIME_TASKS] =
+{
+    TASK_SCH_CFG_TIME_TASKS( ANALYZE_CFG_TASK, 0 )
+};
+
+/* Worst case execution time of each task list, in us */
+static double af64Analyze_Wcet[TASK_SCH_MAX_NUMBER_TIME_TASKS];
+/* Worst case response time of each task list, from slot start, in us */
+static double af64Analyze_Wcrt[TASK_SCH_MAX_NUMBER_TIME_TASKS];
+
+/*****************************************************************************************************
+* Code of module wide FUNCTIONS
+*****************************************************************************************************/
+
+static int s32Analyze_SetWcet(const char * Name, size_t Length, double f64Wcet)
+{
+    uint8_t u8TaskIndex;
+
+    for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
+    {
+        if( ( strlen(Analyze_Tasks[u8TaskIndex].Name) == Length )
+            && ( strncmp(Name, Analyze_Tasks[u8TaskIndex].Name, Length) == 0 ) )
+        {
+            af64Analyze_Wcet[u8TaskIndex] = f64Wcet;
+            return 0;
+        }
+    }
+    fprintf(stderr, "unknown task '%.*s'\n", (int)Length, Name);
+    return 1;
+}
+
+static int s32Analyze_ReadFile(const char * Path)
+{
+    char acLine[256];
+    char acName[128];
+    double f64Wcet;
+    char * Comment;
+    FILE * File = fopen(Path, "r");
+
+    if( File == NULL )
+    {
+        perror(Path);
+        return 1;
+    }
+    while( fgets(acLine, sizeof(acLine), File) != NULL )
+    {
+        Comment = strchr(acLine, '#');
+        if( Comment != NULL )
+        {
+            *Comment = '\0';
+        }
+        if( sscanf(acLine, "%127s %lf", acName, &f64Wcet) == 2 )
+        {
+            if( s32Analyze_SetWcet(acName, strlen(acName), f64Wcet) != 0 )
+            {
+                fclose(File);
+                return 1;
+            }
+        }
+    }
+    fclose(File);
+    return 0;
+}
+
+/* Overload status name, as defined in app_scheduler.h */
+static const char * Analyze_OverloadName(uint8_t u8Owner)
+{
+    static char acName[32];
+
+    switch( TASK_SCHEDULER_OVERLOAD( u8Owner ) )
+    {
+        case TASK_SCHEDULER_OVERLOAD_1MS:
+            return "TASK_SCHEDULER_OVERLOAD_1MS";
+        case TASK_SCHEDULER_OVERLOAD_2MS_A:
+            return "TASK_SCHEDULER_OVERLOAD_2MS_A";
+        case TASK_SCHEDULER_OVERLOAD_2MS_B:
+            return "TASK_SCHEDULER_OVERLOAD_2MS_B";
+        default:
+            snprintf(acName, sizeof(acName), "overload status 0x%02X", TASK_SCHEDULER_OVERLOAD( u8Owner ));
+            return acName;
+    }
+}
+
+/*****************************************************************************************************
+* Code of public FUNCTIONS
+*****************************************************************************************************/
+
+int main(int argc, char * argv[])
+{
+    double f64Isr = 0.0;
+    double f64Load, f64MaxLoad = 0.0, f64TotalLoad = 0.0;
+    uint32_t u32Slot, u32MaxSlot = 0u;
+    uint32_t u32Overloads = 0u;
+    uint8_t u8TaskIndex, u8Owner, u8Quiet = 0u;
+    const char * Separator;
+    int s32Arg;
+
+    for( s32Arg = 1; s32Arg < argc; s32Arg++ )
+    {
+        if( ( strcmp(argv[s32Arg], "-f") == 0 ) && ( ( s32Arg + 1 ) < argc ) )
+        {
+            if( s32Analyze_ReadFile(argv[++s32Arg]) != 0 )
+            {
+                return 2;
+            }
+        }
+        else if( ( strcmp(argv[s32Arg], "-w") == 0 ) && ( ( s32Arg + 1 ) < argc )
+                 && ( ( Separator = strchr(argv[s32Arg + 1], '=') ) != NULL ) )
+        {
+            s32Arg++;
+            if( s32Analyze_SetWcet(argv[s32Arg], (size_t)( Separator - argv[s32Arg] ), strtod(Separator + 1, NULL)) != 0 )
+            {
+                return 2;
+            }
+        }
+        else if( ( strcmp(argv[s32Arg], "-i") == 0 ) && ( ( s32Arg + 1 ) < argc ) )
+        {
+            f64Isr = strtod(argv[++s32Arg], NULL);
+        }
+        else if( strcmp(argv[s32Arg], "-q") == 0 )
+        {
+            u8Quiet = 1u;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-f wcet.txt] [-w TASK_ID=wcet_us]... [-i isr_us] [-q]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("slot budget: %.1f us, tick ISR: %.1f us, hyperperiod: %u slots\n",
+           ANALYZE_SLOT_US, f64Isr, TASK_SCH_HYPERPERIOD_TICKS);
+    if( u8Quiet == 0u )
+    {
+        printf("%5s %-32s %9s %7s %11s\n", "slot", "tasks", "load_us", "util%", "headroom_us");
+    }
+    for( u32Slot = 0u; u32Slot < TASK_SCH_HYPERPERIOD_TICKS; u32Slot++ )
+    {
+        tSchedulerSlotMask SlotMask = 0u;
+        char acTasks[128] = "";
+
+        /* Cooperative execution in table order, the tick ISR runs first */
+        f64Load = f64Isr;
+        for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
+        {
+            if( ( u32Slot % Analyze_Tasks[u8TaskIndex].u16Period ) == Analyze_Tasks[u8TaskIndex].u16Offset )
+            {
+                SlotMask |= (tSchedulerSlotMask)( 1u << u8TaskIndex );
+                f64Load += af64Analyze_Wcet[u8TaskIndex];
+                if( f64Load > af64Analyze_Wcrt[u8TaskIndex] )
+                {
+                    af64Analyze_Wcrt[u8TaskIndex] = f64Load;
+                }
+                snprintf(acTasks + strlen(acTasks), sizeof(acTasks) - strlen(acTasks), "%s%s",
+                         ( acTasks[0] != '\0' ) ? "+" : "", Analyze_Tasks[u8TaskIndex].Name);
+            }
+        }
+        f64TotalLoad += f64Load;
+        if( f64Load > f64MaxLoad )
+        {
+            f64MaxLoad = f64Load;
+            u32MaxSlot = u32Slot;
+        }
+        if( u8Quiet == 0u )
+        {
+            printf("%5u %-32s %9.1f %7.1f %11.1f\n", u32Slot, ( SlotMask != 0u ) ? acTasks : "-",
+                   f64Load, 100.0 * f64Load / ANALYZE_SLOT_US, ANALYZE_SLOT_US - f64Load);
+        }
+        if( ( SlotMask != 0u ) && ( f64Load > ANALYZE_SLOT_US ) )
+        {
+            for( u8Owner = 0u; ( SlotMask & ( 1u << u8Owner ) ) == 0u; u8Owner++ )
+            {
+            }
+            printf("OVERLOAD: slot %u needs %.1f us, would trip %s\n", u32Slot, f64Load,
+                   Analyze_OverloadName(u8Owner));
+            u32Overloads++;
+        }
+    }
+
+    printf("\n%-14s %6s %6s %9s %7s %9s %11s\n", "task", "period", "offset", "wcet_us", "util%", "wcrt_us", "headroom_us");
+    for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
+    {
+        printf("%-14s %6u %6u %9.1f %7.2f %9.1f %11.1f\n", Analyze_Tasks[u8TaskIndex].Name,
+               Analyze_Tasks[u8TaskIndex].u16Period, Analyze_Tasks[u8TaskIndex].u16Offset,
+               af64Analyze_Wcet[u8TaskIndex],
+               100.0 * af64Analyze_Wcet[u8TaskIndex] / ( ANALYZE_SLOT_US * Analyze_Tasks[u8TaskIndex].u16Period ),
+               af64Analyze_Wcrt[u8TaskIndex], ANALYZE_SLOT_US - af64Analyze_Wcrt[u8TaskIndex]);
+    }
+    printf("\nCPU utilization: %.2f %%, worst slot: %u (%.1f us, %.1f %%), overloaded slots: %u\n",
+           100.0 * f64TotalLoad / ( ANALYZE_SLOT_US * TASK_SCH_HYPERPERIOD_TICKS ),
+           u32MaxSlot, f64MaxLoad, 100.0 * f64MaxLoad / ANALYZE_SLOT_US, u32Overloads);
+
+    return ( u32Overloads == 0u ) ? 0 : 1;
+}
@@ -0,0 +1,34 @@
+/****************************************************************************************************/
+/**
+\file       sch_cfg_250us.h
+\brief      Host simulation scenario - default task lists and rates on a 250us tick.
+            Every task list keeps the rate of app_scheduler_cfg.h, periods and offsets being given
+            in 250us ticks, so half of the slots of the hyperperiod are empty. It shows the SysTick
+            suppression of TASK_SCH_CFG_LOW_POWER == 2, which the default table, with a task list in
+            every 500us slot, never gets to. Given to the build with -include, it replaces the tick
+            frequency, the hyperperiod and the time triggered task table of app_scheduler_cfg.h.
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+#ifndef SCH_CFG_250US_H        /*prevent duplicated includes*/
+#define SCH_CFG_250US_H
+
+/* 250us slots */
+#define    TASK_SCHEDULER_BASE_FREQ         4000
+
+/* 100ms, as the default table */
+#define    TASK_SCH_HYPERPERIOD_TICKS       400u
+
+/*                              TaskId        TaskList          Prio  Period  Offset */
+#define    TASK_SCH_CFG_TIME_TASKS( X, Arg )                                            \
+                             X( Arg, TASKS_1_MS,   TASKS_LIST_1MS,   5u,    4u,    1u  ) \
+                             X( Arg, TASKS_2_MS_A, TASKS_LIST_2MS_A, 4u,    8u,    2u  ) \
+                             X( Arg, TASKS_2_MS_B, TASKS_LIST_2MS_B, 4u,    8u,    0u  ) \
+                             X( Arg, TASKS_10_MS,  TASKS_LIST_10MS,  3u,   40u,    0u  ) \
+                             X( Arg, TASKS_50_MS,  TASKS_LIST_50MS,  2u,  200u,  196u  ) \
+                             X( Arg, TASKS_100_MS, TASKS_LIST_100MS, 1u,  400u,  398u  )
+
+#endif /* SCH_CFG_250US_H */
@@ -0,0 +1,182 @@
+/****************************************************************************************************/
+/**
+\file       sch_trace2json.c
+\brief      Host decoder of the scheduler timeline trace.
+            Converts a raw dump of the SchTrace buffer (e.g. debugger memory save of the symbol, or
+            sched_sim -t) into Chrome trace event JSON, viewable in chrome://tracing or Perfetto.
+            Usage: sch_trace2json <dump.bin> [out.json]
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+/** Scheduler task table */
+#include "app_scheduler.h"
+/** Trace buffer layout */
+#include "sch_trace.h"
+
+/*****************************************************************************************************
+* Definition of module wide MACROs / #DEFINE-CONSTANTs
+*****************************************************************************************************/
+
+#define TRACE_CFG_NAME( Arg, TaskId, TaskList, Priority, Period, Offset )    #TaskId,
+#define TRACE_CFG_EVENT_NAME( Arg, TaskId, TaskList, Priority )              #TaskId,
+#define TRACE_CFG_BG_NAME( Arg, TaskId, TaskList, Period )                   #TaskId,
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs -
+*****************************************************************************************************/
+
+static const char * const Trace_TaskNames[TASK_SCH_MAX_NUMBER_TASKS] =
+{
+    TASK_SCH_CFG_TIME_TASKS( TRACE_CFG_NAME, 0 )
+    TASK_SCH_CFG_EVENT_TASKS( TRACE_CFG_EVENT_NAME, 0 )
+    TASK_SCH_CFG_BACKGROUND_TASKS( TRACE_CFG_BG_NAME, 0 )
+};
+
+/*****************************************************************************************************
+* Code of module wide FUNCTIONS
+*****************************************************************************************************/
+
+static void vfnTrace_PrintName(FILE * Out, uint8_t u8TaskId)
+{
+    if( u8TaskId < TASK_SCH_MAX_NUMBER_TASKS )
+    {
+        fprintf(Out, "%s", Trace_TaskNames[u8TaskId]);
+    }
+    else
+    {
+        fprintf(Out, "task_%u", u8TaskId);
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    static const char * const Phase[] = { "i", "B", "E" };
+    tSchTraceBuffer Header;
+    tSchTraceEvent * Events;
+    tSchTraceEvent * Event;
+    uint8_t au8Open[256];
+    uint8_t au8Named[256];
+    uint32_t u32First, u32Index, u32Written = 0u;
+    uint32_t u32PrevTime = 0u;
+    uint64_t u64Time = 0u;
+    uint8_t u8Started = 0u;
+    FILE * In;
+    FILE * Out = stdout;
+
+    if( ( argc < 2 ) || ( argc > 3 ) )
+    {
+        fprintf(stderr, "usage: %s <dump.bin> [out.json]\n", argv[0]);
+        return 2;
+    }
+    In = fopen(argv[1], "rb");
+    if( In == NULL )
+    {
+        perror(argv[1]);
+        return 2;
+    }
+    if( ( fread(&Header, offsetof(tSchTraceBuffer, Events), 1, In) != 1 )
+        || ( Header.u32Magic != SCH_TRACE_MAGIC ) || ( Header.u16Version != SCH_TRACE_VERSION )
+        || ( Header.u16Capacity == 0u ) || ( ( Header.u16Capacity & ( Header.u16Capacity - 1u ) ) != 0u )
+        || ( Header.u32ClockHz == 0u ) )
+    {
+        fprintf(stderr, "%s: not a scheduler trace dump\n", argv[1]);
+        fclose(In);
+        return 1;
+    }
+    Events = (tSchTraceEvent *)malloc(Header.u16Capacity * sizeof(tSchTraceEvent));
+    if( ( Events == NULL ) || ( fread(Events, sizeof(tSchTraceEvent), Header.u16Capacity, In) != Header.u16Capacity ) )
+    {
+        fprintf(stderr, "%s: truncated trace dump\n", argv[1]);
+        fclose(In);
+        free(Events);
+        return 1;
+    }
+    fclose(In);
+    if( argc == 3 )
+    {
+        Out = fopen(argv[2], "w");
+        if( Out == NULL )
+        {
+            perror(argv[2]);
+            free(Events);
+            return 2;
+        }
+    }
+
+    memset(au8Open, 0, sizeof(au8Open));
+    memset(au8Named, 0, sizeof(au8Named));
+    u32First = ( Header.u32Head > Header.u16Capacity ) ? ( Header.u32Head - Header.u16Capacity ) : 0u;
+
+    fprintf(Out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    for( u32Index = u32First; u32Index != Header.u32Head; u32Index++ )
+    {
+        Event = &Events[u32Index & ( Header.u16Capacity - 1u )];
+        /* Skip entries overwritten or not completed when the buffer was dumped */
+        if( ( Event->u16Seq != (uint16_t)u32Index ) || ( Event->u8Event > SCH_TRACE_EVT_END ) )
+        {
+            continue;
+        }
+        /* Unwrap the 32-bit clock, events may be slightly out of order across preemption */
+        if( u8Started != 0u )
+        {
+            u64Time += (uint64_t)(int64_t)(int32_t)( Event->u32Time - u32PrevTime );
+        }
+        u8Started = 1u;
+        u32PrevTime = Event->u32Time;
+
+        if( Event->u8Event == SCH_TRACE_EVT_START )
+        {
+            au8Open[Event->u8TaskId] = 1u;
+        }
+        else if( Event->u8Event == SCH_TRACE_EVT_END )
+        {
+            /* End of an execution whose start was already overwritten */
+            if( au8Open[Event->u8TaskId] == 0u )
+            {
+                continue;
+            }
+            au8Open[Event->u8TaskId] = 0u;
+        }
+
+        if( au8Named[Event->u8TaskId] == 0u )
+        {
+            au8Named[Event->u8TaskId] = 1u;
+            fprintf(Out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"",
+                    ( u32Written != 0u ) ? ",\n" : "", Event->u8TaskId);
+            vfnTrace_PrintName(Out, Event->u8TaskId);
+            fprintf(Out, "\"}},\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                    "\"args\":{\"sort_index\":%u}}", Event->u8TaskId, Event->u8TaskId);
+            u32Written++;
+        }
+        fprintf(Out, "%s{\"name\":\"", ( u32Written != 0u ) ? ",\n" : "");
+        if( Event->u8Event == SCH_TRACE_EVT_ACTIVATE )
+        {
+            fprintf(Out, "activate");
+        }
+        else
+        {
+            vfnTrace_PrintName(Out, Event->u8TaskId);
+        }
+        fprintf(Out, "\",\"cat\":\"scheduler\",\"ph\":\"%s\",%s\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+                Phase[Event->u8Event], ( Event->u8Event == SCH_TRACE_EVT_ACTIVATE ) ? "\"s\":\"t\"," : "",
+                (double)u64Time * 1e6 / (double)Header.u32ClockHz, Event->u8TaskId);
+        u32Written++;
+    }
+    fprintf(Out, "\n]}\n");
+
+    if( Out != stdout )
+    {
+        fclose(Out);
+    }
+    free(Events);
+    return 0;
+}
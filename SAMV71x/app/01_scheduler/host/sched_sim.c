@@ -0,0 +1,591 @@
+/****************************************************************************************************/
+/**
+\file       sched_sim.c
+\brief      Host simulation harness of the multi-thread task scheduler.
+            Runs app_scheduler.c and app_tasks.c on a virtual time base: SysTick interrupts are
+            raised by the driver whenever virtual time reaches a tick boundary, including in the
+            middle of a task list, so slot overruns behave as on target. Event triggered tasks are
+            raised from the simulated tick interrupt every given number of ticks. Background
+            chunks fill the rest of each slot, their cost is given the same way as for task lists.
+            The core sleep and SysTick suppression of TASK_SCH_CFG_LOW_POWER are simulated as well,
+            skipped tick interrupts are reported as wakeups avoided.
+            Built with -DTASK_SCH_CFG_PREEMPTIVE=1u, time triggered task lists run from simulated
+            software interrupt levels (host/stubs/swirq_stub.c) nested on top of each other, and
+            the driver verifies that no task starts while a higher level task list is ready.
+            Background tasks are activated by their period, and by -e as event tasks are.
+            Usage: sched_sim [-n ticks] [-c TASK_ID=cost_us]... [-e TASK_ID=every_n_ticks]...
+                             [-t trace.bin]
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/** Scheduler function prototypes definitions */
+#include "app_scheduler.h"
+/** Simulated SysTick */
+#include "systick.h"
+/** Scheduler timeline trace */
+#include "sch_trace.h"
+/** Simulated core sleep */
+#include "power.h"
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+/** Simulated software interrupt levels */
+#include "swirq.h"
+#endif
+
+/*****************************************************************************************************
+* Definition of module wide MACROs / #DEFINE-CONSTANTs
+*****************************************************************************************************/
+
+/* Duration of one scheduler tick in virtual nanoseconds */
+#define SIM_TICK_NS             ( 1000000000u / (uint32_t)TASK_SCHEDULER_BASE_FREQ )
+
+/* Default simulation length, in ticks */
+#define SIM_DEFAULT_TICKS       10000000u
+
+#define SIM_CFG_NAME( Arg, TaskId, TaskList, Priority, Period, Offset )    #TaskId,
+#define SIM_CFG_EVENT_NAME( Arg, TaskId, TaskList, Priority )              #TaskId,
+#define SIM_CFG_BG_NAME( Arg, TaskId, TaskList, Period )                   #TaskId,
+
+/* End of the event triggered task IDs */
+#define SIM_EVENT_TASKS_END     ( TASK_SCH_MAX_NUMBER_TIME_TASKS + TASK_SCH_MAX_NUMBER_EVENT_TASKS )
+
+/*****************************************************************************************************
+* Declaration of module wide VARIABLEs - scheduler internals observed by the harness
+*****************************************************************************************************/
+extern uint8_t gu8Scheduler_Status;
+extern uint16_t gu16Scheduler_Slot;
+extern volatile tSchedulerSlotMask TaskScheduler_Slot_Activated;
+extern tSchedulerTasks_ID TaskScheduler_Task_ID_Running;
+extern volatile uint32_t gu32Scheduler_EventReady;
+extern void SysTick_Handler(void);
+extern uint32_t u32SysTick_Suppressed;
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+extern uint8_t u8SwIrq_Masked;
+extern void vfnSwIrq_Return(void);
+#endif
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs -
+*****************************************************************************************************/
+
+static const char * const Sim_TaskNames[TASK_SCH_MAX_NUMBER_TASKS] =
+{
+    TASK_SCH_CFG_TIME_TASKS( SIM_CFG_NAME, 0 )
+    TASK_SCH_CFG_EVENT_TASKS( SIM_CFG_EVENT_NAME, 0 )
+    TASK_SCH_CFG_BACKGROUND_TASKS( SIM_CFG_BG_NAME, 0 )
+};
+
+/* Virtual time base */
+static uint64_t gu64Sim_Time;
+static uint64_t gu64Sim_NextTick;
+static uint64_t gu64Sim_Idle;
+static uint32_t gu32Sim_Ticks;
+static uint32_t gu32Sim_TickLimit;
+
+/* Simulated execution cost of each task list, in ns */
+static uint32_t au32Sim_Cost[TASK_SCH_MAX_NUMBER_TASKS];
+/* Event raising interval of each event or background task, in ticks (0 - never raised) */
+static uint32_t au32Sim_EventEvery[TASK_SCH_MAX_NUMBER_TASKS];
+/* Task lists replaced by the harness wrapper */
+static tPtr_to_function apfnSim_TaskList[TASK_SCH_MAX_NUMBER_TASKS];
+static tPtr_to_bg_chunk apfnSim_BgList[TASK_SCH_MAX_NUMBER_TASKS];
+
+/* Observed behavior */
+static uint32_t au32Sim_Activations[TASK_SCH_MAX_NUMBER_TASKS];
+static uint32_t au32Sim_Executions[TASK_SCH_MAX_NUMBER_TASKS];
+static uint32_t au32Sim_Overloads[TASK_SCH_MAX_NUMBER_TASKS];
+static uint32_t gu32Sim_StatusMismatches;
+static uint32_t gu32Sim_SlotsDelayed;
+static uint32_t gu32Sim_Sleeps;
+static uint32_t gu32Sim_WakeupsAvoided;
+static uint8_t  gu8Sim_InTask;
+static uint8_t  gu8Sim_Overrun;
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+/* Task lists started and not completed yet, preemptions and priority inversions seen */
+static uint8_t  au8Sim_Running[TASK_SCH_MAX_NUMBER_TASKS];
+static uint8_t  gu8Sim_MaxNesting;
+static uint32_t gu32Sim_Preemptions;
+static uint32_t gu32Sim_Inversions;
+#endif
+
+/*****************************************************************************************************
+* Code of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/* Profiling time base of the scheduler: virtual ns */
+static uint32_t u32Sim_Clock(void)
+{
+    return (uint32_t)gu64Sim_Time;
+}
+
+/* Reach the current tick boundary: raise the SysTick interrupt unless suppressed, then the
+   simulated event interrupts. Returns 1 when any interrupt was raised (core woken up). */
+static uint8_t u8Sim_Tick(void)
+{
+    tSchedulerSlotMask SlotMask;
+    uint8_t u8TaskIndex;
+    uint8_t u8Interrupt = 0u;
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+    uint8_t u8Overloaded = TASK_SCH_MAX_NUMBER_TIME_TASKS;
+#endif
+
+    gu32Sim_Ticks++;
+    gu64Sim_NextTick += SIM_TICK_NS;
+    if( u32SysTick_Suppressed != 0u )
+    {
+        u32SysTick_Suppressed--;
+        gu32Sim_WakeupsAvoided++;
+    }
+    else
+    {
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+        /* The tick is above all task list levels, they only run on return from it */
+        u8SwIrq_Masked = 1u;
+#endif
+        SysTick_Handler();
+        u8Interrupt = 1u;
+#if ( TASK_SCH_CFG_PREEMPTIVE == 0u )
+        if( gu8Sim_InTask != 0u )
+        {
+            gu8Sim_Overrun = 1u;
+        }
+#endif
+        /* Slot just activated by the handler */
+        SlotMask = SchedulerSlotTable[( gu16Scheduler_Slot + TASK_SCH_HYPERPERIOD_TICKS - 1u ) % TASK_SCH_HYPERPERIOD_TICKS];
+        for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
+        {
+            if( ( SlotMask & ( (tSchedulerSlotMask)1u << u8TaskIndex ) ) != 0u )
+            {
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+                /* Previous activation not completed: the scheduler shall report an overload */
+                if( au32Sim_Activations[u8TaskIndex] != au32Sim_Executions[u8TaskIndex] )
+                {
+                    au32Sim_Overloads[u8TaskIndex]++;
+                    u8Overloaded = u8TaskIndex;
+                }
+#endif
+                au32Sim_Activations[u8TaskIndex]++;
+            }
+        }
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+        if( ( u8Overloaded < TASK_SCH_MAX_NUMBER_TIME_TASKS )
+            && ( gu8Scheduler_Status != TASK_SCHEDULER_OVERLOAD( u8Overloaded ) ) )
+        {
+            gu32Sim_StatusMismatches++;
+        }
+#endif
+    }
+    /* Events are raised from interrupt context, as a peripheral ISR would do */
+    for( u8TaskIndex = TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex < TASK_SCH_MAX_NUMBER_TASKS; u8TaskIndex++ )
+    {
+        if( ( au32Sim_EventEvery[u8TaskIndex] != 0u ) && ( ( gu32Sim_Ticks % au32Sim_EventEvery[u8TaskIndex] ) == 0u ) )
+        {
+            vfnScheduler_EventActivate((tSchedulerTasks_ID)u8TaskIndex);
+            au32Sim_Activations[u8TaskIndex]++;
+            u8Interrupt = 1u;
+        }
+    }
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+    u8SwIrq_Masked = 0u;
+    vfnSwIrq_Return();
+#endif
+    return u8Interrupt;
+}
+
+/* Consume virtual CPU time, interrupts are raised on every tick boundary crossed. Work left is
+   kept rather than an end time, as interrupts may run preempting task lists meanwhile. */
+static void vfnSim_Advance(uint32_t u32Ns)
+{
+    uint64_t u64Left = u32Ns;
+
+    while( ( ( gu64Sim_Time + u64Left ) >= gu64Sim_NextTick ) && ( gu32Sim_Ticks < gu32Sim_TickLimit ) )
+    {
+        /* Interrupt time stamps are taken at the boundary, not at the end of the task */
+        u64Left -= gu64Sim_NextTick - gu64Sim_Time;
+        gu64Sim_Time = gu64Sim_NextTick;
+        (void)u8Sim_Tick();
+    }
+    gu64Sim_Time += u64Left;
+}
+
+/* Core idle until the next interrupt */
+static void vfnSim_Idle(void)
+{
+    do
+    {
+        gu64Sim_Idle += gu64Sim_NextTick - gu64Sim_Time;
+        gu64Sim_Time = gu64Sim_NextTick;
+    }while( ( u8Sim_Tick() == 0u ) && ( gu32Sim_Ticks < gu32Sim_TickLimit ) );
+}
+
+/* Start of any task list or chunk. With preemptive dispatch no time triggered task list of a
+   higher level than the one starting shall be ready and left waiting. */
+static void vfnSim_TaskEnter(tSchedulerTasks_ID TaskId)
+{
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+    uint8_t u8Level = ( TaskId < TASK_SCH_MAX_NUMBER_TIME_TASKS ) ? TimeTriggeredTasks[TaskId].u8Priority : 0u;
+    uint8_t u8TaskIndex;
+
+    for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
+    {
+        if( ( TimeTriggeredTasks[u8TaskIndex].u8Priority > u8Level ) && ( au8Sim_Running[u8TaskIndex] == 0u )
+            && ( au32Sim_Activations[u8TaskIndex] != au32Sim_Executions[u8TaskIndex] ) )
+        {
+            gu32Sim_Inversions++;
+        }
+    }
+    if( gu8Sim_InTask != 0u )
+    {
+        gu32Sim_Preemptions++;
+    }
+    au8Sim_Running[TaskId] = 1u;
+#else
+    (void)TaskId;
+#endif
+    gu8Sim_InTask++;
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+    if( gu8Sim_InTask > gu8Sim_MaxNesting )
+    {
+        gu8Sim_MaxNesting = gu8Sim_InTask;
+    }
+#endif
+}
+
+/* Completion of any task list or chunk, once its simulated cost has been consumed */
+static void vfnSim_TaskExit(tSchedulerTasks_ID TaskId)
+{
+    au32Sim_Executions[TaskId]++;
+    gu8Sim_InTask--;
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+    au8Sim_Running[TaskId] = 0u;
+#endif
+}
+
+/* Replacement of every task list: real task list plus its simulated cost */
+static void vfnSim_TaskWrapper(void)
+{
+    tSchedulerTasks_ID TaskId = TaskScheduler_Task_ID_Running;
+
+    vfnSim_TaskEnter(TaskId);
+    apfnSim_TaskList[TaskId]();
+    vfnSim_Advance(au32Sim_Cost[TaskId]);
+    vfnSim_TaskExit(TaskId);
+}
+
+/* Replacement of every background chunk: real chunk plus its simulated cost */
+static uint8_t u8Sim_BgWrapper(void)
+{
+    tSchedulerTasks_ID TaskId = TaskScheduler_Task_ID_Running;
+    uint8_t u8Result;
+
+    vfnSim_TaskEnter(TaskId);
+    u8Result = apfnSim_BgList[TaskId]();
+    vfnSim_Advance(au32Sim_Cost[TaskId]);
+    vfnSim_TaskExit(TaskId);
+    return u8Result;
+}
+
+static uint8_t u8Sim_SlotOwner(tSchedulerSlotMask SlotMask)
+{
+    uint8_t u8TaskIndex = 0u;
+
+    while( ( u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS )
+           && ( ( SlotMask & ( (tSchedulerSlotMask)1u << u8TaskIndex ) ) == 0u ) )
+    {
+        u8TaskIndex++;
+    }
+    return u8TaskIndex;
+}
+
+/* Parse "TASK_ID=value" for tasks in [u8First, u8Last), returns the task index or u8Last */
+static uint8_t u8Sim_ParseTaskArg(const char * Arg, uint8_t u8First, uint8_t u8Last, double * pf64Value)
+{
+    const char * Separator = strchr(Arg, '=');
+    uint8_t u8TaskIndex;
+
+    if( Separator != NULL )
+    {
+        for( u8TaskIndex = u8First; u8TaskIndex < u8Last; u8TaskIndex++ )
+        {
+            if( ( strlen(Sim_TaskNames[u8TaskIndex]) == (size_t)( Separator - Arg ) )
+                && ( strncmp(Arg, Sim_TaskNames[u8TaskIndex], (size_t)( Separator - Arg ) ) == 0 ) )
+            {
+                *pf64Value = strtod(Separator + 1, NULL);
+                return u8TaskIndex;
+            }
+        }
+    }
+    fprintf(stderr, "invalid task argument '%s'\n", Arg);
+    return u8Last;
+}
+
+/*****************************************************************************************************
+* Code of public FUNCTIONS
+*****************************************************************************************************/
+
+/* Simulated core sleep control (replaces src/MCAL/Power/power.c), interrupts are only raised by
+   the driver so masking them is implicit */
+void vfnPower_EnterCritical(void)
+{
+}
+
+void vfnPower_ExitCritical(void)
+{
+}
+
+void vfnPower_Sleep(void)
+{
+    gu32Sim_Sleeps++;
+    vfnSim_Idle();
+}
+
+int main(int argc, char * argv[])
+{
+    struct timespec Start, End;
+    double f64WallNs;
+    uint32_t u32Expected;
+    uint32_t u32Failures = 0u;
+    uint8_t u8Owner;
+    uint8_t u8TaskIndex;
+    tSchedulerSlotMask SlotMask;
+    tSchedulerTaskStats Stats;
+    tSchedulerIdleStats IdleStats;
+    uint64_t u64Before;
+    uint32_t u32EventReady;
+    double f64Value;
+    const char * TraceFile = NULL;
+    FILE * Trace;
+    int s32Arg;
+
+    gu32Sim_TickLimit = SIM_DEFAULT_TICKS;
+    for( s32Arg = 1; s32Arg < argc; s32Arg++ )
+    {
+        if( ( strcmp(argv[s32Arg], "-n") == 0 ) && ( ( s32Arg + 1 ) < argc ) )
+        {
+            gu32Sim_TickLimit = (uint32_t)strtoul(argv[++s32Arg], NULL, 0);
+        }
+        else if( ( strcmp(argv[s32Arg], "-c") == 0 ) && ( ( s32Arg + 1 ) < argc ) )
+        {
+            u8TaskIndex = u8Sim_ParseTaskArg(argv[++s32Arg], 0u, TASK_SCH_MAX_NUMBER_TASKS, &f64Value);
+            if( u8TaskIndex == TASK_SCH_MAX_NUMBER_TASKS )
+            {
+                return 2;
+            }
+            au32Sim_Cost[u8TaskIndex] = (uint32_t)( f64Value * 1000.0 );
+        }
+        else if( ( strcmp(argv[s32Arg], "-e") == 0 ) && ( ( s32Arg + 1 ) < argc ) )
+        {
+            u8TaskIndex = u8Sim_ParseTaskArg(argv[++s32Arg], TASK_SCH_MAX_NUMBER_TIME_TASKS,
+                                             TASK_SCH_MAX_NUMBER_TASKS, &f64Value);
+            if( u8TaskIndex == TASK_SCH_MAX_NUMBER_TASKS )
+            {
+                return 2;
+            }
+            au32Sim_EventEvery[u8TaskIndex] = (uint32_t)f64Value;
+        }
+        else if( ( strcmp(argv[s32Arg], "-t") == 0 ) && ( ( s32Arg + 1 ) < argc ) )
+        {
+            TraceFile = argv[++s32Arg];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n ticks] [-c TASK_ID=cost_us]... [-e TASK_ID=every_n_ticks]... [-t trace.bin]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    /* Same start-up sequence as main.c, virtual time replaces the DWT counter */
+    vfnScheduler_Init();
+    vfnScheduler_SetProfilingClock(u32Sim_Clock);
+    vfnSchTrace_Init(u32Sim_Clock, 1000000000u);
+    vfnScheduler_Start();
+    for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
+    {
+        apfnSim_TaskList[u8TaskIndex] = TimeTriggeredTasks[u8TaskIndex].ptrTask;
+        TimeTriggeredTasks[u8TaskIndex].ptrTask = vfnSim_TaskWrapper;
+    }
+#if ( TASK_SCH_MAX_NUMBER_EVENT_TASKS > 0u )
+    for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_EVENT_TASKS; u8TaskIndex++ )
+    {
+        apfnSim_TaskList[TASK_SCH_MAX_NUMBER_TIME_TASKS + u8TaskIndex] = EventTriggeredTasks[u8TaskIndex].ptrTask;
+        EventTriggeredTasks[u8TaskIndex].ptrTask = vfnSim_TaskWrapper;
+    }
+#endif
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_BG_TASKS; u8TaskIndex++ )
+    {
+        apfnSim_BgList[SIM_EVENT_TASKS_END + u8TaskIndex] = BackgroundTasks[u8TaskIndex].ptrTask;
+        BackgroundTasks[u8TaskIndex].ptrTask = u8Sim_BgWrapper;
+    }
+#endif
+    gu64Sim_NextTick = SIM_TICK_NS;
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    while( gu32Sim_Ticks < gu32Sim_TickLimit )
+    {
+        SlotMask = TaskScheduler_Slot_Activated;
+        u32EventReady = gu32Scheduler_EventReady;
+        u64Before = gu64Sim_Time;
+        u8Owner = u8Sim_SlotOwner(SlotMask);
+        gu8Sim_Overrun = 0u;
+        vfnTask_Scheduler();
+        if( ( SlotMask == 0u ) && ( u32EventReady == 0u ) && ( gu64Sim_Time == u64Before ) )
+        {
+            /* Busy polling (TASK_SCH_CFG_LOW_POWER == 0) until next tick */
+            vfnSim_Idle();
+        }
+        else if( ( gu8Sim_Overrun != 0u ) && ( SlotMask == 0u ) )
+        {
+            /* An event or background task ran across a tick boundary: the next slot starts late */
+            gu32Sim_SlotsDelayed++;
+        }
+        else if( gu8Sim_Overrun != 0u )
+        {
+            au32Sim_Overloads[u8Owner]++;
+            if( gu8Scheduler_Status != TASK_SCHEDULER_OVERLOAD( u8Owner ) )
+            {
+                gu32Sim_StatusMismatches++;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+    f64WallNs = ( (double)( End.tv_sec - Start.tv_sec ) * 1e9 ) + (double)( End.tv_nsec - Start.tv_nsec );
+
+    printf("ticks: %u (%.3f s virtual), idle: %.2f %%, final status: 0x%02X\n",
+           gu32Sim_Ticks, (double)gu64Sim_Time / 1e9,
+           ( gu64Sim_Time != 0u ) ? ( 100.0 * (double)gu64Sim_Idle / (double)gu64Sim_Time ) : 0.0,
+           gu8Scheduler_Status);
+    printf("host: %.1f ns per tick (callback + dispatch), %.2f Mticks/s\n",
+           f64WallNs / (double)gu32Sim_Ticks, (double)gu32Sim_Ticks * 1e3 / f64WallNs);
+    printf("slots delayed by event or background tasks: %u\n", gu32Sim_SlotsDelayed);
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+    printf("preemptive dispatch: %u preemptions, max nesting %u, %u priority inversions\n",
+           gu32Sim_Preemptions, gu8Sim_MaxNesting, gu32Sim_Inversions);
+    if( gu32Sim_Inversions != 0u )
+    {
+        printf("FAIL: %u task starts while a higher level task list was ready\n", gu32Sim_Inversions);
+        u32Failures++;
+    }
+#endif
+    printf("low power mode %u: %u sleeps, %u tick wakeups avoided (%.2f %% of ticks)\n",
+           TASK_SCH_CFG_LOW_POWER, gu32Sim_Sleeps, gu32Sim_WakeupsAvoided,
+           100.0 * (double)gu32Sim_WakeupsAvoided / (double)gu32Sim_Ticks);
+    if( u8Scheduler_GetIdleStats(&IdleStats) == 0u )
+    {
+        printf("idle capacity: %.3f s in %u windows, %.2f %% consumed by background tasks\n",
+               (double)IdleStats.u64IdleTime / 1e9, IdleStats.u32Windows,
+               ( IdleStats.u64IdleTime != 0u )
+               ? ( 100.0 * (double)IdleStats.u64BackgroundTime / (double)IdleStats.u64IdleTime ) : 0.0);
+    }
+    printf("%-14s %6s %6s %10s %10s %9s %9s %9s %9s\n", "task", "period", "offset",
+           "activated", "executed", "overloads", "avg_us", "max_us", "jitter_us");
+    for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
+    {
+        (void)u8Scheduler_GetTaskStats((tSchedulerTasks_ID)u8TaskIndex, &Stats);
+        printf("%-14s %6u %6u %10u %10u %9u %9.1f %9.1f %9.1f\n", Sim_TaskNames[u8TaskIndex],
+               TimeTriggeredTasks[u8TaskIndex].u16Period, TimeTriggeredTasks[u8TaskIndex].u16Offset,
+               au32Sim_Activations[u8TaskIndex], au32Sim_Executions[u8TaskIndex],
+               au32Sim_Overloads[u8TaskIndex], (double)Stats.u32Avg / 1e3,
+               (double)Stats.u32Max / 1e3, (double)Stats.u32Jitter / 1e3);
+
+        /* Regression check: activations shall match the configured period and offset */
+        u32Expected = ( gu32Sim_Ticks / TimeTriggeredTasks[u8TaskIndex].u16Period )
+                      + ( ( ( gu32Sim_Ticks % TimeTriggeredTasks[u8TaskIndex].u16Period )
+                            > TimeTriggeredTasks[u8TaskIndex].u16Offset ) ? 1u : 0u );
+        if( au32Sim_Activations[u8TaskIndex] != u32Expected )
+        {
+            printf("FAIL: %s activated %u times, expected %u\n", Sim_TaskNames[u8TaskIndex],
+                   au32Sim_Activations[u8TaskIndex], u32Expected);
+            u32Failures++;
+        }
+
+        /* Regression check: an overrun never runs the task list again without a new activation */
+        if( au32Sim_Executions[u8TaskIndex] > au32Sim_Activations[u8TaskIndex] )
+        {
+            printf("FAIL: %s activated %u times, executed %u\n", Sim_TaskNames[u8TaskIndex],
+                   au32Sim_Activations[u8TaskIndex], au32Sim_Executions[u8TaskIndex]);
+            u32Failures++;
+        }
+    }
+    for( u8TaskIndex = TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex < SIM_EVENT_TASKS_END; u8TaskIndex++ )
+    {
+        (void)u8Scheduler_GetTaskStats((tSchedulerTasks_ID)u8TaskIndex, &Stats);
+        printf("%-14s %6s %6s %10u %10u %9s %9.1f %9.1f %9.1f\n", Sim_TaskNames[u8TaskIndex], "event", "-",
+               au32Sim_Activations[u8TaskIndex], au32Sim_Executions[u8TaskIndex], "-",
+               (double)Stats.u32Avg / 1e3, (double)Stats.u32Max / 1e3, (double)Stats.u32Jitter / 1e3);
+
+        /* Regression check: every raised event runs, pending activations of one task coalesce */
+        if( ( au32Sim_Executions[u8TaskIndex] > au32Sim_Activations[u8TaskIndex] )
+            || ( ( au32Sim_Activations[u8TaskIndex] != 0u ) && ( au32Sim_Executions[u8TaskIndex] == 0u ) ) )
+        {
+            printf("FAIL: %s raised %u times, executed %u\n", Sim_TaskNames[u8TaskIndex],
+                   au32Sim_Activations[u8TaskIndex], au32Sim_Executions[u8TaskIndex]);
+            u32Failures++;
+        }
+    }
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    printf("%-14s %6s %10s %10s %10s %10s %9s %9s %9s\n", "background", "period", "activated", "chunks",
+           "passes", "deferred", "overruns", "avg_us", "max_us");
+    for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_BG_TASKS; u8TaskIndex++ )
+    {
+        (void)u8Scheduler_GetTaskStats(BackgroundTasks[u8TaskIndex].TaskId, &Stats);
+        /* First pass on start, then one per period and per raised event */
+        u32Expected = 1u + au32Sim_Activations[SIM_EVENT_TASKS_END + u8TaskIndex];
+        if( BackgroundTasks[u8TaskIndex].u16Period != 0u )
+        {
+            u32Expected += gu32Sim_Ticks / BackgroundTasks[u8TaskIndex].u16Period;
+        }
+        printf("%-14s %6u %10u %10u %10u %10u %9u %9.1f %9.1f\n", Sim_TaskNames[SIM_EVENT_TASKS_END + u8TaskIndex],
+               BackgroundTasks[u8TaskIndex].u16Period, u32Expected,
+               au32Sim_Executions[SIM_EVENT_TASKS_END + u8TaskIndex], BackgroundTasks[u8TaskIndex].u32Passes,
+               BackgroundTasks[u8TaskIndex].u32Deferred, Stats.u32Overruns,
+               (double)Stats.u32Avg / 1e3, (double)Stats.u32Max / 1e3);
+
+        /* Regression check: a background task is idle between passes, never more passes than activations */
+        if( BackgroundTasks[u8TaskIndex].u32Passes > u32Expected )
+        {
+            printf("FAIL: %s ran %u passes for %u activations\n", Sim_TaskNames[SIM_EVENT_TASKS_END + u8TaskIndex],
+                   BackgroundTasks[u8TaskIndex].u32Passes, u32Expected);
+            u32Failures++;
+        }
+
+        /* Regression check: once its length is known a chunk shall never run across a tick */
+        if( Stats.u32Overruns > 1u )
+        {
+            printf("FAIL: %s ran across %u ticks\n", Sim_TaskNames[SIM_EVENT_TASKS_END + u8TaskIndex],
+                   Stats.u32Overruns);
+            u32Failures++;
+        }
+    }
+#endif
+    if( TraceFile != NULL )
+    {
+        /* Raw dump of the trace buffer, same layout as a target memory dump */
+        Trace = fopen(TraceFile, "wb");
+        if( ( Trace == NULL ) || ( fwrite(&SchTrace, sizeof(SchTrace), 1, Trace) != 1 ) )
+        {
+            perror(TraceFile);
+            u32Failures++;
+        }
+        if( Trace != NULL )
+        {
+            fclose(Trace);
+        }
+    }
+    if( gu32Sim_StatusMismatches != 0u )
+    {
+        printf("FAIL: %u overloads not reported through scheduler status\n", gu32Sim_StatusMismatches);
+        u32Failures++;
+    }
+    return ( u32Failures == 0u ) ? 0 : 1;
+}
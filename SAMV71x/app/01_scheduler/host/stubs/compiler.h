@@ -0,0 +1,26 @@
+/****************************************************************************************************/
+/**
+\file       compiler.h
+\brief      Host build stub - replaces libchip compiler.h, only standard C definitions are provided.
+\author     Abraham Tezmol
+\version    1.0
+\project    Tau 
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+#ifndef _COMPILER_H_        /*prevent duplicated includes*/
+#define _COMPILER_H_
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/****************************************************************************************************/
+
+#endif /* _COMPILER_H_ */
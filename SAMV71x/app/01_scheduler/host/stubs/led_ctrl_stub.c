@@ -0,0 +1,27 @@
+/****************************************************************************************************/
+/**
+\file       led_ctrl_stub.c
+\brief      Host build stub - LED control, LED outputs are not simulated.
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+/** Own headers */
+#include     "led_ctrl.h"
+
+/*****************************************************************************************************
+* Code of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/** Configures LED 0 and 1 of SAMV71 board */
+void vfnLedCtrl_Configure( void )
+{;}
+
+/** Turn a combination of 2 LEDs with a unique blinking pattern */
+void vfnLedCtrl_BlinkingPattern(void)
+{;}
@@ -0,0 +1,107 @@
+/****************************************************************************************************/
+/**
+\file       swirq_stub.c
+\brief      Host build stub - Software triggered interrupt levels. Requests are kept in a pending
+            mask and the simulation driver returns from each simulated interrupt through
+            vfnSwIrq_Return, which runs every pending level above the active one, nested, the way
+            the NVIC would.
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+/** Software interrupt function prototypes and definitions */
+#include "swirq.h"
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs - 
+*****************************************************************************************************/
+/* Level handler invoked from every software interrupt */
+tPtr_to_level_handler pfnSwIrq_Handler = (tPtr_to_level_handler)NULL;
+
+/* Requested levels, bit "n" stands for level "n" */
+uint32_t u32SwIrq_Pending = 0u;
+
+/* Level being executed, 0 - thread mode */
+uint8_t u8SwIrq_Active = 0u;
+
+/* Set by the simulation driver while an interrupt above all levels (tick) is executed */
+uint8_t u8SwIrq_Masked = 0u;
+
+/*****************************************************************************************************
+* Declaration of module wide FUNCTIONS
+*****************************************************************************************************/
+/** Exception return, called by the simulation driver at the end of each simulated interrupt */
+void vfnSwIrq_Return(void);
+
+/*****************************************************************************************************
+* Code of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/****************************************************************************************************/
+/**
+* \brief    SwIrq - Initialization (simulated)
+* \author   Abraham Tezmol
+* \param    uint8_t u8Levels	--> Number of levels used (1 .. SWIRQ_MAX_LEVELS)
+* \param    tPtr_to_level_handler pfnHandler	--> Handler invoked with the level number
+* \return   int8_t --> 0 - Successful configuration, 1 - Invalid configuration
+* \todo
+*/
+int8_t vfnSwIrq_Init(uint8_t u8Levels, tPtr_to_level_handler pfnHandler)
+{
+	if ((u8Levels == 0u) || (u8Levels > SWIRQ_MAX_LEVELS) || (pfnHandler == NULL))
+	{
+		return 1;
+	}
+	pfnSwIrq_Handler = pfnHandler;
+	u32SwIrq_Pending = 0u;
+	u8SwIrq_Active = 0u;
+	return 0;
+}
+
+/****************************************************************************************************/
+/**
+* \brief    SwIrq - Request of a level (simulated)
+* \author   Abraham Tezmol
+* \param    uint8_t u8Level	--> Level to be requested
+* \return   void
+* \todo
+*/
+void vfnSwIrq_Trigger(uint8_t u8Level)
+{
+	u32SwIrq_Pending |= (1u << u8Level);
+	vfnSwIrq_Return();
+}
+
+/****************************************************************************************************/
+/**
+* \brief    SwIrq - Exception return (simulated). Pending levels above the active one are
+*           executed, highest first; a level preempted meanwhile resumes once they complete.
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo
+*/
+void vfnSwIrq_Return(void)
+{
+	uint8_t u8Level;
+	uint8_t u8Preempted;
+
+	if (u8SwIrq_Masked != 0u)
+	{
+		return;
+	}
+	while ((u32SwIrq_Pending >> (u8SwIrq_Active + 1u)) != 0u)
+	{
+		u8Level = (uint8_t)(31 - __builtin_clz(u32SwIrq_Pending));
+		u32SwIrq_Pending &= ~(1u << u8Level);
+		u8Preempted = u8SwIrq_Active;
+		u8SwIrq_Active = u8Level;
+		pfnSwIrq_Handler(u8Level);
+		u8SwIrq_Active = u8Preempted;
+	}
+}
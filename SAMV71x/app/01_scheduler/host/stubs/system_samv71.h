@@ -0,0 +1,30 @@
+/****************************************************************************************************/
+/**
+\file       system_samv71.h
+\brief      Host build stub - core clock definition of the simulated device.
+\author     Abraham Tezmol
+\version    1.0
+\project    Tau 
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+#ifndef SYSTEM_SAMV71_H_INCLUDED        /*prevent duplicated includes*/
+#define SYSTEM_SAMV71_H_INCLUDED
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+
+#include <stdint.h>
+
+/*****************************************************************************************************
+* Definition of module wide VARIABLEs
+*****************************************************************************************************/
+
+/** Simulated System Clock Frequency (Core Clock) */
+extern uint32_t SystemCoreClock;
+
+/****************************************************************************************************/
+
+#endif /* SYSTEM_SAMV71_H_INCLUDED */
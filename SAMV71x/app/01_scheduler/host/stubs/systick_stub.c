@@ -0,0 +1,93 @@
+/****************************************************************************************************/
+/**
+\file       systick_stub.c
+\brief      Host build stub - SysTick. The callback is stored and invoked by the simulation driver
+            whenever virtual time reaches a tick boundary.
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+/** Systick function prototypes and definitions */
+#include "systick.h"
+/** Simulated core clock */
+#include "system_samv71.h"
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs - 
+*****************************************************************************************************/
+/* Global pointer used to invoke callback function upon Timer event*/
+tPtr_to_function pfctnSysTick = (tPtr_to_function)NULL;
+
+/* Requested SysTick interrupt frequency */
+int32_t s32SysTick_Freq = 0;
+
+/* Interrupts to be skipped by the simulation driver, set by sysTick_suppress */
+uint32_t u32SysTick_Suppressed = 0u;
+
+/* Simulated core clock, same as SAMV71 Xplained Ultra default configuration */
+uint32_t SystemCoreClock = 300000000u;
+
+/*****************************************************************************************************
+* Code of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/****************************************************************************************************/
+/**
+* \brief    SysTick - Initialization (simulated)
+* \author   Abraham Tezmol
+* \param    int32_t base_freq	--> Requested SysTick interrupt frequency
+* \param    tPtr_to_function sysTick_handler	--> Callback function to handle SysTick ISR.
+* \return   int8_t --> 0 - Successful configuration, 1 - Invalid configuration
+* \todo
+*/
+int8_t sysTick_init(int32_t base_freq, tPtr_to_function sysTick_handler)
+{
+	if ((base_freq <= 0) || ((SystemCoreClock / (uint32_t)base_freq) > 0x01000000u))
+	{
+		return 1;
+	}
+	s32SysTick_Freq = base_freq;
+	pfctnSysTick = sysTick_handler;
+	return 0;
+}
+
+/****************************************************************************************************/
+/**
+* \brief    SysTick - Tick suppression (simulated), same 24-bit limit as the target counter
+* \author   Abraham Tezmol
+* \param    uint32_t periods	--> Number of interrupts to be skipped
+* \return   uint32_t --> Number of interrupts actually skipped
+* \todo
+*/
+uint32_t sysTick_suppress(uint32_t periods)
+{
+	uint32_t u32Max = (0x00FFFFFFu / (SystemCoreClock / (uint32_t)s32SysTick_Freq)) - 1u;
+
+	if (periods > u32Max)
+	{
+		periods = u32Max;
+	}
+	u32SysTick_Suppressed = periods;
+	return periods;
+}
+
+/****************************************************************************************************/
+/**
+* \brief    SysTick - interrupt handling (simulated)
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo
+*/
+void SysTick_Handler(void)
+{
+	if (pfctnSysTick)
+	{
+		(*pfctnSysTick)();
+	}
+}
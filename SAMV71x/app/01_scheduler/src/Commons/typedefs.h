@@ -38,6 +38,7 @@
 #define VINT32 	__attribute__ 	((aligned (4))) volatile int32_t
 
 typedef  void  ( * tPtr_to_function )( void );
+typedef  uint32_t  ( * tPtr_to_clock )( void );
 /*****************************************************************************************************
 * Definition of module wide MACROs / #DEFINE-CONSTANTs 
 *****************************************************************************************************/
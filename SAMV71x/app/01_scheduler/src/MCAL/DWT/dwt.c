@@ -0,0 +1,62 @@
+/****************************************************************************************************/
+/**
+\file       dwt.c
+\brief      MCAL abstraction level - DWT cycle counter configuration and access.
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+/** DWT function prototypes and definitions */
+#include "dwt.h"
+/** Core-specific prototypes and definitions */
+#include "core_cm7.h"
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs - 
+*****************************************************************************************************/
+
+/*****************************************************************************************************
+* Definition of module wide (CONST-) CONSTANTs 
+*****************************************************************************************************/
+/* Key to unlock write access to DWT registers */
+#define DWT_LAR_UNLOCK_KEY      0xC5ACCE55u
+
+/*****************************************************************************************************
+* Code of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/****************************************************************************************************/
+/**
+* \brief    DWT - Initialization. Enables the free running core cycle counter.
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo
+*/
+void vfnDwt_Init(void)
+{
+	/* Enable trace and debug blocks, required to get DWT running */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	/* Cortex-M7 locks DWT registers after reset */
+	DWT->LAR = DWT_LAR_UNLOCK_KEY;
+	DWT->CYCCNT = 0u;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/****************************************************************************************************/
+/**
+* \brief    DWT - Read current value of cycle counter
+* \author   Abraham Tezmol
+* \param    void
+* \return   uint32_t --> Core clock cycles elapsed since vfnDwt_Init (wraps around)
+* \todo
+*/
+uint32_t u32Dwt_GetCycles(void)
+{
+	return DWT->CYCCNT;
+}
@@ -0,0 +1,45 @@
+/****************************************************************************************************/
+/**
+\file       dwt.h
+\brief      MCAL abstraction level - Core DWT cycle counter
+\author     Abraham Tezmol
+\version    1.0
+\project    Tau 
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+#ifndef __DWT_H        /*prevent duplicated includes*/
+#define __DWT_H
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+
+/** Core modules */
+#include "compiler.h"
+#include "typedefs.h"
+
+/*****************************************************************************************************
+* Declaration of module wide TYPEs 
+*****************************************************************************************************/
+
+
+/*****************************************************************************************************
+* Definition of module wide MACROs / #DEFINE-CONSTANTs 
+*****************************************************************************************************/
+
+
+/*****************************************************************************************************
+* Declaration of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/** DWT cycle counter Initialization function */
+void vfnDwt_Init(void);
+
+/** DWT cycle counter read function */
+uint32_t u32Dwt_GetCycles(void);
+
+/****************************************************************************************************/
+
+#endif /* __DWT_H */
@@ -0,0 +1,75 @@
+/****************************************************************************************************/
+/**
+\file       power.c
+\brief      MCAL abstraction level - Core sleep control.
+            The core is put in Sleep mode (WFI with SLEEPDEEP cleared): processor clock is stopped,
+            peripherals and SysTick keep running and any enabled interrupt wakes the core up.
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+/** Power function prototypes and definitions */
+#include "power.h"
+/** Core-specific prototypes and definitions */
+#include "core_cm7.h"
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs - 
+*****************************************************************************************************/
+
+/*****************************************************************************************************
+* Definition of module wide (CONST-) CONSTANTs 
+*****************************************************************************************************/
+
+/*****************************************************************************************************
+* Code of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/****************************************************************************************************/
+/**
+* \brief    Power - Mask interrupts. WFI still wakes up on a pending interrupt while masked,
+*           so no interrupt is lost between the check for pending work and the sleep.
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo
+*/
+void vfnPower_EnterCritical(void)
+{
+	__disable_irq();
+}
+
+/****************************************************************************************************/
+/**
+* \brief    Power - Unmask interrupts, the interrupt that woke the core up is served here
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo
+*/
+void vfnPower_ExitCritical(void)
+{
+	__enable_irq();
+}
+
+/****************************************************************************************************/
+/**
+* \brief    Power - Sleep until next interrupt
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo
+*/
+void vfnPower_Sleep(void)
+{
+	/* Sleep mode, wait mode would stop SysTick */
+	SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+	__DSB();
+	__WFI();
+	__ISB();
+}
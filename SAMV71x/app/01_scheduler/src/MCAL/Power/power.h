@@ -0,0 +1,48 @@
+/****************************************************************************************************/
+/**
+\file       power.h
+\brief      MCAL abstraction level - Core sleep control
+\author     Abraham Tezmol
+\version    1.0
+\project    Tau 
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+#ifndef __POWER_H        /*prevent duplicated includes*/
+#define __POWER_H
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+
+/** Core modules */
+#include "compiler.h"
+#include "typedefs.h"
+
+/*****************************************************************************************************
+* Declaration of module wide TYPEs 
+*****************************************************************************************************/
+
+
+/*****************************************************************************************************
+* Definition of module wide MACROs / #DEFINE-CONSTANTs 
+*****************************************************************************************************/
+
+
+/*****************************************************************************************************
+* Declaration of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/** Interrupts masking, to be called before checking for pending work */
+void vfnPower_EnterCritical(void);
+
+/** Interrupts unmasking, pending interrupts are served here */
+void vfnPower_ExitCritical(void);
+
+/** Core sleep until next interrupt, to be called within a critical section */
+void vfnPower_Sleep(void);
+
+/****************************************************************************************************/
+
+#endif /* __POWER_H */
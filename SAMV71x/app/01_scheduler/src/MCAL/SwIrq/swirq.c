@@ -0,0 +1,128 @@
+/****************************************************************************************************/
+/**
+\file       swirq.c
+\brief      MCAL abstraction level - Software triggered interrupt levels.
+            Interrupt lines of peripherals not used by the application (TC6..TC11) are triggered
+            by software, the NVIC then provides nested preemption between levels in hardware the
+            same way PendSV does for a single level. Level "n" gets NVIC priority
+            SWIRQ_LOWEST_PRIO - (n - 1), SysTick gets SWIRQ_TICK_PRIO, above all levels.
+\author     Abraham Tezmol
+\version    1.0
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+/** Software interrupt function prototypes and definitions */
+#include "swirq.h"
+/** Device definitions: interrupt numbers and handlers */
+#include "chip.h"
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs - 
+*****************************************************************************************************/
+/* Level handler invoked from every software interrupt */
+tPtr_to_level_handler pfnSwIrq_Handler = (tPtr_to_level_handler)NULL;
+
+/*****************************************************************************************************
+* Definition of module wide (CONST-) CONSTANTs 
+*****************************************************************************************************/
+/* Lowest NVIC priority, used by level 1 */
+#define SWIRQ_LOWEST_PRIO       ( ( 1u << __NVIC_PRIO_BITS ) - 1u )
+/* Tick priority, priority 0 is left to application interrupts */
+#define SWIRQ_TICK_PRIO         1u
+
+/* Interrupt line of each level, index 0 is level 1 */
+static const IRQn_Type SwIrq_Lines[SWIRQ_MAX_LEVELS] =
+{
+    TC6_IRQn, TC7_IRQn, TC8_IRQn, TC9_IRQn, TC10_IRQn, TC11_IRQn
+};
+
+typedef char SWIRQ_MAX_LEVELS_shall_fit_below_tick[ ( SWIRQ_MAX_LEVELS <= ( SWIRQ_LOWEST_PRIO - SWIRQ_TICK_PRIO ) ) ? 1 : -1 ];
+
+/*****************************************************************************************************
+* Code of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/****************************************************************************************************/
+/**
+* \brief    SwIrq - Initialization. Levels are given ascending NVIC priority, SysTick preempts them all.
+* \author   Abraham Tezmol
+* \param    uint8_t u8Levels	--> Number of levels used (1 .. SWIRQ_MAX_LEVELS)
+* \param    tPtr_to_level_handler pfnHandler	--> Handler invoked with the level number
+* \return   int8_t --> 0 - Successful configuration, 1 - Invalid configuration
+* \todo
+*/
+int8_t vfnSwIrq_Init(uint8_t u8Levels, tPtr_to_level_handler pfnHandler)
+{
+	uint8_t u8Level;
+
+	if ((u8Levels == 0u) || (u8Levels > SWIRQ_MAX_LEVELS) || (pfnHandler == NULL))
+	{
+		return 1;
+	}
+	pfnSwIrq_Handler = pfnHandler;
+	for (u8Level = 1u; u8Level <= u8Levels; u8Level++)
+	{
+		NVIC_DisableIRQ(SwIrq_Lines[u8Level - 1u]);
+		NVIC_ClearPendingIRQ(SwIrq_Lines[u8Level - 1u]);
+		NVIC_SetPriority(SwIrq_Lines[u8Level - 1u], SWIRQ_LOWEST_PRIO - (u8Level - 1u));
+		NVIC_EnableIRQ(SwIrq_Lines[u8Level - 1u]);
+	}
+	NVIC_SetPriority(SysTick_IRQn, SWIRQ_TICK_PRIO);
+	return 0;
+}
+
+/****************************************************************************************************/
+/**
+* \brief    SwIrq - Request of a level, the handler runs as soon as no equal or higher priority
+*           interrupt is active
+* \author   Abraham Tezmol
+* \param    uint8_t u8Level	--> Level to be requested
+* \return   void
+* \todo
+*/
+void vfnSwIrq_Trigger(uint8_t u8Level)
+{
+	NVIC->STIR = (uint32_t)SwIrq_Lines[u8Level - 1u];
+}
+
+/****************************************************************************************************/
+/**
+* \brief    SwIrq - Interrupt handlers of each level
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo
+*/
+void TC6_Handler(void)
+{
+	pfnSwIrq_Handler(1u);
+}
+
+void TC7_Handler(void)
+{
+	pfnSwIrq_Handler(2u);
+}
+
+void TC8_Handler(void)
+{
+	pfnSwIrq_Handler(3u);
+}
+
+void TC9_Handler(void)
+{
+	pfnSwIrq_Handler(4u);
+}
+
+void TC10_Handler(void)
+{
+	pfnSwIrq_Handler(5u);
+}
+
+void TC11_Handler(void)
+{
+	pfnSwIrq_Handler(6u);
+}
@@ -0,0 +1,49 @@
+/****************************************************************************************************/
+/**
+\file       swirq.h
+\brief      MCAL abstraction level - Software triggered interrupt levels
+\author     Abraham Tezmol
+\version    1.0
+\project    Tau 
+\date       17/October/2026
+*/
+/****************************************************************************************************/
+
+#ifndef __SWIRQ_H        /*prevent duplicated includes*/
+#define __SWIRQ_H
+
+/*****************************************************************************************************
+* Include files
+*****************************************************************************************************/
+
+/** Core modules */
+#include "compiler.h"
+#include "typedefs.h"
+
+/*****************************************************************************************************
+* Declaration of module wide TYPEs 
+*****************************************************************************************************/
+
+/* Handler of a software interrupt level */
+typedef void ( * tPtr_to_level_handler )( uint8_t u8Level );
+
+/*****************************************************************************************************
+* Definition of module wide MACROs / #DEFINE-CONSTANTs 
+*****************************************************************************************************/
+
+/* Number of software interrupt levels available, level 1 being the lowest priority */
+#define SWIRQ_MAX_LEVELS        6u
+
+/*****************************************************************************************************
+* Declaration of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/** Software interrupt levels initialization, SysTick is raised above all levels */
+int8_t vfnSwIrq_Init(uint8_t u8Levels, tPtr_to_level_handler pfnHandler);
+
+/** Software interrupt request of a level, callable from any context */
+void vfnSwIrq_Trigger(uint8_t u8Level);
+
+/****************************************************************************************************/
+
+#endif /* __SWIRQ_H */
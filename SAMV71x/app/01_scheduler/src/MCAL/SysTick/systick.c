@@ -24,6 +24,9 @@
 /* Global pointer used to invoke callback function upon Timer event*/
 tPtr_to_function pfctnSysTick = (tPtr_to_function)NULL;
 
+/* Core clock cycles of one SysTick base period */
+uint32_t u32SysTick_Period = 0u;
+
 /*****************************************************************************************************
 * Definition of module wide (CONST-) CONSTANTs 
 *****************************************************************************************************/
@@ -44,7 +47,48 @@ tPtr_to_function pfctnSysTick = (tPtr_to_function)NULL;
 int8_t sysTick_init(int32_t base_freq, tPtr_to_function sysTick_handler)
 {
 	pfctnSysTick = sysTick_handler;
-	return SysTick_Config(SystemCoreClock / base_freq);
+	u32SysTick_Period = SystemCoreClock / base_freq;
+	return SysTick_Config(u32SysTick_Period);
+}
+
+/****************************************************************************************************/
+/**
+* \brief    SysTick - Tick suppression. Stretches the current period so the next interrupt comes
+*           "periods" base periods later than due, the following ones come back to the base period.
+*           Shall be called with interrupts masked. A few core cycles are lost while the counter
+*           is stopped.
+* \author   Abraham Tezmol
+* \param    uint32_t periods	--> Number of interrupts to be skipped
+* \return   uint32_t --> Number of interrupts actually skipped, limited by the 24-bit counter
+* \todo
+*/
+uint32_t sysTick_suppress(uint32_t periods)
+{
+	uint32_t u32Remaining;
+	uint32_t u32Max;
+
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+	u32Remaining = SysTick->VAL;
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u)
+	{
+		/* Interrupt already due, nothing can be skipped */
+		periods = 0u;
+	}
+	u32Max = (SysTick_LOAD_RELOAD_Msk - u32Remaining) / u32SysTick_Period;
+	if (periods > u32Max)
+	{
+		periods = u32Max;
+	}
+	if (periods != 0u)
+	{
+		/* Counter reloads on next clock, then counts down to the stretched tick */
+		SysTick->LOAD = u32Remaining + (periods * u32SysTick_Period) - 1u;
+		SysTick->VAL = 0u;
+	}
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+	/* Only the current period is stretched, next reloads take the base period again */
+	SysTick->LOAD = u32SysTick_Period - 1u;
+	return periods;
 }
 
 /****************************************************************************************************/
@@ -37,6 +37,9 @@
 /** SysTick Initialization function */
 int8_t sysTick_init(int32_t base_freq, tPtr_to_function sysTick_handler);
 
+/** SysTick suppression of the next interrupts, for extended sleep */
+uint32_t sysTick_suppress(uint32_t periods);
+
 /****************************************************************************************************/
 
 #endif /* __SYSTICK_H */
@@ -16,6 +16,14 @@
 #include "app_tasks.h"
 /** Real Time timer resource assigned as scheduler tick */
 #include "systick.h"
+/** Timeline trace of task lists */
+#include "sch_trace.h"
+/** Core sleep control */
+#include "power.h"
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+/** Software interrupt levels of preemptive task lists */
+#include "swirq.h"
+#endif
 
 
 /*****************************************************************************************************
@@ -23,36 +31,152 @@
 *****************************************************************************************************/
 
 UINT8 gu8Scheduler_Status;
-UINT8 gu8Scheduler_Counter;
+VUINT8 gu8Scheduler_Counter;
 
-tSchedulerTasks_ID TaskScheduler_Task_ID_Activated;
-tSchedulerTasks_ID TaskScheduler_Task_ID_Running;
-tSchedulerTasks_ID TasksScheduler_Task_ID_Backup;
+/* Slot of the hyperperiod to be activated on next tick */
+UINT16 gu16Scheduler_Slot;
 
-UINT8 u8_10ms_Counter;
-UINT8 u8_50ms_Counter;
-UINT8 u8_100ms_Counter;
+/* Set of task lists activated by the last tick and pending for execution */
+volatile tSchedulerSlotMask TaskScheduler_Slot_Activated;
+tSchedulerTasks_ID TaskScheduler_Task_ID_Running;
 
+#define    TASK_SCH_CFG_TASK( Arg, TaskId, TaskList, Priority, Period, Offset )   \
+                { TaskId, TaskList, SUSPENDED, Priority, Period, Offset },
 
 tSchedulingTask TimeTriggeredTasks[TASK_SCH_MAX_NUMBER_TIME_TASKS] =
 { 
-    {TASKS_1_MS,  TASKS_LIST_1MS,  SUSPENDED, 5},
-    {TASKS_2_MS_A,TASKS_LIST_2MS_A,SUSPENDED, 4},
-    {TASKS_2_MS_B,TASKS_LIST_2MS_B,SUSPENDED, 4},
-    {TASKS_10_MS, TASKS_LIST_10MS, SUSPENDED, 3},
-    {TASKS_50_MS, TASKS_LIST_50MS, SUSPENDED, 2},
-    {TASKS_100_MS,TASKS_LIST_100MS,SUSPENDED, 1},
+    TASK_SCH_CFG_TIME_TASKS( TASK_SCH_CFG_TASK, 0 )
+};
+
+#if ( TASK_SCH_MAX_NUMBER_EVENT_TASKS > 0u )
+#define    TASK_SCH_CFG_EVENT_TASK( Arg, TaskId, TaskList, Priority )   \
+                { TaskId, TaskList, SUSPENDED, Priority, 0u, 0u },
+
+tSchedulingTask EventTriggeredTasks[TASK_SCH_MAX_NUMBER_EVENT_TASKS] =
+{ 
+    TASK_SCH_CFG_EVENT_TASKS( TASK_SCH_CFG_EVENT_TASK, 0 )
 };
 
+/* Ready bitmap of event triggered tasks, bit "n" stands for EventTriggeredTasks[n] */
+volatile uint32_t gu32Scheduler_EventReady;
+#endif
+
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+#define    TASK_SCH_CFG_BG_TASK( Arg, TaskId, TaskList, Period )   \
+                { TaskId, TaskList, READY, Period, Period, 0u, 0u },
+
+tSchedulerBgTask BackgroundTasks[TASK_SCH_MAX_NUMBER_BG_TASKS] =
+{ 
+    TASK_SCH_CFG_BACKGROUND_TASKS( TASK_SCH_CFG_BG_TASK, 0 )
+};
+
+/* Activations of background tasks not yet taken, bit "n" stands for BackgroundTasks[n] */
+volatile uint32_t gu32Scheduler_BgActivated;
+/* Next background task to be given a chunk, round robin */
+uint8_t gu8Scheduler_BgNext;
+/* Background tasks hold back until the tick counter moves away from this value */
+uint8_t gu8Scheduler_BgYield;
+uint8_t gu8Scheduler_BgYieldCounter;
+#endif
+
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+/* Profiling time base, no measurements are taken while NULL */
+tPtr_to_clock pfnScheduler_Clock = (tPtr_to_clock)NULL;
+/* Execution statistics of each task list */
+tSchedulerTaskStats TaskStats[TASK_SCH_MAX_NUMBER_TASKS];
+/* Time stamp of last activation of each task list */
+uint32_t au32Scheduler_ActivationTime[TASK_SCH_MAX_NUMBER_TASKS];
+/* Time stamp of the last tick and measured length of a slot */
+volatile uint32_t gu32Scheduler_TickTime;
+volatile uint32_t gu32Scheduler_SlotLength;
+/* Idle window in progress: opened when nothing but background work is left */
+uint8_t gu8Scheduler_IdleOpen;
+uint8_t gu8Scheduler_IdleCounter;
+uint32_t gu32Scheduler_IdleStart;
+tSchedulerIdleStats IdleStats;
+/* Set when the core slept since last tick, the slot length is not measured then */
+uint8_t gu8Scheduler_Slept;
+#endif
+
+#if ( TASK_SCH_CFG_LOW_POWER == 2u )
+/* Empty slots covered by the current, stretched, SysTick period */
+uint16_t gu16Scheduler_Suppressed;
+#endif
+
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+/* Task lists activated and not yet started on each preemption level, index 0 unused */
+volatile tSchedulerSlotMask aScheduler_LevelReady[TASK_SCH_CFG_PREEMPT_LEVELS + 1u];
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+/* Levels being executed and accumulated time spent on them, preempting thread mode */
+uint8_t gu8Scheduler_LevelNesting;
+volatile uint32_t gu32Scheduler_PreemptedTime;
+/* Preempted time when the current idle window was opened */
+uint32_t gu32Scheduler_IdlePreempted;
+#endif
+#endif
+
 /*****************************************************************************************************
 * Definition of module wide (CONST-) CONSTANTs 
 *****************************************************************************************************/
 
+/* Compile time verification of the task table */
+#define    TASK_SCH_CFG_CHECK( Arg, TaskId, TaskList, Priority, Period, Offset )                      \
+                typedef char TaskId##_period_shall_divide_hyperperiod                                  \
+                    [ ( ( (Period) > 0u ) && ( ( TASK_SCH_HYPERPERIOD_TICKS % (Period) ) == 0u ) ) ? 1 : -1 ]; \
+                typedef char TaskId##_offset_shall_be_lower_than_period                                \
+                    [ ( (Offset) < (Period) ) ? 1 : -1 ];                                              \
+                typedef char TaskId##_priority_shall_be_a_preemption_level                             \
+                    [ ( ( TASK_SCH_CFG_PREEMPTIVE == 0u )                                              \
+                        || ( ( (Priority) >= 1u ) && ( (Priority) <= TASK_SCH_CFG_PREEMPT_LEVELS ) ) ) ? 1 : -1 ];
+
+TASK_SCH_CFG_TIME_TASKS( TASK_SCH_CFG_CHECK, 0 )
+
+/* Contribution of one task to slot "n" */
+#define    TASK_SCH_CFG_SLOT_BIT( n, TaskId, TaskList, Priority, Period, Offset )    \
+                | ( ( ( (n) % (Period) ) == (Offset) ) ? ( (tSchedulerSlotMask)1u << (TaskId) ) : 0u )
+#define    TASK_SCH_CFG_SLOT_LOAD( n, TaskId, TaskList, Priority, Period, Offset )   \
+                + ( ( ( (n) % (Period) ) == (Offset) ) ? 1u : 0u )
+
+#define    TASK_SCH_SLOT_MASK( n )    ( (tSchedulerSlotMask)( 0u TASK_SCH_CFG_TIME_TASKS( TASK_SCH_CFG_SLOT_BIT, n ) ) )
+#define    TASK_SCH_SLOT_LOAD( n )    ( 0u TASK_SCH_CFG_TIME_TASKS( TASK_SCH_CFG_SLOT_LOAD, n ) )
+
+/* Slot load verification - a negative bit-field width stops the build on an overloaded slot */
+#define    TASK_SCH_SLOT_GEN( n )     unsigned int : (int)( TASK_SCH_MAX_TASKS_PER_SLOT - TASK_SCH_SLOT_LOAD( n ) );
+typedef struct
+{
+    uint8_t u8Reserved;
+    #include "app_scheduler_slots.h"
+}tSchedulerSlotLoadCheck;
+#undef     TASK_SCH_SLOT_GEN
+
+/* Hyperperiod slot table - set of task lists to be activated on each tick */
+#define    TASK_SCH_SLOT_GEN( n )     TASK_SCH_SLOT_MASK( n ),
+const tSchedulerSlotMask SchedulerSlotTable[TASK_SCH_HYPERPERIOD_TICKS] =
+{
+    #include "app_scheduler_slots.h"
+};
+#undef     TASK_SCH_SLOT_GEN
+
 
 /*****************************************************************************************************
 * Code of module wide private FUNCTIONS
 *****************************************************************************************************/
 void vfnScheduler_Callback(void);
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+void vfnScheduler_ProfileUpdate( tSchedulerTasks_ID TaskId, uint32_t u32StartTime, uint32_t u32EndTime );
+void vfnScheduler_IdleClose(void);
+#endif
+uint8_t u8Scheduler_Background(void);
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+void vfnScheduler_BgRelease( uint16_t u16Ticks );
+#endif
+#if ( TASK_SCH_CFG_LOW_POWER > 0u )
+void vfnScheduler_Sleep(void);
+#endif
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+void vfnScheduler_LevelActivate( uint8_t u8TaskIndex );
+void vfnScheduler_LevelDispatch(uint8_t u8Level);
+#endif
 
 /*****************************************************************************************************
 * Code of public FUNCTIONS
@@ -68,15 +192,43 @@ void vfnScheduler_Callback(void);
 */
 void vfnScheduler_Init(void)
 {    
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+    uint8_t u8Level;
+#endif
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    uint8_t u8BgIndex;
+#endif
+
     /* Init Global and local Task Scheduler variables */
     gu8Scheduler_Counter   = 0u;
-    TaskScheduler_Task_ID_Activated = TASK_NULL;
+    gu16Scheduler_Slot     = 0u;
+    TaskScheduler_Slot_Activated = 0u;
     TaskScheduler_Task_ID_Running = TASK_NULL;
-    TasksScheduler_Task_ID_Backup = TASK_NULL;
-    u8_10ms_Counter        = 0u;
-    u8_50ms_Counter        = 0u;
-    u8_100ms_Counter       = 0u;
+#if ( TASK_SCH_MAX_NUMBER_EVENT_TASKS > 0u )
+    gu32Scheduler_EventReady = 0u;
+#endif
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    gu32Scheduler_BgActivated = 0u;
+    gu8Scheduler_BgNext    = 0u;
+    gu8Scheduler_BgYield   = 0u;
+    /* First pass of every background task right from start */
+    for( u8BgIndex = 0u; u8BgIndex < TASK_SCH_MAX_NUMBER_BG_TASKS; u8BgIndex++ )
+    {
+        BackgroundTasks[u8BgIndex].enTaskState  = READY;
+        BackgroundTasks[u8BgIndex].u16Countdown = BackgroundTasks[u8BgIndex].u16Period;
+    }
+#endif
+#if ( TASK_SCH_CFG_LOW_POWER == 2u )
+    gu16Scheduler_Suppressed = 0u;
+#endif
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+    for( u8Level = 0u; u8Level <= TASK_SCH_CFG_PREEMPT_LEVELS; u8Level++ )
+    {
+        aScheduler_LevelReady[u8Level] = 0u;
+    }
+#endif
     gu8Scheduler_Status    = TASK_SCHEDULER_INIT;
+    vfnScheduler_ResetTaskStats();
 }
 
 /*******************************************************************************/
@@ -91,6 +243,13 @@ void vfnScheduler_Init(void)
 */
 void vfnScheduler_Start(void)
 {
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+	/* Task list levels first, the tick is raised above all of them */
+	if (vfnSwIrq_Init(TASK_SCH_CFG_PREEMPT_LEVELS, vfnScheduler_LevelDispatch))
+	{
+		while (1);
+	}
+#endif
 	if (sysTick_init(TASK_SCHEDULER_BASE_FREQ, vfnScheduler_Callback)) 
 	{
 		while (1);
@@ -114,7 +273,9 @@ void vfnScheduler_Stop(void)
 
 /***************************************************************************************************/
 /**
-* \brief    Scheduler - execution of time or event driven tasks
+* \brief    Scheduler - execution of time or event driven tasks.           \n
+            The running task is restored on completion, as a preemptive    \n
+            task list may start on top of another one.
 * \author   Abraham Tezmol
 * \param    void
 * \return   void
@@ -122,13 +283,31 @@ void vfnScheduler_Stop(void)
 */
 void vfnScheduler_TaskStart( tSchedulingTask * Task )
 {
+    tSchedulerTasks_ID PreviousTask = TaskScheduler_Task_ID_Running;
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    uint32_t u32StartTime = 0u;
+
+    if( pfnScheduler_Clock != NULL )
+    {
+        u32StartTime = pfnScheduler_Clock();
+    }
+#endif
     /* Indicate that this Task has gained CPU allocation */ 
     Task->enTaskState = RUNNING;
     TaskScheduler_Task_ID_Running =  Task->TaskId;
+    SCH_TRACE( SCH_TRACE_EVT_START, Task->TaskId );
     /* Perform actual execution of task */
     Task->ptrTask();
+    SCH_TRACE( SCH_TRACE_EVT_END, Task->TaskId );
     /* Indicate that Task execution has completed */ 
     Task->enTaskState = SUSPENDED;
+    TaskScheduler_Task_ID_Running = PreviousTask;
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    if( pfnScheduler_Clock != NULL )
+    {
+        vfnScheduler_ProfileUpdate( Task->TaskId, u32StartTime, pfnScheduler_Clock() );
+    }
+#endif
 }
 
 /***************************************************************************************************/
@@ -141,17 +320,29 @@ void vfnScheduler_TaskStart( tSchedulingTask * Task )
 */
 void vfnScheduler_TaskActivate( tSchedulingTask * Task )
 { 
-    TaskScheduler_Task_ID_Activated = Task->TaskId;
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    if( pfnScheduler_Clock != NULL )
+    {
+        au32Scheduler_ActivationTime[Task->TaskId] = pfnScheduler_Clock();
+    }
+#endif
+    SCH_TRACE( SCH_TRACE_EVT_ACTIVATE, Task->TaskId );
     Task->enTaskState = READY;
 }
 
 /*******************************************************************************/
 /**
 * \brief    Multi-thread round robin task Scheduler  (non-preemtive)        \n
-            It calls the different tasks based on the status of             \n   
-            "gu8Scheduler_Thread_ID". This variable is modified by          \n
-            ISR "vfnScheduler_PIT_Isr"                                        \n
-            List of tasks shall be defined @ "tasks.h" file
+            It calls the task lists activated for current time slice,       \n
+            "TaskScheduler_Slot_Activated". This variable is modified by    \n
+            ISR "vfnScheduler_Callback".                                    \n
+            Task lists sharing a slot are executed in table order.          \n
+            With no slot pending, one ready event triggered task is run,    \n
+            or else one chunk of a background task. With nothing left to    \n
+            run the core sleeps until next interrupt (TASK_SCH_CFG_LOW_POWER).\n
+            With TASK_SCH_CFG_PREEMPTIVE no slot is ever pending here, time  \n
+            triggered task lists run from their software interrupt level.  \n
+            List of tasks shall be defined @ "app_scheduler_cfg.h" file
 * \author   Abraham Tezmol
 * \param    void
 * \return   void
@@ -159,111 +350,604 @@ void vfnScheduler_TaskActivate( tSchedulingTask * Task )
 */
 void vfnTask_Scheduler(void)
 {
-    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-    /*  1ms execution thread - used to derive two execution threads:                */
-    /*  a) 1ms thread (high priority tasks)                                         */
-    /*  b) 100ms thread (lowest priority tasks)                                     */
-    /*  As any other thread on this scheduler, all tasks must be executed in <=500us*/
-    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-    if( ( TaskScheduler_Task_ID_Activated == TASKS_1_MS )
-         || ( TaskScheduler_Task_ID_Activated == TASKS_100_MS ) )
-    {
-        /* Make a copy of scheduled task ID */
-        TasksScheduler_Task_ID_Backup = TaskScheduler_Task_ID_Activated;
-
-        vfnScheduler_TaskStart (&TimeTriggeredTasks[TASKS_1_MS]);
-        if( TaskScheduler_Task_ID_Activated == TASKS_100_MS )
+    tSchedulerSlotMask SlotMask;
+    uint8_t u8Counter_Backup;
+    uint8_t u8TaskIndex;
+#if ( TASK_SCH_MAX_NUMBER_EVENT_TASKS > 0u )
+    uint32_t u32Ready = gu32Scheduler_EventReady;
+#endif
+
+    SlotMask = TaskScheduler_Slot_Activated;
+    if( SlotMask != 0u )
+    {
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+        vfnScheduler_IdleClose();
+#endif
+        /* Make a copy of the tick counter, any new tick during execution is an overrun */
+        u8Counter_Backup = gu8Scheduler_Counter;
+
+        for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
         {
-            vfnScheduler_TaskStart (&TimeTriggeredTasks[TASKS_100_MS]);
+            if( ( SlotMask & ( (tSchedulerSlotMask)1u << u8TaskIndex ) ) != 0u )
+            {
+                vfnScheduler_TaskStart (&TimeTriggeredTasks[u8TaskIndex]);
+            }
         }
-        /* Verify that thread execution took less than 500 us */
-        if( TasksScheduler_Task_ID_Backup == TaskScheduler_Task_ID_Activated )
+        /* Verify that slot execution took less than 500 us */
+        if( u8Counter_Backup == gu8Scheduler_Counter )
         {
-             /* In case execution of all thread took less than 500us */
-            TaskScheduler_Task_ID_Activated = TASK_NULL;
+            /* In case execution of all task lists took less than 500us */
+            TaskScheduler_Slot_Activated = 0u;
         }
         else
         {
-            gu8Scheduler_Status = TASK_SCHEDULER_OVERLOAD_1MS;
+            /* Slot owner is the first task list of the slot */
+            u8TaskIndex = 0u;
+            while( ( SlotMask & ( (tSchedulerSlotMask)1u << u8TaskIndex ) ) == 0u )
+            {
+                u8TaskIndex++;
+            }
+            gu8Scheduler_Status = TASK_SCHEDULER_OVERLOAD( u8TaskIndex );
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+            TaskStats[u8TaskIndex].u32Overruns++;
+#endif
         }
     }
-    else
+#if ( TASK_SCH_MAX_NUMBER_EVENT_TASKS > 0u )
+    else if( u32Ready != 0u )
     {
         /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-        /*  2ms execution thread - used to derive two execution threads:                */
-        /*  a) 2ms group A thread (high priority tasks)                                 */
-        /*  b) 50ms thread (second lowest priority tasks)                               */
-        /*  As any other thread on this scheduler, all tasks must be executed in <=500us*/
+        /*  Event triggered tasks - executed one per call, so a time triggered slot     */
+        /*  activated meanwhile is served first. Highest priority is the lowest bit.    */
         /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-        if( ( TaskScheduler_Task_ID_Activated == TASKS_2_MS_A )
-             || ( TaskScheduler_Task_ID_Activated == TASKS_50_MS ) )
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+        vfnScheduler_IdleClose();
+#endif
+        u8TaskIndex = (uint8_t)__builtin_ctz( u32Ready );
+        (void)__atomic_fetch_and( &gu32Scheduler_EventReady, ~( 1u << u8TaskIndex ), __ATOMIC_RELAXED );
+        vfnScheduler_TaskStart (&EventTriggeredTasks[u8TaskIndex]);
+    }
+#endif
+#if ( TASK_SCH_CFG_LOW_POWER > 0u )
+    else if( u8Scheduler_Background() == 0u )
+    {
+        vfnScheduler_Sleep();
+    }
+#else
+    else
+    {
+        (void)u8Scheduler_Background();
+    }
+#endif
+}
+
+/*******************************************************************************/
+/**
+* \brief    Scheduler - idle time of the current slot.                      \n
+            Opens the idle window and gives one chunk to the next           \n
+            background task with a pass in progress, round robin. A task    \n
+            finishing its pass stays idle until its next activation.        \n
+            A chunk is held back until the                                  \n
+            next tick when its longest execution so far does not fit in     \n
+            the time left, so time triggered tasks are not delayed. With    \n
+            TASK_SCH_CFG_PREEMPTIVE chunks are simply preempted instead.
+* \author   Abraham Tezmol
+* \param    void
+* \return   uint8_t --> 1 - A background chunk was run, 0 - Nothing to run until next interrupt
+* \todo     
+*/
+uint8_t u8Scheduler_Background(void)
+{
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    tSchedulerBgTask * Task;
+    uint8_t u8Counter_Backup = gu8Scheduler_Counter;
+    uint32_t u32Activated;
+    uint8_t u8BgIndex;
+    uint8_t u8Count;
+#endif
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    uint32_t u32StartTime = 0u;
+    uint32_t u32EndTime;
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+    uint32_t u32Preempted = gu32Scheduler_PreemptedTime;
+#endif
+
+    if( pfnScheduler_Clock != NULL )
+    {
+        u32StartTime = pfnScheduler_Clock();
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+        /* Time triggered task lists preempt the idle loop, a window is closed on every tick */
+        if( gu8Scheduler_IdleCounter != gu8Scheduler_Counter )
+        {
+            vfnScheduler_IdleClose();
+        }
+#endif
+        if( gu8Scheduler_IdleOpen == 0u )
         {
-            /* Make a copy of scheduled task ID */
-            TasksScheduler_Task_ID_Backup = TaskScheduler_Task_ID_Activated;
+            gu8Scheduler_IdleCounter = gu8Scheduler_Counter;
+            gu32Scheduler_IdleStart  = u32StartTime;
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+            gu32Scheduler_IdlePreempted = u32Preempted;
+#endif
+            gu8Scheduler_IdleOpen    = 1u;
+        }
+    }
+#endif
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    if( ( gu8Scheduler_BgYield != 0u ) && ( gu8Scheduler_BgYieldCounter == u8Counter_Backup ) )
+    {
+        return 0u;
+    }
+    gu8Scheduler_BgYield = 0u;
+    /* Activations raised since last call start a new pass, or one more once the current one ends */
+    u32Activated = __atomic_exchange_n( &gu32Scheduler_BgActivated, 0u, __ATOMIC_RELAXED );
+    while( u32Activated != 0u )
+    {
+        u8BgIndex = (uint8_t)__builtin_ctz( u32Activated );
+        u32Activated &= ~( 1u << u8BgIndex );
+        if( BackgroundTasks[u8BgIndex].enTaskState == READY )
+        {
+            (void)__atomic_fetch_or( &gu32Scheduler_BgActivated, ( 1u << u8BgIndex ), __ATOMIC_RELAXED );
+        }
+        else
+        {
+            SCH_TRACE( SCH_TRACE_EVT_ACTIVATE, BackgroundTasks[u8BgIndex].TaskId );
+            BackgroundTasks[u8BgIndex].enTaskState = READY;
+        }
+    }
+    u8BgIndex = gu8Scheduler_BgNext;
+    for( u8Count = 0u; ( u8Count < TASK_SCH_MAX_NUMBER_BG_TASKS ) && ( BackgroundTasks[u8BgIndex].enTaskState != READY ); u8Count++ )
+    {
+        u8BgIndex++;
+        if( u8BgIndex >= TASK_SCH_MAX_NUMBER_BG_TASKS )
+        {
+            u8BgIndex = 0u;
+        }
+    }
+    if( u8Count >= TASK_SCH_MAX_NUMBER_BG_TASKS )
+    {
+        return 0u;
+    }
+    gu8Scheduler_BgNext = u8BgIndex;
+    Task = &BackgroundTasks[u8BgIndex];
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    if( pfnScheduler_Clock != NULL )
+    {
+#if ( TASK_SCH_CFG_PREEMPTIVE == 0u )
+        /* Slot time already used plus longest chunk shall stay within the slot, once measured */
+        if( ( gu32Scheduler_SlotLength != 0u )
+            && ( ( ( u32StartTime - gu32Scheduler_TickTime ) + TaskStats[Task->TaskId].u32Max ) >= gu32Scheduler_SlotLength ) )
+        {
+            Task->u32Deferred++;
+            gu8Scheduler_BgYieldCounter = u8Counter_Backup;
+            gu8Scheduler_BgYield = 1u;
+            return 0u;
+        }
+#endif
+        au32Scheduler_ActivationTime[Task->TaskId] = u32StartTime;
+    }
+#endif
+    Task->enTaskState = RUNNING;
+    TaskScheduler_Task_ID_Running = Task->TaskId;
+    SCH_TRACE( SCH_TRACE_EVT_START, Task->TaskId );
+    if( Task->ptrTask() == TASK_SCH_BG_DONE )
+    {
+        Task->u32Passes++;
+        /* Idle until next activation */
+        Task->enTaskState = SUSPENDED;
+    }
+    else
+    {
+        Task->enTaskState = READY;
+    }
+    SCH_TRACE( SCH_TRACE_EVT_END, Task->TaskId );
+    gu8Scheduler_BgNext++;
+    if( gu8Scheduler_BgNext >= TASK_SCH_MAX_NUMBER_BG_TASKS )
+    {
+        gu8Scheduler_BgNext = 0u;
+    }
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    if( pfnScheduler_Clock != NULL )
+    {
+        u32EndTime = pfnScheduler_Clock();
+        vfnScheduler_ProfileUpdate( Task->TaskId, u32StartTime, u32EndTime );
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+        /* Time triggered task lists that preempted the chunk are not background time */
+        u32EndTime -= gu32Scheduler_PreemptedTime - u32Preempted;
+#endif
+        IdleStats.u64BackgroundTime += u32EndTime - u32StartTime;
+    }
+#if ( TASK_SCH_CFG_PREEMPTIVE == 0u )
+    /* A chunk running across a tick delays the time triggered tasks */
+    if( u8Counter_Backup != gu8Scheduler_Counter )
+    {
+        TaskStats[Task->TaskId].u32Overruns++;
+    }
+#endif
+#endif
+    return 1u;
+#else
+    return 0u;
+#endif
+}
+
+#if ( TASK_SCH_CFG_LOW_POWER > 0u )
+/*******************************************************************************/
+/**
+* \brief    Scheduler - core sleep until next interrupt.                     \n
+            Pending work is checked again with interrupts masked, so an     \n
+            activation raised after the dispatch decision is not slept over.\n
+            With TASK_SCH_CFG_LOW_POWER == 2 the SysTick period is stretched \n
+            over the empty slots ahead, up to the next periodic background  \n
+            activation; an early wake-up (event) keeps the stretched period,\n
+            as the skipped slots have nothing to activate. A background     \n
+            pass held back to the next tick is never stretched over.
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo     
+*/
+void vfnScheduler_Sleep(void)
+{
+    uint8_t u8BgPending = 0u;
+#if ( TASK_SCH_CFG_LOW_POWER == 2u )
+    uint16_t u16Slot;
+    uint16_t u16Empty = 0u;
+    uint16_t u16MaxEmpty = TASK_SCH_HYPERPERIOD_TICKS - 1u;
+#endif
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    uint8_t u8BgIndex;
+#endif
 
-            vfnScheduler_TaskStart (&TimeTriggeredTasks[TASKS_2_MS_A]);
-            if( TaskScheduler_Task_ID_Activated == TASKS_50_MS )
+    vfnPower_EnterCritical();
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    /* Background work left: a pass in progress or an activation not yet taken */
+    u8BgPending = ( gu32Scheduler_BgActivated != 0u ) ? 1u : 0u;
+    for( u8BgIndex = 0u; u8BgIndex < TASK_SCH_MAX_NUMBER_BG_TASKS; u8BgIndex++ )
+    {
+        if( BackgroundTasks[u8BgIndex].enTaskState == READY )
+        {
+            u8BgPending = 1u;
+        }
+#if ( TASK_SCH_CFG_LOW_POWER == 2u )
+        /* Waking up at the tick of the next activation at the latest */
+        else if( ( BackgroundTasks[u8BgIndex].u16Period != 0u )
+                 && ( BackgroundTasks[u8BgIndex].u16Countdown <= u16MaxEmpty ) )
+        {
+            u16MaxEmpty = BackgroundTasks[u8BgIndex].u16Countdown - 1u;
+        }
+#endif
+    }
+    /* Work held back to the next tick does not keep the core awake */
+    if( ( u8BgPending != 0u ) && ( gu8Scheduler_BgYield != 0u ) && ( gu8Scheduler_BgYieldCounter == gu8Scheduler_Counter ) )
+    {
+#if ( TASK_SCH_CFG_LOW_POWER == 2u )
+        u16MaxEmpty = 0u;
+#endif
+        u8BgPending = 0u;
+    }
+#endif
+    if( ( TaskScheduler_Slot_Activated == 0u ) && ( u8BgPending == 0u )
+#if ( TASK_SCH_MAX_NUMBER_EVENT_TASKS > 0u )
+        && ( gu32Scheduler_EventReady == 0u )
+#endif
+      )
+    {
+#if ( TASK_SCH_CFG_LOW_POWER == 2u )
+        if( gu16Scheduler_Suppressed == 0u )
+        {
+            /* Empty slots following the next tick, the slot table is known in advance */
+            u16Slot = gu16Scheduler_Slot;
+            while( ( u16Empty < u16MaxEmpty ) && ( SchedulerSlotTable[u16Slot] == 0u ) )
+            {
+                u16Empty++;
+                u16Slot++;
+                if( u16Slot >= TASK_SCH_HYPERPERIOD_TICKS )
+                {
+                    u16Slot = 0u;
+                }
+            }
+            if( u16Empty != 0u )
             {
-                vfnScheduler_TaskStart (&TimeTriggeredTasks[TASKS_50_MS]);
+                gu16Scheduler_Suppressed = (uint16_t)sysTick_suppress( u16Empty );
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+                IdleStats.u32TicksSuppressed += gu16Scheduler_Suppressed;
+#endif
             }
-            /* Verify that thread execution took less than 500 us */
-            if( TasksScheduler_Task_ID_Backup == TaskScheduler_Task_ID_Activated )
+        }
+#endif
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+        gu8Scheduler_Slept = 1u;
+        IdleStats.u32Sleeps++;
+#endif
+        vfnPower_Sleep();
+    }
+    vfnPower_ExitCritical();
+}
+#endif
+
+/*******************************************************************************/
+/**
+* \brief    Scheduler - activation of an event triggered task, or of a new  \n
+            pass of a background task.                                      \n
+            Lock-free, it may be called from any interrupt or from task     \n
+            level. Activations of a task still pending are merged, a        \n
+            background task activated during a pass runs one more pass.
+* \author   Abraham Tezmol
+* \param    TaskId - event triggered or background task to be activated
+* \return   void
+* \todo     
+*/
+void vfnScheduler_EventActivate(tSchedulerTasks_ID TaskId)
+{
+#if ( TASK_SCH_MAX_NUMBER_EVENT_TASKS > 0u )
+    uint8_t u8EventIndex;
+
+    if( ( TaskId >= TASK_SCH_MAX_NUMBER_TIME_TASKS )
+        && ( TaskId < ( TASK_SCH_MAX_NUMBER_TIME_TASKS + TASK_SCH_MAX_NUMBER_EVENT_TASKS ) ) )
+    {
+        u8EventIndex = (uint8_t)( TaskId - TASK_SCH_MAX_NUMBER_TIME_TASKS );
+        vfnScheduler_TaskActivate(&EventTriggeredTasks[u8EventIndex]);
+        (void)__atomic_fetch_or( &gu32Scheduler_EventReady, ( 1u << u8EventIndex ), __ATOMIC_RELAXED );
+    }
+#endif
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    if( ( TaskId >= ( TASK_SCH_MAX_NUMBER_TIME_TASKS + TASK_SCH_MAX_NUMBER_EVENT_TASKS ) ) && ( TaskId < TASK_NULL ) )
+    {
+        (void)__atomic_fetch_or( &gu32Scheduler_BgActivated,
+                                 ( 1u << ( TaskId - TASK_SCH_MAX_NUMBER_TIME_TASKS - TASK_SCH_MAX_NUMBER_EVENT_TASKS ) ),
+                                 __ATOMIC_RELAXED );
+    }
+#endif
+#if ( ( TASK_SCH_MAX_NUMBER_EVENT_TASKS == 0u ) && ( TASK_SCH_MAX_NUMBER_BG_TASKS == 0u ) )
+    (void)TaskId;
+#endif
+}
+
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+/*******************************************************************************/
+/**
+* \brief    Scheduler - periodic activation of background tasks, called     \n
+            from the tick interrupt with the number of ticks elapsed since  \n
+            the previous one (more than one after a suppressed period).     \n
+            The SysTick period is never stretched past an activation.
+* \author   Abraham Tezmol
+* \param    u16Ticks - ticks elapsed since the previous call
+* \return   void
+* \todo     
+*/
+void vfnScheduler_BgRelease( uint16_t u16Ticks )
+{
+    tSchedulerBgTask * Task;
+    uint8_t u8BgIndex;
+
+    for( u8BgIndex = 0u; u8BgIndex < TASK_SCH_MAX_NUMBER_BG_TASKS; u8BgIndex++ )
+    {
+        Task = &BackgroundTasks[u8BgIndex];
+        if( Task->u16Period != 0u )
+        {
+            if( Task->u16Countdown <= u16Ticks )
             {
-                 /* In case execution of all thread took less than 500us */
-                TaskScheduler_Task_ID_Activated = TASK_NULL;
+                Task->u16Countdown = Task->u16Period;
+                (void)__atomic_fetch_or( &gu32Scheduler_BgActivated, ( 1u << u8BgIndex ), __ATOMIC_RELAXED );
             }
             else
             {
-                gu8Scheduler_Status = TASK_SCHEDULER_OVERLOAD_2MS_A;
+                Task->u16Countdown -= u16Ticks;
             }
         }
+    }
+}
+#endif
+
+/*******************************************************************************/
+/**
+* \brief    Scheduler - selection of the time base used for profiling of     \n
+            task lists, e.g. DWT cycle counter on target or a simulated     \n
+            clock on host builds. NULL stops profiling.
+* \author   Abraham Tezmol
+* \param    ptrClock - free running counter read function
+* \return   void
+* \todo     
+*/
+void vfnScheduler_SetProfilingClock(tPtr_to_clock ptrClock)
+{
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    pfnScheduler_Clock = ptrClock;
+#else
+    (void)ptrClock;
+#endif
+}
+
+/*******************************************************************************/
+/**
+* \brief    Scheduler - query of profiling statistics of a task list.       \n
+            Times are given in profiling clock units, to be checked against \n
+            the 500us slot budget (SystemCoreClock / TASK_SCHEDULER_BASE_FREQ \n
+            cycles when the DWT cycle counter is used).
+* \author   Abraham Tezmol
+* \param    TaskId - task list to be queried
+* \param    Stats  - destination of the statistics
+* \return   uint8_t --> 0 - Statistics copied, 1 - Invalid task or profiling disabled
+* \todo     
+*/
+uint8_t u8Scheduler_GetTaskStats(tSchedulerTasks_ID TaskId, tSchedulerTaskStats * Stats)
+{
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    if( ( TaskId >= TASK_NULL ) || ( Stats == NULL ) )
+    {
+        return 1u;
+    }
+    *Stats = TaskStats[TaskId];
+    if( Stats->u32Count != 0u )
+    {
+        Stats->u32Avg = (uint32_t)( Stats->u64Total / Stats->u32Count );
+        Stats->u32Jitter = Stats->u32LatencyMax - Stats->u32LatencyMin;
+    }
+    else
+    {
+        Stats->u32Min = 0u;
+        Stats->u32LatencyMin = 0u;
+    }
+    return 0u;
+#else
+    (void)TaskId;
+    (void)Stats;
+    return 1u;
+#endif
+}
+
+/*******************************************************************************/
+/**
+* \brief    Scheduler - query of idle capacity statistics.                  \n
+            Idle time is the time found with only background work left,     \n
+            the share consumed by background tasks tells how much of the    \n
+            slot budget is still unused.
+* \author   Abraham Tezmol
+* \param    Stats - destination of the statistics
+* \return   uint8_t --> 0 - Statistics copied, 1 - Profiling disabled
+* \todo     
+*/
+uint8_t u8Scheduler_GetIdleStats(tSchedulerIdleStats * Stats)
+{
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    if( Stats == NULL )
+    {
+        return 1u;
+    }
+    *Stats = IdleStats;
+    return 0u;
+#else
+    (void)Stats;
+    return 1u;
+#endif
+}
+
+/*******************************************************************************/
+/**
+* \brief    Scheduler - reset of profiling statistics of all task lists
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo     
+*/
+void vfnScheduler_ResetTaskStats(void)
+{
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    uint8_t u8TaskIndex;
+
+    for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TASKS; u8TaskIndex++ )
+    {
+        TaskStats[u8TaskIndex].u32Count      = 0u;
+        TaskStats[u8TaskIndex].u32Last       = 0u;
+        TaskStats[u8TaskIndex].u32Min        = 0xFFFFFFFFu;
+        TaskStats[u8TaskIndex].u32Max        = 0u;
+        TaskStats[u8TaskIndex].u32Avg        = 0u;
+        TaskStats[u8TaskIndex].u32LatencyMin = 0xFFFFFFFFu;
+        TaskStats[u8TaskIndex].u32LatencyMax = 0u;
+        TaskStats[u8TaskIndex].u32Jitter     = 0u;
+        TaskStats[u8TaskIndex].u32Overruns   = 0u;
+        TaskStats[u8TaskIndex].u64Total      = 0u;
+    }
+    IdleStats.u32Windows        = 0u;
+    IdleStats.u64IdleTime       = 0u;
+    IdleStats.u64BackgroundTime = 0u;
+    IdleStats.u32Sleeps         = 0u;
+    IdleStats.u32TicksSuppressed = 0u;
+    gu8Scheduler_IdleOpen       = 0u;
+#endif
+}
+
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+/*******************************************************************************/
+/**
+* \brief    Scheduler - update of profiling statistics after execution of   \n
+            a task list. Unsigned differences handle counter wrap-around.
+* \author   Abraham Tezmol
+* \param    TaskId       - executed task list
+* \param    u32StartTime - time stamp before execution
+* \param    u32EndTime   - time stamp after execution
+* \return   void
+* \todo     
+*/
+void vfnScheduler_ProfileUpdate( tSchedulerTasks_ID TaskId, uint32_t u32StartTime, uint32_t u32EndTime )
+{
+    tSchedulerTaskStats * Stats = &TaskStats[TaskId];
+    uint32_t u32Elapsed = u32EndTime - u32StartTime;
+    uint32_t u32Latency = u32StartTime - au32Scheduler_ActivationTime[TaskId];
+
+    Stats->u32Count++;
+    Stats->u32Last = u32Elapsed;
+    Stats->u64Total += u32Elapsed;
+    if( u32Elapsed < Stats->u32Min )
+    {
+        Stats->u32Min = u32Elapsed;
+    }
+    if( u32Elapsed > Stats->u32Max )
+    {
+        Stats->u32Max = u32Elapsed;
+    }
+    if( u32Latency < Stats->u32LatencyMin )
+    {
+        Stats->u32LatencyMin = u32Latency;
+    }
+    if( u32Latency > Stats->u32LatencyMax )
+    {
+        Stats->u32LatencyMax = u32Latency;
+    }
+}
+
+/*******************************************************************************/
+/**
+* \brief    Scheduler - end of the idle window when new work is dispatched. \n
+            A window left by a tick ends at that tick, a window left by an  \n
+            event ends now. With preemptive dispatch it ends now, less the \n
+            time taken by the task lists that preempted it.
+* \author   Abraham Tezmol
+* \param    void
+* \return   void
+* \todo     
+*/
+void vfnScheduler_IdleClose(void)
+{
+    uint32_t u32EndTime;
+
+    if( gu8Scheduler_IdleOpen != 0u )
+    {
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+        /* Windows span ticks, the task lists that preempted them are taken out */
+        u32EndTime = pfnScheduler_Clock() - ( gu32Scheduler_PreemptedTime - gu32Scheduler_IdlePreempted );
+#else
+        if( gu8Scheduler_IdleCounter != gu8Scheduler_Counter )
+        {
+            u32EndTime = gu32Scheduler_TickTime;
+        }
         else
         {
-            /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-            /*  2ms execution thread - used to derive two execution threads:                */
-            /*  a) 2ms group B thread (high priority tasks)                                 */
-            /*  b) 10ms thread (medium priority tasks)                                      */
-            /*  As any other thread on this scheduler, all tasks must be executed in <=500us*/
-            /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-            if( ( TaskScheduler_Task_ID_Activated == TASKS_2_MS_B )
-                 || ( TaskScheduler_Task_ID_Activated == TASKS_10_MS ) )
-            {
-                /* Make a copy of scheduled task ID */
-                TasksScheduler_Task_ID_Backup = TaskScheduler_Task_ID_Activated;
-
-                vfnScheduler_TaskStart (&TimeTriggeredTasks[TASKS_2_MS_B]);
-                if( TaskScheduler_Task_ID_Activated == TASKS_10_MS )
-                {
-                    vfnScheduler_TaskStart (&TimeTriggeredTasks[TASKS_10_MS]);
-                }
-                 /* Verify that thread execution took less than 500 us */
-                if( TasksScheduler_Task_ID_Backup == TaskScheduler_Task_ID_Activated )
-                {
-                    /* In case execution of all thread took less than 500us */
-                    TaskScheduler_Task_ID_Activated = TASK_NULL;
-                }
-                else
-                {
-                    gu8Scheduler_Status = TASK_SCHEDULER_OVERLOAD_2MS_B;
-                }
-            }
+            u32EndTime = pfnScheduler_Clock();
         }
-    }        
+#endif
+        IdleStats.u32Windows++;
+        IdleStats.u64IdleTime += u32EndTime - gu32Scheduler_IdleStart;
+        gu8Scheduler_IdleOpen = 0u;
+    }
 }
+#endif
 
 /*******************************************************************************/
 /**
 * \brief    Periodic Interrupt Timer Service routine.                            \n
             This interrupt is the core of the task scheduler.                   \n
             It is executed every 500us                                          \n
-            It defines 3 basic threads from which other 3 threads are derived:  \n
+            It partitions core execution time into time slices (500us each one).\n 
+            The task lists to be activated on each time slice are taken from    \n
+            the precomputed hyperperiod table "SchedulerSlotTable", built at    \n
+            compile time from the periods and offsets @ "app_scheduler_cfg.h".  \n
+            Default configuration keeps the original layout:                    \n
             a) 1ms thread (basic) ->  100ms thread (derived)                    \n
             b) 2ms A thread (basic)-> 50ms thread (derived)                     \n
             c) 2ms B thread (basic)-> 10ms thread (derived)                     \n
-            It partitions core execution time into time slices (500us each one).\n 
-            This arrangement assures core will have equal task loading across time.\n   
-            For more information on how time slice is assigned to each thread,  \n
-            refer to file "S12X Task Scheduler Layout.xls"
+            This arrangement assures core will have equal task loading across time.
 * \author   Abraham Tezmol
 * \param    void
 * \return   void
@@ -272,81 +956,142 @@ void vfnTask_Scheduler(void)
 
 void vfnScheduler_Callback(void)
 {
-    /*-- Update scheduler control variable --*/
-    gu8Scheduler_Counter++;
+    tSchedulerSlotMask SlotMask;
+    uint8_t u8TaskIndex;
+    uint16_t u16Ticks = 1u;
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    uint32_t u32TickTime;
 
-    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-    /*  1ms execution thread - used to derive two execution threads:                */
-    /*  a) 1ms thread (highest priority tasks)                                      */
-    /*  b) 100ms thread (lowest priority tasks)                                     */
-    /*  As any other thread on this scheduling scheme,                              */
-    /*  all tasks must be executed in <= 500us                                      */
-    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-    if( ( gu8Scheduler_Counter & 0x01u ) == 0x01u )
-    {
-        u8_100ms_Counter++;
-        /*-- Allow 100 ms periodic tasks to be executed --*/
-        if( u8_100ms_Counter >= 100u )
-        {
-            /* Indicate that Task is Ready to be executed */ 
-            vfnScheduler_TaskActivate(&TimeTriggeredTasks[TASKS_100_MS]);
-            u8_100ms_Counter       = 0u;
-        }
-        /*-- Allow 1 ms periodic tasks to be executed --*/
-        else
+    /* Time stamp taken before the counter moves, it closes idle windows */
+    if( pfnScheduler_Clock != NULL )
+    {
+        u32TickTime = pfnScheduler_Clock();
+        if( gu8Scheduler_Slept == 0u )
         {
-            vfnScheduler_TaskActivate(&TimeTriggeredTasks[TASKS_1_MS]);
+            gu32Scheduler_SlotLength = u32TickTime - gu32Scheduler_TickTime;
         }
+        gu8Scheduler_Slept = 0u;
+        gu32Scheduler_TickTime = u32TickTime;
     }
-    else
+#endif
+
+    /*-- Update scheduler control variables --*/
+    gu8Scheduler_Counter++;
+#if ( TASK_SCH_CFG_LOW_POWER == 2u )
+    /* Slots skipped by a stretched period are empty, only the slot index moves */
+    gu16Scheduler_Slot = (uint16_t)( ( gu16Scheduler_Slot + gu16Scheduler_Suppressed ) % TASK_SCH_HYPERPERIOD_TICKS );
+    u16Ticks += gu16Scheduler_Suppressed;
+    gu16Scheduler_Suppressed = 0u;
+#endif
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+    vfnScheduler_BgRelease( u16Ticks );
+#else
+    (void)u16Ticks;
+#endif
+    SlotMask = SchedulerSlotTable[gu16Scheduler_Slot];
+    gu16Scheduler_Slot++;
+    if( gu16Scheduler_Slot >= TASK_SCH_HYPERPERIOD_TICKS )
     {
-        /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-        /*  2ms execution thread - used to derive two execution threads:                */
-        /*  a) 2ms group A thread (high priority tasks)                                 */
-        /*  b) 50ms thread (second lowest priority tasks)                               */
-        /*  As any other thread on this scheduling scheme,                              */
-        /*  all tasks must be executed in <= 500us                                      */
-        /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-        if( ( gu8Scheduler_Counter & 0x02u ) == 0x02u )
+        gu16Scheduler_Slot = 0u;
+    }
+
+    if( SlotMask != 0u )
+    {
+        /* Indicate that Tasks are Ready to be executed */ 
+        for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
         {
-            u8_50ms_Counter++;
-            /*-- Allow 50 ms periodic tasks to be executed --*/
-            if( u8_50ms_Counter >= 25u )
+            if( ( SlotMask & ( (tSchedulerSlotMask)1u << u8TaskIndex ) ) != 0u )
             {
-                vfnScheduler_TaskActivate(&TimeTriggeredTasks[TASKS_50_MS]);
-                u8_50ms_Counter        = 0u;
-            }
-            /*-- Allow 2 ms group A periodic tasks to be executed --*/
-            else
-            {
-                vfnScheduler_TaskActivate(&TimeTriggeredTasks[TASKS_2_MS_A]);
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+                vfnScheduler_LevelActivate( u8TaskIndex );
+#else
+                vfnScheduler_TaskActivate(&TimeTriggeredTasks[u8TaskIndex]);
+#endif
             }
         }
-        else
+    }
+#if ( TASK_SCH_CFG_PREEMPTIVE == 0u )
+    /* Written also for an empty slot, so the task lists of a slot that overran
+       into it are not run a second time */
+    TaskScheduler_Slot_Activated = SlotMask;
+#endif
+}
+
+#if ( TASK_SCH_CFG_PREEMPTIVE == 1u )
+/*******************************************************************************/
+/**
+* \brief    Scheduler - activation of a time triggered task list on its     \n
+            preemption level. Called from the tick interrupt, which is      \n
+            above all levels. A task list still pending or running from its \n
+            previous activation reports an overload, it is then run again   \n
+            once the current execution completes.
+* \author   Abraham Tezmol
+* \param    u8TaskIndex - time triggered task to be activated
+* \return   void
+* \todo     
+*/
+void vfnScheduler_LevelActivate( uint8_t u8TaskIndex )
+{
+    tSchedulingTask * Task = &TimeTriggeredTasks[u8TaskIndex];
+    tSchedulerSlotMask TaskMask = (tSchedulerSlotMask)( 1u << u8TaskIndex );
+
+    if( ( Task->enTaskState != SUSPENDED ) || ( ( aScheduler_LevelReady[Task->u8Priority] & TaskMask ) != 0u ) )
+    {
+        gu8Scheduler_Status = TASK_SCHEDULER_OVERLOAD( u8TaskIndex );
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+        TaskStats[u8TaskIndex].u32Overruns++;
+#endif
+    }
+    vfnScheduler_TaskActivate( Task );
+    (void)__atomic_fetch_or( &aScheduler_LevelReady[Task->u8Priority], TaskMask, __ATOMIC_RELAXED );
+    vfnSwIrq_Trigger( Task->u8Priority );
+}
+
+/*******************************************************************************/
+/**
+* \brief    Scheduler - software interrupt handler of a preemption level.   \n
+            Runs the task lists ready on the level in table order, until    \n
+            none is left. Higher levels and the tick preempt it, lower      \n
+            levels and thread mode (events, background) resume afterwards.
+* \author   Abraham Tezmol
+* \param    u8Level - preemption level being served
+* \return   void
+* \todo     
+*/
+void vfnScheduler_LevelDispatch(uint8_t u8Level)
+{
+    tSchedulerSlotMask LevelMask;
+    uint8_t u8TaskIndex;
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    uint32_t u32StartTime = 0u;
+
+    if( pfnScheduler_Clock != NULL )
+    {
+        u32StartTime = pfnScheduler_Clock();
+    }
+    gu8Scheduler_LevelNesting++;
+#endif
+
+    LevelMask = __atomic_exchange_n( &aScheduler_LevelReady[u8Level], 0u, __ATOMIC_RELAXED );
+    while( LevelMask != 0u )
+    {
+        for( u8TaskIndex = 0u; u8TaskIndex < TASK_SCH_MAX_NUMBER_TIME_TASKS; u8TaskIndex++ )
         {
-            /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-            /*  2ms execution thread - used to derive two execution threads:                */
-            /*  a) 2ms group B thread (high priority tasks)                                 */
-            /*  b) 10ms thread (medium priority tasks)                                      */
-            /*  As any other thread on this scheduling scheme,                              */
-            /*  all tasks must be executed in <= 500us                                      */
-            /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-            if( ( gu8Scheduler_Counter & 0x03u ) == 0x00u )
+            if( ( LevelMask & ( (tSchedulerSlotMask)1u << u8TaskIndex ) ) != 0u )
             {
-                u8_10ms_Counter++;
-                /*-- Allow 10 ms periodic tasks to be executed --*/
-                if( u8_10ms_Counter >= 5u )
-                {
-                    vfnScheduler_TaskActivate(&TimeTriggeredTasks[TASKS_10_MS]);
-                    u8_10ms_Counter        = 0u;
-                }
-                /*-- Allow 2 ms group B periodic tasks to be executed --*/
-                else
-                {
-                    vfnScheduler_TaskActivate(&TimeTriggeredTasks[TASKS_2_MS_B]);
-                }
+                vfnScheduler_TaskStart (&TimeTriggeredTasks[u8TaskIndex]);
             }
         }
+        LevelMask = __atomic_exchange_n( &aScheduler_LevelReady[u8Level], 0u, __ATOMIC_RELAXED );
+    }
+#if ( TASK_SCH_CFG_PROFILING == 1u )
+    /* Outermost level only, nested levels are part of its time */
+    gu8Scheduler_LevelNesting--;
+    if( ( gu8Scheduler_LevelNesting == 0u ) && ( pfnScheduler_Clock != NULL ) )
+    {
+        gu32Scheduler_PreemptedTime += pfnScheduler_Clock() - u32StartTime;
     }
+#endif
 }
-/***************************************************************************************************/
+#endif
+/***************************************************************************************************/
\ No newline at end of file
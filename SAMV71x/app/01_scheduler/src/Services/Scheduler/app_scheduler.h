@@ -14,6 +14,8 @@
 
 #include "compiler.h"
 #include "typedefs.h"
+/** Time triggered task table configuration */
+#include "app_scheduler_cfg.h"
 
 /*****************************************************************************************************
 * Declaration of module wide TYPES
@@ -25,15 +27,16 @@ typedef enum
     RUNNING
 }tTaskStates;
 
-/* Task Scheduler Tasks IDs definitions */
+/* Task Scheduler Tasks IDs definitions: time triggered, event triggered, then background tasks */
+#define    TASK_SCH_CFG_ID( Arg, TaskId, TaskList, Priority, Period, Offset )    TaskId,
+#define    TASK_SCH_CFG_EVENT_ID( Arg, TaskId, TaskList, Priority )               TaskId,
+#define    TASK_SCH_CFG_BG_ID( Arg, TaskId, TaskList, Period )                    TaskId,
+
 typedef enum  
 {   
-    TASKS_1_MS,
-    TASKS_2_MS_A,
-    TASKS_2_MS_B,
-    TASKS_10_MS,
-    TASKS_50_MS,
-    TASKS_100_MS,
+    TASK_SCH_CFG_TIME_TASKS( TASK_SCH_CFG_ID, 0 )
+    TASK_SCH_CFG_EVENT_TASKS( TASK_SCH_CFG_EVENT_ID, 0 )
+    TASK_SCH_CFG_BACKGROUND_TASKS( TASK_SCH_CFG_BG_ID, 0 )
     TASK_NULL,
 }tSchedulerTasks_ID;
 
@@ -43,9 +46,53 @@ typedef struct
     tPtr_to_function       ptrTask;
     tTaskStates            enTaskState;
     uint8_t                u8Priority;
+    uint16_t               u16Period;
+    uint16_t               u16Offset;
     
 }tSchedulingTask;
 
+/* One chunk of a background task, returns TASK_SCH_BG_DONE or TASK_SCH_BG_PENDING */
+typedef uint8_t ( * tPtr_to_bg_chunk )( void );
+
+typedef struct 
+{
+    tSchedulerTasks_ID     TaskId;
+    tPtr_to_bg_chunk       ptrTask;
+    tTaskStates            enTaskState;       /* READY from activation to the end of the pass */
+    uint16_t               u16Period;         /* Activation period in ticks, 0 - activated by events only */
+    uint16_t               u16Countdown;      /* Ticks left to the next periodic activation */
+    uint32_t               u32Passes;         /* Number of completed passes */
+    uint32_t               u32Deferred;       /* Chunks held back as they would not fit before next tick */
+    
+}tSchedulerBgTask;
+
+/* Execution statistics of a task list, all times in profiling clock units */
+typedef struct
+{
+    uint32_t               u32Count;          /* Number of completed executions */
+    uint32_t               u32Last;           /* Last execution time */
+    uint32_t               u32Min;            /* Shortest execution time */
+    uint32_t               u32Max;            /* Longest execution time */
+    uint32_t               u32Avg;            /* Average execution time */
+    uint32_t               u32LatencyMin;     /* Shortest delay from activation to start */
+    uint32_t               u32LatencyMax;     /* Longest delay from activation to start */
+    uint32_t               u32Jitter;         /* Start jitter, u32LatencyMax - u32LatencyMin */
+    uint32_t               u32Overruns;       /* Number of overloaded slots owned by the task */
+    uint64_t               u64Total;          /* Accumulated execution time */
+    
+}tSchedulerTaskStats;
+
+/* Idle capacity left by time and event triggered tasks, all times in profiling clock units */
+typedef struct
+{
+    uint32_t               u32Windows;        /* Number of idle windows, from idle entry to next work */
+    uint64_t               u64IdleTime;       /* Accumulated length of the idle windows */
+    uint64_t               u64BackgroundTime; /* Part of the idle time consumed by background tasks */
+    uint32_t               u32Sleeps;         /* Number of core sleeps */
+    uint32_t               u32TicksSuppressed;/* Tick interrupts skipped over empty slots (wakeups avoided) */
+    
+}tSchedulerIdleStats;
+
 /*****************************************************************************************************
 * Definition of module wide MACROS / #DEFINE-CONSTANTS 
 *****************************************************************************************************/
@@ -60,13 +107,53 @@ typedef struct
 #define    TASK_SCHEDULER_OVERLOAD_2MS_B    0x04u
 #define    TASK_SCHEDULER_HALTED            0xAAu
 
-#define    TASK_SCH_MAX_NUMBER_TIME_TASKS   0x06u
-
-#define    TASK_SCHEDULER_BASE_FREQ		    2000
+/* Overload status reported when the slot owned by "TaskId" overruns its 500us time slice */
+#define    TASK_SCHEDULER_OVERLOAD( TaskId )    ( (uint8_t)( TASK_SCHEDULER_OVERLOAD_1MS + (uint8_t)(TaskId) ) )
+
+/* Background chunk results */
+#define    TASK_SCH_BG_PENDING              0u
+#define    TASK_SCH_BG_DONE                 1u
+
+/* Number of time triggered tasks (preprocessor usable) */
+#define    TASK_SCH_CFG_COUNT( Arg, TaskId, TaskList, Priority, Period, Offset )    + 1u
+#define    TASK_SCH_CFG_EVENT_COUNT( Arg, TaskId, TaskList, Priority )             + 1u
+#define    TASK_SCH_CFG_BG_COUNT( Arg, TaskId, TaskList, Period )                  + 1u
+#define    TASK_SCH_MAX_NUMBER_TIME_TASKS   ( 0u TASK_SCH_CFG_TIME_TASKS( TASK_SCH_CFG_COUNT, 0 ) )
+#define    TASK_SCH_MAX_NUMBER_EVENT_TASKS  ( 0u TASK_SCH_CFG_EVENT_TASKS( TASK_SCH_CFG_EVENT_COUNT, 0 ) )
+#define    TASK_SCH_MAX_NUMBER_BG_TASKS     ( 0u TASK_SCH_CFG_BACKGROUND_TASKS( TASK_SCH_CFG_BG_COUNT, 0 ) )
+#define    TASK_SCH_MAX_NUMBER_TASKS        ( TASK_SCH_MAX_NUMBER_TIME_TASKS + TASK_SCH_MAX_NUMBER_EVENT_TASKS \
+                                              + TASK_SCH_MAX_NUMBER_BG_TASKS )
+
+#if ( TASK_SCH_MAX_NUMBER_EVENT_TASKS > 32u )
+    #error "Too many event triggered tasks"
+#endif
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 32u )
+    #error "Too many background tasks"
+#endif
+
+/* Set of task lists activated within one slot, bit "n" standing for task ID "n" */
+#if ( TASK_SCH_MAX_NUMBER_TIME_TASKS <= 8u )
+typedef uint8_t     tSchedulerSlotMask;
+#elif ( TASK_SCH_MAX_NUMBER_TIME_TASKS <= 16u )
+typedef uint16_t    tSchedulerSlotMask;
+#elif ( TASK_SCH_MAX_NUMBER_TIME_TASKS <= 32u )
+typedef uint32_t    tSchedulerSlotMask;
+#else
+    #error "Too many time triggered tasks"
+#endif
 /*****************************************************************************************************
 * Definition of module wide VARIABLEs
 *****************************************************************************************************/
 extern tSchedulingTask TimeTriggeredTasks[TASK_SCH_MAX_NUMBER_TIME_TASKS];
+#if ( TASK_SCH_MAX_NUMBER_EVENT_TASKS > 0u )
+extern tSchedulingTask EventTriggeredTasks[TASK_SCH_MAX_NUMBER_EVENT_TASKS];
+#endif
+#if ( TASK_SCH_MAX_NUMBER_BG_TASKS > 0u )
+extern tSchedulerBgTask BackgroundTasks[TASK_SCH_MAX_NUMBER_BG_TASKS];
+#endif
+
+/* Precomputed hyperperiod slot table, generated from TASK_SCH_CFG_TIME_TASKS */
+extern const tSchedulerSlotMask SchedulerSlotTable[TASK_SCH_HYPERPERIOD_TICKS];
 
 /*****************************************************************************************************
 * Declaration of module wide FUNCTIONS
@@ -84,6 +171,21 @@ void vfnScheduler_Stop(void);
 /** Multi-thread round robin task scheduler */
 void vfnTask_Scheduler(void);
 
+/** Event triggered or background task activation, callable from any interrupt */
+void vfnScheduler_EventActivate(tSchedulerTasks_ID TaskId);
+
+/** Profiling time base selection, NULL disables time measurements */
+void vfnScheduler_SetProfilingClock(tPtr_to_clock ptrClock);
+
+/** Profiling statistics query of a given task list */
+uint8_t u8Scheduler_GetTaskStats(tSchedulerTasks_ID TaskId, tSchedulerTaskStats * Stats);
+
+/** Profiling statistics reset */
+void vfnScheduler_ResetTaskStats(void);
+
+/** Idle capacity statistics query */
+uint8_t u8Scheduler_GetIdleStats(tSchedulerIdleStats * Stats);
+
 /*******************************************************************************/
 
 #endif /* APP_SCHEDULER_H */
\ No newline at end of file
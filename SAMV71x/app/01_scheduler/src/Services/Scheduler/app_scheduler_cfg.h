@@ -0,0 +1,126 @@
+/*******************************************************************************/
+/**
+\file       app_scheduler_cfg.h
+\brief      Task scheduler configuration - time triggered task table
+\author     Abraham Tezmol
+\version    0.2
+\date       17/10/2026
+*/
+
+#ifndef APP_SCHEDULER_CFG_H        /*prevent duplicated includes*/
+#define APP_SCHEDULER_CFG_H
+
+/*-- Includes ----------------------------------------------------------------*/
+
+/*****************************************************************************************************
+* Definition of module wide MACROS / #DEFINE-CONSTANTS
+*****************************************************************************************************/
+
+/* The tick frequency, the hyperperiod and the time triggered task table may be replaced from the
+   build, e.g. by a host simulation scenario given with -include (see host/sch_cfg_250us.h) */
+
+/* Scheduler tick frequency in Hz, one time slice (slot) per tick -> 500us slots */
+#ifndef    TASK_SCHEDULER_BASE_FREQ
+#define    TASK_SCHEDULER_BASE_FREQ         2000
+#endif
+
+/* Length of the schedule in ticks (slots). Shall be a common multiple of all task periods. */
+#ifndef    TASK_SCH_HYPERPERIOD_TICKS
+#define    TASK_SCH_HYPERPERIOD_TICKS       200u
+#endif
+
+/* Maximum number of task lists allowed to be activated within the same slot */
+#define    TASK_SCH_MAX_TASKS_PER_SLOT      2u
+
+/* Execution time profiling of task lists (1 - enabled, 0 - disabled) */
+#define    TASK_SCH_CFG_PROFILING           1u
+
+/* Timeline trace of task list activation/start/end events (1 - enabled, 0 - disabled) */
+#define    TASK_SCH_CFG_TRACE               1u
+
+/* Idle behavior once all ready work is done, may be selected from the build:
+   0 - busy polling of the slot and event flags
+   1 - core sleep (WFI) until next interrupt
+   2 - core sleep, plus SysTick suppression across the empty slots ahead, up to the next periodic
+       background activation and never while a background pass is in progress
+   The DWT cycle counter stops while the core sleeps, idle statistics only cover awake time. */
+#ifndef    TASK_SCH_CFG_LOW_POWER
+#define    TASK_SCH_CFG_LOW_POWER           1u
+#endif
+
+/* Dispatch of time triggered tasks, may be selected from the build:
+   0 - cooperative, task lists run to completion from vfnTask_Scheduler in table order
+   1 - preemptive, each task list runs from the software interrupt of its priority level and
+       preempts task lists of lower levels; event and background tasks keep running from
+       vfnTask_Scheduler. An overload is reported when a task list is activated again before its
+       previous activation completed. Execution times include the time spent preempted. */
+#ifndef    TASK_SCH_CFG_PREEMPTIVE
+#define    TASK_SCH_CFG_PREEMPTIVE          0u
+#endif
+
+/* Number of preemption levels, time triggered task priorities shall be in 1 .. levels */
+#define    TASK_SCH_CFG_PREEMPT_LEVELS      5u
+
+/*----------------------------------------------------------------------------------------------------
+ Time triggered tasks table.
+ Each entry is expanded through X( Arg, TaskId, TaskList, Priority, Period, Offset ), where:
+   TaskId   - scheduler task identifier (becomes a tSchedulerTasks_ID value)
+   TaskList - function executed when the task is dispatched (see app_tasks.h)
+   Priority - entries shall be listed from highest to lowest priority. With
+              TASK_SCH_CFG_PREEMPTIVE it is the preemption level, task lists sharing a level do not
+              preempt each other.
+   Period   - activation period, in scheduler ticks (500us)
+   Offset   - activation phase within the period, in scheduler ticks (0 .. Period - 1)
+ A task list is activated on every tick "n" of the hyperperiod for which (n % Period) == Offset.
+ Slots are balanced by choosing the offsets; the slot table is generated from this table at compile
+ time and the build fails if any slot gets more than TASK_SCH_MAX_TASKS_PER_SLOT task lists.
+ Tasks sharing a slot are executed in table order, the first one being the slot owner which
+ reports TASK_SCHEDULER_OVERLOAD( TaskId ) on an overrun (cooperative dispatch).
+----------------------------------------------------------------------------------------------------*/
+#ifndef    TASK_SCH_CFG_TIME_TASKS
+/*                              TaskId        TaskList          Prio  Period  Offset */
+#define    TASK_SCH_CFG_TIME_TASKS( X, Arg )                                            \
+                             X( Arg, TASKS_1_MS,   TASKS_LIST_1MS,   5u,    2u,    1u  ) \
+                             X( Arg, TASKS_2_MS_A, TASKS_LIST_2MS_A, 4u,    4u,    2u  ) \
+                             X( Arg, TASKS_2_MS_B, TASKS_LIST_2MS_B, 4u,    4u,    0u  ) \
+                             X( Arg, TASKS_10_MS,  TASKS_LIST_10MS,  3u,   20u,    0u  ) \
+                             X( Arg, TASKS_50_MS,  TASKS_LIST_50MS,  2u,  100u,   98u  ) \
+                             X( Arg, TASKS_100_MS, TASKS_LIST_100MS, 1u,  200u,  199u  )
+#endif
+
+/*----------------------------------------------------------------------------------------------------
+ Event triggered tasks table (up to 32 entries).
+ Each entry is expanded through X( Arg, TaskId, TaskList, Priority ), where:
+   TaskId   - scheduler task identifier (becomes a tSchedulerTasks_ID value)
+   TaskList - function executed when the event is dispatched (see app_tasks.h)
+   Priority - informative priority, entries shall be listed from highest to lowest priority
+ Event tasks are activated from any context through vfnScheduler_EventActivate and run, one at a
+ time and highest priority first, whenever no time triggered slot is pending.
+----------------------------------------------------------------------------------------------------*/
+/*                               TaskId         TaskList           Prio */
+#define    TASK_SCH_CFG_EVENT_TASKS( X, Arg )                      \
+                             X( Arg, TASKS_EVENT_A, TASKS_LIST_EVENT_A, 1u  )
+
+/*----------------------------------------------------------------------------------------------------
+ Background tasks table.
+ Each entry is expanded through X( Arg, TaskId, TaskList, Period ), where:
+   TaskId   - scheduler task identifier (becomes a tSchedulerTasks_ID value)
+   TaskList - function executing one short chunk of a long running job (see app_tasks.h). It keeps
+              its own progress and returns TASK_SCH_BG_DONE when a complete pass has finished,
+              TASK_SCH_BG_PENDING otherwise.
+   Period   - activation period, in scheduler ticks (1 .. 65535), or 0 for a task only activated
+              through vfnScheduler_EventActivate
+ A pass starts on vfnScheduler_Init, then on every activation. Background tasks consume the time
+ left in each slot once time and event triggered tasks have been served, one chunk per call of
+ vfnTask_Scheduler in round robin order, and stay idle from the end of a pass to their next
+ activation. Activations received during a pass start one more pass once it ends. With cooperative
+ dispatch and a profiling clock set, a chunk is only started if its longest measured execution
+ fits before the next tick.
+----------------------------------------------------------------------------------------------------*/
+/*                                    TaskId             TaskList            Period */
+#define    TASK_SCH_CFG_BACKGROUND_TASKS( X, Arg )                                      \
+                             X( Arg, TASKS_BG_CHECKSUM, TASKS_LIST_BG_CHECKSUM, 200u  )
+
+/*******************************************************************************/
+
+#endif /* APP_SCHEDULER_CFG_H */
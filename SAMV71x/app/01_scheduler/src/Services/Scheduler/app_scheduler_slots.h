@@ -0,0 +1,83 @@
+/*******************************************************************************/
+/**
+\file       app_scheduler_slots.h
+\brief      Task scheduler - hyperperiod slot generator.
+            Expands TASK_SCH_SLOT_GEN( n ) once for every slot n = 0 .. TASK_SCH_HYPERPERIOD_TICKS - 1,
+            in ascending order. TASK_SCH_SLOT_GEN shall be defined by the includer.
+            This file is intentionally not protected against multiple inclusion.
+\author     Abraham Tezmol
+\version    0.1
+\date       17/10/2026
+*/
+
+/*-- Includes ----------------------------------------------------------------*/
+#include "app_scheduler_cfg.h"
+
+/*****************************************************************************************************
+* Definition of module wide MACROS / #DEFINE-CONSTANTS
+*****************************************************************************************************/
+
+#ifndef APP_SCHEDULER_SLOTS_H
+#define APP_SCHEDULER_SLOTS_H
+
+/* Largest hyperperiod supported by the generator */
+#define    TASK_SCH_MAX_HYPERPERIOD_TICKS   2047u
+
+/* Expansion of 2^k consecutive slots starting at slot "b" */
+#define    TASK_SCH_SLOTS_1( b )       TASK_SCH_SLOT_GEN( b )
+#define    TASK_SCH_SLOTS_2( b )       TASK_SCH_SLOTS_1( b )   TASK_SCH_SLOTS_1( (b) + 1u )
+#define    TASK_SCH_SLOTS_4( b )       TASK_SCH_SLOTS_2( b )   TASK_SCH_SLOTS_2( (b) + 2u )
+#define    TASK_SCH_SLOTS_8( b )       TASK_SCH_SLOTS_4( b )   TASK_SCH_SLOTS_4( (b) + 4u )
+#define    TASK_SCH_SLOTS_16( b )      TASK_SCH_SLOTS_8( b )   TASK_SCH_SLOTS_8( (b) + 8u )
+#define    TASK_SCH_SLOTS_32( b )      TASK_SCH_SLOTS_16( b )  TASK_SCH_SLOTS_16( (b) + 16u )
+#define    TASK_SCH_SLOTS_64( b )      TASK_SCH_SLOTS_32( b )  TASK_SCH_SLOTS_32( (b) + 32u )
+#define    TASK_SCH_SLOTS_128( b )     TASK_SCH_SLOTS_64( b )  TASK_SCH_SLOTS_64( (b) + 64u )
+#define    TASK_SCH_SLOTS_256( b )     TASK_SCH_SLOTS_128( b ) TASK_SCH_SLOTS_128( (b) + 128u )
+#define    TASK_SCH_SLOTS_512( b )     TASK_SCH_SLOTS_256( b ) TASK_SCH_SLOTS_256( (b) + 256u )
+#define    TASK_SCH_SLOTS_1024( b )    TASK_SCH_SLOTS_512( b ) TASK_SCH_SLOTS_512( (b) + 512u )
+
+#endif /* APP_SCHEDULER_SLOTS_H */
+
+#if ( TASK_SCH_HYPERPERIOD_TICKS == 0u ) || ( TASK_SCH_HYPERPERIOD_TICKS > TASK_SCH_MAX_HYPERPERIOD_TICKS )
+    #error "TASK_SCH_HYPERPERIOD_TICKS out of range"
+#endif
+
+/*----------------------------------------------------------------------------------------------------
+ The hyperperiod is decomposed in powers of two, lowest bit first, so slot numbers come out in
+ ascending order: the block for bit 2^k starts right after all the lower bits of the hyperperiod.
+----------------------------------------------------------------------------------------------------*/
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x001u )
+    TASK_SCH_SLOTS_1( 0u )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x002u )
+    TASK_SCH_SLOTS_2( TASK_SCH_HYPERPERIOD_TICKS & 0x001u )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x004u )
+    TASK_SCH_SLOTS_4( TASK_SCH_HYPERPERIOD_TICKS & 0x003u )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x008u )
+    TASK_SCH_SLOTS_8( TASK_SCH_HYPERPERIOD_TICKS & 0x007u )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x010u )
+    TASK_SCH_SLOTS_16( TASK_SCH_HYPERPERIOD_TICKS & 0x00Fu )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x020u )
+    TASK_SCH_SLOTS_32( TASK_SCH_HYPERPERIOD_TICKS & 0x01Fu )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x040u )
+    TASK_SCH_SLOTS_64( TASK_SCH_HYPERPERIOD_TICKS & 0x03Fu )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x080u )
+    TASK_SCH_SLOTS_128( TASK_SCH_HYPERPERIOD_TICKS & 0x07Fu )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x100u )
+    TASK_SCH_SLOTS_256( TASK_SCH_HYPERPERIOD_TICKS & 0x0FFu )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x200u )
+    TASK_SCH_SLOTS_512( TASK_SCH_HYPERPERIOD_TICKS & 0x1FFu )
+#endif
+#if ( TASK_SCH_HYPERPERIOD_TICKS & 0x400u )
+    TASK_SCH_SLOTS_1024( TASK_SCH_HYPERPERIOD_TICKS & 0x3FFu )
+#endif
+
+/*******************************************************************************/
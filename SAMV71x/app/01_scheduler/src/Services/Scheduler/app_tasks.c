@@ -14,23 +14,44 @@
 
 /** Scheduler function prototypes definitions */
 #include    "app_tasks.h"
+/** Scheduler slot table and background chunk results */
+#include    "app_scheduler.h"
+/** Signals exchanged between task lists */
+#include    "sig_buffer.h"
 
 /*****************************************************************************************************
 * Definition of  VARIABLEs - 
 *****************************************************************************************************/
 
+/* Schedule integrity check - running Fletcher sums and result of the last complete pass */
+uint16_t gu16Tasks_ChecksumIndex;
+uint32_t gu32Tasks_ChecksumSum1;
+uint32_t gu32Tasks_ChecksumSum2;
+uint32_t gu32Tasks_ScheduleChecksum;
+
+/* Executions of the 1ms list, published to slower lists, and last value seen @ 100ms */
+uint32_t gu32Tasks_Counter1ms;
+uint32_t gu32Tasks_Counter1msSnapshot;
+
 
 /*****************************************************************************************************
 * Definition of module wide (CONST-) CONSTANTs 
 *****************************************************************************************************/
 
+/* Slot table entries verified per background chunk */
+#define    TASKS_BG_CHECKSUM_CHUNK      16u
+
 /*****************************************************************************************************
 * Code of module wide FUNCTIONS
 *****************************************************************************************************/
 
 /* List of tasks to be executed @ 1ms */
 void TASKS_LIST_1MS( void )
-{;}
+{
+    gu32Tasks_Counter1ms++;
+    *SIG_WRITE_BEGIN( SIG_COUNTER_1MS ) = gu32Tasks_Counter1ms;
+    vfnSigBuf_WriteEnd( SIG_COUNTER_1MS );
+}
 
 /* List of tasks to be executed @ 2ms, first group */
 void TASKS_LIST_2MS_A(void)
@@ -49,6 +70,44 @@ void TASKS_LIST_50MS( void )
 {;}
 /* List of tasks to be executed @ 100ms */
 void TASKS_LIST_100MS( void )
+{
+    const tSig_SIG_COUNTER_1MS * Counter;
+    uint32_t u32Seq;
+    uint32_t u32Value;
+
+    Counter = SIG_READ_BEGIN( SIG_COUNTER_1MS, &u32Seq );
+    u32Value = *Counter;
+    if( u8SigBuf_ReadEnd( SIG_COUNTER_1MS, u32Seq ) != 0u )
+    {
+        gu32Tasks_Counter1msSnapshot = u32Value;
+    }
+}
+/* List of tasks to be executed on event A */
+void TASKS_LIST_EVENT_A( void )
 {;}
+/* Background integrity check of the schedule, resumed on every chunk */
+uint8_t TASKS_LIST_BG_CHECKSUM( void )
+{
+    uint16_t u16Last = gu16Tasks_ChecksumIndex + TASKS_BG_CHECKSUM_CHUNK;
+
+    if( u16Last > TASK_SCH_HYPERPERIOD_TICKS )
+    {
+        u16Last = TASK_SCH_HYPERPERIOD_TICKS;
+    }
+    for( ; gu16Tasks_ChecksumIndex < u16Last; gu16Tasks_ChecksumIndex++ )
+    {
+        gu32Tasks_ChecksumSum1 = ( gu32Tasks_ChecksumSum1 + SchedulerSlotTable[gu16Tasks_ChecksumIndex] ) % 65535u;
+        gu32Tasks_ChecksumSum2 = ( gu32Tasks_ChecksumSum2 + gu32Tasks_ChecksumSum1 ) % 65535u;
+    }
+    if( gu16Tasks_ChecksumIndex < TASK_SCH_HYPERPERIOD_TICKS )
+    {
+        return TASK_SCH_BG_PENDING;
+    }
+    gu32Tasks_ScheduleChecksum = ( gu32Tasks_ChecksumSum2 << 16 ) | gu32Tasks_ChecksumSum1;
+    gu16Tasks_ChecksumIndex = 0u;
+    gu32Tasks_ChecksumSum1  = 0u;
+    gu32Tasks_ChecksumSum2  = 0u;
+    return TASK_SCH_BG_DONE;
+}
 
 
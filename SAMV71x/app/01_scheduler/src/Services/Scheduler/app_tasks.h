@@ -49,5 +49,11 @@ void TASKS_LIST_50MS( void );
 /* List of tasks to be executed @ 100ms */
 void TASKS_LIST_100MS( void );
 
+/* List of tasks to be executed on event A */
+void TASKS_LIST_EVENT_A( void );
+
+/* Background chunk: integrity check of the schedule, returns TASK_SCH_BG_DONE after each pass */
+uint8_t TASKS_LIST_BG_CHECKSUM( void );
+
 /*============================================================================*/
 #endif /*__APP_TASKS */
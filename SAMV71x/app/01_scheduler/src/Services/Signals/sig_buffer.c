@@ -0,0 +1,175 @@
+/*******************************************************************************/
+/**
+\file       sig_buffer.c
+\brief      Signal exchange - lock-free multi-buffered snapshots.
+            Publication "n" is written into buffer n & ( Buffers - 1 ), the
+            number of buffers being a power of two, so that consecutive
+            publications use consecutive buffers also across the wrap of the
+            sequence counter. Buffer of publication "s" is only reused when
+            the writer starts publication s + Buffers, i.e. after publication
+            s + Buffers - 1 was completed, so a snapshot taken at "s" is valid
+            while the sequence counter has not gone beyond s + Buffers - 2.
+            Single writer per signal.
+\author     Abraham Tezmol
+\version    0.1
+\date       17/10/2026
+*/
+
+/** Signal exchange definitions */
+#include "sig_buffer.h"
+#include <string.h>
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs - 
+*****************************************************************************************************/
+
+/* Buffers of each signal */
+#define    SIG_CFG_STORAGE( Arg, SignalId, Type, Buffers )   tSig_##SignalId SigBuf_##SignalId[Buffers];
+
+SIG_CFG_SIGNALS( SIG_CFG_STORAGE, 0 )
+
+#define    SIG_CFG_ENTRY( Arg, SignalId, Type, Buffers )     \
+                { 0u, (uint16_t)sizeof(Type), (uint8_t)(Buffers), (uint8_t *)SigBuf_##SignalId },
+
+tSigBuf SigBufTable[] =
+{
+    SIG_CFG_SIGNALS( SIG_CFG_ENTRY, 0 )
+};
+
+/*****************************************************************************************************
+* Definition of module wide (CONST-) CONSTANTs 
+*****************************************************************************************************/
+
+#define    SIG_CFG_CHECK( Arg, SignalId, Type, Buffers )                                       \
+                typedef char SignalId##_shall_use_a_power_of_2_buffers                         \
+                    [ ( ( (Buffers) >= 2u ) && ( (Buffers) <= 128u )                           \
+                        && ( ( (Buffers) & ( (Buffers) - 1u ) ) == 0u ) ) ? 1 : -1 ];           \
+                typedef char SignalId##_too_large                                              \
+                    [ ( sizeof(Type) <= 0xFFFFu ) ? 1 : -1 ];
+
+SIG_CFG_SIGNALS( SIG_CFG_CHECK, 0 )
+
+/*****************************************************************************************************
+* Code of public FUNCTIONS
+*****************************************************************************************************/
+
+/****************************************************************************************************/
+/**
+* \brief    Signal exchange - Initialization of a signal, to be called before the scheduler starts
+* \author   Abraham Tezmol
+* \param    SignalId - signal to be initialized
+* \param    pvInit   - initial value, NULL for all zeroes
+* \return   void
+* \todo     
+*/
+void vfnSigBuf_Init(tSigBuf_ID SignalId, const void * pvInit)
+{
+    tSigBuf * Signal = &SigBufTable[SignalId];
+
+    Signal->u32Seq = 0u;
+    if( pvInit != NULL )
+    {
+        memcpy(Signal->pu8Data, pvInit, Signal->u16Size);
+    }
+    else
+    {
+        memset(Signal->pu8Data, 0, Signal->u16Size);
+    }
+}
+
+/****************************************************************************************************/
+/**
+* \brief    Signal exchange - Writer, buffer of next publication. Contents are not defined,
+*           the writer shall fill every field before vfnSigBuf_WriteEnd.
+* \author   Abraham Tezmol
+* \param    SignalId - signal to be written
+* \return   void * --> buffer to be filled
+* \todo     
+*/
+void * pvSigBuf_WriteBegin(tSigBuf_ID SignalId)
+{
+    tSigBuf * Signal = &SigBufTable[SignalId];
+
+    return &Signal->pu8Data[ ( ( Signal->u32Seq + 1u ) & (uint32_t)( Signal->u8Buffers - 1u ) ) * Signal->u16Size ];
+}
+
+/****************************************************************************************************/
+/**
+* \brief    Signal exchange - Writer, publication. Buffer contents are made visible before
+*           the sequence counter moves (release).
+* \author   Abraham Tezmol
+* \param    SignalId - signal written
+* \return   void
+* \todo     
+*/
+void vfnSigBuf_WriteEnd(tSigBuf_ID SignalId)
+{
+    tSigBuf * Signal = &SigBufTable[SignalId];
+
+    __atomic_store_n( &Signal->u32Seq, Signal->u32Seq + 1u, __ATOMIC_RELEASE );
+}
+
+/****************************************************************************************************/
+/**
+* \brief    Signal exchange - Zero copy reader, last published buffer. The snapshot shall be
+*           validated with u8SigBuf_ReadEnd once used.
+* \author   Abraham Tezmol
+* \param    SignalId - signal to be read
+* \param    pu32Seq  - sequence number of the snapshot, for u8SigBuf_ReadEnd
+* \return   const void * --> last published buffer
+* \todo     
+*/
+const void * pvSigBuf_ReadBegin(tSigBuf_ID SignalId, uint32_t * pu32Seq)
+{
+    tSigBuf * Signal = &SigBufTable[SignalId];
+    uint32_t u32Seq = __atomic_load_n( &Signal->u32Seq, __ATOMIC_ACQUIRE );
+
+    *pu32Seq = u32Seq;
+    return &Signal->pu8Data[ ( u32Seq & (uint32_t)( Signal->u8Buffers - 1u ) ) * Signal->u16Size ];
+}
+
+/****************************************************************************************************/
+/**
+* \brief    Signal exchange - Zero copy reader, validation of a snapshot
+* \author   Abraham Tezmol
+* \param    SignalId - signal read
+* \param    u32Seq   - sequence number given by pvSigBuf_ReadBegin
+* \return   uint8_t --> 1 - snapshot consistent, 0 - buffer reused by the writer meanwhile
+* \todo     
+*/
+uint8_t u8SigBuf_ReadEnd(tSigBuf_ID SignalId, uint32_t u32Seq)
+{
+    tSigBuf * Signal = &SigBufTable[SignalId];
+
+    /* Reads of the snapshot complete before the counter is checked again */
+    __atomic_thread_fence( __ATOMIC_ACQUIRE );
+    return ( ( Signal->u32Seq - u32Seq ) <= (uint32_t)( Signal->u8Buffers - 2u ) ) ? 1u : 0u;
+}
+
+/****************************************************************************************************/
+/**
+* \brief    Signal exchange - Copying reader, for readers that may be preempted by the writer
+*           more often than the number of buffers allows
+* \author   Abraham Tezmol
+* \param    SignalId - signal to be read
+* \param    pvDest   - destination of the copy
+* \return   uint8_t --> 1 - consistent copy, 0 - writer too fast, pvDest contents not defined
+* \todo     
+*/
+uint8_t u8SigBuf_Read(tSigBuf_ID SignalId, void * pvDest)
+{
+    const void * pvSnapshot;
+    uint32_t u32Seq;
+    uint8_t u8Retry;
+
+    for( u8Retry = 0u; u8Retry < SIG_BUF_READ_RETRIES; u8Retry++ )
+    {
+        pvSnapshot = pvSigBuf_ReadBegin( SignalId, &u32Seq );
+        memcpy( pvDest, pvSnapshot, SigBufTable[SignalId].u16Size );
+        if( u8SigBuf_ReadEnd( SignalId, u32Seq ) != 0u )
+        {
+            return 1u;
+        }
+    }
+    return 0u;
+}
@@ -0,0 +1,88 @@
+/*******************************************************************************/
+/**
+\file       sig_buffer.h
+\brief      Signal exchange - lock-free multi-buffered snapshots between task lists
+            running at different rates.
+            A writer fills the next free buffer in place and publishes it by incrementing
+            the signal sequence counter; a reader takes a pointer to the last published
+            buffer together with its sequence number and, once done, validates that the
+            writer did not reuse that buffer meanwhile. Neither side disables interrupts.
+\author     Abraham Tezmol
+\version    0.1
+\date       17/10/2026
+*/
+
+#ifndef SIG_BUFFER_H        /*prevent duplicated includes*/
+#define SIG_BUFFER_H
+
+/*-- Includes ----------------------------------------------------------------*/
+
+#include "compiler.h"
+#include "typedefs.h"
+/** Signals configuration */
+#include "sig_buffer_cfg.h"
+
+/*****************************************************************************************************
+* Declaration of module wide TYPES
+*****************************************************************************************************/
+
+/* Signal IDs */
+#define    SIG_CFG_ID( Arg, SignalId, Type, Buffers )       SignalId,
+
+typedef enum
+{
+    SIG_CFG_SIGNALS( SIG_CFG_ID, 0 )
+    SIG_NULL
+}tSigBuf_ID;
+
+/* Signal data types, tSig_<SignalId> */
+#define    SIG_CFG_TYPE( Arg, SignalId, Type, Buffers )     typedef Type tSig_##SignalId;
+
+SIG_CFG_SIGNALS( SIG_CFG_TYPE, 0 )
+
+typedef struct
+{
+    volatile uint32_t      u32Seq;            /* Number of publications, last one in buffer u32Seq & ( u8Buffers - 1 ) */
+    uint16_t               u16Size;           /* Size of one buffer, in bytes */
+    uint8_t                u8Buffers;         /* Number of buffers */
+    uint8_t *              pu8Data;           /* First buffer */
+}tSigBuf;
+
+/*****************************************************************************************************
+* Definition of module wide MACROS / #DEFINE-CONSTANTS
+*****************************************************************************************************/
+
+/* Typed access to the buffers of a signal */
+#define    SIG_WRITE_BEGIN( SignalId )              ( (tSig_##SignalId *)pvSigBuf_WriteBegin( SignalId ) )
+#define    SIG_READ_BEGIN( SignalId, pu32Seq )      ( (const tSig_##SignalId *)pvSigBuf_ReadBegin( SignalId, pu32Seq ) )
+
+/*****************************************************************************************************
+* Definition of module wide VARIABLEs
+*****************************************************************************************************/
+extern tSigBuf SigBufTable[];
+
+/*****************************************************************************************************
+* Declaration of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/** Signal initialization, publishes the given initial value (NULL - zeroes) */
+void vfnSigBuf_Init(tSigBuf_ID SignalId, const void * pvInit);
+
+/** Writer - buffer to be filled for next publication */
+void * pvSigBuf_WriteBegin(tSigBuf_ID SignalId);
+
+/** Writer - publication of the buffer given by pvSigBuf_WriteBegin */
+void vfnSigBuf_WriteEnd(tSigBuf_ID SignalId);
+
+/** Zero copy reader - last published buffer and its sequence number */
+const void * pvSigBuf_ReadBegin(tSigBuf_ID SignalId, uint32_t * pu32Seq);
+
+/** Zero copy reader - validation of a snapshot, 1 - consistent, 0 - overwritten, read again */
+uint8_t u8SigBuf_ReadEnd(tSigBuf_ID SignalId, uint32_t u32Seq);
+
+/** Copying reader, retried up to SIG_BUF_READ_RETRIES times, 1 - consistent copy, 0 - failed */
+uint8_t u8SigBuf_Read(tSigBuf_ID SignalId, void * pvDest);
+
+/*******************************************************************************/
+
+#endif /* SIG_BUFFER_H */
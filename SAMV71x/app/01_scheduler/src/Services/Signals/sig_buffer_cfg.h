@@ -0,0 +1,39 @@
+/*******************************************************************************/
+/**
+\file       sig_buffer_cfg.h
+\brief      Signal exchange configuration - signals shared between task lists
+\author     Abraham Tezmol
+\version    0.1
+\date       17/10/2026
+*/
+
+#ifndef SIG_BUFFER_CFG_H        /*prevent duplicated includes*/
+#define SIG_BUFFER_CFG_H
+
+/*-- Includes ----------------------------------------------------------------*/
+
+/*****************************************************************************************************
+* Definition of module wide MACROS / #DEFINE-CONSTANTS
+*****************************************************************************************************/
+
+/* Maximum number of attempts of a copying read before giving up */
+#define    SIG_BUF_READ_RETRIES             4u
+
+/*----------------------------------------------------------------------------------------------------
+ Signals table.
+ Each entry is expanded through X( Arg, SignalId, Type, Buffers ), where:
+   SignalId - signal identifier (becomes a tSigBuf_ID value and the tSig_<SignalId> type)
+   Type     - data type of the signal, any copyable type (structure, array wrapper, scalar)
+   Buffers  - number of buffers, a power of two so the buffer index does not jump when the
+              sequence counter wraps: 2 (double buffer) or 4 (quad buffer) in general
+ Each signal has a single writer. A zero copy reader may be preempted by Buffers - 2 publications
+ of its writer and still get a consistent snapshot: double buffers suit readers that are never
+ preempted by the writer, quad buffers readers preempted by a faster writer.
+----------------------------------------------------------------------------------------------------*/
+/*                               SignalId            Type       Buffers */
+#define    SIG_CFG_SIGNALS( X, Arg )                                     \
+                             X( Arg, SIG_COUNTER_1MS,  uint32_t,  4u )
+
+/*******************************************************************************/
+
+#endif /* SIG_BUFFER_CFG_H */
@@ -0,0 +1,88 @@
+/*******************************************************************************/
+/**
+\file       sch_trace.c
+\brief      Scheduler timeline trace - lock-free event ring buffer.
+            Entries are reserved with an atomic increment of the head counter
+            (LDREX/STREX on target), so task level and interrupt level writers
+            never block each other nor disable interrupts.
+\author     Abraham Tezmol
+\version    0.1
+\date       17/10/2026
+*/
+
+/** Trace definitions */
+#include "sch_trace.h"
+
+/*****************************************************************************************************
+* Definition of  VARIABLEs - 
+*****************************************************************************************************/
+
+tSchTraceBuffer SchTrace;
+
+/* Time stamp source, events are recorded with time 0 while NULL */
+tPtr_to_clock pfnSchTrace_Clock = (tPtr_to_clock)NULL;
+
+/*****************************************************************************************************
+* Definition of module wide (CONST-) CONSTANTs 
+*****************************************************************************************************/
+
+typedef char SCH_TRACE_EVENTS_shall_be_power_of_two[ ( ( SCH_TRACE_EVENTS & ( SCH_TRACE_EVENTS - 1u ) ) == 0u ) ? 1 : -1 ];
+
+/*****************************************************************************************************
+* Code of public FUNCTIONS
+*****************************************************************************************************/
+
+/****************************************************************************************************/
+/**
+* \brief    Trace - Initialization
+* \author   Abraham Tezmol
+* \param    ptrClock   - free running counter read function used for time stamps
+* \param    u32ClockHz - frequency of ptrClock, stored for the host decoder
+* \return   void
+* \todo     
+*/
+void vfnSchTrace_Init(tPtr_to_clock ptrClock, uint32_t u32ClockHz)
+{
+    uint32_t u32Index;
+
+    pfnSchTrace_Clock    = ptrClock;
+    SchTrace.u32Magic    = SCH_TRACE_MAGIC;
+    SchTrace.u16Version  = SCH_TRACE_VERSION;
+    SchTrace.u16Capacity = (uint16_t)SCH_TRACE_EVENTS;
+    SchTrace.u32ClockHz  = u32ClockHz;
+    SchTrace.u32Head     = 0u;
+    for( u32Index = 0u; u32Index < SCH_TRACE_EVENTS; u32Index++ )
+    {
+        /* Sequence of an empty entry never matches its position */
+        SchTrace.Events[u32Index].u16Seq = (uint16_t)( u32Index + 1u );
+    }
+}
+
+/****************************************************************************************************/
+/**
+* \brief    Trace - record one event. Oldest events are overwritten.
+* \author   Abraham Tezmol
+* \param    u8Event  - event type, SCH_TRACE_EVT_xx
+* \param    u8TaskId - task originating the event
+* \return   void
+* \todo     
+*/
+void vfnSchTrace_Record(uint8_t u8Event, uint8_t u8TaskId)
+{
+    tSchTraceEvent * Event;
+    uint32_t u32Time = 0u;
+    uint32_t u32Index;
+
+    if( pfnSchTrace_Clock != NULL )
+    {
+        u32Time = pfnSchTrace_Clock();
+    }
+    u32Index = __atomic_fetch_add( &SchTrace.u32Head, 1u, __ATOMIC_RELAXED );
+    Event = &SchTrace.Events[u32Index & ( SCH_TRACE_EVENTS - 1u )];
+    Event->u32Time  = u32Time;
+    Event->u8Event  = u8Event;
+    Event->u8TaskId = u8TaskId;
+    Event->u16Seq   = (uint16_t)u32Index;
+}
+
+/*******************************************************************************/
@@ -0,0 +1,83 @@
+/*******************************************************************************/
+/**
+\file       sch_trace.h
+\brief      Scheduler timeline trace - event ring buffer definitions
+\author     Abraham Tezmol
+\version    0.1
+\date       17/10/2026
+*/
+
+#ifndef SCH_TRACE_H        /*prevent duplicated includes*/
+#define SCH_TRACE_H
+
+/*-- Includes ----------------------------------------------------------------*/
+
+#include "compiler.h"
+#include "typedefs.h"
+/** Trace enable configuration */
+#include "app_scheduler_cfg.h"
+
+/*****************************************************************************************************
+* Definition of module wide MACROS / #DEFINE-CONSTANTS
+*****************************************************************************************************/
+
+/* Number of events kept in the ring buffer, shall be a power of two */
+#define    SCH_TRACE_EVENTS                 256u
+
+/* Buffer identification for host side decoding ("STRC") */
+#define    SCH_TRACE_MAGIC                  0x43525453u
+#define    SCH_TRACE_VERSION                1u
+
+/* Trace event types */
+#define    SCH_TRACE_EVT_ACTIVATE           0x00u
+#define    SCH_TRACE_EVT_START              0x01u
+#define    SCH_TRACE_EVT_END                0x02u
+
+/* Scheduler instrumentation hook, compiled out when trace is disabled */
+#if ( TASK_SCH_CFG_TRACE == 1u )
+    #define    SCH_TRACE( Event, TaskId )   vfnSchTrace_Record( (uint8_t)(Event), (uint8_t)(TaskId) )
+#else
+    #define    SCH_TRACE( Event, TaskId )
+#endif
+
+/*****************************************************************************************************
+* Declaration of module wide TYPES
+*****************************************************************************************************/
+
+typedef struct
+{
+    uint32_t               u32Time;           /* Trace clock time stamp */
+    uint8_t                u8Event;           /* SCH_TRACE_EVT_xx */
+    uint8_t                u8TaskId;          /* Task originating the event */
+    uint16_t               u16Seq;            /* Low bits of event number, detects stale entries */
+}tSchTraceEvent;
+
+/* Trace buffer, dumped as is (little endian) for host side decoding */
+typedef struct
+{
+    uint32_t               u32Magic;
+    uint16_t               u16Version;
+    uint16_t               u16Capacity;       /* Number of entries in Events */
+    uint32_t               u32ClockHz;        /* Trace clock frequency */
+    volatile uint32_t      u32Head;           /* Number of events ever recorded */
+    tSchTraceEvent         Events[SCH_TRACE_EVENTS];
+}tSchTraceBuffer;
+
+/*****************************************************************************************************
+* Definition of module wide VARIABLEs
+*****************************************************************************************************/
+extern tSchTraceBuffer SchTrace;
+
+/*****************************************************************************************************
+* Declaration of module wide FUNCTIONS
+*****************************************************************************************************/
+
+/** Trace initialization, selects time stamp source and clears the buffer */
+void vfnSchTrace_Init(tPtr_to_clock ptrClock, uint32_t u32ClockHz);
+
+/** Trace event recording, safe from task and interrupt context */
+void vfnSchTrace_Record(uint8_t u8Event, uint8_t u8TaskId);
+
+/*******************************************************************************/
+
+#endif /* SCH_TRACE_H */
@@ -21,6 +21,10 @@
 #include    "app_scheduler.h"
 /** LED control definitions */ 
 #include    "led_ctrl.h"
+/** Cycle counter definitions */
+#include    "dwt.h"
+/** Scheduler timeline trace definitions */
+#include    "sch_trace.h"
 
 /*~~~~~~  Local definitions ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -49,6 +53,10 @@ extern int main( void )
 	vfnLedCtrl_Configure(); 
 	/* Configure Non-preemtive scheduler */
 	vfnScheduler_Init();
+	/* Measure task lists execution time in core cycles */
+	vfnDwt_Init();
+	vfnScheduler_SetProfilingClock(u32Dwt_GetCycles);
+	vfnSchTrace_Init(u32Dwt_GetCycles, SystemCoreClock);
 	/* Start scheduler */
 	vfnScheduler_Start();
 	
@@ -0,0 +1,193 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Application specific definitions for the Linux host build of the full demo,
+ * see ../src/FreeRTOSConfig.h for the target build.
+ *
+ * The POSIX port runs each task on a host thread, stack sizes are given in
+ * words of the kernel allocated stack, which only holds the port data of the
+ * task (the thread stack is configPOSIX_THREAD_STACK_SIZE bytes).
+ *
+ * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
+ * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.
+ *
+ * See http://www.freertos.org/a00110.html.
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION					1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION	1
+#define configUSE_QUEUE_SETS					1
+#define configUSE_IDLE_HOOK						0
+#define configUSE_TICK_HOOK						1
+#define configCPU_CLOCK_HZ						( 1000000UL )
+#define configTICK_RATE_HZ						( 1000 )
+#define configMAX_PRIORITIES					( 5 )
+#define configMINIMAL_STACK_SIZE				( ( unsigned short ) 130 )
+#define configTOTAL_HEAP_SIZE					( ( size_t ) ( 256 * 1024 ) )
+#define configMAX_TASK_NAME_LEN					( 10 )
+#define configUSE_TRACE_FACILITY				1
+#define configUSE_16_BIT_TICKS					0
+#define configIDLE_SHOULD_YIELD					1
+#define configUSE_MUTEXES						1
+#define configQUEUE_REGISTRY_SIZE				8
+#define configCHECK_FOR_STACK_OVERFLOW			0
+#define configUSE_RECURSIVE_MUTEXES				1
+#define configUSE_MALLOC_FAILED_HOOK			1
+#define configUSE_APPLICATION_TASK_TAG			0
+#define configUSE_COUNTING_SEMAPHORES			1
+#define configUSE_TICKLESS_IDLE					0
+
+/* Run time stats gathering definitions, the POSIX port counts microseconds
+since the scheduler was started.  The CPU loads of cpu_load.c are measured with
+that counter, the tick hook being accounted as an interrupt (see main_host.c),
+so the task run time counters are clocked by ulCpuLoadGetTaskTime().  They are
+left out of the kernel benchmark, which times the context switch without
+them unless built with -DconfigGENERATE_RUN_TIME_STATS=1. */
+#ifndef configGENERATE_RUN_TIME_STATS
+	#if( mainCREATE_KERNEL_BENCHMARK_ONLY == 1 )
+		#define configGENERATE_RUN_TIME_STATS	0
+	#else
+		#define configGENERATE_RUN_TIME_STATS	1
+	#endif
+#endif
+#define configUSE_CPU_LOAD				configGENERATE_RUN_TIME_STATS
+#define configCPU_LOAD_MAX_TASKS		96
+#define configCPU_LOAD_COUNTER()		( ( uint32_t ) ulPortGetRunTime() )
+uint32_t ulCpuLoadGetTaskTime( void );
+#define portGET_RUN_TIME_COUNTER_VALUE()	ulCpuLoadGetTaskTime()
+
+/* Kernel event recorder (trace_recorder.c), built with
+-DconfigUSE_TRACE_RECORDER=1.  The events are time stamped with the host
+monotonic clock in nanoseconds and saved to a file at the end of the run, see
+main_host.c. */
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER		0
+#endif
+#define configTRACE_RECORDER_TIMESTAMP()	ulBenchTimestamp()
+#define configTRACE_RECORDER_TIMESTAMP_HZ	( 1000000000UL )
+#define configTRACE_RECORDER_EVENTS			( 65536 )
+#define configTRACE_RECORDER_NAMES			( 128 )
+
+#define configUSE_STATS_FORMATTING_FUNCTIONS	1
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES 			0
+#define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+
+/* Software timer definitions. */
+#define configUSE_TIMERS				1
+#define configTIMER_TASK_PRIORITY		( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH		5
+#define configTIMER_TASK_STACK_DEPTH	( configMINIMAL_STACK_SIZE * 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet		1
+#define INCLUDE_uxTaskPriorityGet		1
+#define INCLUDE_vTaskDelete				1
+#define INCLUDE_vTaskCleanUpResources	1
+#define INCLUDE_vTaskSuspend			1
+#define INCLUDE_vTaskDelayUntil			1
+#define INCLUDE_vTaskDelay				1
+#define INCLUDE_eTaskGetState			1
+#define INCLUDE_xTimerPendFunctionCall	1
+#define INCLUDE_xTaskGetSchedulerState	1
+#define INCLUDE_xTaskGetIdleTaskHandle	1
+
+/* Time base of the kernel benchmark (KernelBench.c): host monotonic clock in
+nanoseconds, see main_host.c. */
+uint32_t ulBenchTimestamp( void );
+#define configBENCH_TIMESTAMP()			ulBenchTimestamp()
+#define configBENCH_TIMESTAMP_UNIT		"ns"
+#define configBENCH_PRINTF( X )			printf X
+
+/* The kernel benchmark also times xTaskIncrementTick() up to the tick hook, see
+vApplicationTickHook() in main_host.c. */
+#if( mainCREATE_KERNEL_BENCHMARK_ONLY == 1 )
+	void vKernelBenchTickEntry( void );
+	#define traceTASK_INCREMENT_TICK( xTickCount )	vKernelBenchTickEntry()
+#endif
+
+/* With the regions of heap_tlsf.c (mainUSE_HEAP_REGIONS set to 2, see
+main_host.c) task stacks are allocated from the fast region. */
+#if defined( mainUSE_HEAP_REGIONS ) && ( mainUSE_HEAP_REGIONS == 2 )
+	#define pvPortMallocAligned( x, puxStackBuffer ) ( ( ( puxStackBuffer ) == NULL ) ? ( pvPortMallocRegion( ( x ), portHEAP_REGION_FAST ) ) : ( puxStackBuffer ) )
+#endif
+
+/* An assert reports the failing line and ends the process with a non zero
+status, so a CI run fails instead of hanging. */
+void vAssertCalled( const char *pcFile, unsigned long ulLine );
+#define configASSERT( x ) if( ( x ) == 0 ) { vAssertCalled( __FILE__, __LINE__ ); }
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,732 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/******************************************************************************
+ * Linux host build of the comprehensive test and demo application, using the
+ * GCC/Posix port.  It runs the portable subset of the standard demo tasks
+ * started by main_full(), plus a few more, natively so kernel changes can be
+ * regression tested without a board.
+ *
+ * The register test tasks and the interrupt queue tasks are not included as
+ * they need the Cortex-M7 core and a hardware timer.  The interrupt safe API
+ * demos are driven from the tick hook, the tick being the only interrupt of the
+ * host port.
+ *
+ * The check task verifies every mainCHECK_PERIOD that all the demo tasks are
+ * still running without error and prints the result.  After mainRUN_TIME the
+ * scheduler is ended and the process exits with status 0 if no error was ever
+ * found, 1 otherwise.  An assert exits with status 2.
+ *
+ * The CPU load of each task and of the tick hook, accounted as an interrupt, is
+ * measured by Source/cpu_load.c and printed before the scheduler is ended.
+ *
+ * Built with -DconfigUSE_TRACE_RECORDER=1 the kernel events are recorded by
+ * Source/trace_recorder.c and the recording is saved to mainTRACE_FILE when the
+ * scheduler has ended or an assert fails, for trace_decode.c to convert.
+ *
+ * Built with -DmainCREATE_KERNEL_BENCHMARK_ONLY=1 only the kernel benchmark
+ * (KernelBench.c) runs, the scheduler is ended once its report is printed.
+ *
+ * The heap is heap_4.c by default.  heap_tlsf.c links in its place as is, to
+ * link heap_5.c build with -DmainUSE_HEAP_REGIONS=1: the heap is then defined
+ * as two regions of half configTOTAL_HEAP_SIZE each.  With heap_tlsf.c,
+ * -DmainUSE_HEAP_REGIONS=2 adds static arrays standing for the fast, DMA and
+ * bulk regions of the target, task stacks are allocated from the fast region
+ * (see FreeRTOSConfig.h), HeapRegionTest.c checks the placement of
+ * allocations and the statistics of each region are printed at the end of the
+ * run.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "semphr.h"
+#include "cpu_load.h"
+
+/* Standard demo application includes. */
+#include "flop.h"
+#include "integer.h"
+#include "semtest.h"
+#include "dynamic.h"
+#include "BlockQ.h"
+#include "blocktim.h"
+#include "countsem.h"
+#include "GenQTest.h"
+#include "recmutex.h"
+#include "death.h"
+#include "PollQ.h"
+#include "QPeek.h"
+#include "QueueSet.h"
+#include "TimerDemo.h"
+#include "QueueOverwrite.h"
+#include "EventGroupsDemo.h"
+#include "IntSemTest.h"
+#include "TaskNotify.h"
+#include "StreamBufferDemo.h"
+#include "HeapRegionTest.h"
+#include "FastSemaphoreDemo.h"
+#include "QueueMultiple.h"
+#include "PriorityQueueDemo.h"
+#include "BufferPoolDemo.h"
+#include "KernelBench.h"
+
+/* Set mainCREATE_KERNEL_BENCHMARK_ONLY to one to run the kernel benchmark
+instead of the demo tasks. */
+#ifndef mainCREATE_KERNEL_BENCHMARK_ONLY
+	#define mainCREATE_KERNEL_BENCHMARK_ONLY	0
+#endif
+
+/* Set mainUSE_HEAP_REGIONS to one when heap_5.c is linked, to two to add the
+regions of heap_tlsf.c. */
+#ifndef mainUSE_HEAP_REGIONS
+	#define mainUSE_HEAP_REGIONS				0
+#endif
+
+/* Priorities for the demo application tasks. */
+#define mainSEM_TEST_PRIORITY				( tskIDLE_PRIORITY + 1UL )
+#define mainBLOCK_Q_PRIORITY				( tskIDLE_PRIORITY + 2UL )
+#define mainQUEUE_POLL_PRIORITY				( tskIDLE_PRIORITY + 1UL )
+#define mainCREATOR_TASK_PRIORITY			( tskIDLE_PRIORITY + 3UL )
+#define mainFLOP_TASK_PRIORITY				( tskIDLE_PRIORITY )
+#define mainINTEGER_TASK_PRIORITY			( tskIDLE_PRIORITY )
+#define mainCHECK_TASK_PRIORITY				( configMAX_PRIORITIES - 1 )
+#define mainQUEUE_OVERWRITE_PRIORITY		( tskIDLE_PRIORITY )
+#define mainBENCHMARK_PRIORITY				( tskIDLE_PRIORITY + 2UL )
+#define mainHEAP_REGION_PRIORITY			( tskIDLE_PRIORITY )
+
+/* The period at which the check task verifies the demo tasks, and the time
+after which the scheduler is ended, both in ms. */
+#define mainCHECK_PERIOD					( 3000UL / portTICK_PERIOD_MS )
+#ifndef mainRUN_TIME
+	#define mainRUN_TIME					( 30000UL / portTICK_PERIOD_MS )
+#endif
+
+/* The period at which the end of the kernel benchmark is polled. */
+#define mainBENCHMARK_POLL_PERIOD			( 100UL / portTICK_PERIOD_MS )
+
+/* The base period used by the timer test tasks. */
+#define mainTIMER_TEST_PERIOD				( 50 )
+
+/* Sizes of the heap_tlsf.c regions added when mainUSE_HEAP_REGIONS is 2.  The
+fast region is too small for all the demo stacks, so some come from the
+default region. */
+#define mainFAST_REGION_SIZE				( 32UL * 1024UL )
+#define mainDMA_REGION_SIZE					( 16UL * 1024UL )
+#define mainBULK_REGION_SIZE				( 1024UL * 1024UL )
+
+/* Process exit status on an assert. */
+#define mainASSERT_EXIT_STATUS				( 2 )
+
+/* Size of the buffer the CPU load table is written to. */
+#define mainCPU_LOAD_BUFFER_SIZE			( 4096 )
+
+/* The file the trace recorder buffer is saved to. */
+#ifndef mainTRACE_FILE
+	#define mainTRACE_FILE					"trace.bin"
+#endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The check task, as described at the top of this file.
+ */
+static void prvCheckTask( void *pvParameters );
+
+/*
+ * Ends the scheduler once the kernel benchmark has printed its report.
+ */
+#if( mainCREATE_KERNEL_BENCHMARK_ONLY == 1 )
+	static void prvBenchmarkEndTask( void *pvParameters );
+#endif
+
+/*
+ * Prints the statistics of each heap_tlsf.c region.
+ */
+#if( mainUSE_HEAP_REGIONS == 2 )
+	static void prvPrintHeapRegions( void );
+#endif
+
+/*
+ * Saves the trace recorder buffer to mainTRACE_FILE.
+ */
+#if( configUSE_TRACE_RECORDER == 1 )
+	static void prvSaveTrace( void );
+#endif
+
+#if( mainCREATE_KERNEL_BENCHMARK_ONLY == 1 )
+
+	static void prvBenchmarkEndTask( void *pvParameters )
+	{
+		( void ) pvParameters;
+
+		while( xIsKernelBenchmarkComplete() == pdFALSE )
+		{
+			vTaskDelay( mainBENCHMARK_POLL_PERIOD );
+		}
+
+		vTaskEndScheduler();
+	}
+
+#endif /* mainCREATE_KERNEL_BENCHMARK_ONLY */
+/*-----------------------------------------------------------*/
+
+#if( mainUSE_HEAP_REGIONS == 2 )
+
+	static void prvPrintHeapRegions( void )
+	{
+	static const char * const pcRegionNames[ portHEAP_REGION_COUNT ] = { "default", "fast", "dma", "bulk" };
+	HeapStats_t xStats;
+	UBaseType_t uxRegion;
+
+		for( uxRegion = 0; uxRegion < ( UBaseType_t ) portHEAP_REGION_COUNT; uxRegion++ )
+		{
+			vPortGetHeapRegionStats( uxRegion, &xStats );
+			printf( "heap %s: free %lu, minimum ever free %lu, largest free block %lu, allocations %lu, frees %lu\n",
+					pcRegionNames[ uxRegion ], ( unsigned long ) xStats.xAvailableHeapSpaceInBytes,
+					( unsigned long ) xStats.xMinimumEverFreeBytesRemaining, ( unsigned long ) xStats.xSizeOfLargestFreeBlockInBytes,
+					( unsigned long ) xStats.xNumberOfSuccessfulAllocations, ( unsigned long ) xStats.xNumberOfSuccessfulFrees );
+		}
+	}
+
+#endif /* mainUSE_HEAP_REGIONS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TRACE_RECORDER == 1 )
+
+	static void prvSaveTrace( void )
+	{
+	FILE *pxFile;
+	const void *pvTrace;
+	size_t xSize;
+
+		vTraceRecorderStop();
+		pvTrace = pvTraceRecorderGetBuffer( &xSize );
+
+		pxFile = fopen( mainTRACE_FILE, "wb" );
+		if( pxFile != NULL )
+		{
+			if( fwrite( pvTrace, 1, xSize, pxFile ) == xSize )
+			{
+				printf( "trace saved to %s\n", mainTRACE_FILE );
+			}
+			( void ) fclose( pxFile );
+		}
+	}
+
+#endif /* configUSE_TRACE_RECORDER */
+/*-----------------------------------------------------------*/
+
+uint32_t ulBenchTimestamp( void )
+{
+struct timespec xNow;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( uint32_t ) ( ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec );
+}
+/*-----------------------------------------------------------*/
+
+/* Prototypes for the standard FreeRTOS callback/hook functions implemented
+within this file. */
+void vApplicationMallocFailedHook( void );
+void vApplicationIdleHook( void );
+void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName );
+void vApplicationTickHook( void );
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize );
+	void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize );
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* Errors found by the check task, one bit per demo, accumulated over the run. */
+static volatile unsigned long ulErrorsFound = 0UL;
+
+#if( configUSE_CPU_LOAD == 1 )
+	/* The number cpu_load.c accounts the tick hook under. */
+	static UBaseType_t uxTickHookISR;
+#endif
+
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	#if( configUSE_TRACE_RECORDER == 1 )
+	{
+		/* Before any object is created, so they are all named. */
+		vTraceRecorderStart();
+	}
+	#endif
+
+	#if( mainUSE_HEAP_REGIONS == 1 )
+	{
+	static uint8_t ucRegion1[ configTOTAL_HEAP_SIZE / 2 ], ucRegion2[ configTOTAL_HEAP_SIZE / 2 ];
+	HeapRegion_t xHeapRegions[ 3 ] = { { NULL, 0 }, { NULL, 0 }, { NULL, 0 } };
+
+		/* heap_5.c wants the regions in address order. */
+		xHeapRegions[ 0 ].pucStartAddress = ( ( size_t ) ucRegion1 < ( size_t ) ucRegion2 ) ? ucRegion1 : ucRegion2;
+		xHeapRegions[ 0 ].xSizeInBytes = sizeof( ucRegion1 );
+		xHeapRegions[ 1 ].pucStartAddress = ( ( size_t ) ucRegion1 < ( size_t ) ucRegion2 ) ? ucRegion2 : ucRegion1;
+		xHeapRegions[ 1 ].xSizeInBytes = sizeof( ucRegion2 );
+		vPortDefineHeapRegions( xHeapRegions );
+	}
+	#elif( mainUSE_HEAP_REGIONS == 2 )
+	{
+	static uint8_t ucFastRegion[ mainFAST_REGION_SIZE ], ucDMARegion[ mainDMA_REGION_SIZE ], ucBulkRegion[ mainBULK_REGION_SIZE ];
+
+		/* On the target these are the DTCM, the non cacheable SRAM and the
+		SDRAM once BOARD_ConfigureSdram() has run. */
+		vPortAddHeapRegion( portHEAP_REGION_FAST, ucFastRegion, sizeof( ucFastRegion ) );
+		vPortAddHeapRegion( portHEAP_REGION_DMA, ucDMARegion, sizeof( ucDMARegion ) );
+		vPortAddHeapRegion( portHEAP_REGION_BULK, ucBulkRegion, sizeof( ucBulkRegion ) );
+	}
+	#endif
+
+	#if( mainCREATE_KERNEL_BENCHMARK_ONLY == 1 )
+	{
+		vStartKernelBenchmarkTask( mainBENCHMARK_PRIORITY );
+		xTaskCreate( prvBenchmarkEndTask, "BenchEnd", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL );
+		vTaskStartScheduler();
+
+		#if( configUSE_TRACE_RECORDER == 1 )
+		{
+			prvSaveTrace();
+		}
+		#endif
+
+		return 0;
+	}
+	#endif
+
+	#if( configUSE_CPU_LOAD == 1 )
+	{
+		uxTickHookISR = uxCpuLoadRegisterISR( "Tick" );
+	}
+	#endif
+
+	/* Start the standard demo/test tasks. */
+	vStartIntegerMathTasks( mainINTEGER_TASK_PRIORITY );
+	vStartDynamicPriorityTasks();
+	vStartBlockingQueueTasks( mainBLOCK_Q_PRIORITY );
+	vCreateBlockTimeTasks();
+	vStartCountingSemaphoreTasks();
+	vStartGenericQueueTasks( tskIDLE_PRIORITY );
+	vStartRecursiveMutexTasks();
+	vStartSemaphoreTasks( mainSEM_TEST_PRIORITY );
+	vStartPolledQueueTasks( mainQUEUE_POLL_PRIORITY );
+	vStartQueuePeekTasks();
+	vStartQueueSetTasks();
+	vStartMathTasks( mainFLOP_TASK_PRIORITY );
+	vStartTimerDemoTask( mainTIMER_TEST_PERIOD );
+	vStartQueueOverwriteTask( mainQUEUE_OVERWRITE_PRIORITY );
+	vStartEventGroupTasks();
+	vStartInterruptSemaphoreTasks();
+	vStartTaskNotifyTask();
+	vStartStreamBufferTasks();
+	vStartFastSemaphoreTasks();
+	vStartQueueMultipleTasks();
+	vStartPriorityQueueTasks();
+	vStartBufferPoolTasks();
+
+	#if( mainUSE_HEAP_REGIONS == 2 )
+	{
+		vStartHeapRegionTask( mainHEAP_REGION_PRIORITY );
+	}
+	#endif
+
+	xTaskCreate( prvCheckTask, "Check", configMINIMAL_STACK_SIZE, NULL, mainCHECK_TASK_PRIORITY, NULL );
+
+	/* The set of tasks created by the following function call have to be
+	created last as they keep account of the number of tasks they expect to see
+	running. */
+	vCreateSuicidalTasks( mainCREATOR_TASK_PRIORITY );
+
+	/* Returns once the check task ends the scheduler. */
+	vTaskStartScheduler();
+
+	#if( mainUSE_HEAP_REGIONS == 2 )
+	{
+		prvPrintHeapRegions();
+	}
+	#endif
+
+	#if( configUSE_TRACE_RECORDER == 1 )
+	{
+		prvSaveTrace();
+	}
+	#endif
+
+	printf( "%s: %s (errors 0x%05lx)\n", __FILE__, ( ulErrorsFound == 0UL ) ? "PASS" : "FAIL", ulErrorsFound );
+
+	return ( ulErrorsFound == 0UL ) ? 0 : 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckTask( void *pvParameters )
+{
+TickType_t xLastExecutionTime;
+unsigned long ulErrorFound;
+
+	/* Just to stop compiler warnings. */
+	( void ) pvParameters;
+
+	xLastExecutionTime = xTaskGetTickCount();
+
+	/* Start sampling the CPU load.  Done once the scheduler runs, the timer
+	demo fills the timer command queue before. */
+	#if( configUSE_CPU_LOAD == 1 )
+	{
+		if( xCpuLoadStart() != pdPASS )
+		{
+			ulErrorsFound |= 1UL << 18UL;
+		}
+	}
+	#endif
+
+	while( xTaskGetTickCount() < mainRUN_TIME )
+	{
+		vTaskDelayUntil( &xLastExecutionTime, mainCHECK_PERIOD );
+		ulErrorFound = 0UL;
+
+		/* Check all the demo tasks to ensure that they are all still running,
+		and that none have detected an error. */
+		if( xAreIntegerMathsTaskStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 0UL;
+		}
+
+		if( xAreMathsTaskStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 1UL;
+		}
+
+		if( xAreDynamicPriorityTasksStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 2UL;
+		}
+
+		if( xAreBlockingQueuesStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 3UL;
+		}
+
+		if ( xAreBlockTimeTestTasksStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 4UL;
+		}
+
+		if ( xAreGenericQueueTasksStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 5UL;
+		}
+
+		if ( xAreRecursiveMutexTasksStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 6UL;
+		}
+
+		if( xIsCreateTaskStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 7UL;
+		}
+
+		if( xAreSemaphoreTasksStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 8UL;
+		}
+
+		if( xAreTimerDemoTasksStillRunning( ( TickType_t ) mainCHECK_PERIOD ) != pdPASS )
+		{
+			ulErrorFound |= 1UL << 9UL;
+		}
+
+		if( xAreCountingSemaphoreTasksStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 10UL;
+		}
+
+		if( xIsQueueOverwriteTaskStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 11UL;
+		}
+
+		if( xAreEventGroupTasksStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 12UL;
+		}
+
+		if( xAreInterruptSemaphoreTasksStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 13UL;
+		}
+
+		if( xAreTaskNotificationTasksStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 14UL;
+		}
+
+		if( xArePollingQueuesStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 15UL;
+		}
+
+		if( xAreQueuePeekTasksStillRunning() != pdTRUE )
+		{
+			ulErrorFound |= 1UL << 16UL;
+		}
+
+		if( xAreQueueSetTasksStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 17UL;
+		}
+
+		if( xAreStreamBufferTasksStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 19UL;
+		}
+
+		if( xAreFastSemaphoreTasksStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 21UL;
+		}
+
+		if( xAreQueueMultipleTasksStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 22UL;
+		}
+
+		if( xArePriorityQueueTasksStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 23UL;
+		}
+
+		if( xAreBufferPoolTasksStillRunning() != pdPASS )
+		{
+			ulErrorFound |= 1UL << 24UL;
+		}
+
+		#if( mainUSE_HEAP_REGIONS == 2 )
+		{
+			if( xIsHeapRegionTaskStillRunning() != pdPASS )
+			{
+				ulErrorFound |= 1UL << 20UL;
+			}
+		}
+		#endif
+
+		ulErrorsFound |= ulErrorFound;
+
+		/* The C library is not called from an interrupt, a critical section
+		keeps other tasks from being switched in while stdout is locked. */
+		taskENTER_CRITICAL();
+		{
+			printf( "tick %lu: %s (errors 0x%05lx), free heap %lu\n", ( unsigned long ) xTaskGetTickCount(),
+					( ulErrorFound == 0UL ) ? "ok" : "ERROR", ulErrorFound, ( unsigned long ) xPortGetFreeHeapSize() );
+			fflush( stdout );
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	#if( configUSE_CPU_LOAD == 1 )
+	{
+	static char cLoadTable[ mainCPU_LOAD_BUFFER_SIZE ];
+
+		vCpuLoadGetStats( cLoadTable, sizeof( cLoadTable ) );
+
+		taskENTER_CRITICAL();
+		{
+			printf( "%s", cLoadTable );
+			fflush( stdout );
+		}
+		taskEXIT_CRITICAL();
+	}
+	#endif
+
+	vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+	/* Called if a call to pvPortMalloc() fails because there is insufficient
+	free memory available in the FreeRTOS heap. */
+	configASSERT( ( volatile void * ) NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName )
+{
+	( void ) pcTaskName;
+	( void ) pxTask;
+
+	/* Not used, task stacks are host thread stacks. */
+	configASSERT( ( volatile void * ) NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+	#if( mainCREATE_KERNEL_BENCHMARK_ONLY == 0 )
+	{
+		#if( configUSE_CPU_LOAD == 1 )
+		{
+			vCpuLoadISREnter();
+		}
+		#endif
+
+		/* The software timer demo/test requires prodding periodically from the
+		tick interrupt. */
+		vTimerPeriodicISRTests();
+
+		/* Call the periodic queue overwrite from ISR demo. */
+		vQueueOverwritePeriodicISRDemo();
+
+		/* Call the periodic event group from ISR demo. */
+		vPeriodicEventGroupsProcessing();
+
+		/* Call the code that uses a mutex from an ISR. */
+		vInterruptSemaphorePeriodicTest();
+
+		/* Call the code that 'gives' a task notification from an ISR. */
+		xNotifyTaskFromISR();
+
+		/* Access queues from the queue set from ISR. */
+		vQueueSetAccessQueueSetFromISR();
+
+		/* Write to and read from stream buffers from ISR. */
+		vPeriodicStreamBufferProcessing();
+
+		#if( configUSE_CPU_LOAD == 1 )
+		{
+			vCpuLoadISRExit( uxTickHookISR );
+		}
+		#endif
+	}
+	#else
+	{
+		/* End of the tick processing timed by the kernel benchmark. */
+		vKernelBenchTickHook();
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize )
+	{
+	static StaticTask_t xIdleTaskTCB;
+	static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+		*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+		*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+		*pusIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize )
+	{
+	static StaticTask_t xTimerTaskTCB;
+	static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
+
+		*ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+		*ppxTimerTaskStackBuffer = uxTimerTaskStack;
+		*pusTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+	/* Interrupts stay masked, no other task runs while the message is
+	printed. */
+	taskDISABLE_INTERRUPTS();
+	fprintf( stderr, "ASSERT: %s:%lu\n", pcFile, ulLine );
+
+	#if( configUSE_TRACE_RECORDER == 1 )
+	{
+		/* The events that led to the assert. */
+		prvSaveTrace();
+	}
+	#endif
+
+	exit( mainASSERT_EXIT_STATUS );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,750 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/******************************************************************************
+ * Host decoder of the kernel event recorder (Source/trace_recorder.c).  Reads
+ * a recording, as saved by main_host.c or from the RAM of the target by a
+ * debugger, and writes it as a trace in the JSON trace event format, which the
+ * Perfetto UI (ui.perfetto.dev) and chrome://tracing open:
+ *
+ *   trace_decode trace.bin trace.json
+ *
+ * Each task has a track showing when it was running, ready (preempted or woken
+ * and waiting for the processor), blocked on a queue, semaphore or mutex,
+ * delayed or suspended, with the queue accesses it made as instants.  Each
+ * interrupt recorded has a track of its executions, nested ones included, with
+ * the accesses made from it.  The items in each queue accessed are drawn as a
+ * counter.  Times are in microseconds from the first event of the recording.
+ *
+ * The layout of the recording is described in trace_recorder.h.  The byte
+ * order of the recording is found from its magic number.  Only standard C is
+ * used, build with e.g. "gcc -O2 -o trace_decode trace_decode.c".
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* Identifies the recording and its layout, as in trace_recorder.h. */
+#define decodeMAGIC					( 0x52545246UL )
+#define decodeVERSION				( 1UL )
+#define decodeHEADER_SIZE			( 32UL )
+#define decodeEVENT_SIZE			( 8UL )
+
+/* Event codes, as in trace_recorder.h. */
+#define decodeTASK_SWITCHED_IN		( 0x01U )
+#define decodeTASK_READY			( 0x02U )
+#define decodeTASK_CREATE			( 0x03U )
+#define decodeTASK_DELETE			( 0x04U )
+#define decodeTASK_DELAY			( 0x05U )
+#define decodeTASK_DELAY_UNTIL		( 0x06U )
+#define decodeTASK_SUSPEND			( 0x07U )
+#define decodeTASK_RESUME			( 0x08U )
+#define decodeTASK_PRIORITY_SET		( 0x09U )
+#define decodeTASK_PRIORITY_INHERIT	( 0x0AU )
+#define decodeTASK_PRIORITY_DISINHERIT	( 0x0BU )
+#define decodeQUEUE_CREATE			( 0x10U )
+#define decodeQUEUE_DELETE			( 0x11U )
+#define decodeQUEUE_SEND			( 0x12U )
+#define decodeQUEUE_SEND_FAILED		( 0x13U )
+#define decodeQUEUE_RECEIVE			( 0x14U )
+#define decodeQUEUE_RECEIVE_FAILED	( 0x15U )
+#define decodeQUEUE_PEEK			( 0x16U )
+#define decodeQUEUE_PEEK_FAILED		( 0x17U )
+#define decodeQUEUE_BLOCK_SEND		( 0x18U )
+#define decodeQUEUE_BLOCK_RECEIVE	( 0x19U )
+#define decodeISR_ENTER				( 0x20U )
+#define decodeISR_EXIT				( 0x21U )
+#define decodeTICK					( 0x30U )
+#define decodeMARK					( 0x31U )
+#define decodeFROM_ISR				( 0x80U )
+
+/* Kinds of the entries of the name table, as in trace_recorder.h. */
+#define decodeNAME_TASK				( 1U )
+#define decodeNAME_QUEUE			( 2U )
+#define decodeNAME_ISR				( 3U )
+
+/* Objects are numbered on 16 bits. */
+#define decodeMAX_OBJECTS			( 65536UL )
+
+/* Thread numbers of the tracks: tasks by their number, interrupts after them,
+and events recorded before the first context switch on track 0. */
+#define decodeISR_TRACK				( 100000UL )
+#define decodeUNKNOWN_TRACK			( 0UL )
+
+/* Interrupts nest at most this deep. */
+#define decodeMAX_ISR_NESTING		( 16 )
+
+/* Longest name output, object names included. */
+#define decodeNAME_SIZE				( 64 )
+
+/* The states a task track shows. */
+typedef enum
+{
+	eNone = 0,		/* Not seen yet, or deleted. */
+	eRunning,
+	eReady,
+	eBlocked,
+	eDelayed,
+	eSuspended
+} TaskState_t;
+
+typedef struct xDECODE_TASK
+{
+	TaskState_t eState;
+	uint64_t ullStateStart;		/* Time the state was entered. */
+	char cStateName[ decodeNAME_SIZE ];
+	unsigned uPriority;
+	int iSeen;					/* Set once the track is used. */
+} DecodeTask_t;
+
+typedef struct xDECODE_QUEUE
+{
+	int iCreated;				/* Set once its creation was seen. */
+	unsigned uType;				/* queueQUEUE_TYPE_xxx. */
+	int iSeen;					/* Set once its counter is output. */
+} DecodeQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Read a field of the recording in its byte order.
+ */
+static uint32_t prvRead32( const uint8_t *pucData );
+static uint16_t prvRead16( const uint8_t *pucData );
+
+/*
+ * The name of an object, from the name table of the recording or made from
+ * its number.
+ */
+static const char *prvTaskName( unsigned uTask );
+static const char *prvQueueName( unsigned uQueue );
+static const char *prvISRName( unsigned uISR );
+static const char *prvFindName( unsigned uKind, unsigned uObject );
+
+/*
+ * Change the state of a task, outputting the slice of the state it leaves.
+ */
+static void prvSetState( unsigned uTask, TaskState_t eState, const char *pcName, uint64_t ullTime );
+
+/*
+ * Output an instant event on a track, and the value of a queue counter.
+ */
+static void prvInstant( unsigned long ulTrack, const char *pcName, uint64_t ullTime, const char *pcArgName, unsigned uArg );
+static void prvCounter( unsigned uQueue, unsigned uItems, uint64_t ullTime );
+
+/*
+ * Output a slice, and a string escaped for JSON.
+ */
+static void prvSlice( unsigned long ulTrack, const char *pcName, uint64_t ullStart, uint64_t ullEnd, const char *pcArgName, unsigned uArg );
+static void prvString( const char *pcString );
+
+/*
+ * The time in microseconds, from the first event, of a counter value.
+ */
+static double prvTime( uint64_t ullTime );
+
+/*-----------------------------------------------------------*/
+
+/* The recording and its layout. */
+static uint8_t *pucRecording = NULL;
+static int iSwapBytes = 0;
+static uint32_t ulTimestampHz, ulEventCapacity, ulNameCapacity, ulNameLength;
+static const uint8_t *pucNames = NULL;
+
+/* The output, and whether an event was output yet (to separate them). */
+static FILE *pxOutput = NULL;
+static int iFirstOutput = 1;
+
+/* The time stamp of the first event. */
+static uint64_t ullTimeOrigin = 0ULL;
+
+/* Objects state. */
+static DecodeTask_t xTasks[ decodeMAX_OBJECTS ];
+static DecodeQueue_t xQueues[ decodeMAX_OBJECTS ];
+static int iISRSeen[ decodeMAX_OBJECTS ];
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+FILE *pxInput;
+long lSize;
+uint32_t ulEventsWritten, ulFirst, ulCount, ulEvent, ulLast32 = 0UL, ulISRDepth = 0UL;
+const uint8_t *pucEvents, *pucEvent;
+uint64_t ullTime = 0ULL, ullEnd = 0ULL;
+unsigned uCode, uParameter, uObject, uCurrent = 0U, uFromISR;
+unsigned uISRStack[ decodeMAX_ISR_NESTING ];
+uint64_t ullISRStart[ decodeMAX_ISR_NESTING ];
+unsigned long ulTrack, ulDepth, ulScan;
+char cName[ decodeNAME_SIZE * 2 ];
+
+	if( ( argc < 2 ) || ( argc > 3 ) )
+	{
+		fprintf( stderr, "usage: %s <recording> [<trace.json>]\n", argv[ 0 ] );
+		return 1;
+	}
+
+	/* Read the whole recording. */
+	pxInput = fopen( argv[ 1 ], "rb" );
+	if( pxInput == NULL )
+	{
+		fprintf( stderr, "cannot open %s\n", argv[ 1 ] );
+		return 1;
+	}
+	fseek( pxInput, 0L, SEEK_END );
+	lSize = ftell( pxInput );
+	fseek( pxInput, 0L, SEEK_SET );
+	if( lSize < ( long ) decodeHEADER_SIZE )
+	{
+		fprintf( stderr, "%s: too short for a recording\n", argv[ 1 ] );
+		return 1;
+	}
+	pucRecording = malloc( ( size_t ) lSize );
+	if( ( pucRecording == NULL ) || ( fread( pucRecording, 1, ( size_t ) lSize, pxInput ) != ( size_t ) lSize ) )
+	{
+		fprintf( stderr, "%s: read error\n", argv[ 1 ] );
+		return 1;
+	}
+	fclose( pxInput );
+
+	/* The magic number gives the byte order. */
+	if( prvRead32( pucRecording ) != decodeMAGIC )
+	{
+		iSwapBytes = 1;
+		if( prvRead32( pucRecording ) != decodeMAGIC )
+		{
+			fprintf( stderr, "%s: not a recording (was the recorder started?)\n", argv[ 1 ] );
+			return 1;
+		}
+	}
+	if( prvRead32( pucRecording + 4 ) != decodeVERSION )
+	{
+		fprintf( stderr, "%s: version %lu not supported\n", argv[ 1 ], ( unsigned long ) prvRead32( pucRecording + 4 ) );
+		return 1;
+	}
+
+	ulTimestampHz = prvRead32( pucRecording + 8 );
+	ulEventCapacity = prvRead32( pucRecording + 12 );
+	ulNameCapacity = prvRead32( pucRecording + 16 );
+	ulNameLength = prvRead32( pucRecording + 20 );
+	ulEventsWritten = prvRead32( pucRecording + 24 );
+
+	if( ( ulTimestampHz == 0UL ) || ( ( ( uint64_t ) decodeHEADER_SIZE + ( ( uint64_t ) ulNameCapacity * ( 4U + ulNameLength ) ) + ( ( uint64_t ) ulEventCapacity * decodeEVENT_SIZE ) ) > ( uint64_t ) lSize ) )
+	{
+		fprintf( stderr, "%s: truncated recording\n", argv[ 1 ] );
+		return 1;
+	}
+
+	pucNames = pucRecording + decodeHEADER_SIZE;
+	pucEvents = pucNames + ( ulNameCapacity * ( 4U + ulNameLength ) );
+
+	/* Until the buffer wraps the events start at its beginning, after that at
+	the oldest event, which is the next one to be overwritten. */
+	if( ulEventsWritten <= ulEventCapacity )
+	{
+		ulFirst = 0UL;
+		ulCount = ulEventsWritten;
+	}
+	else
+	{
+		ulFirst = ulEventsWritten % ulEventCapacity;
+		ulCount = ulEventCapacity;
+	}
+
+	if( argc == 3 )
+	{
+		pxOutput = fopen( argv[ 2 ], "w" );
+		if( pxOutput == NULL )
+		{
+			fprintf( stderr, "cannot create %s\n", argv[ 2 ] );
+			return 1;
+		}
+	}
+	else
+	{
+		pxOutput = stdout;
+	}
+
+	fprintf( pxOutput, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n" );
+
+	for( ulEvent = 0UL; ulEvent < ulCount; ulEvent++ )
+	{
+		pucEvent = pucEvents + ( ( ( ulFirst + ulEvent ) % ulEventCapacity ) * decodeEVENT_SIZE );
+
+		/* The time stamps are 32 bits wide, the recorder makes sure there is
+		an event at least once per period of the counter. */
+		if( ulEvent == 0UL )
+		{
+			ullTime = prvRead32( pucEvent );
+			ullTimeOrigin = ullTime;
+		}
+		else
+		{
+			ullTime += ( uint32_t ) ( prvRead32( pucEvent ) - ulLast32 );
+		}
+		ulLast32 = prvRead32( pucEvent );
+		ullEnd = ullTime;
+
+		uFromISR = pucEvent[ 4 ] & decodeFROM_ISR;
+		uCode = pucEvent[ 4 ] & ~decodeFROM_ISR;
+		uParameter = pucEvent[ 5 ];
+		uObject = prvRead16( pucEvent + 6 );
+
+		/* Accesses are shown on the track of the interrupt or task that made
+		them. */
+		if( ulISRDepth > 0UL )
+		{
+			ulTrack = decodeISR_TRACK + uISRStack[ ulISRDepth - 1UL ];
+		}
+		else
+		{
+			ulTrack = uCurrent;
+		}
+
+		switch( uCode )
+		{
+			case decodeTASK_SWITCHED_IN:
+				/* A task switched out while running was preempted. */
+				if( ( uCurrent != 0U ) && ( xTasks[ uCurrent ].eState == eRunning ) )
+				{
+					prvSetState( uCurrent, eReady, "Ready", ullTime );
+				}
+				uCurrent = uObject;
+				xTasks[ uObject ].uPriority = uParameter;
+				prvSetState( uObject, eRunning, "Running", ullTime );
+				break;
+
+			case decodeTASK_READY:
+				if( xTasks[ uObject ].eState != eRunning )
+				{
+					xTasks[ uObject ].uPriority = uParameter;
+					prvSetState( uObject, eReady, "Ready", ullTime );
+				}
+				break;
+
+			case decodeTASK_CREATE:
+				xTasks[ uObject ].uPriority = uParameter;
+				prvInstant( uObject, "Created", ullTime, "priority", uParameter );
+				break;
+
+			case decodeTASK_DELETE:
+				prvSetState( uObject, eNone, "", ullTime );
+				prvInstant( uObject, "Deleted", ullTime, NULL, 0U );
+				if( uObject == uCurrent )
+				{
+					uCurrent = 0U;
+				}
+				break;
+
+			case decodeTASK_DELAY:
+			case decodeTASK_DELAY_UNTIL:
+				/* Also recorded by a task already blocked on a queue with a
+				time out, which is kept as the state. */
+				if( xTasks[ uObject ].eState == eRunning )
+				{
+					prvSetState( uObject, eDelayed, "Delayed", ullTime );
+				}
+				break;
+
+			case decodeTASK_SUSPEND:
+				prvSetState( uObject, eSuspended, "Suspended", ullTime );
+				break;
+
+			case decodeTASK_RESUME:
+				prvInstant( uObject, uFromISR ? "Resumed from ISR" : "Resumed", ullTime, NULL, 0U );
+				break;
+
+			case decodeTASK_PRIORITY_SET:
+				prvInstant( uObject, "Priority set", ullTime, "priority", uParameter );
+				break;
+
+			case decodeTASK_PRIORITY_INHERIT:
+				prvInstant( uObject, "Priority inherited", ullTime, "priority", uParameter );
+				break;
+
+			case decodeTASK_PRIORITY_DISINHERIT:
+				prvInstant( uObject, "Priority disinherited", ullTime, "priority", uParameter );
+				break;
+
+			case decodeQUEUE_CREATE:
+				xQueues[ uObject ].iCreated = 1;
+				xQueues[ uObject ].uType = uParameter;
+				break;
+
+			case decodeQUEUE_DELETE:
+				xQueues[ uObject ].iCreated = 0;
+				break;
+
+			case decodeQUEUE_SEND:
+			case decodeQUEUE_SEND_FAILED:
+			case decodeQUEUE_RECEIVE:
+			case decodeQUEUE_RECEIVE_FAILED:
+			case decodeQUEUE_PEEK:
+			case decodeQUEUE_PEEK_FAILED:
+				snprintf( cName, sizeof( cName ), "%s%s %s",
+						  ( ( uCode == decodeQUEUE_SEND ) || ( uCode == decodeQUEUE_SEND_FAILED ) ) ? "Send" :
+						  ( ( uCode == decodeQUEUE_RECEIVE ) || ( uCode == decodeQUEUE_RECEIVE_FAILED ) ) ? "Receive" : "Peek",
+						  ( ( uCode == decodeQUEUE_SEND_FAILED ) || ( uCode == decodeQUEUE_RECEIVE_FAILED ) || ( uCode == decodeQUEUE_PEEK_FAILED ) ) ? " failed" : "",
+						  prvQueueName( uObject ) );
+				prvInstant( ulTrack, cName, ullTime, "items", uParameter );
+
+				/* The parameter is the number of items before the access. */
+				if( uCode == decodeQUEUE_SEND )
+				{
+					prvCounter( uObject, uParameter + 1U, ullTime );
+				}
+				else if( ( uCode == decodeQUEUE_RECEIVE ) && ( uParameter > 0U ) )
+				{
+					prvCounter( uObject, uParameter - 1U, ullTime );
+				}
+				break;
+
+			case decodeQUEUE_BLOCK_SEND:
+			case decodeQUEUE_BLOCK_RECEIVE:
+				if( uCurrent != 0U )
+				{
+					snprintf( cName, sizeof( cName ), "Blocked %s %s", ( uCode == decodeQUEUE_BLOCK_SEND ) ? "sending to" : "receiving from", prvQueueName( uObject ) );
+					prvSetState( uCurrent, eBlocked, cName, ullTime );
+				}
+				break;
+
+			case decodeISR_ENTER:
+				/* The interrupt is known from its exit, found by scanning
+				ahead for the exit at the same nesting depth. */
+				ulDepth = 0UL;
+				for( ulScan = ulEvent + 1UL; ulScan < ulCount; ulScan++ )
+				{
+					pucEvent = pucEvents + ( ( ( ulFirst + ulScan ) % ulEventCapacity ) * decodeEVENT_SIZE );
+					if( pucEvent[ 4 ] == decodeISR_ENTER )
+					{
+						ulDepth++;
+					}
+					else if( pucEvent[ 4 ] == decodeISR_EXIT )
+					{
+						if( ulDepth == 0UL )
+						{
+							break;
+						}
+						ulDepth--;
+					}
+				}
+
+				if( ( ulScan < ulCount ) && ( ulISRDepth < decodeMAX_ISR_NESTING ) )
+				{
+					uISRStack[ ulISRDepth ] = prvRead16( pucEvent + 6 );
+					ullISRStart[ ulISRDepth ] = ullTime;
+					ulISRDepth++;
+				}
+				break;
+
+			case decodeISR_EXIT:
+				/* The exits of interrupts entered before the first event, or
+				not exited by the last one, are left out. */
+				if( ( ulISRDepth > 0UL ) && ( uISRStack[ ulISRDepth - 1UL ] == uObject ) )
+				{
+					ulISRDepth--;
+					iISRSeen[ uObject ] = 1;
+					prvSlice( decodeISR_TRACK + uObject, prvISRName( uObject ), ullISRStart[ ulISRDepth ], ullTime, "depth", ( unsigned ) ulISRDepth );
+				}
+				break;
+
+			case decodeMARK:
+				snprintf( cName, sizeof( cName ), "Mark %u", uObject );
+				prvInstant( ulTrack, cName, ullTime, "value", uParameter );
+				break;
+
+			default:
+				/* decodeTICK only serves to unwrap the time stamps. */
+				break;
+		}
+	}
+
+	/* Close the states in progress at the end of the recording. */
+	for( uObject = 1U; uObject < decodeMAX_OBJECTS; uObject++ )
+	{
+		prvSetState( uObject, eNone, "", ullEnd );
+	}
+
+	/* Name the tracks that were used, the interrupts after the tasks. */
+	fprintf( pxOutput, ",\n{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"FreeRTOS\"}}" );
+	for( uObject = 0U; uObject < decodeMAX_OBJECTS; uObject++ )
+	{
+		if( xTasks[ uObject ].iSeen != 0 )
+		{
+			fprintf( pxOutput, ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":", uObject );
+			prvString( ( uObject == decodeUNKNOWN_TRACK ) ? "(before first switch)" : prvTaskName( uObject ) );
+			fprintf( pxOutput, "}},\n{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":%u}}", uObject, uObject );
+		}
+
+		if( iISRSeen[ uObject ] != 0 )
+		{
+			fprintf( pxOutput, ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"name\":\"thread_name\",\"args\":{\"name\":", decodeISR_TRACK + uObject );
+			snprintf( cName, sizeof( cName ), "[%s]", prvISRName( uObject ) );
+			prvString( cName );
+			fprintf( pxOutput, "}},\n{\"ph\":\"M\",\"pid\":1,\"tid\":%lu,\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":%lu}}", decodeISR_TRACK + uObject, decodeISR_TRACK + uObject );
+		}
+	}
+
+	fprintf( pxOutput, "\n]}\n" );
+
+	if( pxOutput != stdout )
+	{
+		fclose( pxOutput );
+	}
+
+	fprintf( stderr, "%lu events over %.3f ms, %lu overwritten\n", ( unsigned long ) ulCount, prvTime( ullEnd ) / 1000.0,
+			 ( unsigned long ) ( ulEventsWritten - ulCount ) );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRead32( const uint8_t *pucData )
+{
+	if( iSwapBytes == 0 )
+	{
+		return ( uint32_t ) pucData[ 0 ] | ( ( uint32_t ) pucData[ 1 ] << 8 ) | ( ( uint32_t ) pucData[ 2 ] << 16 ) | ( ( uint32_t ) pucData[ 3 ] << 24 );
+	}
+	else
+	{
+		return ( uint32_t ) pucData[ 3 ] | ( ( uint32_t ) pucData[ 2 ] << 8 ) | ( ( uint32_t ) pucData[ 1 ] << 16 ) | ( ( uint32_t ) pucData[ 0 ] << 24 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint16_t prvRead16( const uint8_t *pucData )
+{
+	if( iSwapBytes == 0 )
+	{
+		return ( uint16_t ) ( pucData[ 0 ] | ( pucData[ 1 ] << 8 ) );
+	}
+	else
+	{
+		return ( uint16_t ) ( pucData[ 1 ] | ( pucData[ 0 ] << 8 ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static const char *prvFindName( unsigned uKind, unsigned uObject )
+{
+const uint8_t *pucEntry;
+uint32_t ulEntry;
+
+	for( ulEntry = 0UL; ulEntry < ulNameCapacity; ulEntry++ )
+	{
+		pucEntry = pucNames + ( ulEntry * ( 4U + ulNameLength ) );
+		if( ( pucEntry[ 2 ] == uKind ) && ( prvRead16( pucEntry ) == uObject ) && ( pucEntry[ 4 + ulNameLength - 1U ] == 0U ) )
+		{
+			return ( const char * ) ( pucEntry + 4 );
+		}
+	}
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static const char *prvTaskName( unsigned uTask )
+{
+static char cName[ decodeNAME_SIZE ];
+const char *pcName = prvFindName( decodeNAME_TASK, uTask );
+
+	if( pcName == NULL )
+	{
+		snprintf( cName, sizeof( cName ), "Task %u", uTask );
+		pcName = cName;
+	}
+
+	return pcName;
+}
+/*-----------------------------------------------------------*/
+
+static const char *prvQueueName( unsigned uQueue )
+{
+static const char * const pcTypeNames[] = { "Queue", "Mutex", "Counting semaphore", "Binary semaphore", "Recursive mutex" };
+static char cName[ decodeNAME_SIZE ];
+const char *pcName = prvFindName( decodeNAME_QUEUE, uQueue );
+
+	if( pcName == NULL )
+	{
+		snprintf( cName, sizeof( cName ), "%s %u",
+				  ( ( xQueues[ uQueue ].iCreated != 0 ) && ( xQueues[ uQueue ].uType < ( sizeof( pcTypeNames ) / sizeof( pcTypeNames[ 0 ] ) ) ) ) ? pcTypeNames[ xQueues[ uQueue ].uType ] : "Queue",
+				  uQueue );
+		pcName = cName;
+	}
+
+	return pcName;
+}
+/*-----------------------------------------------------------*/
+
+static const char *prvISRName( unsigned uISR )
+{
+static char cName[ decodeNAME_SIZE ];
+const char *pcName = prvFindName( decodeNAME_ISR, uISR );
+
+	if( pcName == NULL )
+	{
+		snprintf( cName, sizeof( cName ), "ISR %u", uISR );
+		pcName = cName;
+	}
+
+	return pcName;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetState( unsigned uTask, TaskState_t eState, const char *pcName, uint64_t ullTime )
+{
+DecodeTask_t *pxTask = &( xTasks[ uTask ] );
+
+	if( pxTask->eState != eNone )
+	{
+		prvSlice( uTask, pxTask->cStateName, pxTask->ullStateStart, ullTime, ( pxTask->eState == eRunning ) ? "priority" : NULL, pxTask->uPriority );
+	}
+
+	pxTask->eState = eState;
+	pxTask->ullStateStart = ullTime;
+	snprintf( pxTask->cStateName, sizeof( pxTask->cStateName ), "%s", pcName );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSlice( unsigned long ulTrack, const char *pcName, uint64_t ullStart, uint64_t ullEnd, const char *pcArgName, unsigned uArg )
+{
+	if( ulTrack < decodeMAX_OBJECTS )
+	{
+		xTasks[ ulTrack ].iSeen = 1;
+	}
+
+	fprintf( pxOutput, "%s{\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f,\"name\":", iFirstOutput ? "" : ",\n", ulTrack, prvTime( ullStart ), prvTime( ullEnd ) - prvTime( ullStart ) );
+	prvString( pcName );
+	if( pcArgName != NULL )
+	{
+		fprintf( pxOutput, ",\"args\":{\"%s\":%u}", pcArgName, uArg );
+	}
+	fprintf( pxOutput, "}" );
+	iFirstOutput = 0;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInstant( unsigned long ulTrack, const char *pcName, uint64_t ullTime, const char *pcArgName, unsigned uArg )
+{
+	if( ulTrack < decodeMAX_OBJECTS )
+	{
+		xTasks[ ulTrack ].iSeen = 1;
+	}
+
+	fprintf( pxOutput, "%s{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"name\":", iFirstOutput ? "" : ",\n", ulTrack, prvTime( ullTime ) );
+	prvString( pcName );
+	if( pcArgName != NULL )
+	{
+		fprintf( pxOutput, ",\"args\":{\"%s\":%u}", pcArgName, uArg );
+	}
+	fprintf( pxOutput, "}" );
+	iFirstOutput = 0;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCounter( unsigned uQueue, unsigned uItems, uint64_t ullTime )
+{
+	fprintf( pxOutput, "%s{\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"name\":", iFirstOutput ? "" : ",\n", prvTime( ullTime ) );
+	prvString( prvQueueName( uQueue ) );
+	fprintf( pxOutput, ",\"args\":{\"items\":%u}}", uItems );
+	iFirstOutput = 0;
+}
+/*-----------------------------------------------------------*/
+
+static void prvString( const char *pcString )
+{
+	fputc( '"', pxOutput );
+	for( ; *pcString != '\0'; pcString++ )
+	{
+		if( ( *pcString == '"' ) || ( *pcString == '\\' ) )
+		{
+			fprintf( pxOutput, "\\%c", *pcString );
+		}
+		else if( ( unsigned char ) *pcString < 0x20U )
+		{
+			fprintf( pxOutput, "\\u%04x", ( unsigned ) ( unsigned char ) *pcString );
+		}
+		else
+		{
+			fputc( *pcString, pxOutput );
+		}
+	}
+	fputc( '"', pxOutput );
+}
+/*-----------------------------------------------------------*/
+
+static double prvTime( uint64_t ullTime )
+{
+	return ( ( double ) ( ullTime - ullTimeOrigin ) * 1000000.0 ) / ( double ) ulTimestampHz;
+}
+/*-----------------------------------------------------------*/
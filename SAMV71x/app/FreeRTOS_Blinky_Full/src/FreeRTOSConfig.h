@@ -112,13 +112,58 @@
 #define configUSE_APPLICATION_TASK_TAG			0
 #define configUSE_COUNTING_SEMAPHORES			1
 
+/* Set STATIC_ALLOCATION=1 in the compiler defines of the project to create the
+idle and timer tasks, and the queue and tasks of the blinky demo, in statically
+allocated memory, see main.c and main_blinky.c.  The blinky demo then does not
+use the heap at all and heap_4.c can be removed from its project.  The full
+demo keeps creating its other objects from the heap. */
+#ifndef STATIC_ALLOCATION
+	#define STATIC_ALLOCATION	0
+#endif
+#define configSUPPORT_STATIC_ALLOCATION			STATIC_ALLOCATION
+#if( ( STATIC_ALLOCATION == 1 ) && ( BLINKY == 1 ) )
+	#define configSUPPORT_DYNAMIC_ALLOCATION	0
+#endif
+
 /* The full demo always has tasks to run so the tick will never be turned off.
 The blinky demo will use the default tickless idle implementation to turn the
 tick off. */
 #define configUSE_TICKLESS_IDLE					0
 
-/* Run time stats gathering definitions. */
-#define configGENERATE_RUN_TIME_STATS	0
+/* Run time stats gathering definitions.  The full demo measures the CPU load of
+each task and of the tick and TC0 interrupts with cpu_load.c, clocked by the DWT
+core cycle counter, and prints it on the debug console (see main_full.c).  The
+task run time counters are clocked by ulCpuLoadGetTaskTime(), the cycle counter
+less the cycles spent in the accounted interrupts.  A TC channel can be the
+time base instead by reading its counter value register in
+configCPU_LOAD_COUNTER(), at a lower resolution.  The blinky demo and the
+kernel benchmark are built without, the benchmark times the context switch
+without the run time counter reads. */
+#if( ( BLINKY == 1 ) || ( KERNEL_BENCH == 1 ) )
+	#define configGENERATE_RUN_TIME_STATS	0
+#else
+	#define configGENERATE_RUN_TIME_STATS	1
+	#define configUSE_CPU_LOAD				1
+	#define configCPU_LOAD_MAX_TASKS		64
+	#define configCPU_LOAD_COUNTER()		( DWT->CYCCNT )
+	#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()	configBENCH_TIMESTAMP_INIT()
+	uint32_t ulCpuLoadGetTaskTime( void );
+	#define portGET_RUN_TIME_COUNTER_VALUE()			ulCpuLoadGetTaskTime()
+#endif
+
+/* Set TRACE_RECORDER=1 in the compiler defines of the Demo project to record
+the kernel events in RAM with trace_recorder.c, time stamped with the DWT core
+cycle counter (started in main.c).  To look at the last
+configTRACE_RECORDER_EVENTS events, halt the target, save the xTraceRecorder
+variable of trace_recorder.c to a file with the debugger, and convert the file
+with the decoder of the host build (../host/trace_decode.c). */
+#ifndef TRACE_RECORDER
+	#define TRACE_RECORDER	0
+#endif
+#define configUSE_TRACE_RECORDER			TRACE_RECORDER
+#define configTRACE_RECORDER_TIMESTAMP()	( DWT->CYCCNT )
+#define configTRACE_RECORDER_TIMESTAMP_HZ	configCPU_CLOCK_HZ
+#define configTRACE_RECORDER_EVENTS			( 2048 )
 
 /* This demo makes use of one or more example stats formatting functions.  These
 format the raw data provided by the uxTaskGetSystemState() function in to human
@@ -126,6 +171,24 @@ readable ASCII form.  See the notes in the implementation of vTaskList() within
 FreeRTOS/Source/tasks.c for limitations. */
 #define configUSE_STATS_FORMATTING_FUNCTIONS	1
 
+/* Time base of the kernel benchmark (KernelBench.c): the DWT core cycle
+counter.  Cortex-M7 locks the DWT registers after reset.  The report is output
+on the debug console. */
+#define configBENCH_TIMESTAMP_INIT()	{ CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; DWT->LAR = 0xC5ACCE55UL; DWT->CYCCNT = 0UL; DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; }
+#define configBENCH_TIMESTAMP()			( DWT->CYCCNT )
+#define configBENCH_TIMESTAMP_UNIT		"cycles"
+#define configBENCH_PRINTF( X )			printf X
+
+/* The kernel benchmark also times xTaskIncrementTick() up to the tick hook, see
+vApplicationTickHook() in main.c.  The delayed tasks and software timers it
+creates are limited to what the heap holds. */
+#define configBENCH_DELAYED_TASKS		32
+#define configBENCH_TIMERS				128
+#if( KERNEL_BENCH == 1 )
+	void vKernelBenchTickEntry( void );
+	#define traceTASK_INCREMENT_TICK( xTickCount )	vKernelBenchTickEntry()
+#endif
+
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 			0
 #define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
@@ -147,6 +210,7 @@ to exclude the API function. */
 #define INCLUDE_vTaskDelay				1
 #define INCLUDE_eTaskGetState			1
 #define INCLUDE_xTimerPendFunctionCall	1
+#define INCLUDE_xTaskGetIdleTaskHandle	1
 
 /* Cortex-M specific definitions. */
 #ifdef __NVIC_PRIO_BITS
@@ -178,10 +242,13 @@ header file. */
 #define configASSERT( x ) if( ( x ) == 0 ) { taskDISABLE_INTERRUPTS(); for( ;; ); }
 
 /* Definitions that map the FreeRTOS port interrupt handlers to their CMSIS
-standard names. */
+standard names.  With the run time stats SysTick_Handler() is defined in main.c,
+which accounts the time of the tick interrupt. */
 #define xPortPendSVHandler PendSV_Handler
 #define vPortSVCHandler SVC_Handler
-#define xPortSysTickHandler SysTick_Handler
+#if( configGENERATE_RUN_TIME_STATS == 0 )
+	#define xPortSysTickHandler SysTick_Handler
+#endif
 
 #endif /* FREERTOS_CONFIG_H */
 
@@ -89,6 +89,7 @@
 
 /* Scheduler includes. */
 #include "FreeRTOS.h"
+#include "cpu_load.h"
 
 /* Demo includes. */
 #include "IntQueueTimer.h"
@@ -124,6 +125,11 @@ timers must still be above the tick interrupt priority. */
 used as the time base for the run time stats. */
 volatile uint32_t ulHighFrequencyTimerCounts = 0;
 
+#if( configUSE_CPU_LOAD == 1 )
+	/* The number the CPU load of the TC0 interrupt is accounted under. */
+	static UBaseType_t uxTC0LoadISR;
+#endif
+
 /*-----------------------------------------------------------*/
 
 void vInitialiseTimerForIntQueueTest( void )
@@ -146,6 +152,12 @@ const uint32_t ulDivider = 128UL, ulTCCLKS = 3UL;
 	TC0->TC_CHANNEL[ tmrTC0_CHANNEL_1 ].TC_RC = ( configCPU_CLOCK_HZ / 2 ) / ( tmrTIMER_1_FREQUENCY * ulDivider );
 	TC0->TC_CHANNEL[ tmrTC0_CHANNEL_1 ].TC_IER = TC_IER_CPCS;
 
+	#if( configUSE_CPU_LOAD == 1 )
+	{
+		uxTC0LoadISR = uxCpuLoadRegisterISR( "TC0" );
+	}
+	#endif
+
     /* Configure and enable TC0 interrupt on RC compare. */ 
 	NVIC_SetPriority( TC0_IRQn, tmrLOWER_PRIORITY );
     NVIC_ClearPendingIRQ( TC0_IRQn );
@@ -170,6 +182,12 @@ const uint32_t ulDivider = 128UL, ulTCCLKS = 3UL;
 
 void TC0_Handler( void )
 {
+	#if( configUSE_CPU_LOAD == 1 )
+	{
+		vCpuLoadISREnter();
+	}
+	#endif
+
 	/* Read will clear the status bit. */
 	if( ( TC0->TC_CHANNEL[ tmrTC0_CHANNEL_0 ].TC_SR & tmrRC_COMPARE ) != 0 )
 	{
@@ -182,6 +200,12 @@ void TC0_Handler( void )
 		/* Call the IntQ test function for this channel. */
 		portYIELD_FROM_ISR( xSecondTimerHandler() );
 	}
+
+	#if( configUSE_CPU_LOAD == 1 )
+	{
+		vCpuLoadISRExit( uxTC0LoadISR );
+	}
+	#endif
 }
 /*-----------------------------------------------------------*/
 
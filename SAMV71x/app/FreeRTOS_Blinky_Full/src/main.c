@@ -88,6 +88,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "semphr.h"
+#include "cpu_load.h"
 
 /* Standard demo includes. */
 #include "TimerDemo.h"
@@ -95,6 +96,7 @@
 #include "EventGroupsDemo.h"
 #include "IntSemTest.h"
 #include "TaskNotify.h"
+#include "KernelBench.h"
 
 /* Library includes. */
 #include "board.h"
@@ -103,6 +105,18 @@
 or 0 to run the more comprehensive test and demo application. */
 #define mainCREATE_SIMPLE_BLINKY_DEMO_ONLY	BLINKY
 
+/* Set mainCREATE_KERNEL_BENCHMARK_ONLY to one (KERNEL_BENCH=1 in the compiler
+defines of the Demo project) to run the kernel benchmark, see KernelBench.c,
+instead of the comprehensive demo.  The report is output on the debug
+console. */
+#ifndef KERNEL_BENCH
+	#define KERNEL_BENCH	0
+#endif
+#define mainCREATE_KERNEL_BENCHMARK_ONLY	KERNEL_BENCH
+
+/* Priority of the kernel benchmark task, the task it wakes runs one higher. */
+#define mainBENCHMARK_PRIORITY				( tskIDLE_PRIORITY + 2UL )
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -126,6 +140,24 @@ void vApplicationMallocFailedHook( void );
 void vApplicationIdleHook( void );
 void vApplicationStackOverflowHook( TaskHandle_t pxTask, char *pcTaskName );
 void vApplicationTickHook( void );
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize );
+	void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize );
+#endif
+
+/* The tick interrupt handler of the port, called by SysTick_Handler() when the
+CPU load accounts the tick interrupt (see FreeRTOSConfig.h). */
+#if( configUSE_CPU_LOAD == 1 )
+	void SysTick_Handler( void );
+	void xPortSysTickHandler( void );
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( configUSE_CPU_LOAD == 1 )
+	/* The number cpu_load.c accounts the tick interrupt under. */
+	static UBaseType_t uxTickISR;
+#endif
 
 /*-----------------------------------------------------------*/
 
@@ -140,6 +172,11 @@ int main( void )
 	{
 		main_blinky();
 	}
+	#elif( mainCREATE_KERNEL_BENCHMARK_ONLY == 1 )
+	{
+		vStartKernelBenchmarkTask( mainBENCHMARK_PRIORITY );
+		vTaskStartScheduler();
+	}
 	#else
 	{
 		main_full();
@@ -161,6 +198,21 @@ static void prvSetupHardware( void )
 
     LED_Configure( 0 );
     LED_Configure( 1 );
+
+	#if( configUSE_TRACE_RECORDER == 1 )
+	{
+		/* The events are time stamped with the cycle counter, recording
+		starts before any kernel object is created so they are all named. */
+		configBENCH_TIMESTAMP_INIT();
+		vTraceRecorderStart();
+	}
+	#endif
+
+	#if( configUSE_CPU_LOAD == 1 )
+	{
+		uxTickISR = uxCpuLoadRegisterISR( "Tick" );
+	}
+	#endif
 }
 /*-----------------------------------------------------------*/
 
@@ -202,7 +254,16 @@ volatile size_t xFreeHeapSpace;
 	management options.  If there is a lot of heap memory free then the
 	configTOTAL_HEAP_SIZE value in FreeRTOSConfig.h can be reduced to free up
 	RAM. */
-	xFreeHeapSpace = xPortGetFreeHeapSize();
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		xFreeHeapSpace = xPortGetFreeHeapSize();
+	}
+	#else
+	{
+		/* There is no heap. */
+		xFreeHeapSpace = 0;
+	}
+	#endif
 
 	/* Remove compiler warning about xFreeHeapSpace being set but never used. */
 	( void ) xFreeHeapSpace;
@@ -211,7 +272,7 @@ volatile size_t xFreeHeapSpace;
 
 void vApplicationTickHook( void )
 {
-	#if mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 0
+	#if( ( mainCREATE_SIMPLE_BLINKY_DEMO_ONLY == 0 ) && ( mainCREATE_KERNEL_BENCHMARK_ONLY == 0 ) )
 	{
 		/* The full demo includes a software timer demo/test that requires
 		prodding periodically from the tick interrupt. */
@@ -229,10 +290,58 @@ void vApplicationTickHook( void )
 		/* Call the code that 'gives' a task notification from an ISR. */
 		xNotifyTaskFromISR();
 	}
+	#elif( mainCREATE_KERNEL_BENCHMARK_ONLY == 1 )
+	{
+		/* End of the tick processing timed by the kernel benchmark. */
+		vKernelBenchTickHook();
+	}
 	#endif
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_CPU_LOAD == 1 )
+
+	void SysTick_Handler( void )
+	{
+		/* The time of the tick interrupt, the tick hook included, is accounted
+		apart from the time of the task it interrupted. */
+		vCpuLoadISREnter();
+		xPortSysTickHandler();
+		vCpuLoadISRExit( uxTickISR );
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_CPU_LOAD */
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize )
+	{
+	static StaticTask_t xIdleTaskTCB;
+	static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+		/* Called by vTaskStartScheduler() for the memory of the idle task when
+		configSUPPORT_STATIC_ALLOCATION is 1. */
+		*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+		*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+		*pusIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize )
+	{
+	static StaticTask_t xTimerTaskTCB;
+	static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
+
+		/* As vApplicationGetIdleTaskMemory(), for the timer service task. */
+		*ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+		*ppxTimerTaskStackBuffer = uxTimerTaskStack;
+		*pusTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
 /* Just to keep the linker happy. */
 int __write( int x );
 int __write( int x )
@@ -147,25 +147,53 @@ static void prvQueueSendTask( void *pvParameters );
 /* The queue used by both tasks. */
 static QueueHandle_t xQueue = NULL;
 
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	/* The memory of the queue and of the tasks when they are created
+	statically, see configSUPPORT_STATIC_ALLOCATION in FreeRTOSConfig.h. */
+	static StaticQueue_t xStaticQueue;
+	static uint8_t ucQueueStorage[ mainQUEUE_LENGTH * sizeof( uint32_t ) ];
+	static StaticTask_t xRxTaskTCB, xTxTaskTCB;
+	static StackType_t uxRxTaskStack[ configMINIMAL_STACK_SIZE ], uxTxTaskStack[ configMINIMAL_STACK_SIZE ];
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 void main_blinky( void )
 {
 	/* Create the queue. */
-	xQueue = xQueueCreate( mainQUEUE_LENGTH, sizeof( uint32_t ) );
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+		xQueue = xQueueCreateStatic( mainQUEUE_LENGTH, sizeof( uint32_t ), ucQueueStorage, &xStaticQueue );
+	}
+	#else
+	{
+		xQueue = xQueueCreate( mainQUEUE_LENGTH, sizeof( uint32_t ) );
+	}
+	#endif
 
 	if( xQueue != NULL )
 	{
 		/* Start the two tasks as described in the comments at the top of this
 		file. */
-		xTaskCreate( prvQueueReceiveTask,				/* The function that implements the task. */
-					"Rx", 								/* The text name assigned to the task - for debug only as it is not used by the kernel. */
-					configMINIMAL_STACK_SIZE, 			/* The size of the stack to allocate to the task. */
-					NULL, 								/* The parameter passed to the task - not used in this case. */
-					mainQUEUE_RECEIVE_TASK_PRIORITY, 	/* The priority assigned to the task. */
-					NULL );								/* The task handle is not required, so NULL is passed. */
-
-		xTaskCreate( prvQueueSendTask, "TX", configMINIMAL_STACK_SIZE, NULL, mainQUEUE_SEND_TASK_PRIORITY, NULL );
+		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		{
+			xTaskCreateStatic( prvQueueReceiveTask, "Rx", configMINIMAL_STACK_SIZE, NULL, mainQUEUE_RECEIVE_TASK_PRIORITY, uxRxTaskStack, &xRxTaskTCB );
+			xTaskCreateStatic( prvQueueSendTask, "TX", configMINIMAL_STACK_SIZE, NULL, mainQUEUE_SEND_TASK_PRIORITY, uxTxTaskStack, &xTxTaskTCB );
+		}
+		#else
+		{
+			xTaskCreate( prvQueueReceiveTask,				/* The function that implements the task. */
+						"Rx", 								/* The text name assigned to the task - for debug only as it is not used by the kernel. */
+						configMINIMAL_STACK_SIZE, 			/* The size of the stack to allocate to the task. */
+						NULL, 								/* The parameter passed to the task - not used in this case. */
+						mainQUEUE_RECEIVE_TASK_PRIORITY, 	/* The priority assigned to the task. */
+						NULL );								/* The task handle is not required, so NULL is passed. */
+
+			xTaskCreate( prvQueueSendTask, "TX", configMINIMAL_STACK_SIZE, NULL, mainQUEUE_SEND_TASK_PRIORITY, NULL );
+		}
+		#endif
 
 		/* Start the tasks and timer running. */
 		vTaskStartScheduler();
@@ -105,6 +105,12 @@
  * toggles every three seconds, then no issues have been discovered.  If the LED
  * toggles every 200ms, then an issue has been discovered with at least one
  * task.
+ *
+ * "CPU load" task - Starts sampling the CPU load (Source/cpu_load.c), then
+ * every 10 seconds prints the load of each task and of the tick and TC0
+ * interrupts over the last second and the last 10 seconds on the debug
+ * console.  It runs at a low priority so the printing does not delay the
+ * tasks that check their timing.
  */
 
 /* Standard includes. */
@@ -115,6 +121,7 @@
 #include "task.h"
 #include "timers.h"
 #include "semphr.h"
+#include "cpu_load.h"
 
 /* Standard demo application includes. */
 #include "flop.h"
@@ -145,6 +152,7 @@
 #define mainCOM_TEST_TASK_PRIORITY			( tskIDLE_PRIORITY + 2 )
 #define mainCHECK_TASK_PRIORITY				( configMAX_PRIORITIES - 1 )
 #define mainQUEUE_OVERWRITE_PRIORITY		( tskIDLE_PRIORITY )
+#define mainCPU_LOAD_TASK_PRIORITY			( tskIDLE_PRIORITY + 1UL )
 
 /* The initial priority used by the UART command console task. */
 #define mainUART_COMMAND_CONSOLE_TASK_PRIORITY	( configMAX_PRIORITIES - 2 )
@@ -173,6 +181,13 @@ purpose of ensuring parameters are passed into tasks correctly. */
 /* The base period used by the timer test tasks. */
 #define mainTIMER_TEST_PERIOD				( 50 )
 
+/* The period at which the CPU load is printed, the stack of the task printing
+it (sprintf() and printf() are called) and the size of the buffer the load
+table is written to. */
+#define mainCPU_LOAD_REPORT_PERIOD			( 10000UL / portTICK_PERIOD_MS )
+#define mainCPU_LOAD_STACK_SIZE				( configMINIMAL_STACK_SIZE * 4UL )
+#define mainCPU_LOAD_BUFFER_SIZE			( 2048 )
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -186,6 +201,13 @@ void main_full( void );
  */
 static void prvCheckTask( void *pvParameters );
 
+/*
+ * The CPU load task, as described at the top of this file.
+ */
+#if( configUSE_CPU_LOAD == 1 )
+	static void prvCpuLoadTask( void *pvParameters );
+#endif
+
 /*
  * Register check tasks, and the tasks used to write over and check the contents
  * of the FPU registers, as described at the top of this file.  The nature of
@@ -236,6 +258,12 @@ void main_full( void )
 	the top of this file. */
 	xTaskCreate( prvCheckTask, "Check", configMINIMAL_STACK_SIZE, NULL, mainCHECK_TASK_PRIORITY, NULL );
 
+	#if( configUSE_CPU_LOAD == 1 )
+	{
+		xTaskCreate( prvCpuLoadTask, "Load", mainCPU_LOAD_STACK_SIZE, NULL, mainCPU_LOAD_TASK_PRIORITY, NULL );
+	}
+	#endif
+
 	/* The set of tasks created by the following function call have to be
 	created last as they keep account of the number of tasks they expect to see
 	running. */
@@ -389,6 +417,37 @@ unsigned long ulErrorFound = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_CPU_LOAD == 1 )
+
+	static void prvCpuLoadTask( void *pvParameters )
+	{
+	static char cLoadTable[ mainCPU_LOAD_BUFFER_SIZE ];
+	TickType_t xLastExecutionTime;
+
+		/* Just to stop compiler warnings. */
+		( void ) pvParameters;
+
+		/* Started from a task as the timer demo fills the timer command queue
+		before the scheduler is started. */
+		if( xCpuLoadStart() != pdPASS )
+		{
+			configASSERT( ( volatile void * ) NULL );
+		}
+
+		xLastExecutionTime = xTaskGetTickCount();
+
+		for( ;; )
+		{
+			vTaskDelayUntil( &xLastExecutionTime, mainCPU_LOAD_REPORT_PERIOD );
+
+			vCpuLoadGetStats( cLoadTable, sizeof( cLoadTable ) );
+			printf( "%s\r\n", cLoadTable );
+		}
+	}
+
+#endif /* configUSE_CPU_LOAD */
+/*-----------------------------------------------------------*/
+
 static void prvRegTestTaskEntry1( void *pvParameters )
 {
 	/* Although the regtest task is written in assembler, its entry point is
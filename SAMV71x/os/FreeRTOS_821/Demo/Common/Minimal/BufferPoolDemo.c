@@ -0,0 +1,650 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the buffer pools and message queues of buffer_pool.c.
+ *
+ * The controller task first runs tests that need no other task.  Every buffer
+ * of a pool is taken, each distinct and aligned, then filled with a pattern
+ * that must survive the other buffers being filled.  Taking from the empty
+ * pool fails, at once without a block time and once the block time expires
+ * with one, after which a release must return the buffer to the pool rather
+ * than hand it over to a task that has stopped waiting.  A buffer sent to a
+ * message queue is received back unchanged.
+ *
+ * It then releases buffers to two higher priority waiter tasks blocked taking
+ * from the empty pool.  Each release must hand its buffer over to the higher
+ * priority waiter, even though it blocked last, before the release returns,
+ * and the buffer must not go back to the pool.  The next release goes to the
+ * other waiter.
+ *
+ * A lower priority waiter then blocks with a short block time, which the
+ * controller lets expire without letting the waiter run.  A buffer released
+ * before the waiter runs again must still be handed over to it.
+ *
+ * A producer and a consumer task also pass buffers through a message queue
+ * longer than the pool.  The producer has the higher priority, so it keeps
+ * blocking on the empty pool until a buffer released by the consumer is
+ * handed over to it.  The consumer checks the sequence number and pattern
+ * written by the producer in each buffer.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "buffer_pool.h"
+
+/* Demo program include files. */
+#include "BufferPoolDemo.h"
+
+/* The priorities of the tasks, as described at the top of this file. */
+#define bpLOWER_PRIORITY			( tskIDLE_PRIORITY )
+#define bpHIGHER_PRIORITY			( tskIDLE_PRIORITY + 1 )
+#define bpCONTROLLER_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define bpMEDIUM_PRIORITY			( tskIDLE_PRIORITY + 2 )
+#define bpHIGH_PRIORITY				( tskIDLE_PRIORITY + 3 )
+
+#define bpDONT_BLOCK				( ( TickType_t ) 0 )
+#define bpSHORT_DELAY				pdMS_TO_TICKS( 20 )
+
+/* The block time of the lower priority waiter, and the number of times the
+controller delays for a tick waiting for it to block or to run. */
+#define bpLATE_BLOCK_TIME			( ( TickType_t ) 5 )
+#define bpMAX_POLLS					( 200 )
+
+/* The pool of the controller task tests. */
+#define bpBUFFER_COUNT				( ( UBaseType_t ) 3 )
+#define bpBUFFER_SIZE				( ( size_t ) 100 )
+
+/* The pool and message queue of the streaming tasks.  The first word of each
+buffer holds its sequence number. */
+#define bpSTREAM_BUFFER_COUNT		( ( UBaseType_t ) 2 )
+#define bpSTREAM_BUFFER_SIZE		( ( size_t ) 64 )
+#define bpSTREAM_QUEUE_LENGTH		( ( UBaseType_t ) 4 )
+
+/* Indexes of the blocked waiters. */
+#define bpMEDIUM_TASK				( 0 )
+#define bpHIGH_TASK					( 1 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks as described at the top of this file.
+ */
+static void prvControllerTask( void *pvParameters );
+static void prvWaiterTask( void *pvParameters );
+static void prvLateWaiterTask( void *pvParameters );
+static void prvProducerTask( void *pvParameters );
+static void prvConsumerTask( void *pvParameters );
+
+/*
+ * The tests of the controller task.
+ */
+static void prvSingleTaskTests( void );
+static void prvHandOverTests( void );
+static void prvLateHandOverTests( void );
+
+/*
+ * Fill the xLength bytes of pucBuffer with a pattern derived from ucSeed, or
+ * check they hold that pattern, latching an error if not.
+ */
+static void prvFillBuffer( uint8_t *pucBuffer, size_t xLength, uint8_t ucSeed );
+static void prvCheckBuffer( const uint8_t *pucBuffer, size_t xLength, uint8_t ucSeed );
+
+/*
+ * Delay a tick at a time until the task xTask is blocked, latching an error if
+ * it takes too long.
+ */
+static void prvWaitUntilBlocked( TaskHandle_t xTask );
+
+/*-----------------------------------------------------------*/
+
+/* Used to latch errors during the test's execution. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* Incremented by the controller task, and by the consumer, to show they are
+still running. */
+static volatile uint32_t ulControllerCycles = 0UL, ulConsumerCycles = 0UL;
+
+/* The pool and message queue of the controller task tests, and the buffers
+taken from the pool. */
+static BufferPoolHandle_t xPool = NULL;
+static QueueHandle_t xTestQueue = NULL;
+static uint8_t *pucBuffers[ bpBUFFER_COUNT ];
+
+/* The waiters, and the buffers they were handed over, NULL until they took
+one. */
+static TaskHandle_t xWaiterTasks[ 2 ] = { NULL, NULL }, xLateWaiterTask = NULL;
+static uint8_t * volatile pucWaiterBuffers[ 2 ] = { NULL, NULL };
+static uint8_t * volatile pucLateWaiterBuffer = NULL;
+static volatile BaseType_t xLateWaiterDone = pdFALSE;
+
+/* The pool and message queue of the streaming tasks. */
+static BufferPoolHandle_t xStreamPool = NULL;
+static QueueHandle_t xStreamQueue = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vStartBufferPoolTasks( void )
+{
+	xPool = xBufferPoolCreate( bpBUFFER_COUNT, bpBUFFER_SIZE );
+	xTestQueue = xMessageQueueCreate( bpBUFFER_COUNT );
+	xStreamPool = xBufferPoolCreate( bpSTREAM_BUFFER_COUNT, bpSTREAM_BUFFER_SIZE );
+	xStreamQueue = xMessageQueueCreate( bpSTREAM_QUEUE_LENGTH );
+	configASSERT( xPool );
+	configASSERT( xTestQueue );
+	configASSERT( xStreamPool );
+	configASSERT( xStreamQueue );
+
+	xTaskCreate( prvControllerTask, "BPCtrl", configMINIMAL_STACK_SIZE, NULL, bpCONTROLLER_PRIORITY, NULL );
+	xTaskCreate( prvWaiterTask, "BPWait1", configMINIMAL_STACK_SIZE, ( void * ) bpMEDIUM_TASK, bpMEDIUM_PRIORITY, &( xWaiterTasks[ bpMEDIUM_TASK ] ) );
+	xTaskCreate( prvWaiterTask, "BPWait2", configMINIMAL_STACK_SIZE, ( void * ) bpHIGH_TASK, bpHIGH_PRIORITY, &( xWaiterTasks[ bpHIGH_TASK ] ) );
+	xTaskCreate( prvLateWaiterTask, "BPLate", configMINIMAL_STACK_SIZE, NULL, bpLOWER_PRIORITY, &xLateWaiterTask );
+
+	xTaskCreate( prvProducerTask, "BPProd", configMINIMAL_STACK_SIZE, NULL, bpHIGHER_PRIORITY, NULL );
+	xTaskCreate( prvConsumerTask, "BPCons", configMINIMAL_STACK_SIZE, NULL, bpLOWER_PRIORITY, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControllerTask( void *pvParameters )
+{
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		prvSingleTaskTests();
+		prvHandOverTests();
+		prvLateHandOverTests();
+
+		/* Incremented to show the task is still running. */
+		ulControllerCycles++;
+
+		/* Leave the streaming tasks of the lower priority a chance to run. */
+		vTaskDelay( bpSHORT_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSingleTaskTests( void )
+{
+UBaseType_t ux, uxOther;
+TickType_t xTimeBefore;
+uint8_t *pucBuffer;
+
+	if( ( uxBufferPoolGetFreeCount( xPool ) != bpBUFFER_COUNT ) || ( xBufferPoolGetBufferSize( xPool ) != bpBUFFER_SIZE ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Every buffer can be taken, each distinct and aligned, and none overlaps
+	another. */
+	for( ux = 0; ux < bpBUFFER_COUNT; ux++ )
+	{
+		pucBuffers[ ux ] = ( uint8_t * ) pvBufferPoolTake( xPool, bpDONT_BLOCK );
+
+		if( pucBuffers[ ux ] == NULL )
+		{
+			/* The other tests would use the NULL buffer. */
+			xErrorStatus = pdFAIL;
+			vTaskSuspend( NULL );
+		}
+
+		if( ( ( ( size_t ) pucBuffers[ ux ] ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) != 0 )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		for( uxOther = 0; uxOther < ux; uxOther++ )
+		{
+			if( pucBuffers[ uxOther ] == pucBuffers[ ux ] )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+
+		if( uxBufferPoolGetFreeCount( xPool ) != ( bpBUFFER_COUNT - ux - 1 ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		prvFillBuffer( pucBuffers[ ux ], bpBUFFER_SIZE, ( uint8_t ) ( ux + ulControllerCycles ) );
+	}
+
+	for( ux = 0; ux < bpBUFFER_COUNT; ux++ )
+	{
+		prvCheckBuffer( pucBuffers[ ux ], bpBUFFER_SIZE, ( uint8_t ) ( ux + ulControllerCycles ) );
+	}
+
+	/* The pool is empty, taking fails at once without a block time. */
+	if( pvBufferPoolTake( xPool, bpDONT_BLOCK ) != NULL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* And once the block time expires with one. */
+	xTimeBefore = xTaskGetTickCount();
+	if( pvBufferPoolTake( xPool, bpSHORT_DELAY ) != NULL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeBefore ) < bpSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* No task is waiting any more, so a released buffer goes back to the
+	pool, and is the next one taken. */
+	vBufferPoolRelease( pucBuffers[ 0 ] );
+
+	if( uxBufferPoolGetFreeCount( xPool ) != 1 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( pvBufferPoolTake( xPool, bpDONT_BLOCK ) != pucBuffers[ 0 ] )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* A message queue holds the buffers themselves, not copies, and they are
+	not back in the pool while it does. */
+	for( ux = 0; ux < bpBUFFER_COUNT; ux++ )
+	{
+		if( xMessageQueueSend( xTestQueue, pucBuffers[ ux ], bpDONT_BLOCK ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	if( uxBufferPoolGetFreeCount( xPool ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	for( ux = 0; ux < bpBUFFER_COUNT; ux++ )
+	{
+		pucBuffer = ( uint8_t * ) pvMessageQueueReceive( xTestQueue, bpDONT_BLOCK );
+
+		if( pucBuffer != pucBuffers[ ux ] )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			prvCheckBuffer( pucBuffer, bpBUFFER_SIZE, ( uint8_t ) ( ux + ulControllerCycles ) );
+		}
+	}
+
+	if( pvMessageQueueReceive( xTestQueue, bpDONT_BLOCK ) != NULL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The buffers are left taken for the hand over tests. */
+}
+/*-----------------------------------------------------------*/
+
+static void prvHandOverTests( void )
+{
+	/* The controller holds every buffer.  The waiters run as soon as they are
+	resumed and block taking from the empty pool, the high priority waiter
+	last. */
+	pucWaiterBuffers[ bpMEDIUM_TASK ] = NULL;
+	pucWaiterBuffers[ bpHIGH_TASK ] = NULL;
+	vTaskResume( xWaiterTasks[ bpMEDIUM_TASK ] );
+	vTaskResume( xWaiterTasks[ bpHIGH_TASK ] );
+
+	if( ( eTaskGetState( xWaiterTasks[ bpMEDIUM_TASK ] ) != eBlocked ) || ( eTaskGetState( xWaiterTasks[ bpHIGH_TASK ] ) != eBlocked ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The high priority waiter is handed the buffer, and has filled it and
+	suspended itself, before the release returns. */
+	vBufferPoolRelease( pucBuffers[ 0 ] );
+
+	if( ( pucWaiterBuffers[ bpHIGH_TASK ] != pucBuffers[ 0 ] ) || ( pucWaiterBuffers[ bpMEDIUM_TASK ] != NULL ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( eTaskGetState( xWaiterTasks[ bpHIGH_TASK ] ) != eSuspended ) || ( eTaskGetState( xWaiterTasks[ bpMEDIUM_TASK ] ) != eBlocked ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The next release goes to the other waiter. */
+	vBufferPoolRelease( pucBuffers[ 1 ] );
+
+	if( ( pucWaiterBuffers[ bpMEDIUM_TASK ] != pucBuffers[ 1 ] ) || ( eTaskGetState( xWaiterTasks[ bpMEDIUM_TASK ] ) != eSuspended ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Neither buffer went back to the pool. */
+	if( uxBufferPoolGetFreeCount( xPool ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	prvCheckBuffer( pucBuffers[ 0 ], bpBUFFER_SIZE, ( uint8_t ) bpHIGH_TASK );
+	prvCheckBuffer( pucBuffers[ 1 ], bpBUFFER_SIZE, ( uint8_t ) bpMEDIUM_TASK );
+
+	/* The waiters leave their buffers to the controller, which still holds
+	the last one, so the pool stays empty for prvLateHandOverTests(). */
+}
+/*-----------------------------------------------------------*/
+
+static void prvLateHandOverTests( void )
+{
+TickType_t xTimeBefore;
+UBaseType_t ux;
+BaseType_t x;
+
+	xLateWaiterDone = pdFALSE;
+	pucLateWaiterBuffer = NULL;
+
+	/* The waiter has a lower priority, so only blocks once the controller
+	delays. */
+	vTaskResume( xLateWaiterTask );
+	prvWaitUntilBlocked( xLateWaiterTask );
+
+	/* Let its block time expire without delaying, so it is ready but cannot
+	run and leave the tasks waiting on the pool. */
+	xTimeBefore = xTaskGetTickCount();
+	while( ( xTaskGetTickCount() - xTimeBefore ) <= ( bpLATE_BLOCK_TIME + 1 ) )
+	{
+		/* Wait for the tick. */
+	}
+
+	if( eTaskGetState( xLateWaiterTask ) != eReady )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The waiter is still counted as waiting, so the buffer is handed over to
+	it rather than returned to the pool. */
+	vBufferPoolRelease( pucBuffers[ 2 ] );
+
+	if( uxBufferPoolGetFreeCount( xPool ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	for( x = 0; ( x < bpMAX_POLLS ) && ( xLateWaiterDone == pdFALSE ); x++ )
+	{
+		vTaskDelay( ( TickType_t ) 1 );
+	}
+
+	if( pucLateWaiterBuffer != pucBuffers[ 2 ] )
+	{
+		/* The buffer is lost, stop before the other tests run short of
+		buffers. */
+		xErrorStatus = pdFAIL;
+		vTaskSuspend( NULL );
+	}
+
+	/* Every buffer is back in the pool once released. */
+	for( ux = 0; ux < bpBUFFER_COUNT; ux++ )
+	{
+		vBufferPoolRelease( pucBuffers[ ux ] );
+	}
+
+	if( uxBufferPoolGetFreeCount( xPool ) != bpBUFFER_COUNT )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitUntilBlocked( TaskHandle_t xTask )
+{
+BaseType_t x;
+
+	for( x = 0; ( x < bpMAX_POLLS ) && ( eTaskGetState( xTask ) != eBlocked ); x++ )
+	{
+		vTaskDelay( ( TickType_t ) 1 );
+	}
+
+	if( eTaskGetState( xTask ) != eBlocked )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaiterTask( void *pvParameters )
+{
+const UBaseType_t uxTask = ( UBaseType_t ) ( ( size_t ) pvParameters );
+uint8_t *pucBuffer;
+
+	for( ;; )
+	{
+		/* Resumed by the controller. */
+		vTaskSuspend( NULL );
+
+		pucBuffer = ( uint8_t * ) pvBufferPoolTake( xPool, portMAX_DELAY );
+
+		if( pucBuffer == NULL )
+		{
+			/* The block time is unlimited. */
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			prvFillBuffer( pucBuffer, bpBUFFER_SIZE, ( uint8_t ) uxTask );
+		}
+
+		pucWaiterBuffers[ uxTask ] = pucBuffer;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvLateWaiterTask( void *pvParameters )
+{
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Resumed by the controller. */
+		vTaskSuspend( NULL );
+
+		/* The block time expires before the buffer is released, yet the
+		buffer is still received. */
+		pucLateWaiterBuffer = ( uint8_t * ) pvBufferPoolTake( xPool, bpLATE_BLOCK_TIME );
+		xLateWaiterDone = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProducerTask( void *pvParameters )
+{
+uint32_t ulNext = 0UL;
+uint8_t *pucBuffer;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Blocks once the two buffers are in the queue, until the consumer
+		releases one. */
+		pucBuffer = ( uint8_t * ) pvBufferPoolTake( xStreamPool, portMAX_DELAY );
+
+		if( pucBuffer == NULL )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			*( ( uint32_t * ) pucBuffer ) = ulNext; /*lint !e826 The buffers are aligned. */
+			prvFillBuffer( pucBuffer + sizeof( uint32_t ), bpSTREAM_BUFFER_SIZE - sizeof( uint32_t ), ( uint8_t ) ulNext );
+			ulNext++;
+
+			if( xMessageQueueSend( xStreamQueue, pucBuffer, portMAX_DELAY ) != pdPASS )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsumerTask( void *pvParameters )
+{
+uint32_t ulExpected = 0UL;
+uint8_t *pucBuffer;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		pucBuffer = ( uint8_t * ) pvMessageQueueReceive( xStreamQueue, portMAX_DELAY );
+
+		if( pucBuffer == NULL )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			if( *( ( uint32_t * ) pucBuffer ) != ulExpected ) /*lint !e826 The buffers are aligned. */
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			prvCheckBuffer( pucBuffer + sizeof( uint32_t ), bpSTREAM_BUFFER_SIZE - sizeof( uint32_t ), ( uint8_t ) ulExpected );
+			ulExpected++;
+
+			/* Hands the buffer over to the producer, which preempts this task
+			before the release returns. */
+			vBufferPoolRelease( pucBuffer );
+		}
+
+		ulConsumerCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvFillBuffer( uint8_t *pucBuffer, size_t xLength, uint8_t ucSeed )
+{
+size_t x;
+
+	for( x = 0; x < xLength; x++ )
+	{
+		pucBuffer[ x ] = ( uint8_t ) ( ucSeed + ( uint8_t ) x );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckBuffer( const uint8_t *pucBuffer, size_t xLength, uint8_t ucSeed )
+{
+size_t x;
+
+	for( x = 0; x < xLength; x++ )
+	{
+		if( pucBuffer[ x ] != ( uint8_t ) ( ucSeed + ( uint8_t ) x ) )
+		{
+			xErrorStatus = pdFAIL;
+			break;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreBufferPoolTasksStillRunning( void )
+{
+static uint32_t ulLastControllerCycles = 0UL, ulLastConsumerCycles = 0UL;
+
+	if( ulLastControllerCycles == ulControllerCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastControllerCycles = ulControllerCycles;
+	}
+
+	if( ulLastConsumerCycles == ulConsumerCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastConsumerCycles = ulConsumerCycles;
+	}
+
+	return xErrorStatus;
+}
+/*-----------------------------------------------------------*/
+
@@ -0,0 +1,614 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the fast semaphores and mutexes of Source/fast_semaphore.c, in
+ * particular their kernel paths, taken once a task blocks and the waiting flag
+ * of the state word is set.
+ *
+ * The controller task runs at fsCONTROLLER_PRIORITY and, on each cycle:
+ *
+ * - Checks a counting semaphore on its own: a take with a block time fails
+ *   once the time has expired, gives fail above the maximum count, and the
+ *   give that follows the expired take, which finds the waiting flag still set
+ *   but no task to wake, is counted all the same.
+ *
+ * - Gives a binary semaphore two higher priority waiter tasks block on.  Each
+ *   give must wake the highest priority waiter, even when it blocked last,
+ *   which runs before the give returns.
+ *
+ * - Gives a semaphore a task of its own priority blocks on, then takes it
+ *   back before that task runs.  The task finds the semaphore taken when it
+ *   runs and must block again for the rest of its block time only.
+ *
+ * - Takes a fast mutex, then resumes a higher priority task that blocks taking
+ *   it.  The controller must inherit the priority of that task, keep it while
+ *   it gives back a second mutex it also holds, and go back to its own
+ *   priority when it gives back the mutex the task waits for, the task taking
+ *   it before the give returns.  The same is checked when the block time of
+ *   the task expires before the mutex is given back.
+ *
+ * Two tasks at the idle priority take a shared fast mutex and yield while
+ * holding it, so the other keeps blocking on it and every give goes through
+ * the kernel path.  A task finding the other in the mutex latches an error.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fast_semaphore.h"
+
+/* Demo program include files. */
+#include "FastSemaphoreDemo.h"
+
+/* The priorities of the tasks, as described at the top of this file. */
+#define fsCONTENDING_PRIORITY		( tskIDLE_PRIORITY )
+#define fsCONTROLLER_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define fsSTOLEN_WAKE_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define fsMEDIUM_WAITER_PRIORITY	( tskIDLE_PRIORITY + 2 )
+#define fsHIGH_WAITER_PRIORITY		( tskIDLE_PRIORITY + 3 )
+#define fsMUTEX_TASK_PRIORITY		( tskIDLE_PRIORITY + 3 )
+
+#define fsDONT_BLOCK				( ( TickType_t ) 0 )
+#define fsSHORT_DELAY				pdMS_TO_TICKS( 20 )
+
+/* The block time of the task woken by a give of the semaphore taken back
+before it runs, and the extra time it may take to return.  The give comes
+half way through the block time, so a task blocking again for its whole block
+time returns well after the margin. */
+#define fsSTOLEN_WAKE_BLOCK			pdMS_TO_TICKS( 100 )
+#define fsSTOLEN_WAKE_MARGIN		pdMS_TO_TICKS( 30 )
+
+/* The maximum count of the counting semaphore. */
+#define fsMAX_COUNT					( ( UBaseType_t ) 3 )
+
+/* Values recorded by the waiter tasks for the order they are woken in. */
+#define fsMEDIUM_WAITER				( ( uint8_t ) 1 )
+#define fsHIGH_WAITER				( ( uint8_t ) 2 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks as described at the top of this file.
+ */
+static void prvControllerTask( void *pvParameters );
+static void prvWaiterTask( void *pvParameters );
+static void prvStolenWakeTask( void *pvParameters );
+static void prvMutexTask( void *pvParameters );
+static void prvContendingTask( void *pvParameters );
+
+/*
+ * The tests of the controller task.
+ */
+static void prvCountingSemaphoreTests( void );
+static void prvPriorityWakeTests( void );
+static void prvStolenWakeTests( void );
+static void prvMutexInheritanceTests( void );
+
+/*-----------------------------------------------------------*/
+
+/* Used to latch errors during the test's execution. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* Incremented by the tasks to show they are still running. */
+static volatile uint32_t ulControllerCycles = 0UL, ulContendingCycles[ 2 ] = { 0UL, 0UL };
+
+/* The semaphores and mutexes of the tests. */
+static FastSemaphoreHandle_t xCountingSemaphore = NULL, xWakeSemaphore = NULL, xStolenSemaphore = NULL;
+static FastSemaphoreHandle_t xInheritedMutex = NULL, xOtherMutex = NULL, xContendedMutex = NULL;
+
+/* The order the waiter tasks are woken in, and how many were woken. */
+static volatile uint8_t ucWakeOrder[ 3 ];
+static volatile UBaseType_t uxWoken = 0;
+
+/* The tasks the controller suspends or resumes, the block time the mutex task
+takes the mutex with, and the results of both. */
+static TaskHandle_t xHighWaiterTask = NULL, xStolenWakeTask = NULL, xMutexTask = NULL;
+static volatile TickType_t xMutexBlockTime = 0, xStolenWakeTime = 0;
+static volatile BaseType_t xMutexResult = pdFAIL, xStolenWakeResult = pdPASS;
+static volatile uint32_t ulMutexTaskCycles = 0UL;
+
+/* The contending task holding xContendedMutex, 0 if none. */
+static volatile UBaseType_t uxContendedOwner = 0;
+
+/*-----------------------------------------------------------*/
+
+void vStartFastSemaphoreTasks( void )
+{
+	xCountingSemaphore = xFastSemaphoreCreateCounting( fsMAX_COUNT, 0 );
+	xWakeSemaphore = xFastSemaphoreCreateBinary();
+	xStolenSemaphore = xFastSemaphoreCreateBinary();
+	xInheritedMutex = xFastSemaphoreCreateMutex();
+	xOtherMutex = xFastSemaphoreCreateMutex();
+	xContendedMutex = xFastSemaphoreCreateMutex();
+	configASSERT( xCountingSemaphore );
+	configASSERT( xWakeSemaphore );
+	configASSERT( xStolenSemaphore );
+	configASSERT( xInheritedMutex );
+	configASSERT( xOtherMutex );
+	configASSERT( xContendedMutex );
+
+	xTaskCreate( prvControllerTask, "FSCtrl", configMINIMAL_STACK_SIZE, NULL, fsCONTROLLER_PRIORITY, NULL );
+	xTaskCreate( prvWaiterTask, "FSWait1", configMINIMAL_STACK_SIZE, ( void * ) fsMEDIUM_WAITER, fsMEDIUM_WAITER_PRIORITY, NULL );
+	xTaskCreate( prvWaiterTask, "FSWait2", configMINIMAL_STACK_SIZE, ( void * ) fsHIGH_WAITER, fsHIGH_WAITER_PRIORITY, &xHighWaiterTask );
+	xTaskCreate( prvStolenWakeTask, "FSStolen", configMINIMAL_STACK_SIZE, NULL, fsSTOLEN_WAKE_PRIORITY, &xStolenWakeTask );
+	xTaskCreate( prvMutexTask, "FSMutex", configMINIMAL_STACK_SIZE, NULL, fsMUTEX_TASK_PRIORITY, &xMutexTask );
+	xTaskCreate( prvContendingTask, "FSCont1", configMINIMAL_STACK_SIZE, ( void * ) 1, fsCONTENDING_PRIORITY, NULL );
+	xTaskCreate( prvContendingTask, "FSCont2", configMINIMAL_STACK_SIZE, ( void * ) 2, fsCONTENDING_PRIORITY, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControllerTask( void *pvParameters )
+{
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		prvCountingSemaphoreTests();
+		prvPriorityWakeTests();
+		prvStolenWakeTests();
+		prvMutexInheritanceTests();
+
+		/* Incremented to show the task is still running. */
+		ulControllerCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCountingSemaphoreTests( void )
+{
+TickType_t xTimeBefore;
+UBaseType_t ux;
+
+	/* Nothing to take, the block time expires. */
+	xTimeBefore = xTaskGetTickCount();
+	if( xFastSemaphoreTake( xCountingSemaphore, fsSHORT_DELAY ) != pdFAIL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeBefore ) < fsSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The task left the list when its block time expired, the waiting flag is
+	cleared by the first give. */
+	for( ux = 0; ux < fsMAX_COUNT; ux++ )
+	{
+		if( xFastSemaphoreGive( xCountingSemaphore ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		if( uxFastSemaphoreGetCount( xCountingSemaphore ) != ( ux + 1 ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	if( xFastSemaphoreGive( xCountingSemaphore ) != pdFAIL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	for( ux = 0; ux < fsMAX_COUNT; ux++ )
+	{
+		if( xFastSemaphoreTake( xCountingSemaphore, fsDONT_BLOCK ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	if( ( xFastSemaphoreTake( xCountingSemaphore, fsDONT_BLOCK ) != pdFAIL ) || ( uxFastSemaphoreGetCount( xCountingSemaphore ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvPriorityWakeTests( void )
+{
+	/* Both waiters are blocked, as they run above this task. */
+	uxWoken = 0;
+
+	/* The give wakes the highest priority waiter, which takes the semaphore
+	before the give returns. */
+	if( xFastSemaphoreGive( xWakeSemaphore ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( uxWoken != 1 ) || ( ucWakeOrder[ 0 ] != fsHIGH_WAITER ) || ( uxFastSemaphoreGetCount( xWakeSemaphore ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The high priority waiter blocked again, but is still ahead. */
+	if( xFastSemaphoreGive( xWakeSemaphore ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( uxWoken != 2 ) || ( ucWakeOrder[ 1 ] != fsHIGH_WAITER ) || ( uxFastSemaphoreGetCount( xWakeSemaphore ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* With the high priority waiter out of the list the medium priority one,
+	blocked for longer, is woken. */
+	vTaskSuspend( xHighWaiterTask );
+
+	if( xFastSemaphoreGive( xWakeSemaphore ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( uxWoken != 3 ) || ( ucWakeOrder[ 2 ] != fsMEDIUM_WAITER ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Resumed, the high priority waiter finds nothing to take and blocks
+	again. */
+	vTaskResume( xHighWaiterTask );
+
+	if( uxWoken != 3 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStolenWakeTests( void )
+{
+TickType_t xWaited;
+
+	/* The task blocks on the semaphore while this task is delayed. */
+	xStolenWakeResult = pdPASS;
+	vTaskResume( xStolenWakeTask );
+	vTaskDelay( fsSTOLEN_WAKE_BLOCK / 2 );
+
+	/* The give makes the task ready without preempting this task, which takes
+	the semaphore first. */
+	if( xFastSemaphoreGive( xStolenSemaphore ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( xFastSemaphoreTake( xStolenSemaphore, fsDONT_BLOCK ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The task finds nothing to take and blocks again until its block time,
+	counted from its first attempt, expires.  It suspends itself once it has
+	recorded the result. */
+	for( xWaited = 0; ( eTaskGetState( xStolenWakeTask ) != eSuspended ) && ( xWaited < ( fsSTOLEN_WAKE_BLOCK * 2 ) ); xWaited += fsSHORT_DELAY )
+	{
+		vTaskDelay( fsSHORT_DELAY );
+	}
+
+	if( ( xStolenWakeResult != pdFAIL ) || ( xStolenWakeTime < fsSTOLEN_WAKE_BLOCK ) || ( xStolenWakeTime > ( fsSTOLEN_WAKE_BLOCK + fsSTOLEN_WAKE_MARGIN ) ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( eTaskGetState( xStolenWakeTask ) != eSuspended )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMutexInheritanceTests( void )
+{
+uint32_t ulCyclesBefore;
+
+	/* Taken on the fast path, nothing waits. */
+	if( ( xFastSemaphoreTake( xInheritedMutex, fsDONT_BLOCK ) != pdPASS ) || ( xFastSemaphoreTake( xOtherMutex, fsDONT_BLOCK ) != pdPASS ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( uxFastSemaphoreGetCount( xInheritedMutex ) != 0 ) || ( uxFastSemaphoreGetCount( xOtherMutex ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The mutex task blocks on the mutex, raising this task to its priority. */
+	ulCyclesBefore = ulMutexTaskCycles;
+	xMutexBlockTime = portMAX_DELAY;
+	vTaskResume( xMutexTask );
+
+	if( uxTaskPriorityGet( NULL ) != fsMUTEX_TASK_PRIORITY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The priority is kept while another mutex is held. */
+	if( xFastSemaphoreGive( xOtherMutex ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( uxTaskPriorityGet( NULL ) != fsMUTEX_TASK_PRIORITY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Giving back the mutex returns this task to its own priority and lets the
+	mutex task take the mutex, give it back and suspend itself. */
+	if( xFastSemaphoreGive( xInheritedMutex ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( uxTaskPriorityGet( NULL ) != fsCONTROLLER_PRIORITY ) || ( ulMutexTaskCycles != ( ulCyclesBefore + 1 ) ) || ( xMutexResult != pdPASS ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( uxFastSemaphoreGetCount( xInheritedMutex ) != 1 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Again, but the block time of the mutex task expires first. */
+	if( xFastSemaphoreTake( xInheritedMutex, fsDONT_BLOCK ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	xMutexBlockTime = fsSHORT_DELAY;
+	vTaskResume( xMutexTask );
+
+	if( uxTaskPriorityGet( NULL ) != fsMUTEX_TASK_PRIORITY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	vTaskDelay( fsSHORT_DELAY * 2 );
+
+	if( ( ulMutexTaskCycles != ( ulCyclesBefore + 2 ) ) || ( xMutexResult != pdFAIL ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The give finds no task to wake, and clears the waiting flag, so the
+	next take and give are on the fast path again. */
+	if( xFastSemaphoreGive( xInheritedMutex ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( uxTaskPriorityGet( NULL ) != fsCONTROLLER_PRIORITY ) || ( uxFastSemaphoreGetCount( xInheritedMutex ) != 1 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xFastSemaphoreTake( xInheritedMutex, fsDONT_BLOCK ) != pdPASS ) || ( xFastSemaphoreGive( xInheritedMutex ) != pdPASS ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaiterTask( void *pvParameters )
+{
+const uint8_t ucWaiter = ( uint8_t ) ( ( size_t ) pvParameters );
+
+	for( ;; )
+	{
+		if( xFastSemaphoreTake( xWakeSemaphore, portMAX_DELAY ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		if( uxWoken < ( UBaseType_t ) sizeof( ucWakeOrder ) )
+		{
+			ucWakeOrder[ uxWoken ] = ucWaiter;
+		}
+
+		uxWoken++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStolenWakeTask( void *pvParameters )
+{
+TickType_t xTimeBefore;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Resumed by the controller. */
+		vTaskSuspend( NULL );
+
+		xTimeBefore = xTaskGetTickCount();
+		xStolenWakeResult = xFastSemaphoreTake( xStolenSemaphore, fsSTOLEN_WAKE_BLOCK );
+		xStolenWakeTime = xTaskGetTickCount() - xTimeBefore;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMutexTask( void *pvParameters )
+{
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Resumed by the controller, which holds the mutex. */
+		vTaskSuspend( NULL );
+
+		xMutexResult = xFastSemaphoreTake( xInheritedMutex, xMutexBlockTime );
+
+		if( xMutexResult == pdPASS )
+		{
+			/* Only the holder can give it back. */
+			if( xFastSemaphoreGive( xInheritedMutex ) != pdPASS )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			if( xFastSemaphoreGive( xInheritedMutex ) != pdFAIL )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+		else
+		{
+			/* The mutex is still held by the controller. */
+			if( xFastSemaphoreGive( xInheritedMutex ) != pdFAIL )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+
+		ulMutexTaskCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvContendingTask( void *pvParameters )
+{
+const UBaseType_t uxTask = ( UBaseType_t ) ( ( size_t ) pvParameters );
+
+	for( ;; )
+	{
+		if( xFastSemaphoreTake( xContendedMutex, portMAX_DELAY ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		if( uxContendedOwner != 0 )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		uxContendedOwner = uxTask;
+
+		/* The other task runs and blocks on the mutex. */
+		taskYIELD();
+
+		if( ( uxContendedOwner != uxTask ) || ( uxFastSemaphoreGetCount( xContendedMutex ) != 0 ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		uxContendedOwner = 0;
+
+		if( xFastSemaphoreGive( xContendedMutex ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		ulContendingCycles[ uxTask - 1 ]++;
+
+		/* Leave the other task a chance to take the mutex. */
+		taskYIELD();
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreFastSemaphoreTasksStillRunning( void )
+{
+static uint32_t ulLastControllerCycles = 0UL;
+static uint32_t ulLastContendingCycles[ 2 ] = { 0UL, 0UL };
+BaseType_t x;
+
+	if( ulLastControllerCycles == ulControllerCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastControllerCycles = ulControllerCycles;
+	}
+
+	for( x = 0; x < 2; x++ )
+	{
+		if( ulLastContendingCycles[ x ] == ulContendingCycles[ x ] )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			ulLastContendingCycles[ x ] = ulContendingCycles[ x ];
+		}
+	}
+
+	return xErrorStatus;
+}
+/*-----------------------------------------------------------*/
+
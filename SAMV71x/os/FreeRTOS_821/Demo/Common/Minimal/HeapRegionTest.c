@@ -0,0 +1,577 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the memory regions of heap_tlsf.c, pvPortMallocRegion() and
+ * vPortGetHeapRegionStats(), so is only built with heap_tlsf.c and the fast,
+ * DMA and bulk regions added by the application.
+ *
+ * The task allocates blocks of pseudo random sizes from pseudo random regions
+ * and frees them in a pseudo random order, filling each block with a pattern
+ * that is checked before it is freed, so blocks that overlap each other or the
+ * heap structures are found.  The statistics of every region are read before
+ * and after each call, with the scheduler suspended so no other task allocates
+ * in between: exactly one region must have counted the allocation or free, in
+ * its histogram class too, and its free bytes must have changed by the size of
+ * the block.  A block comes from the region asked for, or from the default
+ * region when the fast or bulk region has no room, but never for the DMA region.
+ *
+ * Each cycle then fills the fast and the bulk region until the largest free
+ * block is smaller than rgnFALLBACK_SIZE, and checks that an allocation of
+ * rgnFALLBACK_SIZE bytes from either comes from the default region.  Finally
+ * every block is freed, after which the DMA and bulk regions, that only this
+ * task uses, must be back to the one free block they were at the start.
+ *
+ * The malloc failed hook of the demos asserts, so the DMA region, which has no
+ * fallback, is only allocated from while it has room.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo program include files. */
+#include "HeapRegionTest.h"
+
+/* The number of blocks the task holds at most, and the number of allocations
+and frees made in each cycle. */
+#define rgnNUM_BLOCKS			( 32 )
+#define rgnSTEPS_PER_CYCLE		( 200 )
+
+/* The largest block allocated from the bulk region, and from the others. */
+#define rgnMAX_BULK_SIZE		( 4096UL )
+#define rgnMAX_SIZE				( 256UL )
+
+/* The size of the allocations that must fall back to the default region once
+the fast or the bulk region is full, and the number of blocks filling a region
+can take before the test gives up. */
+#define rgnFALLBACK_SIZE		( ( size_t ) 1024 )
+#define rgnMAX_FILL_BLOCKS		( 32 )
+
+/* The time the task waits between cycles, leaving the other tasks of its
+priority a chance to run. */
+#define rgnCYCLE_DELAY			pdMS_TO_TICKS( 5 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * A block held by the task.
+ */
+typedef struct REGION_BLOCK
+{
+	uint8_t *pucBlock;		/*< NULL when the slot is free. */
+	size_t xSize;			/*< The size asked for. */
+	UBaseType_t uxRegion;	/*< The region the block came from. */
+	size_t xTaken;			/*< The free bytes of the region the block took. */
+	uint8_t ucPattern;		/*< The first byte of the pattern filling the block. */
+} RegionBlock_t;
+
+/*
+ * The task that runs the tests.
+ */
+static void prvHeapRegionTask( void *pvParameters );
+
+/*
+ * Allocate xSize bytes from uxRegionHint into xBlocks[ xIndex ], checking the
+ * region it came from against the statistics, and free that block, checking
+ * its pattern and the region it goes back to.
+ */
+static void prvAllocateBlock( BaseType_t xIndex, size_t xSize, UBaseType_t uxRegionHint );
+static void prvFreeBlock( BaseType_t xIndex );
+
+/*
+ * Fill the region uxRegion until an allocation of rgnFALLBACK_SIZE bytes must
+ * come from the default region, and check it does.
+ */
+static void prvFallbackTest( UBaseType_t uxRegion );
+
+/*
+ * Read the statistics of every region into pxStats, and check the statistics
+ * of each are consistent.
+ */
+static void prvReadStats( HeapStats_t *pxStats );
+
+/*
+ * Return the region whose allocation count is one more in pxAfter than in
+ * pxBefore, or portHEAP_REGION_COUNT if there is not exactly one.  The other
+ * regions must not have changed at all.
+ */
+static UBaseType_t prvRegionAllocatedFrom( const HeapStats_t *pxBefore, const HeapStats_t *pxAfter );
+
+/*
+ * The histogram class vPortGetHeapRegionStats() counts an allocation of xSize
+ * bytes in.
+ */
+static UBaseType_t prvHistogramBin( size_t xSize );
+
+/*
+ * Utility function to create pseudo random numbers.
+ */
+static uint32_t prvRand( uint32_t *pulSeed );
+
+/*-----------------------------------------------------------*/
+
+/* Used to latch errors during the test's execution. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* Incremented on each cycle to show the task is still running. */
+static volatile uint32_t ulCycles = 0UL;
+
+/* The blocks held by the task, and the blocks filling a region during the
+fallback test. */
+static RegionBlock_t xBlocks[ rgnNUM_BLOCKS ];
+static void *pvFillBlocks[ rgnMAX_FILL_BLOCKS ];
+
+/* The statistics of every region before and after a call, kept out of the
+stack of the task. */
+static HeapStats_t xStatsBefore[ portHEAP_REGION_COUNT ], xStatsAfter[ portHEAP_REGION_COUNT ];
+
+/*-----------------------------------------------------------*/
+
+void vStartHeapRegionTask( UBaseType_t uxPriority )
+{
+	xTaskCreate( prvHeapRegionTask, "HRgn", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapRegionTask( void *pvParameters )
+{
+HeapStats_t xDMAStart, xBulkStart;
+uint32_t ulSeed = 0x5a5a1234UL, ulRand;
+BaseType_t x, xStep;
+UBaseType_t uxRegion;
+size_t xSize;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	/* Nothing else allocates from the DMA and bulk regions, so they are as
+	added, one free block each. */
+	vPortGetHeapRegionStats( portHEAP_REGION_DMA, &xDMAStart );
+	vPortGetHeapRegionStats( portHEAP_REGION_BULK, &xBulkStart );
+
+	if( ( xDMAStart.xNumberOfFreeBlocks != 1 ) || ( xBulkStart.xNumberOfFreeBlocks != 1 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	for( ;; )
+	{
+		for( xStep = 0; xStep < rgnSTEPS_PER_CYCLE; xStep++ )
+		{
+			ulRand = prvRand( &ulSeed );
+			x = ( BaseType_t ) ( ulRand % ( uint32_t ) rgnNUM_BLOCKS );
+
+			if( xBlocks[ x ].pucBlock != NULL )
+			{
+				prvFreeBlock( x );
+			}
+			else
+			{
+				uxRegion = ( UBaseType_t ) ( prvRand( &ulSeed ) % ( uint32_t ) portHEAP_REGION_COUNT );
+
+				if( uxRegion == portHEAP_REGION_BULK )
+				{
+					xSize = ( size_t ) ( ( prvRand( &ulSeed ) % rgnMAX_BULK_SIZE ) + 1UL );
+				}
+				else
+				{
+					xSize = ( size_t ) ( ( prvRand( &ulSeed ) % rgnMAX_SIZE ) + 1UL );
+				}
+
+				prvAllocateBlock( x, xSize, uxRegion );
+			}
+		}
+
+		prvFallbackTest( portHEAP_REGION_FAST );
+		prvFallbackTest( portHEAP_REGION_BULK );
+
+		for( x = 0; x < rgnNUM_BLOCKS; x++ )
+		{
+			if( xBlocks[ x ].pucBlock != NULL )
+			{
+				prvFreeBlock( x );
+			}
+		}
+
+		/* The free blocks of the regions only this task uses must have been
+		merged back into one. */
+		vPortGetHeapRegionStats( portHEAP_REGION_DMA, &( xStatsAfter[ portHEAP_REGION_DMA ] ) );
+		vPortGetHeapRegionStats( portHEAP_REGION_BULK, &( xStatsAfter[ portHEAP_REGION_BULK ] ) );
+
+		if( ( xStatsAfter[ portHEAP_REGION_DMA ].xAvailableHeapSpaceInBytes != xDMAStart.xAvailableHeapSpaceInBytes ) ||
+			( xStatsAfter[ portHEAP_REGION_DMA ].xNumberOfFreeBlocks != 1 ) ||
+			( xStatsAfter[ portHEAP_REGION_BULK ].xAvailableHeapSpaceInBytes != xBulkStart.xAvailableHeapSpaceInBytes ) ||
+			( xStatsAfter[ portHEAP_REGION_BULK ].xNumberOfFreeBlocks != 1 ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		/* Incremented to show the task is still running. */
+		ulCycles++;
+
+		vTaskDelay( rgnCYCLE_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvAllocateBlock( BaseType_t xIndex, size_t xSize, UBaseType_t uxRegionHint )
+{
+RegionBlock_t *pxBlock = &( xBlocks[ xIndex ] );
+UBaseType_t uxRegion;
+size_t x;
+
+	vTaskSuspendAll();
+	{
+		prvReadStats( xStatsBefore );
+
+		/* Twice the largest request leaves room for the block header and the
+		rounding up of the size to a free list. */
+		if( ( uxRegionHint == portHEAP_REGION_DMA ) && ( xStatsBefore[ portHEAP_REGION_DMA ].xSizeOfLargestFreeBlockInBytes < ( rgnMAX_SIZE * 2UL ) ) )
+		{
+			pxBlock->pucBlock = NULL;
+		}
+		else
+		{
+			pxBlock->pucBlock = ( uint8_t * ) pvPortMallocRegion( xSize, uxRegionHint );
+			prvReadStats( xStatsAfter );
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( pxBlock->pucBlock != NULL )
+	{
+		uxRegion = prvRegionAllocatedFrom( xStatsBefore, xStatsAfter );
+
+		/* Only the fast and the bulk region fall back to the default region. */
+		if( ( uxRegion != uxRegionHint ) &&
+			( ( uxRegion != portHEAP_REGION_DEFAULT ) || ( uxRegionHint == portHEAP_REGION_DMA ) ) )
+		{
+			xErrorStatus = pdFAIL;
+
+			/* Still free the block, the statistics of the region asked for
+			being as good a guess as any. */
+			if( uxRegion == portHEAP_REGION_COUNT )
+			{
+				uxRegion = uxRegionHint;
+			}
+		}
+		else if( ( xStatsAfter[ uxRegion ].xAllocationHistogram[ prvHistogramBin( xSize ) ] != ( xStatsBefore[ uxRegion ].xAllocationHistogram[ prvHistogramBin( xSize ) ] + 1 ) ) ||
+				 ( ( xStatsBefore[ uxRegion ].xAvailableHeapSpaceInBytes - xStatsAfter[ uxRegion ].xAvailableHeapSpaceInBytes ) < xSize ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( ( ( size_t ) pxBlock->pucBlock ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) != 0 )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		pxBlock->xSize = xSize;
+		pxBlock->uxRegion = uxRegion;
+		pxBlock->xTaken = xStatsBefore[ uxRegion ].xAvailableHeapSpaceInBytes - xStatsAfter[ uxRegion ].xAvailableHeapSpaceInBytes;
+		pxBlock->ucPattern = ( uint8_t ) ( ulCycles + ( uint32_t ) xIndex );
+
+		for( x = 0; x < xSize; x++ )
+		{
+			pxBlock->pucBlock[ x ] = ( uint8_t ) ( pxBlock->ucPattern + x );
+		}
+	}
+	else if( uxRegionHint != portHEAP_REGION_DMA )
+	{
+		/* Only DMA allocations are skipped. */
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvFreeBlock( BaseType_t xIndex )
+{
+RegionBlock_t *pxBlock = &( xBlocks[ xIndex ] );
+UBaseType_t uxRegion;
+size_t x;
+
+	/* Nothing wrote over the block while it was held. */
+	for( x = 0; x < pxBlock->xSize; x++ )
+	{
+		if( pxBlock->pucBlock[ x ] != ( uint8_t ) ( pxBlock->ucPattern + x ) )
+		{
+			xErrorStatus = pdFAIL;
+			break;
+		}
+	}
+
+	vTaskSuspendAll();
+	{
+		prvReadStats( xStatsBefore );
+		vPortFree( pxBlock->pucBlock );
+		prvReadStats( xStatsAfter );
+	}
+	( void ) xTaskResumeAll();
+
+	pxBlock->pucBlock = NULL;
+
+	/* Only the region the block came from counts the free, and gets back the
+	bytes the block took. */
+	for( uxRegion = 0; uxRegion < ( UBaseType_t ) portHEAP_REGION_COUNT; uxRegion++ )
+	{
+		if( uxRegion == pxBlock->uxRegion )
+		{
+			if( ( xStatsAfter[ uxRegion ].xNumberOfSuccessfulFrees != ( xStatsBefore[ uxRegion ].xNumberOfSuccessfulFrees + 1 ) ) ||
+				( xStatsAfter[ uxRegion ].xAvailableHeapSpaceInBytes != ( xStatsBefore[ uxRegion ].xAvailableHeapSpaceInBytes + pxBlock->xTaken ) ) )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+		else if( ( xStatsAfter[ uxRegion ].xNumberOfSuccessfulFrees != xStatsBefore[ uxRegion ].xNumberOfSuccessfulFrees ) ||
+				 ( xStatsAfter[ uxRegion ].xAvailableHeapSpaceInBytes != xStatsBefore[ uxRegion ].xAvailableHeapSpaceInBytes ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvFallbackTest( UBaseType_t uxRegion )
+{
+BaseType_t x, xFillBlocks = 0;
+HeapStats_t xStats;
+void *pvFallback = NULL;
+size_t xFrees;
+
+	/* The other tasks allocate from the fast region too, the scheduler stays
+	suspended until the region has room again. */
+	vTaskSuspendAll();
+	{
+		vPortGetHeapRegionStats( uxRegion, &xStats );
+		xFrees = xStats.xNumberOfSuccessfulFrees;
+
+		/* Half the largest free block always fits in it, whatever the
+		rounding of the size. */
+		while( ( xStats.xSizeOfLargestFreeBlockInBytes > rgnFALLBACK_SIZE ) && ( xFillBlocks < rgnMAX_FILL_BLOCKS ) )
+		{
+			prvReadStats( xStatsBefore );
+			pvFillBlocks[ xFillBlocks ] = pvPortMallocRegion( xStats.xSizeOfLargestFreeBlockInBytes / 2, uxRegion );
+			prvReadStats( xStatsAfter );
+			xFillBlocks++;
+
+			if( prvRegionAllocatedFrom( xStatsBefore, xStatsAfter ) != uxRegion )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			vPortGetHeapRegionStats( uxRegion, &xStats );
+		}
+
+		if( xStats.xSizeOfLargestFreeBlockInBytes > rgnFALLBACK_SIZE )
+		{
+			/* Ran out of fill blocks. */
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			/* The block and its header do not fit in the region any more. */
+			prvReadStats( xStatsBefore );
+			pvFallback = pvPortMallocRegion( rgnFALLBACK_SIZE, uxRegion );
+			prvReadStats( xStatsAfter );
+
+			if( ( pvFallback == NULL ) || ( prvRegionAllocatedFrom( xStatsBefore, xStatsAfter ) != portHEAP_REGION_DEFAULT ) )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+
+		vPortFree( pvFallback );
+
+		for( x = 0; x < xFillBlocks; x++ )
+		{
+			vPortFree( pvFillBlocks[ x ] );
+		}
+
+		/* The fill blocks went back to the region they came from. */
+		vPortGetHeapRegionStats( uxRegion, &xStats );
+
+		if( xStats.xNumberOfSuccessfulFrees != ( xFrees + ( size_t ) xFillBlocks ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+static void prvReadStats( HeapStats_t *pxStats )
+{
+UBaseType_t uxRegion, uxBin;
+size_t xHistogramTotal;
+
+	for( uxRegion = 0; uxRegion < ( UBaseType_t ) portHEAP_REGION_COUNT; uxRegion++ )
+	{
+		vPortGetHeapRegionStats( uxRegion, &( pxStats[ uxRegion ] ) );
+
+		/* Every allocation is counted in one histogram class. */
+		xHistogramTotal = 0;
+
+		for( uxBin = 0; uxBin < ( UBaseType_t ) portHEAP_HISTOGRAM_BINS; uxBin++ )
+		{
+			xHistogramTotal += pxStats[ uxRegion ].xAllocationHistogram[ uxBin ];
+		}
+
+		if( ( xHistogramTotal != pxStats[ uxRegion ].xNumberOfSuccessfulAllocations ) ||
+			( pxStats[ uxRegion ].xNumberOfSuccessfulFrees > pxStats[ uxRegion ].xNumberOfSuccessfulAllocations ) ||
+			( pxStats[ uxRegion ].xSizeOfLargestFreeBlockInBytes > pxStats[ uxRegion ].xAvailableHeapSpaceInBytes ) ||
+			( pxStats[ uxRegion ].xMinimumEverFreeBytesRemaining > pxStats[ uxRegion ].xAvailableHeapSpaceInBytes ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvRegionAllocatedFrom( const HeapStats_t *pxBefore, const HeapStats_t *pxAfter )
+{
+UBaseType_t uxRegion, uxReturn = portHEAP_REGION_COUNT;
+
+	for( uxRegion = 0; uxRegion < ( UBaseType_t ) portHEAP_REGION_COUNT; uxRegion++ )
+	{
+		if( pxAfter[ uxRegion ].xNumberOfSuccessfulAllocations == ( pxBefore[ uxRegion ].xNumberOfSuccessfulAllocations + 1 ) )
+		{
+			if( uxReturn == portHEAP_REGION_COUNT )
+			{
+				uxReturn = uxRegion;
+			}
+			else
+			{
+				/* Counted twice. */
+				xErrorStatus = pdFAIL;
+			}
+		}
+		else if( ( pxAfter[ uxRegion ].xNumberOfSuccessfulAllocations != pxBefore[ uxRegion ].xNumberOfSuccessfulAllocations ) ||
+				 ( pxAfter[ uxRegion ].xAvailableHeapSpaceInBytes != pxBefore[ uxRegion ].xAvailableHeapSpaceInBytes ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvHistogramBin( size_t xSize )
+{
+UBaseType_t uxBin = 0;
+
+	/* Below 32 bytes, then one class per power of two. */
+	xSize >>= 5;
+
+	while( ( xSize != 0 ) && ( uxBin < ( ( UBaseType_t ) portHEAP_HISTOGRAM_BINS - 1 ) ) )
+	{
+		xSize >>= 1;
+		uxBin++;
+	}
+
+	return uxBin;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsHeapRegionTaskStillRunning( void )
+{
+static uint32_t ulLastCycles = 0UL;
+
+	if( ulLastCycles == ulCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastCycles = ulCycles;
+	}
+
+	return xErrorStatus;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRand( uint32_t *pulSeed )
+{
+const uint32_t ulMultiplier = 0x015a4e35UL, ulIncrement = 1UL;
+
+	/* Utility function to generate a pseudo random number. */
+	*pulSeed = ( ulMultiplier * *pulSeed ) + ulIncrement;
+	return ( *pulSeed >> 16UL ) & 0x7fffUL;
+}
+/*-----------------------------------------------------------*/
+
@@ -0,0 +1,2021 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/*
+ * Kernel micro-benchmark.  Measures the execution time of the queue, semaphore,
+ * mutex and task notification primitives exercised by the BlockQ, GenQTest,
+ * semtest, recmutex and TaskNotify demos, both through the task API and through
+ * the interrupt safe API, and the cost of a context switch.
+ *
+ * Each primitive is timed on its own over benchITERATIONS calls, on the path
+ * that neither blocks nor wakes a task.  The interrupt safe functions are called
+ * from the benchmark task with interrupts masked, so interrupt entry and exit
+ * are not included.  Context switches are timed three ways: a yield between two
+ * tasks of the same priority, and the time from giving a queue, semaphore or
+ * notification to a higher priority task blocked on it until that task runs
+ * (from a task and from the interrupt safe API).
+ *
+ * The cost of delayed tasks is measured with 1, 8, 32 and 64 tasks of priority
+ * uxPriority + 1 that keep blocking in vTaskDelay() for pseudo random periods,
+ * up to configBENCH_DELAYED_TASKS of them.  The periods are up to 16 ticks per
+ * task, so a task wakes every 8 ticks on average whatever the count and a flat
+ * curve shows a tick cost independent of the tasks not due.  For each count the
+ * benchmark task records, over benchITERATIONS ticks, the time spent in
+ * xTaskIncrementTick() up to the tick hook (tick_delayed_<n>), and the time
+ * from a task calling vTaskDelay() until the benchmark task runs
+ * (delay_block_<n>), which includes inserting the task in the delayed list and
+ * one context switch.  Comparing builds with configUSE_DELAYED_TASK_WHEEL set
+ * to 0 and 1 shows how the sorted lists and the wheel scale.  The tick measurement needs the application to
+ * call vKernelBenchTickEntry() from traceTASK_INCREMENT_TICK() and
+ * vKernelBenchTickHook() from its tick hook, without them only the delay_block
+ * results are output.
+ *
+ * Software timers are measured with configBENCH_TIMERS auto-reload timers
+ * running, with pseudo random periods: the cost of xTimerStart() and
+ * xTimerStop() on another timer (timer_start, timer_stop, up to the point the
+ * timer service task has processed the command when it runs at a higher
+ * priority), the time spent in xTaskIncrementTick() (tick_timers), and the
+ * time from the start of the tick in which a one tick timer expires until its
+ * callback runs (timer_expiry).  With configUSE_TIMER_WHEEL set to 1 the same
+ * expiry is also measured with the callback called from the tick
+ * (timer_expiry_tick, see vTimerSetCallbackFromTick()).
+ *
+ * Passing messages is measured as the time to transfer one message through a
+ * queue of length one, from the sender to the receiver: by copy with
+ * xQueueSend() and xQueueReceive() for 32, 256 and 1024 byte messages
+ * (msg_copy_<n>), and by reference (msg_ref), taking a buffer from a buffer
+ * pool, posting it to a message queue, receiving it and releasing it to the
+ * pool (see buffer_pool.h), whose cost does not depend on the message size.
+ * The interrupt safe versions are measured with 256 byte messages.
+ *
+ * Batches of 8 items are measured through a queue of 8 uint32_t, sent and
+ * received one xQueueSend() and xQueueReceive() call at a time (queue_send_8,
+ * queue_receive_8), and in a single call each side with xQueueSendMultiple()
+ * and xQueueReceiveMultiple() (queue_send_multiple_8, queue_receive_multiple_8)
+ * or their interrupt safe versions (queue_send_multiple_isr_8,
+ * queue_receive_multiple_isr_8).
+ *
+ * The priority queues of priority_queue.h are measured holding 15 items of
+ * pseudo random priorities, by the time to send an item of a priority above
+ * them and to receive it again (prioq_send, prioq_receive, prioq_send_isr,
+ * prioq_receive_isr), which moves its entry from the bottom to the top of the
+ * heap and back.  Compare with queue_send and queue_receive.
+ *
+ * Byte streams are measured as the time to move a 64 byte block from the
+ * writer to the reader: one byte at a time through a queue of bytes
+ * (stream_queue_64), the way a UART driver would without stream buffers, and
+ * in one call each side through a stream buffer (stream_buffer_64, see
+ * stream_buffer.h).  A 256 byte message is also passed through a message buffer
+ * (msgbuf_256, see message_buffer.h), to compare with msg_copy_256.  The
+ * interrupt safe versions are measured in the same way.
+ *
+ * Creating kernel objects is measured for tasks, queues and software timers,
+ * from the heap (task_create, queue_create, timer_create) and, with
+ * configSUPPORT_STATIC_ALLOCATION set to 1, from memory provided by the
+ * application (task_create_static, queue_create_static, timer_create_static),
+ * which is what an application pays at start up.  The RAM each object takes
+ * is reported on BENCH_ALLOC lines: the heap it uses, allocator overhead and
+ * alignment included, measured with xPortGetFreeHeapSize(), and the size of
+ * its static buffers.  With heap regions only the default region is counted.
+ *
+ * The heap is measured with a pseudo random mix of configBENCH_HEAP_OPERATIONS
+ * allocations and frees over configBENCH_HEAP_BLOCKS live blocks, mostly small
+ * with some up to 4KB, using at most half of the free heap (heap_malloc,
+ * heap_free).  The worst case of a first fit search is then measured by
+ * allocating a 4KB block past configBENCH_HEAP_BLOCKS / 2 holes too small for
+ * it (heap_malloc_holes): its time grows with the number of holes in heap_4.c
+ * and heap_5.c and stays constant in heap_tlsf.c.  The state of the heap at
+ * the end of the mix, blocks still allocated, is reported
+ * from vPortGetHeapStats() on BENCH_HEAP lines.  Set configBENCH_HEAP to 0 when
+ * the heap does not provide vPortGetHeapStats().
+ *
+ * Data shared between an interrupt and tasks is measured as the time to write
+ * and to read a 256 byte structure through a sequence lock (seqlock_write_256,
+ * seqlock_read_256, see seqlock.h), and to copy it from a critical section
+ * (critical_copy_256), which also masks interrupts for the whole copy.
+ *
+ * The fast semaphores and mutexes of fast_semaphore.h are measured with the
+ * same sequences as the queue based ones (fast_sem_give, fast_sem_take,
+ * fast_sem_give_isr, fast_sem_take_isr, fast_mutex_take, fast_mutex_give), on
+ * their compare and swap path, and on their kernel path by the time to wake a
+ * higher priority task blocked on a fast semaphore (fast_sem_wake,
+ * fast_sem_wake_isr), to compare with sem_wake and sem_wake_isr.
+ *
+ * With configUSE_TRACE_RECORDER set to 1 the cost of recording one event with
+ * the trace recorder (trace_event, see trace_recorder.h) is measured first, and
+ * every other measurement includes the events it records.  Comparing with a
+ * build without the recorder gives its overhead on each kernel path.
+ *
+ * The time base is taken from FreeRTOSConfig.h:
+ *
+ *   configBENCH_TIMESTAMP()        Free running 32-bit counter, e.g. the DWT
+ *                                  cycle counter on Cortex-M.
+ *   configBENCH_TIMESTAMP_INIT()   Optional, starts the counter.
+ *   configBENCH_TIMESTAMP_UNIT     Optional, unit name printed in the report.
+ *   configBENCH_PRINTF( X )        Optional, outputs the report, e.g. printf X.
+ *   configBENCH_ITERATIONS         Optional, samples per measurement.
+ *   configBENCH_DELAYED_TASKS      Optional, largest number of delayed tasks
+ *                                  created, 64 by default.
+ *   configBENCH_TIMERS             Optional, number of software timers
+ *                                  running, 256 by default.
+ *   configBENCH_HEAP               Optional, 0 to leave out the heap
+ *                                  measurements, 1 by default.
+ *   configBENCH_HEAP_BLOCKS        Optional, live blocks of the heap mix, 128
+ *                                  by default.
+ *   configBENCH_HEAP_OPERATIONS    Optional, length of the heap mix, 20000 by
+ *                                  default.
+ *   configBENCH_ALLOCATION         Optional, 0 to leave out the object
+ *                                  creation measurements, 1 by default.
+ *
+ * The overhead of reading the time base is measured first and subtracted from
+ * every sample.  The report is machine readable, one line per configuration
+ * option that affects the kernel paths, then one line per measurement:
+ *
+ *   BENCH_CONFIG,<option>,<value>
+ *   BENCH,<name>,<unit>,<samples>,<min>,<avg>,<max>
+ *   BENCH_HEAP,<statistic>,<value>
+ *   BENCH_ALLOC,<object>,<heap bytes>,<static bytes>
+ *   BENCH_END
+ *
+ * The results are also kept in xBenchResults[] for a debugger to read.  Run the
+ * benchmark without other application tasks at or above its priority, the
+ * woken task runs at uxPriority + 1.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+#include "buffer_pool.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+#include "fast_semaphore.h"
+#include "seqlock.h"
+#include "priority_queue.h"
+
+/* Demo program include files. */
+#include "KernelBench.h"
+
+#ifndef configBENCH_TIMESTAMP
+	#error configBENCH_TIMESTAMP() must be defined in FreeRTOSConfig.h to use KernelBench.c
+#endif
+
+#ifndef configBENCH_TIMESTAMP_INIT
+	#define configBENCH_TIMESTAMP_INIT()
+#endif
+
+#ifndef configBENCH_TIMESTAMP_UNIT
+	#define configBENCH_TIMESTAMP_UNIT "ticks"
+#endif
+
+#ifndef configBENCH_PRINTF
+	#define configBENCH_PRINTF( X )
+#endif
+
+#ifndef configBENCH_ITERATIONS
+	#define configBENCH_ITERATIONS 1000
+#endif
+
+#ifndef configBENCH_DELAYED_TASKS
+	#define configBENCH_DELAYED_TASKS 64
+#endif
+
+#ifndef configBENCH_TIMERS
+	#define configBENCH_TIMERS 256
+#endif
+
+#ifndef configBENCH_HEAP
+	#define configBENCH_HEAP 1
+#endif
+
+#ifndef configBENCH_HEAP_BLOCKS
+	#define configBENCH_HEAP_BLOCKS 128
+#endif
+
+#ifndef configBENCH_HEAP_OPERATIONS
+	#define configBENCH_HEAP_OPERATIONS 20000
+#endif
+
+#ifndef configBENCH_ALLOCATION
+	#define configBENCH_ALLOCATION 1
+#endif
+
+#define benchITERATIONS			( ( uint32_t ) configBENCH_ITERATIONS )
+#define benchSTACK_SIZE			( configMINIMAL_STACK_SIZE * 4 )
+#define benchDONT_BLOCK			( ( TickType_t ) 0 )
+
+/* The delayed task counts measured, the delays the delayed tasks pick (1 to
+benchDELAY_TICKS_PER_TASK times the number of tasks), the periods of the
+software timers (1 to benchDELAY_SPREAD ticks), and the time left for the idle
+task to free the tasks of one count before the next. */
+#define benchDELAYED_STEPS			( 4 )
+#define benchDELAY_TICKS_PER_TASK	( ( uint32_t ) 16 )
+#define benchDELAY_SPREAD			( ( uint32_t ) 100 )
+#define benchSETTLE_DELAY			( ( TickType_t ) 2 )
+
+/* Period of the timer started and stopped, long enough for it never to
+expire. */
+#define benchIDLE_TIMER_PERIOD	( ( TickType_t ) 10000 )
+
+/* The message sizes passed by copy, and the size of the pool buffers. */
+#define benchMESSAGE_STEPS		( 3 )
+#define benchMAX_MESSAGE_SIZE	( 1024 )
+#define benchISR_MESSAGE_SIZE	( 256 )
+
+/* The block moved through the byte streams. */
+#define benchSTREAM_BLOCK_SIZE	( 64 )
+
+/* The items moved at once by xQueueSendMultiple() and xQueueReceiveMultiple(),
+which is also the length of the queue. */
+#define benchQUEUE_BATCH		( 8 )
+
+/* The length of the priority queue, which holds one item less while it is
+measured, and the priority of the item sent and received, above the priorities
+of the items held. */
+#define benchPRIORITY_QUEUE_LENGTH	( 16 )
+#define benchURGENT_PRIORITY		( ( UBaseType_t ) 8 )
+
+/* The size of the data shared through a sequence lock. */
+#define benchSHARED_DATA_SIZE	( 256 )
+
+/* Largest allocation of the heap mix, and the size of the blocks leaving
+holes in the heap. */
+#define benchHEAP_MAX_BLOCK		( 4096 )
+#define benchHEAP_HOLE_SIZE		( 32 )
+
+/* Objects created in a row before they are deleted, and the length of the
+queues created (of uint32_t items). */
+#define benchCREATE_BATCH		( 8 )
+#define benchCREATE_QUEUE_LENGTH	( 8 )
+
+/* The measurements, in report order. */
+typedef enum
+{
+	benchTIMESTAMP = 0,
+	benchTRACE_EVENT,
+	benchQUEUE_SEND,
+	benchQUEUE_RECEIVE,
+	benchQUEUE_SEND_ISR,
+	benchQUEUE_RECEIVE_ISR,
+	benchQUEUE_SEND_8,
+	benchQUEUE_RECEIVE_8,
+	benchQUEUE_SEND_MULTIPLE_8,
+	benchQUEUE_RECEIVE_MULTIPLE_8,
+	benchQUEUE_SEND_MULTIPLE_ISR_8,
+	benchQUEUE_RECEIVE_MULTIPLE_ISR_8,
+	benchPRIOQ_SEND,
+	benchPRIOQ_RECEIVE,
+	benchPRIOQ_SEND_ISR,
+	benchPRIOQ_RECEIVE_ISR,
+	benchSEM_GIVE,
+	benchSEM_TAKE,
+	benchSEM_GIVE_ISR,
+	benchSEM_TAKE_ISR,
+	benchMUTEX_TAKE,
+	benchMUTEX_GIVE,
+	benchRECMUTEX_TAKE,
+	benchRECMUTEX_GIVE,
+	benchFAST_SEM_GIVE,
+	benchFAST_SEM_TAKE,
+	benchFAST_SEM_GIVE_ISR,
+	benchFAST_SEM_TAKE_ISR,
+	benchFAST_MUTEX_TAKE,
+	benchFAST_MUTEX_GIVE,
+	benchNOTIFY_GIVE,
+	benchNOTIFY_TAKE,
+	benchNOTIFY_GIVE_ISR,
+	benchYIELD,
+	benchQUEUE_WAKE,
+	benchSEM_WAKE,
+	benchNOTIFY_WAKE,
+	benchQUEUE_WAKE_ISR,
+	benchSEM_WAKE_ISR,
+	benchNOTIFY_WAKE_ISR,
+	benchFAST_SEM_WAKE,
+	benchFAST_SEM_WAKE_ISR,
+	benchTICK_DELAYED_1,
+	benchTICK_DELAYED_8,
+	benchTICK_DELAYED_32,
+	benchTICK_DELAYED_64,
+	benchDELAY_BLOCK_1,
+	benchDELAY_BLOCK_8,
+	benchDELAY_BLOCK_32,
+	benchDELAY_BLOCK_64,
+	benchTIMER_START,
+	benchTIMER_STOP,
+	benchTICK_TIMERS,
+	benchTIMER_EXPIRY,
+	benchTIMER_EXPIRY_TICK,
+	benchMSG_COPY_32,
+	benchMSG_COPY_256,
+	benchMSG_COPY_1024,
+	benchMSG_REF,
+	benchMSG_COPY_ISR_256,
+	benchMSG_REF_ISR,
+	benchSTREAM_QUEUE_64,
+	benchSTREAM_BUFFER_64,
+	benchMSGBUF_256,
+	benchSTREAM_QUEUE_ISR_64,
+	benchSTREAM_BUFFER_ISR_64,
+	benchMSGBUF_ISR_256,
+	benchSEQLOCK_WRITE_256,
+	benchSEQLOCK_READ_256,
+	benchCRITICAL_COPY_256,
+	benchTASK_CREATE,
+	benchTASK_CREATE_STATIC,
+	benchQUEUE_CREATE,
+	benchQUEUE_CREATE_STATIC,
+	benchTIMER_CREATE,
+	benchTIMER_CREATE_STATIC,
+	benchHEAP_MALLOC,
+	benchHEAP_FREE,
+	benchHEAP_MALLOC_HOLES,
+	benchNUMBER_OF_RESULTS
+} BenchId_t;
+
+typedef struct xBENCH_RESULT
+{
+	const char *pcName;
+	uint32_t ulSamples;
+	uint32_t ulMin;
+	uint32_t ulMax;
+	uint64_t ullTotal;
+} BenchResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Runs all the measurements then outputs the report.
+ */
+static void prvBenchmarkTask( void *pvParameters );
+
+/*
+ * The measurements that do not involve another task.
+ */
+static void prvBenchQueue( void );
+static void prvBenchQueueMultiple( void );
+static void prvBenchPriorityQueue( void );
+static void prvBenchSemaphore( void );
+static void prvBenchMutex( void );
+static void prvBenchFastSemaphore( void );
+static void prvBenchNotify( void );
+
+/*
+ * Yield between the benchmark task and prvYieldTask().
+ */
+static void prvBenchYield( void );
+static void prvYieldTask( void *pvParameters );
+static void prvYieldAndRecord( TaskHandle_t xThisTask, TaskHandle_t xOtherTask );
+
+/*
+ * Give an object prvWakeTask() is blocked on, measured until prvWakeTask()
+ * runs.
+ */
+static void prvBenchWake( BenchId_t xId );
+static void prvWakeTask( void *pvParameters );
+
+/*
+ * Tick and vTaskDelay() costs with the number of delayed tasks selected by
+ * uxStep, the tasks running prvDelayedTask().
+ */
+static void prvBenchDelayed( UBaseType_t uxStep );
+static void prvDelayedTask( void *pvParameters );
+
+/*
+ * Software timer costs with configBENCH_TIMERS timers running
+ * prvLoadTimerCallback(), the expiry being timed by prvProbeTimerCallback().
+ */
+#if( configUSE_TIMERS == 1 )
+	static void prvBenchTimers( void );
+	static void prvLoadTimerCallback( TimerHandle_t xTimer );
+	static void prvProbeTimerCallback( TimerHandle_t xTimer );
+#endif
+
+/*
+ * Message transfers by copy and by reference.
+ */
+static void prvBenchMessages( void );
+
+/*
+ * Byte stream transfers through a queue of bytes, a stream buffer and a
+ * message buffer.
+ */
+static void prvBenchStreams( void );
+
+/*
+ * Copies of shared data through a sequence lock and in a critical section.
+ */
+static void prvBenchSeqLock( void );
+
+/*
+ * Allocation and free times under a pseudo random mix, and the heap statistics
+ * at the end of it.
+ */
+#if( configBENCH_HEAP == 1 )
+	static void prvBenchHeap( void );
+#endif
+
+/*
+ * Creation times of tasks running prvCreatedTask(), queues and timers, from
+ * the heap and from static memory, and the RAM each one takes.
+ */
+#if( configBENCH_ALLOCATION == 1 )
+	static void prvBenchAllocation( void );
+	static void prvCreatedTask( void *pvParameters );
+#endif
+
+static void prvRecord( BenchId_t xId, uint32_t ulStart, uint32_t ulEnd );
+static void prvReport( void );
+
+/*-----------------------------------------------------------*/
+
+/* The results, readable from a debugger once xBenchComplete is set. */
+BenchResult_t xBenchResults[ benchNUMBER_OF_RESULTS ] =
+{
+	{ "timestamp", 0, 0, 0, 0 },
+	{ "trace_event", 0, 0, 0, 0 },
+	{ "queue_send", 0, 0, 0, 0 },
+	{ "queue_receive", 0, 0, 0, 0 },
+	{ "queue_send_isr", 0, 0, 0, 0 },
+	{ "queue_receive_isr", 0, 0, 0, 0 },
+	{ "queue_send_8", 0, 0, 0, 0 },
+	{ "queue_receive_8", 0, 0, 0, 0 },
+	{ "queue_send_multiple_8", 0, 0, 0, 0 },
+	{ "queue_receive_multiple_8", 0, 0, 0, 0 },
+	{ "queue_send_multiple_isr_8", 0, 0, 0, 0 },
+	{ "queue_receive_multiple_isr_8", 0, 0, 0, 0 },
+	{ "prioq_send", 0, 0, 0, 0 },
+	{ "prioq_receive", 0, 0, 0, 0 },
+	{ "prioq_send_isr", 0, 0, 0, 0 },
+	{ "prioq_receive_isr", 0, 0, 0, 0 },
+	{ "sem_give", 0, 0, 0, 0 },
+	{ "sem_take", 0, 0, 0, 0 },
+	{ "sem_give_isr", 0, 0, 0, 0 },
+	{ "sem_take_isr", 0, 0, 0, 0 },
+	{ "mutex_take", 0, 0, 0, 0 },
+	{ "mutex_give", 0, 0, 0, 0 },
+	{ "recmutex_take", 0, 0, 0, 0 },
+	{ "recmutex_give", 0, 0, 0, 0 },
+	{ "fast_sem_give", 0, 0, 0, 0 },
+	{ "fast_sem_take", 0, 0, 0, 0 },
+	{ "fast_sem_give_isr", 0, 0, 0, 0 },
+	{ "fast_sem_take_isr", 0, 0, 0, 0 },
+	{ "fast_mutex_take", 0, 0, 0, 0 },
+	{ "fast_mutex_give", 0, 0, 0, 0 },
+	{ "notify_give", 0, 0, 0, 0 },
+	{ "notify_take", 0, 0, 0, 0 },
+	{ "notify_give_isr", 0, 0, 0, 0 },
+	{ "yield_switch", 0, 0, 0, 0 },
+	{ "queue_wake", 0, 0, 0, 0 },
+	{ "sem_wake", 0, 0, 0, 0 },
+	{ "notify_wake", 0, 0, 0, 0 },
+	{ "queue_wake_isr", 0, 0, 0, 0 },
+	{ "sem_wake_isr", 0, 0, 0, 0 },
+	{ "notify_wake_isr", 0, 0, 0, 0 },
+	{ "fast_sem_wake", 0, 0, 0, 0 },
+	{ "fast_sem_wake_isr", 0, 0, 0, 0 },
+	{ "tick_delayed_1", 0, 0, 0, 0 },
+	{ "tick_delayed_8", 0, 0, 0, 0 },
+	{ "tick_delayed_32", 0, 0, 0, 0 },
+	{ "tick_delayed_64", 0, 0, 0, 0 },
+	{ "delay_block_1", 0, 0, 0, 0 },
+	{ "delay_block_8", 0, 0, 0, 0 },
+	{ "delay_block_32", 0, 0, 0, 0 },
+	{ "delay_block_64", 0, 0, 0, 0 },
+	{ "timer_start", 0, 0, 0, 0 },
+	{ "timer_stop", 0, 0, 0, 0 },
+	{ "tick_timers", 0, 0, 0, 0 },
+	{ "timer_expiry", 0, 0, 0, 0 },
+	{ "timer_expiry_tick", 0, 0, 0, 0 },
+	{ "msg_copy_32", 0, 0, 0, 0 },
+	{ "msg_copy_256", 0, 0, 0, 0 },
+	{ "msg_copy_1024", 0, 0, 0, 0 },
+	{ "msg_ref", 0, 0, 0, 0 },
+	{ "msg_copy_isr_256", 0, 0, 0, 0 },
+	{ "msg_ref_isr", 0, 0, 0, 0 },
+	{ "stream_queue_64", 0, 0, 0, 0 },
+	{ "stream_buffer_64", 0, 0, 0, 0 },
+	{ "msgbuf_256", 0, 0, 0, 0 },
+	{ "stream_queue_isr_64", 0, 0, 0, 0 },
+	{ "stream_buffer_isr_64", 0, 0, 0, 0 },
+	{ "msgbuf_isr_256", 0, 0, 0, 0 },
+	{ "seqlock_write_256", 0, 0, 0, 0 },
+	{ "seqlock_read_256", 0, 0, 0, 0 },
+	{ "critical_copy_256", 0, 0, 0, 0 },
+	{ "task_create", 0, 0, 0, 0 },
+	{ "task_create_static", 0, 0, 0, 0 },
+	{ "queue_create", 0, 0, 0, 0 },
+	{ "queue_create_static", 0, 0, 0, 0 },
+	{ "timer_create", 0, 0, 0, 0 },
+	{ "timer_create_static", 0, 0, 0, 0 },
+	{ "heap_malloc", 0, 0, 0, 0 },
+	{ "heap_free", 0, 0, 0, 0 },
+	{ "heap_malloc_holes", 0, 0, 0, 0 }
+};
+
+/* Number of delayed tasks of each step, matching the results above. */
+static const UBaseType_t uxDelayedTaskCounts[ benchDELAYED_STEPS ] = { 1, 8, 32, 64 };
+
+/* Message sizes passed by copy, matching the results above. */
+static const size_t xMessageSizes[ benchMESSAGE_STEPS ] = { 32, 256, 1024 };
+
+static volatile BaseType_t xBenchComplete = pdFALSE;
+
+/* Cost of reading the time base, subtracted from every sample. */
+static uint32_t ulTimestampOverhead = 0;
+
+/* Objects exercised by the measurements. */
+static QueueHandle_t xQueue = NULL;
+static SemaphoreHandle_t xSemaphore = NULL, xMutex = NULL, xRecursiveMutex = NULL;
+static FastSemaphoreHandle_t xFastSemaphore = NULL, xFastMutex = NULL;
+static TaskHandle_t xBenchTask = NULL, xYieldTask = NULL, xWokenTask = NULL;
+
+/* Time stamp taken before a yield or a give, read by the task that runs
+next, and the task that yielded. */
+static volatile uint32_t ulSwitchStart = 0;
+static volatile TaskHandle_t xYieldingTask = NULL;
+
+/* Time stamp taken by a delayed task before it blocks. */
+static volatile uint32_t ulDelayStart = 0;
+static volatile BaseType_t xDelayStarted = pdFALSE;
+static uint32_t ulDelaySpread = 1;
+
+/* The tick measurement in progress, benchNUMBER_OF_RESULTS when none, and
+the time stamp taken on entry to xTaskIncrementTick(). */
+static volatile BenchId_t xTickBenchId = benchNUMBER_OF_RESULTS;
+static volatile uint32_t ulTickStart = 0;
+static volatile BaseType_t xTickStarted = pdFALSE;
+
+/* The expiry measurement in progress, benchNUMBER_OF_RESULTS when none. */
+static volatile BenchId_t xExpiryBenchId = benchNUMBER_OF_RESULTS;
+
+#if( configBENCH_HEAP == 1 )
+	/* The heap with the mix still allocated, output by prvReport(). */
+	static HeapStats_t xHeapStats;
+	static BaseType_t xHeapMeasured = pdFALSE;
+#endif
+
+#if( configBENCH_ALLOCATION == 1 )
+	/* Heap taken by one task, queue and timer, output by prvReport(). */
+	static size_t xTaskHeapBytes = 0, xQueueHeapBytes = 0, xTimerHeapBytes = 0;
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		/* The memory of the objects created statically, reused by each
+		batch. */
+		static StaticTask_t xCreatedTaskBuffers[ benchCREATE_BATCH ];
+		static StackType_t uxCreatedTaskStacks[ benchCREATE_BATCH ][ configMINIMAL_STACK_SIZE ];
+		static StaticQueue_t xCreatedQueueBuffer;
+		static uint8_t ucCreatedQueueStorage[ benchCREATE_QUEUE_LENGTH * sizeof( uint32_t ) ];
+		#if( configUSE_TIMERS == 1 )
+			static StaticTimer_t xCreatedTimerBuffers[ benchCREATE_BATCH ];
+		#endif
+	#endif
+#endif
+
+/* Priority of the benchmark task, the woken task runs one higher. */
+static UBaseType_t uxBenchPriority = tskIDLE_PRIORITY;
+
+/*-----------------------------------------------------------*/
+
+void vStartKernelBenchmarkTask( UBaseType_t uxPriority )
+{
+	configASSERT( ( uxPriority + 1 ) < configMAX_PRIORITIES );
+	uxBenchPriority = uxPriority;
+
+	xQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+	xSemaphore = xSemaphoreCreateBinary();
+	xMutex = xSemaphoreCreateMutex();
+	xRecursiveMutex = xSemaphoreCreateRecursiveMutex();
+	xFastSemaphore = xFastSemaphoreCreateBinary();
+	xFastMutex = xFastSemaphoreCreateMutex();
+	configASSERT( xQueue );
+	configASSERT( xSemaphore );
+	configASSERT( xMutex );
+	configASSERT( xRecursiveMutex );
+	configASSERT( xFastSemaphore );
+	configASSERT( xFastMutex );
+
+	xTaskCreate( prvBenchmarkTask, "Bench", benchSTACK_SIZE, NULL, uxPriority, &xBenchTask );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsKernelBenchmarkComplete( void )
+{
+	return xBenchComplete;
+}
+/*-----------------------------------------------------------*/
+
+void vKernelBenchTickEntry( void )
+{
+	if( xTickBenchId != benchNUMBER_OF_RESULTS )
+	{
+		ulTickStart = configBENCH_TIMESTAMP();
+		xTickStarted = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vKernelBenchTickHook( void )
+{
+	if( xTickStarted != pdFALSE )
+	{
+		xTickStarted = pdFALSE;
+		prvRecord( xTickBenchId, ulTickStart, configBENCH_TIMESTAMP() );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTask( void *pvParameters )
+{
+uint32_t ulLoop, ulStart, ulEnd;
+BenchId_t xId;
+UBaseType_t uxStep;
+
+	( void ) pvParameters;
+
+	configBENCH_TIMESTAMP_INIT();
+
+	/* Cost of reading the time base, the minimum is used as the overhead. */
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchTIMESTAMP, ulStart, ulEnd );
+	}
+	ulTimestampOverhead = xBenchResults[ benchTIMESTAMP ].ulMin;
+
+	#if( configUSE_TRACE_RECORDER == 1 )
+	{
+		/* Cost of recording one event, as each trace macro does. */
+		for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			vTraceRecorderMark( 0U, ( uint8_t ) ulLoop );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchTRACE_EVENT, ulStart, ulEnd );
+		}
+	}
+	#endif
+
+	prvBenchQueue();
+	prvBenchQueueMultiple();
+	prvBenchPriorityQueue();
+	prvBenchSemaphore();
+	prvBenchMutex();
+	prvBenchFastSemaphore();
+	prvBenchNotify();
+	prvBenchMessages();
+	prvBenchStreams();
+	prvBenchSeqLock();
+	prvBenchYield();
+
+	for( xId = benchQUEUE_WAKE; xId <= benchFAST_SEM_WAKE_ISR; xId++ )
+	{
+		prvBenchWake( xId );
+	}
+
+	for( uxStep = 0; uxStep < benchDELAYED_STEPS; uxStep++ )
+	{
+		if( uxDelayedTaskCounts[ uxStep ] <= configBENCH_DELAYED_TASKS )
+		{
+			prvBenchDelayed( uxStep );
+		}
+	}
+
+	#if( configUSE_TIMERS == 1 )
+	{
+		prvBenchTimers();
+	}
+	#endif
+
+	#if( configBENCH_ALLOCATION == 1 )
+	{
+		prvBenchAllocation();
+	}
+	#endif
+
+	#if( configBENCH_HEAP == 1 )
+	{
+		prvBenchHeap();
+	}
+	#endif
+
+	prvReport();
+	xBenchComplete = pdTRUE;
+
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchQueue( void )
+{
+uint32_t ulLoop, ulStart, ulEnd, ulValue = 0;
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* The queue holds one item, so each send is followed by a receive. */
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xQueueSend( xQueue, &ulLoop, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchQUEUE_SEND, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xQueueReceive( xQueue, &ulValue, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchQUEUE_RECEIVE, ulStart, ulEnd );
+		configASSERT( ulValue == ulLoop );
+	}
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xQueueSendFromISR( xQueue, &ulLoop, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchQUEUE_SEND_ISR, ulStart, ulEnd );
+
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xQueueReceiveFromISR( xQueue, &ulValue, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchQUEUE_RECEIVE_ISR, ulStart, ulEnd );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		configASSERT( ulValue == ulLoop );
+	}
+
+	/* No task was blocked on the queue. */
+	configASSERT( xHigherPriorityTaskWoken == pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchQueueMultiple( void )
+{
+QueueHandle_t xBatchQueue;
+uint32_t ulTxItems[ benchQUEUE_BATCH ], ulRxItems[ benchQUEUE_BATCH ];
+uint32_t ulLoop, ulStart, ulEnd;
+UBaseType_t uxItem, uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	xBatchQueue = xQueueCreate( benchQUEUE_BATCH, sizeof( uint32_t ) );
+	configASSERT( xBatchQueue );
+
+	/* Fill the queue and empty it again, from a different position in the
+	storage area each iteration so the copies wrap around its end. */
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		for( uxItem = 0; uxItem < benchQUEUE_BATCH; uxItem++ )
+		{
+			ulTxItems[ uxItem ] = ulLoop + ( uint32_t ) uxItem;
+		}
+
+		ulStart = configBENCH_TIMESTAMP();
+		for( uxItem = 0; uxItem < benchQUEUE_BATCH; uxItem++ )
+		{
+			( void ) xQueueSend( xBatchQueue, &( ulTxItems[ uxItem ] ), benchDONT_BLOCK );
+		}
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchQUEUE_SEND_8, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		for( uxItem = 0; uxItem < benchQUEUE_BATCH; uxItem++ )
+		{
+			( void ) xQueueReceive( xBatchQueue, &( ulRxItems[ uxItem ] ), benchDONT_BLOCK );
+		}
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchQUEUE_RECEIVE_8, ulStart, ulEnd );
+		configASSERT( ulRxItems[ benchQUEUE_BATCH - 1 ] == ulTxItems[ benchQUEUE_BATCH - 1 ] );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xQueueSendMultiple( xBatchQueue, ulTxItems, benchQUEUE_BATCH, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchQUEUE_SEND_MULTIPLE_8, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xQueueReceiveMultiple( xBatchQueue, ulRxItems, benchQUEUE_BATCH, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchQUEUE_RECEIVE_MULTIPLE_8, ulStart, ulEnd );
+		configASSERT( memcmp( ulRxItems, ulTxItems, sizeof( ulRxItems ) ) == 0 );
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xQueueSendMultipleFromISR( xBatchQueue, ulTxItems, benchQUEUE_BATCH, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchQUEUE_SEND_MULTIPLE_ISR_8, ulStart, ulEnd );
+
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xQueueReceiveMultipleFromISR( xBatchQueue, ulRxItems, benchQUEUE_BATCH, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchQUEUE_RECEIVE_MULTIPLE_ISR_8, ulStart, ulEnd );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		configASSERT( memcmp( ulRxItems, ulTxItems, sizeof( ulRxItems ) ) == 0 );
+
+		/* Move the read and write positions on by one item. */
+		( void ) xQueueSend( xBatchQueue, &ulLoop, benchDONT_BLOCK );
+		( void ) xQueueReceive( xBatchQueue, &ulLoop, benchDONT_BLOCK );
+	}
+
+	/* No task was blocked on the queue. */
+	configASSERT( xHigherPriorityTaskWoken == pdFALSE );
+
+	vQueueDelete( xBatchQueue );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchPriorityQueue( void )
+{
+PriorityQueueHandle_t xPriorityQueue;
+uint32_t ulLoop, ulStart, ulEnd, ulValue = 0;
+UBaseType_t uxItem, uxPriority = 0, uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	xPriorityQueue = xPriorityQueueCreate( benchPRIORITY_QUEUE_LENGTH, sizeof( uint32_t ) );
+	configASSERT( xPriorityQueue );
+
+	for( uxItem = 0; uxItem < ( benchPRIORITY_QUEUE_LENGTH - 1 ); uxItem++ )
+	{
+		ulValue = ( uint32_t ) uxItem;
+		( void ) xPriorityQueueSend( xPriorityQueue, &ulValue, ( uxItem * 5 ) % benchURGENT_PRIORITY, benchDONT_BLOCK );
+	}
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xPriorityQueueSend( xPriorityQueue, &ulLoop, benchURGENT_PRIORITY, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchPRIOQ_SEND, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xPriorityQueueReceive( xPriorityQueue, &ulValue, &uxPriority, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchPRIOQ_RECEIVE, ulStart, ulEnd );
+		configASSERT( ( ulValue == ulLoop ) && ( uxPriority == benchURGENT_PRIORITY ) );
+	}
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xPriorityQueueSendFromISR( xPriorityQueue, &ulLoop, benchURGENT_PRIORITY, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchPRIOQ_SEND_ISR, ulStart, ulEnd );
+
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xPriorityQueueReceiveFromISR( xPriorityQueue, &ulValue, &uxPriority, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchPRIOQ_RECEIVE_ISR, ulStart, ulEnd );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		configASSERT( ( ulValue == ulLoop ) && ( uxPriority == benchURGENT_PRIORITY ) );
+	}
+
+	/* The items held come out highest priority first. */
+	for( uxItem = 0; uxItem < ( benchPRIORITY_QUEUE_LENGTH - 1 ); uxItem++ )
+	{
+		ulLoop = ( uint32_t ) uxPriority;
+		( void ) xPriorityQueueReceive( xPriorityQueue, &ulValue, &uxPriority, benchDONT_BLOCK );
+		configASSERT( uxPriority <= ( UBaseType_t ) ulLoop );
+	}
+
+	/* No task was blocked on the queue. */
+	configASSERT( xHigherPriorityTaskWoken == pdFALSE );
+
+	vPriorityQueueDelete( xPriorityQueue );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchSemaphore( void )
+{
+uint32_t ulLoop, ulStart, ulEnd;
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xSemaphoreGive( xSemaphore );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchSEM_GIVE, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xSemaphoreTake( xSemaphore, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchSEM_TAKE, ulStart, ulEnd );
+	}
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xSemaphoreGiveFromISR( xSemaphore, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchSEM_GIVE_ISR, ulStart, ulEnd );
+
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xSemaphoreTakeFromISR( xSemaphore, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchSEM_TAKE_ISR, ulStart, ulEnd );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+	configASSERT( xHigherPriorityTaskWoken == pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchMutex( void )
+{
+uint32_t ulLoop, ulStart, ulEnd;
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xSemaphoreTake( xMutex, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchMUTEX_TAKE, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xSemaphoreGive( xMutex );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchMUTEX_GIVE, ulStart, ulEnd );
+	}
+
+	/* Recursive mutex taken once more while already held, as recmutex.c
+	does. */
+	( void ) xSemaphoreTakeRecursive( xRecursiveMutex, benchDONT_BLOCK );
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xSemaphoreTakeRecursive( xRecursiveMutex, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchRECMUTEX_TAKE, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xSemaphoreGiveRecursive( xRecursiveMutex );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchRECMUTEX_GIVE, ulStart, ulEnd );
+	}
+	( void ) xSemaphoreGiveRecursive( xRecursiveMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchFastSemaphore( void )
+{
+uint32_t ulLoop, ulStart, ulEnd;
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* The same sequences as prvBenchSemaphore() and prvBenchMutex(), no task
+	is blocked so only the compare and swap paths are timed. */
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xFastSemaphoreGive( xFastSemaphore );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchFAST_SEM_GIVE, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xFastSemaphoreTake( xFastSemaphore, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchFAST_SEM_TAKE, ulStart, ulEnd );
+	}
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xFastSemaphoreGiveFromISR( xFastSemaphore, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchFAST_SEM_GIVE_ISR, ulStart, ulEnd );
+
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xFastSemaphoreTakeFromISR( xFastSemaphore );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchFAST_SEM_TAKE_ISR, ulStart, ulEnd );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+	configASSERT( xHigherPriorityTaskWoken == pdFALSE );
+	configASSERT( uxFastSemaphoreGetCount( xFastSemaphore ) == 0 );
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xFastSemaphoreTake( xFastMutex, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchFAST_MUTEX_TAKE, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xFastSemaphoreGive( xFastMutex );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchFAST_MUTEX_GIVE, ulStart, ulEnd );
+	}
+
+	configASSERT( uxFastSemaphoreGetCount( xFastMutex ) == 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchNotify( void )
+{
+uint32_t ulLoop, ulStart, ulEnd;
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* The benchmark task notifies itself, so no task is unblocked. */
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xTaskNotifyGive( xBenchTask );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchNOTIFY_GIVE, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) ulTaskNotifyTake( pdTRUE, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchNOTIFY_TAKE, ulStart, ulEnd );
+	}
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			vTaskNotifyGiveFromISR( xBenchTask, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchNOTIFY_GIVE_ISR, ulStart, ulEnd );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	configASSERT( ulTaskNotifyTake( pdTRUE, benchDONT_BLOCK ) == benchITERATIONS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchMessages( void )
+{
+static uint8_t ucTxMessage[ benchMAX_MESSAGE_SIZE ], ucRxMessage[ benchMAX_MESSAGE_SIZE ];
+QueueHandle_t xCopyQueue, xMessageQueue;
+BufferPoolHandle_t xPool;
+uint32_t ulLoop, ulStart, ulEnd;
+UBaseType_t uxStep, uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+uint8_t *pucBuffer;
+
+	for( uxStep = 0; uxStep < benchMESSAGE_STEPS; uxStep++ )
+	{
+		xCopyQueue = xQueueCreate( 1, ( UBaseType_t ) xMessageSizes[ uxStep ] );
+		configASSERT( xCopyQueue );
+
+		for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+		{
+			ucTxMessage[ 0 ] = ( uint8_t ) ulLoop;
+
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xQueueSend( xCopyQueue, ucTxMessage, benchDONT_BLOCK );
+			( void ) xQueueReceive( xCopyQueue, ucRxMessage, benchDONT_BLOCK );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( ( BenchId_t ) ( benchMSG_COPY_32 + uxStep ), ulStart, ulEnd );
+			configASSERT( ucRxMessage[ 0 ] == ( uint8_t ) ulLoop );
+		}
+
+		vQueueDelete( xCopyQueue );
+	}
+
+	xCopyQueue = xQueueCreate( 1, benchISR_MESSAGE_SIZE );
+	xMessageQueue = xMessageQueueCreate( 1 );
+	xPool = xBufferPoolCreate( 1, benchMAX_MESSAGE_SIZE );
+	configASSERT( xCopyQueue );
+	configASSERT( xMessageQueue );
+	configASSERT( xPool );
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ulStart = configBENCH_TIMESTAMP();
+		pucBuffer = ( uint8_t * ) pvBufferPoolTake( xPool, benchDONT_BLOCK );
+		( void ) xMessageQueueSend( xMessageQueue, pucBuffer, benchDONT_BLOCK );
+		pucBuffer = ( uint8_t * ) pvMessageQueueReceive( xMessageQueue, benchDONT_BLOCK );
+		vBufferPoolRelease( pucBuffer );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchMSG_REF, ulStart, ulEnd );
+	}
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xQueueSendFromISR( xCopyQueue, ucTxMessage, &xHigherPriorityTaskWoken );
+			( void ) xQueueReceiveFromISR( xCopyQueue, ucRxMessage, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchMSG_COPY_ISR_256, ulStart, ulEnd );
+
+			ulStart = configBENCH_TIMESTAMP();
+			pucBuffer = ( uint8_t * ) pvBufferPoolTakeFromISR( xPool );
+			( void ) xMessageQueueSendFromISR( xMessageQueue, pucBuffer, &xHigherPriorityTaskWoken );
+			pucBuffer = ( uint8_t * ) pvMessageQueueReceiveFromISR( xMessageQueue, &xHigherPriorityTaskWoken );
+			vBufferPoolReleaseFromISR( pucBuffer, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchMSG_REF_ISR, ulStart, ulEnd );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+	configASSERT( uxBufferPoolGetFreeCount( xPool ) == 1 );
+
+	vQueueDelete( xCopyQueue );
+	vQueueDelete( xMessageQueue );
+	vBufferPoolDelete( xPool );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchStreams( void )
+{
+static uint8_t ucTxBlock[ benchISR_MESSAGE_SIZE ], ucRxBlock[ benchISR_MESSAGE_SIZE ];
+QueueHandle_t xByteQueue;
+StreamBufferHandle_t xStreamBuffer;
+MessageBufferHandle_t xMessageBuffer;
+uint32_t ulLoop, ulStart, ulEnd;
+UBaseType_t uxByte, uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+size_t xReceived;
+
+	xByteQueue = xQueueCreate( benchSTREAM_BLOCK_SIZE, sizeof( uint8_t ) );
+	xStreamBuffer = xStreamBufferCreate( benchSTREAM_BLOCK_SIZE, 1 );
+	xMessageBuffer = xMessageBufferCreate( benchISR_MESSAGE_SIZE + sizeof( size_t ) );
+	configASSERT( xByteQueue );
+	configASSERT( xStreamBuffer );
+	configASSERT( xMessageBuffer );
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ucTxBlock[ 0 ] = ( uint8_t ) ulLoop;
+
+		ulStart = configBENCH_TIMESTAMP();
+		for( uxByte = 0; uxByte < benchSTREAM_BLOCK_SIZE; uxByte++ )
+		{
+			( void ) xQueueSend( xByteQueue, &( ucTxBlock[ uxByte ] ), benchDONT_BLOCK );
+		}
+		for( uxByte = 0; uxByte < benchSTREAM_BLOCK_SIZE; uxByte++ )
+		{
+			( void ) xQueueReceive( xByteQueue, &( ucRxBlock[ uxByte ] ), benchDONT_BLOCK );
+		}
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchSTREAM_QUEUE_64, ulStart, ulEnd );
+		configASSERT( ucRxBlock[ 0 ] == ( uint8_t ) ulLoop );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xStreamBufferSend( xStreamBuffer, ucTxBlock, benchSTREAM_BLOCK_SIZE, benchDONT_BLOCK );
+		xReceived = xStreamBufferReceive( xStreamBuffer, ucRxBlock, benchSTREAM_BLOCK_SIZE, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchSTREAM_BUFFER_64, ulStart, ulEnd );
+		configASSERT( xReceived == benchSTREAM_BLOCK_SIZE );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xMessageBufferSend( xMessageBuffer, ucTxBlock, benchISR_MESSAGE_SIZE, benchDONT_BLOCK );
+		xReceived = xMessageBufferReceive( xMessageBuffer, ucRxBlock, benchISR_MESSAGE_SIZE, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchMSGBUF_256, ulStart, ulEnd );
+		configASSERT( xReceived == benchISR_MESSAGE_SIZE );
+	}
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			for( uxByte = 0; uxByte < benchSTREAM_BLOCK_SIZE; uxByte++ )
+			{
+				( void ) xQueueSendFromISR( xByteQueue, &( ucTxBlock[ uxByte ] ), &xHigherPriorityTaskWoken );
+			}
+			for( uxByte = 0; uxByte < benchSTREAM_BLOCK_SIZE; uxByte++ )
+			{
+				( void ) xQueueReceiveFromISR( xByteQueue, &( ucRxBlock[ uxByte ] ), &xHigherPriorityTaskWoken );
+			}
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchSTREAM_QUEUE_ISR_64, ulStart, ulEnd );
+
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xStreamBufferSendFromISR( xStreamBuffer, ucTxBlock, benchSTREAM_BLOCK_SIZE, &xHigherPriorityTaskWoken );
+			( void ) xStreamBufferReceiveFromISR( xStreamBuffer, ucRxBlock, benchSTREAM_BLOCK_SIZE, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchSTREAM_BUFFER_ISR_64, ulStart, ulEnd );
+
+			ulStart = configBENCH_TIMESTAMP();
+			( void ) xMessageBufferSendFromISR( xMessageBuffer, ucTxBlock, benchISR_MESSAGE_SIZE, &xHigherPriorityTaskWoken );
+			( void ) xMessageBufferReceiveFromISR( xMessageBuffer, ucRxBlock, benchISR_MESSAGE_SIZE, &xHigherPriorityTaskWoken );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchMSGBUF_ISR_256, ulStart, ulEnd );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+	configASSERT( xStreamBufferIsEmpty( xStreamBuffer ) == pdTRUE );
+	configASSERT( xMessageBufferIsEmpty( xMessageBuffer ) == pdTRUE );
+
+	vQueueDelete( xByteQueue );
+	vStreamBufferDelete( xStreamBuffer );
+	vMessageBufferDelete( xMessageBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchSeqLock( void )
+{
+static uint8_t ucSharedData[ benchSHARED_DATA_SIZE ], ucNewData[ benchSHARED_DATA_SIZE ], ucCopy[ benchSHARED_DATA_SIZE ];
+SeqLock_t xSeqLock;
+uint32_t ulLoop, ulStart, ulEnd;
+
+	vSeqLockInitialise( &xSeqLock );
+
+	/* No write overlaps a read, so each read copies the data once, which is
+	what a reader pays when the writer is an interrupt that rarely hits the
+	copy.  The same copy from a critical section is what it replaces. */
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		ucNewData[ 0 ] = ( uint8_t ) ulLoop;
+
+		ulStart = configBENCH_TIMESTAMP();
+		vSeqLockWrite( &xSeqLock, ucSharedData, ucNewData, benchSHARED_DATA_SIZE );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchSEQLOCK_WRITE_256, ulStart, ulEnd );
+
+		ulStart = configBENCH_TIMESTAMP();
+		( void ) xSeqLockRead( &xSeqLock, ucCopy, ucSharedData, benchSHARED_DATA_SIZE, benchDONT_BLOCK );
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchSEQLOCK_READ_256, ulStart, ulEnd );
+		configASSERT( ucCopy[ 0 ] == ( uint8_t ) ulLoop );
+
+		ulStart = configBENCH_TIMESTAMP();
+		taskENTER_CRITICAL();
+		{
+			memcpy( ucCopy, ucSharedData, benchSHARED_DATA_SIZE );
+		}
+		taskEXIT_CRITICAL();
+		ulEnd = configBENCH_TIMESTAMP();
+		prvRecord( benchCRITICAL_COPY_256, ulStart, ulEnd );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchYield( void )
+{
+uint32_t ulLoop;
+
+	/* The other task shares the priority of the benchmark task, each yield
+	switches to it and each of its yields switches back. */
+	xTaskCreate( prvYieldTask, "BenchY", benchSTACK_SIZE, NULL, uxBenchPriority, &xYieldTask );
+	configASSERT( xYieldTask );
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		prvYieldAndRecord( xBenchTask, xYieldTask );
+	}
+
+	vTaskDelete( xYieldTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		prvYieldAndRecord( xYieldTask, xBenchTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldAndRecord( TaskHandle_t xThisTask, TaskHandle_t xOtherTask )
+{
+uint32_t ulStart, ulEnd;
+
+	/* Only a switch caused by the yield of the other task is recorded, not
+	one caused by the tick. */
+	if( xYieldingTask == xOtherTask )
+	{
+		ulStart = ulSwitchStart;
+		ulEnd = configBENCH_TIMESTAMP();
+		xYieldingTask = NULL;
+		prvRecord( benchYIELD, ulStart, ulEnd );
+	}
+
+	ulSwitchStart = configBENCH_TIMESTAMP();
+	xYieldingTask = xThisTask;
+	taskYIELD();
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchWake( BenchId_t xId )
+{
+uint32_t ulLoop;
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xHigherPriorityTaskWoken;
+
+	/* The woken task has the higher priority, it runs straight away and
+	blocks on the object selected by xId. */
+	xTaskCreate( prvWakeTask, "BenchW", benchSTACK_SIZE, ( void * ) ( size_t ) xId, uxBenchPriority + 1, &xWokenTask );
+	configASSERT( xWokenTask );
+
+	for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+	{
+		/* By the time the give returns the woken task has run and blocked
+		again. */
+		ulSwitchStart = configBENCH_TIMESTAMP();
+		switch( xId )
+		{
+			case benchQUEUE_WAKE:
+				( void ) xQueueSend( xQueue, &ulLoop, benchDONT_BLOCK );
+				break;
+
+			case benchSEM_WAKE:
+				( void ) xSemaphoreGive( xSemaphore );
+				break;
+
+			case benchNOTIFY_WAKE:
+				( void ) xTaskNotifyGive( xWokenTask );
+				break;
+
+			case benchFAST_SEM_WAKE:
+				( void ) xFastSemaphoreGive( xFastSemaphore );
+				break;
+
+			default:
+				/* The interrupt safe variants, the context switch is requested
+				as an interrupt would do on exit. */
+				xHigherPriorityTaskWoken = pdFALSE;
+				uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+				{
+					if( xId == benchQUEUE_WAKE_ISR )
+					{
+						( void ) xQueueSendFromISR( xQueue, &ulLoop, &xHigherPriorityTaskWoken );
+					}
+					else if( xId == benchSEM_WAKE_ISR )
+					{
+						( void ) xSemaphoreGiveFromISR( xSemaphore, &xHigherPriorityTaskWoken );
+					}
+					else if( xId == benchFAST_SEM_WAKE_ISR )
+					{
+						( void ) xFastSemaphoreGiveFromISR( xFastSemaphore, &xHigherPriorityTaskWoken );
+					}
+					else
+					{
+						vTaskNotifyGiveFromISR( xWokenTask, &xHigherPriorityTaskWoken );
+					}
+				}
+				portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+				portEND_SWITCHING_ISR( xHigherPriorityTaskWoken );
+				break;
+		}
+	}
+
+	/* The woken task deletes itself once it has taken all the samples. */
+	configASSERT( xBenchResults[ xId ].ulSamples == benchITERATIONS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWakeTask( void *pvParameters )
+{
+BenchId_t xId = ( BenchId_t ) ( size_t ) pvParameters;
+uint32_t ulValue;
+
+	while( xBenchResults[ xId ].ulSamples < benchITERATIONS )
+	{
+		if( ( xId == benchQUEUE_WAKE ) || ( xId == benchQUEUE_WAKE_ISR ) )
+		{
+			( void ) xQueueReceive( xQueue, &ulValue, portMAX_DELAY );
+		}
+		else if( ( xId == benchSEM_WAKE ) || ( xId == benchSEM_WAKE_ISR ) )
+		{
+			( void ) xSemaphoreTake( xSemaphore, portMAX_DELAY );
+		}
+		else if( ( xId == benchFAST_SEM_WAKE ) || ( xId == benchFAST_SEM_WAKE_ISR ) )
+		{
+			( void ) xFastSemaphoreTake( xFastSemaphore, portMAX_DELAY );
+		}
+		else
+		{
+			( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		}
+
+		prvRecord( xId, ulSwitchStart, configBENCH_TIMESTAMP() );
+	}
+
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchDelayed( UBaseType_t uxStep )
+{
+TaskHandle_t xDelayedTasks[ configBENCH_DELAYED_TASKS ];
+UBaseType_t uxTask, uxTasks = uxDelayedTaskCounts[ uxStep ];
+BenchId_t xBlockId = ( BenchId_t ) ( benchDELAY_BLOCK_1 + uxStep );
+TickType_t xStartTime;
+uint32_t ulStart, ulEnd;
+BaseType_t xStarted;
+
+	/* The delays grow with the number of tasks, so as many tasks wake per
+	tick whatever the count and the tick measures the cost of the delayed
+	tasks not due. */
+	ulDelaySpread = ( uint32_t ) uxTasks * benchDELAY_TICKS_PER_TASK;
+
+	/* Each task runs straight away, picks its first delay and blocks. */
+	for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+	{
+		xTaskCreate( prvDelayedTask, "BenchD", configMINIMAL_STACK_SIZE, ( void * ) ( size_t ) ( uxTask + 1 ), uxBenchPriority + 1, &( xDelayedTasks[ uxTask ] ) );
+		configASSERT( xDelayedTasks[ uxTask ] );
+	}
+
+	xDelayStarted = pdFALSE;
+	xTickBenchId = ( BenchId_t ) ( benchTICK_DELAYED_1 + uxStep );
+	xStartTime = xTaskGetTickCount();
+
+	/* The benchmark task only runs once all the delayed tasks are blocked, so
+	the first time it looks after one of them called vTaskDelay() it finds the
+	time stamp that task took. */
+	while( ( xTaskGetTickCount() - xStartTime ) < ( TickType_t ) benchITERATIONS )
+	{
+		taskENTER_CRITICAL();
+		{
+			xStarted = xDelayStarted;
+			ulStart = ulDelayStart;
+			ulEnd = configBENCH_TIMESTAMP();
+			xDelayStarted = pdFALSE;
+		}
+		taskEXIT_CRITICAL();
+
+		if( xStarted != pdFALSE )
+		{
+			prvRecord( xBlockId, ulStart, ulEnd );
+		}
+	}
+
+	xTickBenchId = benchNUMBER_OF_RESULTS;
+
+	for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+	{
+		vTaskDelete( xDelayedTasks[ uxTask ] );
+	}
+
+	vTaskDelay( benchSETTLE_DELAY );
+}
+/*-----------------------------------------------------------*/
+
+static void prvDelayedTask( void *pvParameters )
+{
+uint32_t ulSeed = ( uint32_t ) ( size_t ) pvParameters;
+TickType_t xDelay;
+
+	for( ;; )
+	{
+		/* Pseudo random delays spread the wake times across the delayed
+		list. */
+		ulSeed = ( ulSeed * 1103515245UL ) + 12345UL;
+		xDelay = ( TickType_t ) ( ( ( ulSeed >> 16 ) % ulDelaySpread ) + 1UL );
+
+		ulDelayStart = configBENCH_TIMESTAMP();
+		xDelayStarted = pdTRUE;
+		vTaskDelay( xDelay );
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMERS == 1 )
+
+	static void prvBenchTimers( void )
+	{
+	static TimerHandle_t xLoadTimers[ configBENCH_TIMERS ];
+	TimerHandle_t xIdleTimer, xProbeTimer;
+	UBaseType_t uxTimer;
+	uint32_t ulLoop, ulStart, ulEnd, ulSeed = 1;
+	TickType_t xPeriod;
+
+		for( uxTimer = 0; uxTimer < configBENCH_TIMERS; uxTimer++ )
+		{
+			ulSeed = ( ulSeed * 1103515245UL ) + 12345UL;
+			xPeriod = ( TickType_t ) ( ( ( ulSeed >> 16 ) % benchDELAY_SPREAD ) + 1UL );
+
+			xLoadTimers[ uxTimer ] = xTimerCreate( "BenchL", xPeriod, pdTRUE, NULL, prvLoadTimerCallback );
+			configASSERT( xLoadTimers[ uxTimer ] );
+			xTimerStart( xLoadTimers[ uxTimer ], portMAX_DELAY );
+		}
+
+		xIdleTimer = xTimerCreate( "BenchI", benchIDLE_TIMER_PERIOD, pdFALSE, NULL, prvLoadTimerCallback );
+		xProbeTimer = xTimerCreate( "BenchP", ( TickType_t ) 1, pdTRUE, NULL, prvProbeTimerCallback );
+		configASSERT( xIdleTimer );
+		configASSERT( xProbeTimer );
+
+		for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			xTimerStart( xIdleTimer, portMAX_DELAY );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchTIMER_START, ulStart, ulEnd );
+
+			ulStart = configBENCH_TIMESTAMP();
+			xTimerStop( xIdleTimer, portMAX_DELAY );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchTIMER_STOP, ulStart, ulEnd );
+		}
+
+		/* The probe timer expires on every tick, the time stamp taken on
+		entry to xTaskIncrementTick() is the start of its expiry. */
+		xTickBenchId = benchTICK_TIMERS;
+		xExpiryBenchId = benchTIMER_EXPIRY;
+		xTimerStart( xProbeTimer, portMAX_DELAY );
+		vTaskDelay( ( TickType_t ) benchITERATIONS );
+		xTimerStop( xProbeTimer, portMAX_DELAY );
+
+		#if( configUSE_TIMER_WHEEL == 1 )
+		{
+			vTimerSetCallbackFromTick( xProbeTimer, pdTRUE );
+			xExpiryBenchId = benchTIMER_EXPIRY_TICK;
+			xTimerStart( xProbeTimer, portMAX_DELAY );
+			vTaskDelay( ( TickType_t ) benchITERATIONS );
+			xTimerStop( xProbeTimer, portMAX_DELAY );
+		}
+		#endif
+
+		xExpiryBenchId = benchNUMBER_OF_RESULTS;
+		xTickBenchId = benchNUMBER_OF_RESULTS;
+
+		for( uxTimer = 0; uxTimer < configBENCH_TIMERS; uxTimer++ )
+		{
+			xTimerDelete( xLoadTimers[ uxTimer ], portMAX_DELAY );
+		}
+		xTimerDelete( xIdleTimer, portMAX_DELAY );
+		xTimerDelete( xProbeTimer, portMAX_DELAY );
+
+		vTaskDelay( benchSETTLE_DELAY );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvLoadTimerCallback( TimerHandle_t xTimer )
+	{
+		/* The load is the timer processing itself. */
+		( void ) xTimer;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvProbeTimerCallback( TimerHandle_t xTimer )
+	{
+	BenchId_t xId = xExpiryBenchId;
+
+		( void ) xTimer;
+
+		/* A timer service task running later than the next tick makes the
+		sample the time since that tick. */
+		if( xId != benchNUMBER_OF_RESULTS )
+		{
+			prvRecord( xId, ulTickStart, configBENCH_TIMESTAMP() );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TIMERS */
+
+#if( configBENCH_HEAP == 1 )
+
+	static void prvBenchHeap( void )
+	{
+	static void *pvBlocks[ configBENCH_HEAP_BLOCKS ];
+	static size_t xSizes[ configBENCH_HEAP_BLOCKS ];
+	uint32_t ulOperation, ulStart, ulEnd, ulSeed = 1UL, ulRandom;
+	size_t xSize, xLiveBytes = 0, xBudget;
+	UBaseType_t uxBlock;
+	void *pvLarge;
+
+		/* Failed allocations would call the malloc failed hook, the mix stays
+		well within the free heap. */
+		xBudget = xPortGetFreeHeapSize() / ( size_t ) 2;
+
+		for( ulOperation = 0; ulOperation < ( uint32_t ) configBENCH_HEAP_OPERATIONS; ulOperation++ )
+		{
+			ulSeed = ( ulSeed * 1103515245UL ) + 12345UL;
+			uxBlock = ( UBaseType_t ) ( ( ulSeed >> 16 ) % ( uint32_t ) configBENCH_HEAP_BLOCKS );
+
+			if( pvBlocks[ uxBlock ] != NULL )
+			{
+				ulStart = configBENCH_TIMESTAMP();
+				vPortFree( pvBlocks[ uxBlock ] );
+				ulEnd = configBENCH_TIMESTAMP();
+				prvRecord( benchHEAP_FREE, ulStart, ulEnd );
+
+				pvBlocks[ uxBlock ] = NULL;
+				xLiveBytes -= xSizes[ uxBlock ];
+			}
+			else
+			{
+				/* 70% up to 128 bytes, 25% up to 1KB, 5% up to 4KB. */
+				ulSeed = ( ulSeed * 1103515245UL ) + 12345UL;
+				ulRandom = ( ulSeed >> 16 ) % 100UL;
+				ulSeed = ( ulSeed * 1103515245UL ) + 12345UL;
+
+				if( ulRandom < 70UL )
+				{
+					xSize = ( size_t ) ( ( ulSeed >> 8 ) % 128UL ) + 1;
+				}
+				else if( ulRandom < 95UL )
+				{
+					xSize = ( size_t ) ( ( ulSeed >> 8 ) % 1024UL ) + 1;
+				}
+				else
+				{
+					xSize = ( size_t ) ( ( ulSeed >> 8 ) % ( uint32_t ) benchHEAP_MAX_BLOCK ) + 1;
+				}
+
+				if( ( xLiveBytes + xSize ) <= xBudget )
+				{
+					ulStart = configBENCH_TIMESTAMP();
+					pvBlocks[ uxBlock ] = pvPortMalloc( xSize );
+					ulEnd = configBENCH_TIMESTAMP();
+					prvRecord( benchHEAP_MALLOC, ulStart, ulEnd );
+
+					configASSERT( pvBlocks[ uxBlock ] );
+					xSizes[ uxBlock ] = xSize;
+					xLiveBytes += xSize;
+				}
+			}
+		}
+
+		vPortGetHeapStats( &xHeapStats );
+		xHeapMeasured = pdTRUE;
+
+		for( uxBlock = 0; uxBlock < ( UBaseType_t ) configBENCH_HEAP_BLOCKS; uxBlock++ )
+		{
+			vPortFree( pvBlocks[ uxBlock ] );
+			pvBlocks[ uxBlock ] = NULL;
+		}
+
+		/* The worst case of a first fit search: freeing every other small
+		block leaves holes too small for the request, a list search visits all
+		of them. */
+		for( uxBlock = 0; uxBlock < ( UBaseType_t ) configBENCH_HEAP_BLOCKS; uxBlock++ )
+		{
+			pvBlocks[ uxBlock ] = pvPortMalloc( benchHEAP_HOLE_SIZE );
+			configASSERT( pvBlocks[ uxBlock ] );
+		}
+
+		for( uxBlock = 0; uxBlock < ( UBaseType_t ) configBENCH_HEAP_BLOCKS; uxBlock += 2 )
+		{
+			vPortFree( pvBlocks[ uxBlock ] );
+			pvBlocks[ uxBlock ] = NULL;
+		}
+
+		for( ulOperation = 0; ulOperation < benchITERATIONS; ulOperation++ )
+		{
+			ulStart = configBENCH_TIMESTAMP();
+			pvLarge = pvPortMalloc( benchHEAP_MAX_BLOCK );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchHEAP_MALLOC_HOLES, ulStart, ulEnd );
+
+			configASSERT( pvLarge );
+			vPortFree( pvLarge );
+		}
+
+		for( uxBlock = 1; uxBlock < ( UBaseType_t ) configBENCH_HEAP_BLOCKS; uxBlock += 2 )
+		{
+			vPortFree( pvBlocks[ uxBlock ] );
+			pvBlocks[ uxBlock ] = NULL;
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configBENCH_HEAP */
+
+#if( configBENCH_ALLOCATION == 1 )
+
+	static void prvBenchAllocation( void )
+	{
+	TaskHandle_t xCreatedTasks[ benchCREATE_BATCH ];
+	QueueHandle_t xCreatedQueue;
+	uint32_t ulLoop, ulStart, ulEnd;
+	UBaseType_t uxObject;
+	size_t xFreeBefore;
+	#if( configUSE_TIMERS == 1 )
+		TimerHandle_t xCreatedTimers[ benchCREATE_BATCH ];
+	#endif
+
+		/* The tasks are created at the idle priority so they do not run, and
+		are deleted in batches.  The idle task frees them, or leaves the static
+		buffers to be reused, while the benchmark task is delayed. */
+		for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop += benchCREATE_BATCH )
+		{
+			xFreeBefore = xPortGetFreeHeapSize();
+
+			for( uxObject = 0; uxObject < benchCREATE_BATCH; uxObject++ )
+			{
+				ulStart = configBENCH_TIMESTAMP();
+				( void ) xTaskCreate( prvCreatedTask, "Created", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, &( xCreatedTasks[ uxObject ] ) );
+				ulEnd = configBENCH_TIMESTAMP();
+				prvRecord( benchTASK_CREATE, ulStart, ulEnd );
+				configASSERT( xCreatedTasks[ uxObject ] );
+			}
+
+			xTaskHeapBytes = ( xFreeBefore - xPortGetFreeHeapSize() ) / ( size_t ) benchCREATE_BATCH;
+
+			for( uxObject = 0; uxObject < benchCREATE_BATCH; uxObject++ )
+			{
+				vTaskDelete( xCreatedTasks[ uxObject ] );
+			}
+			vTaskDelay( benchSETTLE_DELAY );
+		}
+
+		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		{
+			for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop += benchCREATE_BATCH )
+			{
+				for( uxObject = 0; uxObject < benchCREATE_BATCH; uxObject++ )
+				{
+					ulStart = configBENCH_TIMESTAMP();
+					xCreatedTasks[ uxObject ] = xTaskCreateStatic( prvCreatedTask, "Created", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, uxCreatedTaskStacks[ uxObject ], &( xCreatedTaskBuffers[ uxObject ] ) );
+					ulEnd = configBENCH_TIMESTAMP();
+					prvRecord( benchTASK_CREATE_STATIC, ulStart, ulEnd );
+					configASSERT( xCreatedTasks[ uxObject ] );
+				}
+
+				for( uxObject = 0; uxObject < benchCREATE_BATCH; uxObject++ )
+				{
+					vTaskDelete( xCreatedTasks[ uxObject ] );
+				}
+				vTaskDelay( benchSETTLE_DELAY );
+			}
+		}
+		#endif
+
+		/* Queues are deleted as soon as created. */
+		for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop++ )
+		{
+			xFreeBefore = xPortGetFreeHeapSize();
+
+			ulStart = configBENCH_TIMESTAMP();
+			xCreatedQueue = xQueueCreate( benchCREATE_QUEUE_LENGTH, sizeof( uint32_t ) );
+			ulEnd = configBENCH_TIMESTAMP();
+			prvRecord( benchQUEUE_CREATE, ulStart, ulEnd );
+			configASSERT( xCreatedQueue );
+
+			xQueueHeapBytes = xFreeBefore - xPortGetFreeHeapSize();
+			vQueueDelete( xCreatedQueue );
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				ulStart = configBENCH_TIMESTAMP();
+				xCreatedQueue = xQueueCreateStatic( benchCREATE_QUEUE_LENGTH, sizeof( uint32_t ), ucCreatedQueueStorage, &xCreatedQueueBuffer );
+				ulEnd = configBENCH_TIMESTAMP();
+				prvRecord( benchQUEUE_CREATE_STATIC, ulStart, ulEnd );
+				configASSERT( xCreatedQueue );
+
+				vQueueDelete( xCreatedQueue );
+			}
+			#endif
+		}
+
+		#if( configUSE_TIMERS == 1 )
+		{
+			/* Timers are deleted by the timer service task, which is left to
+			process the deletes before the static buffers are reused. */
+			for( ulLoop = 0; ulLoop < benchITERATIONS; ulLoop += benchCREATE_BATCH )
+			{
+				xFreeBefore = xPortGetFreeHeapSize();
+
+				for( uxObject = 0; uxObject < benchCREATE_BATCH; uxObject++ )
+				{
+					ulStart = configBENCH_TIMESTAMP();
+					xCreatedTimers[ uxObject ] = xTimerCreate( "Created", benchIDLE_TIMER_PERIOD, pdFALSE, NULL, prvLoadTimerCallback );
+					ulEnd = configBENCH_TIMESTAMP();
+					prvRecord( benchTIMER_CREATE, ulStart, ulEnd );
+					configASSERT( xCreatedTimers[ uxObject ] );
+				}
+
+				xTimerHeapBytes = ( xFreeBefore - xPortGetFreeHeapSize() ) / ( size_t ) benchCREATE_BATCH;
+
+				for( uxObject = 0; uxObject < benchCREATE_BATCH; uxObject++ )
+				{
+					( void ) xTimerDelete( xCreatedTimers[ uxObject ], portMAX_DELAY );
+				}
+				vTaskDelay( benchSETTLE_DELAY );
+
+				#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+				{
+					for( uxObject = 0; uxObject < benchCREATE_BATCH; uxObject++ )
+					{
+						ulStart = configBENCH_TIMESTAMP();
+						xCreatedTimers[ uxObject ] = xTimerCreateStatic( "Created", benchIDLE_TIMER_PERIOD, pdFALSE, NULL, prvLoadTimerCallback, &( xCreatedTimerBuffers[ uxObject ] ) );
+						ulEnd = configBENCH_TIMESTAMP();
+						prvRecord( benchTIMER_CREATE_STATIC, ulStart, ulEnd );
+						configASSERT( xCreatedTimers[ uxObject ] );
+					}
+
+					for( uxObject = 0; uxObject < benchCREATE_BATCH; uxObject++ )
+					{
+						( void ) xTimerDelete( xCreatedTimers[ uxObject ], portMAX_DELAY );
+					}
+					vTaskDelay( benchSETTLE_DELAY );
+				}
+				#endif
+			}
+		}
+		#endif /* configUSE_TIMERS */
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvCreatedTask( void *pvParameters )
+	{
+		/* The task is deleted before it gets to run. */
+		( void ) pvParameters;
+		configASSERT( pdFALSE );
+
+		for( ;; )
+		{
+			vTaskDelay( benchSETTLE_DELAY );
+		}
+	}
+
+#endif /* configBENCH_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvRecord( BenchId_t xId, uint32_t ulStart, uint32_t ulEnd )
+{
+BenchResult_t *pxResult = &( xBenchResults[ xId ] );
+uint32_t ulTime = ulEnd - ulStart;
+
+	if( ulTime > ulTimestampOverhead )
+	{
+		ulTime -= ulTimestampOverhead;
+	}
+	else
+	{
+		ulTime = 0;
+	}
+
+	if( ( pxResult->ulSamples == 0 ) || ( ulTime < pxResult->ulMin ) )
+	{
+		pxResult->ulMin = ulTime;
+	}
+
+	if( ulTime > pxResult->ulMax )
+	{
+		pxResult->ulMax = ulTime;
+	}
+
+	pxResult->ullTotal += ulTime;
+	pxResult->ulSamples++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReport( void )
+{
+BenchResult_t *pxResult;
+UBaseType_t uxId;
+
+	/* The C library may take locks the port cannot see, no other task runs
+	while the report is output. */
+	vTaskSuspendAll();
+	{
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configUSE_PORT_OPTIMISED_TASK_SELECTION,%d\n", configUSE_PORT_OPTIMISED_TASK_SELECTION ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configUSE_TRACE_FACILITY,%d\n", configUSE_TRACE_FACILITY ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configUSE_QUEUE_SETS,%d\n", configUSE_QUEUE_SETS ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configGENERATE_RUN_TIME_STATS,%d\n", configGENERATE_RUN_TIME_STATS ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configUSE_TRACE_RECORDER,%d\n", configUSE_TRACE_RECORDER ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configCHECK_FOR_STACK_OVERFLOW,%d\n", configCHECK_FOR_STACK_OVERFLOW ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configMAX_PRIORITIES,%d\n", configMAX_PRIORITIES ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configTICK_RATE_HZ,%lu\n", ( unsigned long ) configTICK_RATE_HZ ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configUSE_DELAYED_TASK_WHEEL,%d\n", configUSE_DELAYED_TASK_WHEEL ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configUSE_TIMER_WHEEL,%d\n", configUSE_TIMER_WHEEL ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configBENCH_TIMERS,%d\n", configBENCH_TIMERS ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,configSUPPORT_STATIC_ALLOCATION,%d\n", configSUPPORT_STATIC_ALLOCATION ) );
+		configBENCH_PRINTF( ( "BENCH_CONFIG,timestamp_overhead,%lu\n", ( unsigned long ) ulTimestampOverhead ) );
+
+		for( uxId = 0; uxId < benchNUMBER_OF_RESULTS; uxId++ )
+		{
+			pxResult = &( xBenchResults[ uxId ] );
+			if( pxResult->ulSamples != 0 )
+			{
+				configBENCH_PRINTF( ( "BENCH,%s,%s,%lu,%lu,%lu,%lu\n", pxResult->pcName, configBENCH_TIMESTAMP_UNIT,
+									  ( unsigned long ) pxResult->ulSamples, ( unsigned long ) pxResult->ulMin,
+									  ( unsigned long ) ( pxResult->ullTotal / pxResult->ulSamples ),
+									  ( unsigned long ) pxResult->ulMax ) );
+			}
+		}
+
+		#if( configBENCH_HEAP == 1 )
+		{
+			if( xHeapMeasured != pdFALSE )
+			{
+				configBENCH_PRINTF( ( "BENCH_HEAP,free_bytes,%lu\n", ( unsigned long ) xHeapStats.xAvailableHeapSpaceInBytes ) );
+				configBENCH_PRINTF( ( "BENCH_HEAP,largest_free_block,%lu\n", ( unsigned long ) xHeapStats.xSizeOfLargestFreeBlockInBytes ) );
+				configBENCH_PRINTF( ( "BENCH_HEAP,smallest_free_block,%lu\n", ( unsigned long ) xHeapStats.xSizeOfSmallestFreeBlockInBytes ) );
+				configBENCH_PRINTF( ( "BENCH_HEAP,free_blocks,%lu\n", ( unsigned long ) xHeapStats.xNumberOfFreeBlocks ) );
+				configBENCH_PRINTF( ( "BENCH_HEAP,fragmentation_percent,%lu\n", ( unsigned long ) xHeapStats.uxFragmentationPercent ) );
+				configBENCH_PRINTF( ( "BENCH_HEAP,minimum_ever_free_bytes,%lu\n", ( unsigned long ) xHeapStats.xMinimumEverFreeBytesRemaining ) );
+				configBENCH_PRINTF( ( "BENCH_HEAP,allocations,%lu\n", ( unsigned long ) xHeapStats.xNumberOfSuccessfulAllocations ) );
+				configBENCH_PRINTF( ( "BENCH_HEAP,frees,%lu\n", ( unsigned long ) xHeapStats.xNumberOfSuccessfulFrees ) );
+
+				for( uxId = 0; uxId < ( UBaseType_t ) portHEAP_HISTOGRAM_BINS; uxId++ )
+				{
+					/* Named after the smallest request counted by each class,
+					a class ends where the next one starts. */
+					configBENCH_PRINTF( ( "BENCH_HEAP,histogram_%lu,%lu\n", ( unsigned long ) ( ( uxId == 0 ) ? 0UL : ( 16UL << uxId ) ), ( unsigned long ) xHeapStats.xAllocationHistogram[ uxId ] ) );
+				}
+			}
+		}
+		#endif
+
+		#if( configBENCH_ALLOCATION == 1 )
+		{
+			/* A task takes its TCB and its stack, a queue its storage area. */
+			configBENCH_PRINTF( ( "BENCH_ALLOC,task,%lu,%lu\n", ( unsigned long ) xTaskHeapBytes, ( unsigned long ) ( sizeof( StaticTask_t ) + ( configMINIMAL_STACK_SIZE * sizeof( StackType_t ) ) ) ) );
+			configBENCH_PRINTF( ( "BENCH_ALLOC,queue,%lu,%lu\n", ( unsigned long ) xQueueHeapBytes, ( unsigned long ) ( sizeof( StaticQueue_t ) + ( benchCREATE_QUEUE_LENGTH * sizeof( uint32_t ) ) ) ) );
+			#if( configUSE_TIMERS == 1 )
+			{
+				configBENCH_PRINTF( ( "BENCH_ALLOC,timer,%lu,%lu\n", ( unsigned long ) xTimerHeapBytes, ( unsigned long ) sizeof( StaticTimer_t ) ) );
+			}
+			#endif
+		}
+		#endif
+
+		configBENCH_PRINTF( ( "BENCH_END\n" ) );
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
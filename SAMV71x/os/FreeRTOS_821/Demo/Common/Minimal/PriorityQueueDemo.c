@@ -0,0 +1,714 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the priority queues of priority_queue.c.
+ *
+ * The controller task first runs tests that need no other task.  Items of
+ * random priorities are posted and received in a random order, each receive
+ * being checked against a model of the queue: the item received must be the
+ * one of the highest priority, the first posted if several have that
+ * priority, and come with the priority it was posted with.  A block time
+ * expires when no item or no space arrives.
+ *
+ * It then posts items to two higher priority receiver tasks blocked on an
+ * empty queue.  A single item must be received by the higher priority
+ * receiver before the send returns.  Items posted with the scheduler suspended
+ * must then be received by the higher priority receiver in priority order,
+ * the oldest first among equal priorities, up to the number it receives before
+ * suspending itself, and the rest by the other receiver in the same order.
+ *
+ * Last it fills a queue that two higher priority sender tasks then block
+ * posting to.  Each receive must let the higher priority sender post first,
+ * even though it blocked last, and the items must then be received in
+ * priority order whatever the order they were posted in.
+ *
+ * A pair of tasks also stream items of random priorities through a queue with
+ * an unlimited block time.  The sender has the higher priority, so it keeps
+ * blocking on a full queue until the receiver wakes it.  The items of each
+ * priority must be received in the order they were posted.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "priority_queue.h"
+
+/* Demo program include files. */
+#include "PriorityQueueDemo.h"
+
+/* The priorities of the tasks, as described at the top of this file. */
+#define pqLOWER_PRIORITY			( tskIDLE_PRIORITY )
+#define pqHIGHER_PRIORITY			( tskIDLE_PRIORITY + 1 )
+#define pqCONTROLLER_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define pqMEDIUM_PRIORITY			( tskIDLE_PRIORITY + 2 )
+#define pqHIGH_PRIORITY				( tskIDLE_PRIORITY + 3 )
+
+#define pqDONT_BLOCK				( ( TickType_t ) 0 )
+#define pqSHORT_DELAY				pdMS_TO_TICKS( 20 )
+
+/* The length of the queue of the single task tests, the number of random
+posts and receives made to it, and the range of the priorities of its items. */
+#define pqTEST_QUEUE_LENGTH			( ( UBaseType_t ) 16 )
+#define pqRANDOM_STEPS				( 64 )
+#define pqITEM_PRIORITIES			( 4UL )
+
+/* The length of the queue of the blocked senders. */
+#define pqQUEUE_LENGTH				( ( UBaseType_t ) 4 )
+
+/* The number of items posted to the blocked receivers with the scheduler
+suspended, see uxPostedPriorities[], which is also the length of their queue,
+and the number of items a blocked receiver receives before suspending itself. */
+#define pqPOSTED_ITEMS				( ( UBaseType_t ) 5 )
+#define pqRECEIVE_BATCH				( ( UBaseType_t ) 4 )
+
+/* The length of the queue of the streaming tasks.  Their items carry their
+priority in the top byte, and their sequence number within that priority. */
+#define pqSTREAM_QUEUE_LENGTH		( ( UBaseType_t ) 7 )
+#define pqPRIORITY_SHIFT			( 24 )
+#define pqSEQUENCE_MASK				( 0x00ffffffUL )
+
+/* Indexes of the blocked receivers and senders. */
+#define pqMEDIUM_TASK				( 0 )
+#define pqHIGH_TASK					( 1 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks as described at the top of this file.
+ */
+static void prvControllerTask( void *pvParameters );
+static void prvBlockedReceiverTask( void *pvParameters );
+static void prvBlockedSenderTask( void *pvParameters );
+static void prvStreamSenderTask( void *pvParameters );
+static void prvStreamReceiverTask( void *pvParameters );
+
+/*
+ * The tests of the controller task.
+ */
+static void prvSingleTaskTests( void );
+static void prvBlockedReceiverTests( void );
+static void prvBlockedSenderTests( void );
+
+/*
+ * Post an item of priority uxPriority to the queue of the single task tests,
+ * and add it to the model of that queue.
+ */
+static void prvModelSend( UBaseType_t uxPriority );
+
+/*
+ * Receive an item from the queue of the single task tests, checking it is the
+ * item the model says is to be received first, and remove it from the model.
+ */
+static void prvModelReceive( void );
+
+/*
+ * Receive an item from xSenderQueue without blocking, checking its value and
+ * priority.
+ */
+static void prvReceiveFromSenderQueue( uint32_t ulExpectedValue, UBaseType_t uxExpectedPriority );
+
+/*
+ * Utility function to create pseudo random numbers.
+ */
+static uint32_t prvRand( uint32_t *pulSeed );
+
+/*-----------------------------------------------------------*/
+
+/* Used to latch errors during the test's execution. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* Incremented by the controller task, and by the stream receiver, to show
+they are still running. */
+static volatile uint32_t ulControllerCycles = 0UL, ulStreamReceiveCycles = 0UL;
+
+/* The queues of the controller task tests, and of the streaming tasks. */
+static PriorityQueueHandle_t xTestQueue = NULL, xReceiverQueue = NULL, xSenderQueue = NULL, xStreamQueue = NULL;
+
+/* The model of xTestQueue: the value and priority of each item held, values
+being posted in increasing order so the oldest item has the lowest. */
+static uint32_t ulModelValues[ pqTEST_QUEUE_LENGTH ];
+static UBaseType_t uxModelPriorities[ pqTEST_QUEUE_LENGTH ];
+static UBaseType_t uxModelCount = 0;
+static uint32_t ulNextModelValue = 0UL;
+
+/* The priorities of the items posted to the blocked receivers with the
+scheduler suspended, and the order in which the high and medium priority
+receivers are to receive them. */
+static const UBaseType_t uxPostedPriorities[ pqPOSTED_ITEMS ] = { 1, 3, 2, 3, 1 };
+static const UBaseType_t uxHighReceiveOrder[ pqRECEIVE_BATCH - 1 ] = { 1, 3, 2 };
+static const UBaseType_t uxMediumReceiveOrder[ pqPOSTED_ITEMS - ( pqRECEIVE_BATCH - 1 ) ] = { 0, 4 };
+
+/* The blocked receivers and senders.  The receivers record the value and
+priority of the items they receive, the senders post ulSenderValues[] with
+the priority set in uxSenderPriorities[] each time they are resumed. */
+static TaskHandle_t xReceiverTasks[ 2 ] = { NULL, NULL }, xSenderTasks[ 2 ] = { NULL, NULL };
+static volatile UBaseType_t uxReceived[ 2 ] = { 0, 0 };
+static uint32_t ulReceivedValues[ 2 ][ pqRECEIVE_BATCH ];
+static UBaseType_t uxReceivedPriorities[ 2 ][ pqRECEIVE_BATCH ];
+static volatile uint32_t ulSenderValues[ 2 ] = { 0UL, 0UL };
+static volatile UBaseType_t uxSenderPriorities[ 2 ] = { 0, 0 }, uxSent[ 2 ] = { 0, 0 };
+
+/*-----------------------------------------------------------*/
+
+void vStartPriorityQueueTasks( void )
+{
+	xTestQueue = xPriorityQueueCreate( pqTEST_QUEUE_LENGTH, sizeof( uint32_t ) );
+	xReceiverQueue = xPriorityQueueCreate( pqPOSTED_ITEMS, sizeof( uint32_t ) );
+	xSenderQueue = xPriorityQueueCreate( pqQUEUE_LENGTH, sizeof( uint32_t ) );
+	xStreamQueue = xPriorityQueueCreate( pqSTREAM_QUEUE_LENGTH, sizeof( uint32_t ) );
+	configASSERT( xTestQueue );
+	configASSERT( xReceiverQueue );
+	configASSERT( xSenderQueue );
+	configASSERT( xStreamQueue );
+
+	xTaskCreate( prvControllerTask, "PQCtrl", configMINIMAL_STACK_SIZE, NULL, pqCONTROLLER_PRIORITY, NULL );
+	xTaskCreate( prvBlockedReceiverTask, "PQRx1", configMINIMAL_STACK_SIZE, ( void * ) pqMEDIUM_TASK, pqMEDIUM_PRIORITY, &( xReceiverTasks[ pqMEDIUM_TASK ] ) );
+	xTaskCreate( prvBlockedReceiverTask, "PQRx2", configMINIMAL_STACK_SIZE, ( void * ) pqHIGH_TASK, pqHIGH_PRIORITY, &( xReceiverTasks[ pqHIGH_TASK ] ) );
+	xTaskCreate( prvBlockedSenderTask, "PQTx1", configMINIMAL_STACK_SIZE, ( void * ) pqMEDIUM_TASK, pqMEDIUM_PRIORITY, &( xSenderTasks[ pqMEDIUM_TASK ] ) );
+	xTaskCreate( prvBlockedSenderTask, "PQTx2", configMINIMAL_STACK_SIZE, ( void * ) pqHIGH_TASK, pqHIGH_PRIORITY, &( xSenderTasks[ pqHIGH_TASK ] ) );
+
+	xTaskCreate( prvStreamSenderTask, "PQStTx", configMINIMAL_STACK_SIZE, NULL, pqHIGHER_PRIORITY, NULL );
+	xTaskCreate( prvStreamReceiverTask, "PQStRx", configMINIMAL_STACK_SIZE, NULL, pqLOWER_PRIORITY, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControllerTask( void *pvParameters )
+{
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		prvSingleTaskTests();
+		prvBlockedReceiverTests();
+		prvBlockedSenderTests();
+
+		/* Incremented to show the task is still running. */
+		ulControllerCycles++;
+
+		/* Leave the streaming tasks of the lower priority a chance to run. */
+		vTaskDelay( pqSHORT_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSingleTaskTests( void )
+{
+static uint32_t ulSeed = 0x5a5aUL;
+uint32_t ulValue;
+BaseType_t x;
+TickType_t xTimeBefore;
+
+	/* Nothing to receive, the block time expires and nothing is returned. */
+	xTimeBefore = xTaskGetTickCount();
+	if( xPriorityQueueReceive( xTestQueue, &ulValue, NULL, pqSHORT_DELAY ) != errQUEUE_EMPTY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeBefore ) < pqSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Post and receive in a random order, posting more often than receiving
+	so the queue also gets full. */
+	ulNextModelValue = 0UL;
+
+	for( x = 0; x < pqRANDOM_STEPS; x++ )
+	{
+		if( ( uxModelCount == 0 ) || ( ( uxModelCount < pqTEST_QUEUE_LENGTH ) && ( ( prvRand( &ulSeed ) % 3UL ) != 0UL ) ) )
+		{
+			prvModelSend( ( UBaseType_t ) ( prvRand( &ulSeed ) % pqITEM_PRIORITIES ) );
+		}
+		else
+		{
+			prvModelReceive();
+		}
+
+		if( uxPriorityQueueMessagesWaiting( xTestQueue ) != uxModelCount )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	/* Fill the queue, then no space, the block time expires and nothing is
+	posted. */
+	while( uxModelCount < pqTEST_QUEUE_LENGTH )
+	{
+		prvModelSend( ( UBaseType_t ) ( prvRand( &ulSeed ) % pqITEM_PRIORITIES ) );
+	}
+
+	xTimeBefore = xTaskGetTickCount();
+	if( xPriorityQueueSend( xTestQueue, &ulValue, pqITEM_PRIORITIES, pqSHORT_DELAY ) != errQUEUE_FULL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeBefore ) < pqSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	while( uxModelCount > 0 )
+	{
+		prvModelReceive();
+	}
+
+	if( uxPriorityQueueMessagesWaiting( xTestQueue ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvModelSend( UBaseType_t uxPriority )
+{
+	if( xPriorityQueueSend( xTestQueue, &ulNextModelValue, uxPriority, pqDONT_BLOCK ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulModelValues[ uxModelCount ] = ulNextModelValue;
+		uxModelPriorities[ uxModelCount ] = uxPriority;
+		uxModelCount++;
+	}
+
+	ulNextModelValue++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvModelReceive( void )
+{
+uint32_t ulValue;
+UBaseType_t ux, uxFirst = 0, uxPriority;
+
+	/* The item of the highest priority, the lowest value meaning the oldest
+	among equal priorities. */
+	for( ux = 1; ux < uxModelCount; ux++ )
+	{
+		if( ( uxModelPriorities[ ux ] > uxModelPriorities[ uxFirst ] ) ||
+			( ( uxModelPriorities[ ux ] == uxModelPriorities[ uxFirst ] ) && ( ulModelValues[ ux ] < ulModelValues[ uxFirst ] ) ) )
+		{
+			uxFirst = ux;
+		}
+	}
+
+	if( xPriorityQueueReceive( xTestQueue, &ulValue, &uxPriority, pqDONT_BLOCK ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else if( ( ulValue != ulModelValues[ uxFirst ] ) || ( uxPriority != uxModelPriorities[ uxFirst ] ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Remove the item from the model whatever was received, so one error does
+	not cascade. */
+	uxModelCount--;
+	ulModelValues[ uxFirst ] = ulModelValues[ uxModelCount ];
+	uxModelPriorities[ uxFirst ] = uxModelPriorities[ uxModelCount ];
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockedReceiverTests( void )
+{
+const uint32_t ulBase = ulControllerCycles * pqPOSTED_ITEMS;
+uint32_t ulValue;
+UBaseType_t ux;
+
+	/* Both receivers are blocked, as they run above this task.  The counts
+	are only cleared while they are. */
+	if( ( eTaskGetState( xReceiverTasks[ pqMEDIUM_TASK ] ) != eBlocked ) || ( eTaskGetState( xReceiverTasks[ pqHIGH_TASK ] ) != eBlocked ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	uxReceived[ pqMEDIUM_TASK ] = 0;
+	uxReceived[ pqHIGH_TASK ] = 0;
+
+	/* A single item is taken by the high priority receiver before the send
+	returns. */
+	ulValue = ~ulBase;
+	if( xPriorityQueueSend( xReceiverQueue, &ulValue, 0, pqDONT_BLOCK ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( uxReceived[ pqHIGH_TASK ] != 1 ) || ( uxReceived[ pqMEDIUM_TASK ] != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else if( ( ulReceivedValues[ pqHIGH_TASK ][ 0 ] != ulValue ) || ( uxReceivedPriorities[ pqHIGH_TASK ][ 0 ] != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The items posted with the scheduler suspended wake both receivers, and
+	are all held by the queue when the scheduler is resumed.  The high priority
+	receiver then takes the items of the highest priorities until it suspends
+	itself, the medium priority receiver the others. */
+	vTaskSuspendAll();
+	{
+		for( ux = 0; ux < pqPOSTED_ITEMS; ux++ )
+		{
+			ulValue = ulBase + ( uint32_t ) ux;
+			if( xPriorityQueueSend( xReceiverQueue, &ulValue, uxPostedPriorities[ ux ], pqDONT_BLOCK ) != pdPASS )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+
+		if( ( uxReceived[ pqHIGH_TASK ] != 1 ) || ( uxReceived[ pqMEDIUM_TASK ] != 0 ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+	xTaskResumeAll();
+
+	if( ( uxReceived[ pqHIGH_TASK ] != pqRECEIVE_BATCH ) || ( uxReceived[ pqMEDIUM_TASK ] != ( pqPOSTED_ITEMS - ( pqRECEIVE_BATCH - 1 ) ) ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		for( ux = 0; ux < ( pqRECEIVE_BATCH - 1 ); ux++ )
+		{
+			if( ( ulReceivedValues[ pqHIGH_TASK ][ ux + 1 ] != ( ulBase + ( uint32_t ) uxHighReceiveOrder[ ux ] ) ) ||
+				( uxReceivedPriorities[ pqHIGH_TASK ][ ux + 1 ] != uxPostedPriorities[ uxHighReceiveOrder[ ux ] ] ) )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+
+		for( ux = 0; ux < ( pqPOSTED_ITEMS - ( pqRECEIVE_BATCH - 1 ) ); ux++ )
+		{
+			if( ( ulReceivedValues[ pqMEDIUM_TASK ][ ux ] != ( ulBase + ( uint32_t ) uxMediumReceiveOrder[ ux ] ) ) ||
+				( uxReceivedPriorities[ pqMEDIUM_TASK ][ ux ] != uxPostedPriorities[ uxMediumReceiveOrder[ ux ] ] ) )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+	}
+
+	if( uxPriorityQueueMessagesWaiting( xReceiverQueue ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( eTaskGetState( xReceiverTasks[ pqHIGH_TASK ] ) != eSuspended ) || ( eTaskGetState( xReceiverTasks[ pqMEDIUM_TASK ] ) != eBlocked ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Back to blocking on the empty queue. */
+	vTaskResume( xReceiverTasks[ pqHIGH_TASK ] );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockedSenderTests( void )
+{
+const uint32_t ulBase = ulControllerCycles * pqQUEUE_LENGTH;
+uint32_t ulValue;
+UBaseType_t ux;
+
+	for( ux = 0; ux < pqQUEUE_LENGTH; ux++ )
+	{
+		ulValue = ulBase + ( uint32_t ) ux;
+		if( xPriorityQueueSend( xSenderQueue, &ulValue, 2, pqDONT_BLOCK ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	/* The medium priority sender posts an item of a higher priority than
+	those held, the high priority sender one of a lower priority. */
+	ulSenderValues[ pqMEDIUM_TASK ] = ~ulBase;
+	uxSenderPriorities[ pqMEDIUM_TASK ] = 3;
+	ulSenderValues[ pqHIGH_TASK ] = ~( ulBase + 1UL );
+	uxSenderPriorities[ pqHIGH_TASK ] = 1;
+	uxSent[ pqMEDIUM_TASK ] = 0;
+	uxSent[ pqHIGH_TASK ] = 0;
+
+	/* The senders run as soon as they are resumed and block on the full
+	queue, the high priority sender last. */
+	vTaskResume( xSenderTasks[ pqMEDIUM_TASK ] );
+	vTaskResume( xSenderTasks[ pqHIGH_TASK ] );
+
+	if( ( eTaskGetState( xSenderTasks[ pqMEDIUM_TASK ] ) != eBlocked ) || ( eTaskGetState( xSenderTasks[ pqHIGH_TASK ] ) != eBlocked ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Each receive makes space for one sender, the high priority one first. */
+	prvReceiveFromSenderQueue( ulBase, 2 );
+
+	if( ( uxSent[ pqHIGH_TASK ] != 1 ) || ( uxSent[ pqMEDIUM_TASK ] != 0 ) || ( eTaskGetState( xSenderTasks[ pqMEDIUM_TASK ] ) != eBlocked ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	prvReceiveFromSenderQueue( ulBase + 1UL, 2 );
+
+	if( uxSent[ pqMEDIUM_TASK ] != 1 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( eTaskGetState( xSenderTasks[ pqMEDIUM_TASK ] ) != eSuspended ) || ( eTaskGetState( xSenderTasks[ pqHIGH_TASK ] ) != eSuspended ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The item posted last is received first, the item posted first last. */
+	prvReceiveFromSenderQueue( ~ulBase, 3 );
+	prvReceiveFromSenderQueue( ulBase + 2UL, 2 );
+	prvReceiveFromSenderQueue( ulBase + 3UL, 2 );
+	prvReceiveFromSenderQueue( ~( ulBase + 1UL ), 1 );
+
+	if( uxPriorityQueueMessagesWaiting( xSenderQueue ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiveFromSenderQueue( uint32_t ulExpectedValue, UBaseType_t uxExpectedPriority )
+{
+uint32_t ulValue;
+UBaseType_t uxPriority;
+
+	if( xPriorityQueueReceive( xSenderQueue, &ulValue, &uxPriority, pqDONT_BLOCK ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else if( ( ulValue != ulExpectedValue ) || ( uxPriority != uxExpectedPriority ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockedReceiverTask( void *pvParameters )
+{
+const UBaseType_t uxTask = ( UBaseType_t ) ( ( size_t ) pvParameters );
+uint32_t ulValue;
+UBaseType_t ux, uxPriority;
+
+	for( ;; )
+	{
+		if( xPriorityQueueReceive( xReceiverQueue, &ulValue, &uxPriority, portMAX_DELAY ) != pdPASS )
+		{
+			/* The block time is unlimited. */
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			/* The receivers do not preempt each other once woken, the
+			controller being below both. */
+			ux = uxReceived[ uxTask ];
+			if( ux < pqRECEIVE_BATCH )
+			{
+				ulReceivedValues[ uxTask ][ ux ] = ulValue;
+				uxReceivedPriorities[ uxTask ][ ux ] = uxPriority;
+			}
+			else
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			uxReceived[ uxTask ] = ux + 1;
+
+			/* The receiver leaves the rest to the other once it has a full
+			batch, until the controller resumes it. */
+			if( ( ux + 1 ) == pqRECEIVE_BATCH )
+			{
+				vTaskSuspend( NULL );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockedSenderTask( void *pvParameters )
+{
+const UBaseType_t uxTask = ( UBaseType_t ) ( ( size_t ) pvParameters );
+uint32_t ulValue;
+
+	for( ;; )
+	{
+		/* Resumed by the controller. */
+		vTaskSuspend( NULL );
+
+		ulValue = ulSenderValues[ uxTask ];
+		if( xPriorityQueueSend( xSenderQueue, &ulValue, uxSenderPriorities[ uxTask ], portMAX_DELAY ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		uxSent[ uxTask ]++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamSenderTask( void *pvParameters )
+{
+uint32_t ulValue, ulNext[ pqITEM_PRIORITIES ] = { 0UL }, ulSeed = 0x1234UL;
+UBaseType_t uxPriority;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		uxPriority = ( UBaseType_t ) ( prvRand( &ulSeed ) % pqITEM_PRIORITIES );
+		ulValue = ( ( uint32_t ) uxPriority << pqPRIORITY_SHIFT ) | ( ulNext[ uxPriority ] & pqSEQUENCE_MASK );
+		ulNext[ uxPriority ]++;
+
+		if( xPriorityQueueSend( xStreamQueue, &ulValue, uxPriority, portMAX_DELAY ) != pdPASS )
+		{
+			/* The block time is unlimited. */
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamReceiverTask( void *pvParameters )
+{
+uint32_t ulValue, ulExpected[ pqITEM_PRIORITIES ] = { 0UL };
+UBaseType_t uxPriority;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		if( xPriorityQueueReceive( xStreamQueue, &ulValue, &uxPriority, portMAX_DELAY ) != pdPASS )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else if( ( uxPriority >= pqITEM_PRIORITIES ) || ( ( ulValue >> pqPRIORITY_SHIFT ) != ( uint32_t ) uxPriority ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			/* The items of one priority arrive in the order posted. */
+			if( ( ulValue & pqSEQUENCE_MASK ) != ( ulExpected[ uxPriority ] & pqSEQUENCE_MASK ) )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			ulExpected[ uxPriority ]++;
+		}
+
+		ulStreamReceiveCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xArePriorityQueueTasksStillRunning( void )
+{
+static uint32_t ulLastControllerCycles = 0UL, ulLastStreamReceiveCycles = 0UL;
+
+	if( ulLastControllerCycles == ulControllerCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastControllerCycles = ulControllerCycles;
+	}
+
+	if( ulLastStreamReceiveCycles == ulStreamReceiveCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastStreamReceiveCycles = ulStreamReceiveCycles;
+	}
+
+	return xErrorStatus;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRand( uint32_t *pulSeed )
+{
+const uint32_t ulMultiplier = 0x015a4e35UL, ulIncrement = 1UL;
+
+	/* Utility function to generate a pseudo random number. */
+	*pulSeed = ( ulMultiplier * *pulSeed ) + ulIncrement;
+	return ( *pulSeed >> 16UL ) & 0x7fffUL;
+}
+/*-----------------------------------------------------------*/
+
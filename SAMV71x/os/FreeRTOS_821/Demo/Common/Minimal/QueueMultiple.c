@@ -0,0 +1,647 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests xQueueSendMultiple() and xQueueReceiveMultiple().
+ *
+ * The controller task first runs tests that need no other task: batches of
+ * every size are sent and received back in order while the start of the data
+ * moves around the storage area of the queue, a batch longer than the space
+ * left is cut to it, and a block time expires when no space or item arrives.
+ *
+ * It then sends one batch to two higher priority receiver tasks blocked
+ * receiving batches.  The higher priority receiver must take the first items,
+ * up to the size of its batch, and the other receiver the rest, both before
+ * the send returns.
+ *
+ * Last it fills a queue that two higher priority sender tasks then block
+ * sending batches to, and receives from it in batches.  Each receive must let
+ * the higher priority sender post its batch first, even though it blocked
+ * last, and the other sender as much of its batch as there is space left for,
+ * that sender posting the rest once the next receive makes room.
+ *
+ * Two pairs of tasks stream a sequence of values through queues with an
+ * unlimited block time, in batches of random sizes that do not divide the
+ * length of the queue, so the batches keep wrapping around its end.  In the
+ * first pair the sender has the higher priority, so it keeps blocking on a
+ * full queue until the receiver wakes it.  In the second the receiver has the
+ * higher priority, so it keeps blocking on an empty queue.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Demo program include files. */
+#include "QueueMultiple.h"
+
+/* The priorities of the tasks, as described at the top of this file. */
+#define qmLOWER_PRIORITY			( tskIDLE_PRIORITY )
+#define qmHIGHER_PRIORITY			( tskIDLE_PRIORITY + 1 )
+#define qmCONTROLLER_PRIORITY		( tskIDLE_PRIORITY + 1 )
+#define qmMEDIUM_PRIORITY			( tskIDLE_PRIORITY + 2 )
+#define qmHIGH_PRIORITY				( tskIDLE_PRIORITY + 3 )
+
+#define qmDONT_BLOCK				( ( TickType_t ) 0 )
+#define qmSHORT_DELAY				pdMS_TO_TICKS( 20 )
+
+/* The length of the queues of the controller task, and the size of the
+batches the blocked receivers receive and the blocked senders send. */
+#define qmQUEUE_LENGTH				( ( UBaseType_t ) 8 )
+#define qmRECEIVE_BATCH				( ( UBaseType_t ) 4 )
+#define qmSEND_BATCH				( ( UBaseType_t ) 6 )
+
+/* The length of the queues of the streaming tasks, and the largest batch they
+send or receive. */
+#define qmSTREAM_QUEUE_LENGTH		( ( UBaseType_t ) 7 )
+#define qmMAX_STREAM_BATCH			( ( UBaseType_t ) 10 )
+
+/* The blocked senders tag their values with their number in the top byte. */
+#define qmSENDER_SHIFT				( 24 )
+#define qmSEQUENCE_MASK				( 0x00ffffffUL )
+
+/* Indexes of the blocked receivers and senders. */
+#define qmMEDIUM_TASK				( 0 )
+#define qmHIGH_TASK					( 1 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The two sides of a stream, see the comments at the top of this file.
+ */
+typedef struct STREAM_QUEUE
+{
+	QueueHandle_t xQueue;
+	volatile uint32_t ulReceiveCycles;
+} StreamQueue_t;
+
+/*
+ * The tasks as described at the top of this file.
+ */
+static void prvControllerTask( void *pvParameters );
+static void prvBlockedReceiverTask( void *pvParameters );
+static void prvBlockedSenderTask( void *pvParameters );
+static void prvStreamSenderTask( void *pvParameters );
+static void prvStreamReceiverTask( void *pvParameters );
+
+/*
+ * The tests of the controller task.
+ */
+static void prvSingleTaskTests( void );
+static void prvBlockedReceiverTests( void );
+static void prvBlockedSenderTests( void );
+
+/*
+ * Receive uxExpected values from xSenderQueue in one call, checking the first
+ * uxFromHigh come from the high priority sender and the others from the
+ * medium priority sender, each continuing its sequence.
+ */
+static void prvReceiveFromSenders( UBaseType_t uxExpected, UBaseType_t uxFromHigh );
+
+/*
+ * Utility function to create pseudo random numbers.
+ */
+static uint32_t prvRand( uint32_t *pulSeed );
+
+/*-----------------------------------------------------------*/
+
+/* Used to latch errors during the test's execution. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* Incremented by the controller task to show it is still running. */
+static volatile uint32_t ulControllerCycles = 0UL;
+
+/* The queues of the controller task tests. */
+static QueueHandle_t xTestQueue = NULL, xReceiverQueue = NULL, xSenderQueue = NULL;
+
+/* The blocked receivers and senders, the number of values each received, and
+the next value of the sequence sent to the receivers and of each sender. */
+static TaskHandle_t xReceiverTasks[ 2 ] = { NULL, NULL }, xSenderTasks[ 2 ] = { NULL, NULL };
+static volatile UBaseType_t uxReceived[ 2 ] = { 0, 0 };
+static volatile uint32_t ulNextToReceivers = 0UL, ulNextReceived = 0UL;
+static uint32_t ulNextFromSender[ 2 ] = { 0UL, 0UL };
+
+/* The two pairs of streaming tasks. */
+static StreamQueue_t xStreamQueues[ 2 ];
+
+/*-----------------------------------------------------------*/
+
+void vStartQueueMultipleTasks( void )
+{
+BaseType_t x;
+
+	xTestQueue = xQueueCreate( qmQUEUE_LENGTH, sizeof( uint32_t ) );
+	xReceiverQueue = xQueueCreate( qmQUEUE_LENGTH, sizeof( uint32_t ) );
+	xSenderQueue = xQueueCreate( qmQUEUE_LENGTH, sizeof( uint32_t ) );
+	configASSERT( xTestQueue );
+	configASSERT( xReceiverQueue );
+	configASSERT( xSenderQueue );
+
+	for( x = 0; x < 2; x++ )
+	{
+		xStreamQueues[ x ].xQueue = xQueueCreate( qmSTREAM_QUEUE_LENGTH, sizeof( uint32_t ) );
+		configASSERT( xStreamQueues[ x ].xQueue );
+	}
+
+	xTaskCreate( prvControllerTask, "QMCtrl", configMINIMAL_STACK_SIZE, NULL, qmCONTROLLER_PRIORITY, NULL );
+	xTaskCreate( prvBlockedReceiverTask, "QMRx1", configMINIMAL_STACK_SIZE, ( void * ) qmMEDIUM_TASK, qmMEDIUM_PRIORITY, &( xReceiverTasks[ qmMEDIUM_TASK ] ) );
+	xTaskCreate( prvBlockedReceiverTask, "QMRx2", configMINIMAL_STACK_SIZE, ( void * ) qmHIGH_TASK, qmHIGH_PRIORITY, &( xReceiverTasks[ qmHIGH_TASK ] ) );
+	xTaskCreate( prvBlockedSenderTask, "QMTx1", configMINIMAL_STACK_SIZE, ( void * ) qmMEDIUM_TASK, qmMEDIUM_PRIORITY, &( xSenderTasks[ qmMEDIUM_TASK ] ) );
+	xTaskCreate( prvBlockedSenderTask, "QMTx2", configMINIMAL_STACK_SIZE, ( void * ) qmHIGH_TASK, qmHIGH_PRIORITY, &( xSenderTasks[ qmHIGH_TASK ] ) );
+
+	xTaskCreate( prvStreamSenderTask, "QMStTx1", configMINIMAL_STACK_SIZE, &( xStreamQueues[ 0 ] ), qmHIGHER_PRIORITY, NULL );
+	xTaskCreate( prvStreamReceiverTask, "QMStRx1", configMINIMAL_STACK_SIZE, &( xStreamQueues[ 0 ] ), qmLOWER_PRIORITY, NULL );
+	xTaskCreate( prvStreamSenderTask, "QMStTx2", configMINIMAL_STACK_SIZE, &( xStreamQueues[ 1 ] ), qmLOWER_PRIORITY, NULL );
+	xTaskCreate( prvStreamReceiverTask, "QMStRx2", configMINIMAL_STACK_SIZE, &( xStreamQueues[ 1 ] ), qmHIGHER_PRIORITY, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControllerTask( void *pvParameters )
+{
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		prvSingleTaskTests();
+		prvBlockedReceiverTests();
+		prvBlockedSenderTests();
+
+		/* Incremented to show the task is still running. */
+		ulControllerCycles++;
+
+		/* Leave the streaming tasks of the lower priority a chance to run. */
+		vTaskDelay( qmSHORT_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSingleTaskTests( void )
+{
+uint32_t ulTx[ qmQUEUE_LENGTH + 3 ], ulRx[ qmQUEUE_LENGTH + 3 ], ulValue;
+UBaseType_t ux, uxCount, uxReturned;
+TickType_t xTimeBefore;
+
+	for( ux = 0; ux < ( UBaseType_t ) ( sizeof( ulTx ) / sizeof( ulTx[ 0 ] ) ); ux++ )
+	{
+		ulTx[ ux ] = ( uint32_t ) ux + ulControllerCycles;
+	}
+
+	/* Nothing to receive, the block time expires and nothing is returned. */
+	xTimeBefore = xTaskGetTickCount();
+	if( xQueueReceiveMultiple( xTestQueue, ulRx, qmQUEUE_LENGTH, qmSHORT_DELAY ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeBefore ) < qmSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Send and receive back batches of every size, moving the start of the
+	data along the storage area so batches wrap around its end. */
+	for( uxCount = 1; uxCount <= qmQUEUE_LENGTH; uxCount++ )
+	{
+		if( xQueueSendMultiple( xTestQueue, ulTx, uxCount, qmDONT_BLOCK ) != uxCount )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		if( ( uxQueueMessagesWaiting( xTestQueue ) != uxCount ) || ( uxQueueSpacesAvailable( xTestQueue ) != ( qmQUEUE_LENGTH - uxCount ) ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		/* Receive in two parts, the first shorter than the batch. */
+		uxReturned = xQueueReceiveMultiple( xTestQueue, ulRx, uxCount / 2, qmDONT_BLOCK );
+		uxReturned += xQueueReceiveMultiple( xTestQueue, &( ulRx[ uxReturned ] ), qmQUEUE_LENGTH, qmDONT_BLOCK );
+
+		if( uxReturned != uxCount )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		for( ux = 0; ux < uxCount; ux++ )
+		{
+			if( ulRx[ ux ] != ulTx[ ux ] )
+			{
+				xErrorStatus = pdFAIL;
+			}
+		}
+	}
+
+	/* A batch longer than the queue is cut to the space available, without
+	blocking as there is space. */
+	xTimeBefore = xTaskGetTickCount();
+	if( xQueueSendMultiple( xTestQueue, ulTx, qmQUEUE_LENGTH + 3, qmSHORT_DELAY ) != qmQUEUE_LENGTH )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeBefore ) >= qmSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* No space, the block time expires and nothing is sent. */
+	xTimeBefore = xTaskGetTickCount();
+	if( xQueueSendMultiple( xTestQueue, ulTx, 1, qmSHORT_DELAY ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeBefore ) < qmSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Single item calls and batches see the same order. */
+	if( ( xQueueReceiveMultiple( xTestQueue, ulRx, 3, qmDONT_BLOCK ) != 3 ) || ( ulRx[ 0 ] != ulTx[ 0 ] ) || ( ulRx[ 2 ] != ulTx[ 2 ] ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	ulValue = ~ulControllerCycles;
+	if( xQueueSend( xTestQueue, &ulValue, qmDONT_BLOCK ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( xQueueReceiveMultiple( xTestQueue, ulRx, qmQUEUE_LENGTH + 3, qmDONT_BLOCK ) != ( qmQUEUE_LENGTH - 2 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	for( ux = 0; ux < ( qmQUEUE_LENGTH - 3 ); ux++ )
+	{
+		if( ulRx[ ux ] != ulTx[ ux + 3 ] )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	if( ( ulRx[ qmQUEUE_LENGTH - 3 ] != ulValue ) || ( uxQueueMessagesWaiting( xTestQueue ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockedReceiverTests( void )
+{
+uint32_t ulTx[ qmRECEIVE_BATCH + 2 ];
+UBaseType_t ux, uxMediumBefore, uxHighBefore;
+
+	for( ux = 0; ux < ( qmRECEIVE_BATCH + 2 ); ux++ )
+	{
+		ulTx[ ux ] = ulNextToReceivers;
+		ulNextToReceivers++;
+	}
+
+	uxMediumBefore = uxReceived[ qmMEDIUM_TASK ];
+	uxHighBefore = uxReceived[ qmHIGH_TASK ];
+
+	/* Both receivers are blocked, as they run above this task.  Each is woken
+	by the batch, the high priority receiver taking a full batch and
+	suspending itself, the medium priority receiver the rest. */
+	if( xQueueSendMultiple( xReceiverQueue, ulTx, qmRECEIVE_BATCH + 2, qmDONT_BLOCK ) != ( qmRECEIVE_BATCH + 2 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( uxReceived[ qmHIGH_TASK ] != ( uxHighBefore + qmRECEIVE_BATCH ) ) || ( uxReceived[ qmMEDIUM_TASK ] != ( uxMediumBefore + 2 ) ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( ulNextReceived != ulNextToReceivers ) || ( uxQueueMessagesWaiting( xReceiverQueue ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( eTaskGetState( xReceiverTasks[ qmHIGH_TASK ] ) != eSuspended )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Back to blocking on the empty queue. */
+	vTaskResume( xReceiverTasks[ qmHIGH_TASK ] );
+
+	if( eTaskGetState( xReceiverTasks[ qmHIGH_TASK ] ) != eBlocked )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockedSenderTests( void )
+{
+uint32_t ulFill[ qmQUEUE_LENGTH ];
+UBaseType_t ux;
+
+	for( ux = 0; ux < qmQUEUE_LENGTH; ux++ )
+	{
+		ulFill[ ux ] = ( uint32_t ) ux;
+	}
+
+	if( xQueueSendMultiple( xSenderQueue, ulFill, qmQUEUE_LENGTH, qmDONT_BLOCK ) != qmQUEUE_LENGTH )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The senders run as soon as they are resumed and block on the full
+	queue, the high priority sender last. */
+	vTaskResume( xSenderTasks[ qmMEDIUM_TASK ] );
+	vTaskResume( xSenderTasks[ qmHIGH_TASK ] );
+
+	if( ( eTaskGetState( xSenderTasks[ qmMEDIUM_TASK ] ) != eBlocked ) || ( eTaskGetState( xSenderTasks[ qmHIGH_TASK ] ) != eBlocked ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Emptying the queue wakes both senders.  The high priority sender posts
+	its whole batch and suspends itself, the medium priority sender fills the
+	space left and blocks again. */
+	if( xQueueReceiveMultiple( xSenderQueue, ulFill, qmQUEUE_LENGTH, qmDONT_BLOCK ) != qmQUEUE_LENGTH )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	for( ux = 0; ux < qmQUEUE_LENGTH; ux++ )
+	{
+		if( ulFill[ ux ] != ( uint32_t ) ux )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	if( eTaskGetState( xSenderTasks[ qmHIGH_TASK ] ) != eSuspended )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	prvReceiveFromSenders( qmQUEUE_LENGTH, qmSEND_BATCH );
+
+	/* The medium priority sender posted the rest of its batch. */
+	if( eTaskGetState( xSenderTasks[ qmMEDIUM_TASK ] ) != eSuspended )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	prvReceiveFromSenders( qmSEND_BATCH - ( qmQUEUE_LENGTH - qmSEND_BATCH ), 0 );
+
+	if( uxQueueMessagesWaiting( xSenderQueue ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiveFromSenders( UBaseType_t uxExpected, UBaseType_t uxFromHigh )
+{
+uint32_t ulRx[ qmQUEUE_LENGTH ];
+UBaseType_t ux, uxSender;
+
+	if( xQueueReceiveMultiple( xSenderQueue, ulRx, qmQUEUE_LENGTH, qmDONT_BLOCK ) != uxExpected )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		for( ux = 0; ux < uxExpected; ux++ )
+		{
+			uxSender = ( ux < uxFromHigh ) ? qmHIGH_TASK : qmMEDIUM_TASK;
+
+			if( ulRx[ ux ] != ( ( ( uint32_t ) ( uxSender + 1 ) << qmSENDER_SHIFT ) | ( ulNextFromSender[ uxSender ] & qmSEQUENCE_MASK ) ) )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			ulNextFromSender[ uxSender ]++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockedReceiverTask( void *pvParameters )
+{
+const UBaseType_t uxTask = ( UBaseType_t ) ( ( size_t ) pvParameters );
+uint32_t ulRx[ qmRECEIVE_BATCH ];
+UBaseType_t ux, uxCount;
+
+	for( ;; )
+	{
+		uxCount = xQueueReceiveMultiple( xReceiverQueue, ulRx, qmRECEIVE_BATCH, portMAX_DELAY );
+
+		/* The receivers do not preempt each other once woken, the controller
+		being below both. */
+		for( ux = 0; ux < uxCount; ux++ )
+		{
+			if( ulRx[ ux ] != ulNextReceived )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			ulNextReceived++;
+		}
+
+		uxReceived[ uxTask ] += uxCount;
+
+		/* The high priority receiver leaves the rest to the other. */
+		if( uxTask == qmHIGH_TASK )
+		{
+			vTaskSuspend( NULL );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBlockedSenderTask( void *pvParameters )
+{
+const UBaseType_t uxTask = ( UBaseType_t ) ( ( size_t ) pvParameters );
+uint32_t ulTx[ qmSEND_BATCH ], ulNext = 0UL;
+UBaseType_t ux;
+
+	for( ;; )
+	{
+		/* Resumed by the controller. */
+		vTaskSuspend( NULL );
+
+		for( ux = 0; ux < qmSEND_BATCH; ux++ )
+		{
+			ulTx[ ux ] = ( ( uint32_t ) ( uxTask + 1 ) << qmSENDER_SHIFT ) | ( ulNext & qmSEQUENCE_MASK );
+			ulNext++;
+		}
+
+		for( ux = 0; ux < qmSEND_BATCH; )
+		{
+			ux += xQueueSendMultiple( xSenderQueue, &( ulTx[ ux ] ), qmSEND_BATCH - ux, portMAX_DELAY );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamSenderTask( void *pvParameters )
+{
+StreamQueue_t * const pxStream = ( StreamQueue_t * ) pvParameters;
+uint32_t ulTx[ qmMAX_STREAM_BATCH ], ulNext = 0UL, ulSeed = ( uint32_t ) ( size_t ) pvParameters;
+UBaseType_t ux, uxCount, uxSent;
+
+	for( ;; )
+	{
+		uxCount = ( UBaseType_t ) ( prvRand( &ulSeed ) % qmMAX_STREAM_BATCH ) + 1;
+
+		for( ux = 0; ux < uxCount; ux++ )
+		{
+			ulTx[ ux ] = ulNext;
+			ulNext++;
+		}
+
+		for( uxSent = 0; uxSent < uxCount; )
+		{
+			uxSent += xQueueSendMultiple( pxStream->xQueue, &( ulTx[ uxSent ] ), uxCount - uxSent, portMAX_DELAY );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamReceiverTask( void *pvParameters )
+{
+StreamQueue_t * const pxStream = ( StreamQueue_t * ) pvParameters;
+uint32_t ulRx[ qmMAX_STREAM_BATCH ], ulExpected = 0UL, ulSeed = ~( uint32_t ) ( size_t ) pvParameters;
+UBaseType_t ux, uxCount;
+
+	for( ;; )
+	{
+		uxCount = xQueueReceiveMultiple( pxStream->xQueue, ulRx, ( UBaseType_t ) ( prvRand( &ulSeed ) % qmMAX_STREAM_BATCH ) + 1, portMAX_DELAY );
+
+		if( uxCount == 0 )
+		{
+			/* The block time is unlimited. */
+			xErrorStatus = pdFAIL;
+		}
+
+		for( ux = 0; ux < uxCount; ux++ )
+		{
+			if( ulRx[ ux ] != ulExpected )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			ulExpected++;
+		}
+
+		pxStream->ulReceiveCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreQueueMultipleTasksStillRunning( void )
+{
+static uint32_t ulLastControllerCycles = 0UL;
+static uint32_t ulLastReceiveCycles[ 2 ] = { 0UL, 0UL };
+BaseType_t x;
+
+	if( ulLastControllerCycles == ulControllerCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastControllerCycles = ulControllerCycles;
+	}
+
+	for( x = 0; x < 2; x++ )
+	{
+		if( ulLastReceiveCycles[ x ] == xStreamQueues[ x ].ulReceiveCycles )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			ulLastReceiveCycles[ x ] = xStreamQueues[ x ].ulReceiveCycles;
+		}
+	}
+
+	return xErrorStatus;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRand( uint32_t *pulSeed )
+{
+const uint32_t ulMultiplier = 0x015a4e35UL, ulIncrement = 1UL;
+
+	/* Utility function to generate a pseudo random number. */
+	*pulSeed = ( ulMultiplier * *pulSeed ) + ulIncrement;
+	return ( *pulSeed >> 16UL ) & 0x7fffUL;
+}
+/*-----------------------------------------------------------*/
+
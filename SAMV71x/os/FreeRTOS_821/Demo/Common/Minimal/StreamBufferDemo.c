@@ -0,0 +1,735 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the stream and message buffers of Source/stream_buffer.c.
+ *
+ * The controller task first runs tests that need no other task: the bytes
+ * written are read back in order, across the end of the storage area, writes
+ * are cut to the space available, a message buffer only takes whole messages
+ * and a block time expires when no room or data arrives.  It then checks the
+ * trigger level against a higher priority task blocked reading: the reader
+ * must not run before the trigger level is reached and must run as soon as it
+ * is, whatever the trigger level when the writer blocks for room.
+ *
+ * Two pairs of tasks stream a sequence of bytes through a small buffer with an
+ * unlimited block time, in random sized writes and reads.  In the first pair
+ * the writer has the higher priority, so it keeps blocking for room until the
+ * reader wakes it.  In the second the reader has the higher priority, so it
+ * keeps blocking for data until the writer reaches the trigger level.
+ *
+ * vPeriodicStreamBufferProcessing(), called from the tick hook, streams a
+ * sequence to a task with xStreamBufferSendFromISR() and reads the sequence
+ * another task writes with xStreamBufferReceiveFromISR(), waking that task
+ * when it blocked for room.
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+
+/* Demo program include files. */
+#include "StreamBufferDemo.h"
+
+#define sbLOWER_PRIORITY		( tskIDLE_PRIORITY )
+#define sbHIGHER_PRIORITY		( tskIDLE_PRIORITY + 1 )
+
+#define sbDONT_BLOCK			( ( TickType_t ) 0 )
+#define sbSHORT_DELAY			pdMS_TO_TICKS( 20 )
+
+/* The block time of the task receiving from the tick hook, which writes on
+every tick, so data must arrive well before it expires. */
+#define sbISR_RECEIVE_BLOCK		pdMS_TO_TICKS( 200 )
+
+/* Size of the buffers, and the number of bytes the trigger level tests wake
+the reader at. */
+#define sbBUFFER_LENGTH			( ( size_t ) 32 )
+#define sbTRIGGER_LEVEL			( ( size_t ) 10 )
+
+/* Number of bytes written to and read from the buffers by the tick hook on
+each call, and the trigger level of the buffer it writes to. */
+#define sbISR_BYTES				( ( size_t ) 3 )
+#define sbISR_TRIGGER_LEVEL		( ( size_t ) 8 )
+
+/* The length of the messages written to the message buffer, each message
+taking as many bytes again as a size_t holds its length. */
+#define sbMESSAGE_LENGTH		( ( size_t ) 10 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The two sides of a stream, see the comments at the top of this file.
+ */
+typedef struct STREAM_PAIR
+{
+	StreamBufferHandle_t xBuffer;
+	volatile uint32_t ulReceiveCycles;
+} StreamPair_t;
+
+/*
+ * The controller task, and the task it checks the trigger level against.
+ */
+static void prvControllerTask( void *pvParameters );
+static void prvTriggerReaderTask( void *pvParameters );
+
+/*
+ * The tests of the controller task that need no other task.
+ */
+static void prvSingleTaskTests( void );
+static void prvMessageBufferTests( void );
+
+/*
+ * The trigger level tests of the controller task.
+ */
+static void prvTriggerLevelTests( void );
+
+/*
+ * Write xCount bytes of the sequence that continues at *pucNext to the trigger
+ * reader, which must then have read xExpectedRead bytes in one read, or not
+ * have run if xExpectedRead is 0.
+ */
+static void prvWriteSequence( uint8_t *pucNext, size_t xCount, size_t xExpectedRead );
+
+/*
+ * The writing and reading sides of a pair of tasks streaming through a
+ * StreamPair_t.
+ */
+static void prvStreamSenderTask( void *pvParameters );
+static void prvStreamReceiverTask( void *pvParameters );
+
+/*
+ * The tasks reading the sequence written by the tick hook and writing the
+ * sequence the tick hook reads.
+ */
+static void prvISRReceiverTask( void *pvParameters );
+static void prvISRSenderTask( void *pvParameters );
+
+/*
+ * Utility function to create pseudo random numbers.
+ */
+static uint32_t prvRand( uint32_t *pulSeed );
+
+/*-----------------------------------------------------------*/
+
+/* Used to latch errors during the test's execution. */
+static volatile BaseType_t xErrorStatus = pdPASS;
+
+/* Incremented by the tasks, and by the tick hook for the bytes it reads, to
+show they are still running. */
+static volatile uint32_t ulControllerCycles = 0UL, ulISRReceiveCycles = 0UL, ulISRBytesReceived = 0UL;
+
+/* The two pairs of streaming tasks. */
+static StreamPair_t xStreamPairs[ 2 ];
+
+/* The buffer the controller task writes to the trigger reader through, the
+number of reads the trigger reader made and the length of the last one. */
+static StreamBufferHandle_t xTriggerBuffer = NULL;
+static volatile uint32_t ulTriggerReads = 0UL;
+static volatile size_t xTriggerReadLength = 0;
+
+/* The buffers written by the tick hook and read by the tick hook. */
+static StreamBufferHandle_t xISRToTaskBuffer = NULL, xTaskToISRBuffer = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vStartStreamBufferTasks( void )
+{
+BaseType_t x;
+
+	xTriggerBuffer = xStreamBufferCreate( sbBUFFER_LENGTH, sbTRIGGER_LEVEL );
+	xISRToTaskBuffer = xStreamBufferCreate( sbBUFFER_LENGTH, sbISR_TRIGGER_LEVEL );
+	xTaskToISRBuffer = xStreamBufferCreate( sbBUFFER_LENGTH, 1 );
+	configASSERT( xTriggerBuffer );
+	configASSERT( xISRToTaskBuffer );
+	configASSERT( xTaskToISRBuffer );
+
+	/* The small trigger level of the first pair wakes its reader on each
+	write, the second pair wakes its reader once enough bytes arrived. */
+	for( x = 0; x < 2; x++ )
+	{
+		xStreamPairs[ x ].xBuffer = xStreamBufferCreate( sbBUFFER_LENGTH / 2, ( x == 0 ) ? 1 : sbTRIGGER_LEVEL );
+		configASSERT( xStreamPairs[ x ].xBuffer );
+	}
+
+	xTaskCreate( prvControllerTask, "SBCtrl", configMINIMAL_STACK_SIZE, NULL, sbLOWER_PRIORITY, NULL );
+	xTaskCreate( prvTriggerReaderTask, "SBTrig", configMINIMAL_STACK_SIZE, NULL, sbHIGHER_PRIORITY, NULL );
+
+	xTaskCreate( prvStreamSenderTask, "SBTx1", configMINIMAL_STACK_SIZE, &( xStreamPairs[ 0 ] ), sbHIGHER_PRIORITY, NULL );
+	xTaskCreate( prvStreamReceiverTask, "SBRx1", configMINIMAL_STACK_SIZE, &( xStreamPairs[ 0 ] ), sbLOWER_PRIORITY, NULL );
+	xTaskCreate( prvStreamSenderTask, "SBTx2", configMINIMAL_STACK_SIZE, &( xStreamPairs[ 1 ] ), sbLOWER_PRIORITY, NULL );
+	xTaskCreate( prvStreamReceiverTask, "SBRx2", configMINIMAL_STACK_SIZE, &( xStreamPairs[ 1 ] ), sbHIGHER_PRIORITY, NULL );
+
+	xTaskCreate( prvISRReceiverTask, "SBISRRx", configMINIMAL_STACK_SIZE, NULL, sbHIGHER_PRIORITY, NULL );
+	xTaskCreate( prvISRSenderTask, "SBISRTx", configMINIMAL_STACK_SIZE, NULL, sbLOWER_PRIORITY, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvControllerTask( void *pvParameters )
+{
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		prvSingleTaskTests();
+		prvMessageBufferTests();
+		prvTriggerLevelTests();
+
+		/* Incremented to show the task is still running. */
+		ulControllerCycles++;
+
+		#if( configUSE_PREEMPTION == 0 )
+			taskYIELD();
+		#endif
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSingleTaskTests( void )
+{
+StreamBufferHandle_t xBuffer;
+uint8_t ucTx[ sbBUFFER_LENGTH + 8 ], ucRx[ sbBUFFER_LENGTH + 8 ];
+size_t x, xOffset, xReturned;
+TickType_t xTimeBefore;
+
+	for( x = 0; x < sizeof( ucTx ); x++ )
+	{
+		ucTx[ x ] = ( uint8_t ) ( x + ulControllerCycles );
+	}
+
+	xBuffer = xStreamBufferCreate( sbBUFFER_LENGTH, 1 );
+	configASSERT( xBuffer );
+
+	if( ( xStreamBufferIsEmpty( xBuffer ) != pdTRUE ) || ( xStreamBufferSpacesAvailable( xBuffer ) != sbBUFFER_LENGTH ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Nothing to read, the block time expires and nothing is returned. */
+	xTimeBefore = xTaskGetTickCount();
+	if( xStreamBufferReceive( xBuffer, ucRx, sizeof( ucRx ), sbSHORT_DELAY ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeBefore ) < sbSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Write and read back blocks of every size, moving the start of the data
+	along the storage area so reads and writes wrap around its end. */
+	for( xOffset = 1; xOffset <= sbBUFFER_LENGTH; xOffset++ )
+	{
+		if( xStreamBufferSend( xBuffer, ucTx, xOffset, sbDONT_BLOCK ) != xOffset )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		if( ( xStreamBufferBytesAvailable( xBuffer ) != xOffset ) || ( xStreamBufferSpacesAvailable( xBuffer ) != ( sbBUFFER_LENGTH - xOffset ) ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		/* Read in two parts, the first shorter than the data. */
+		memset( ucRx, 0x00, sizeof( ucRx ) );
+		xReturned = xStreamBufferReceive( xBuffer, ucRx, xOffset / 2, sbDONT_BLOCK );
+		xReturned += xStreamBufferReceive( xBuffer, &( ucRx[ xReturned ] ), sizeof( ucRx ) - xReturned, sbDONT_BLOCK );
+
+		if( ( xReturned != xOffset ) || ( memcmp( ucTx, ucRx, xOffset ) != 0 ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	/* A write longer than the buffer is cut to the space available, without
+	blocking as the buffer cannot take more. */
+	if( xStreamBufferSend( xBuffer, ucTx, sizeof( ucTx ), sbSHORT_DELAY ) != sbBUFFER_LENGTH )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( xStreamBufferIsFull( xBuffer ) != pdTRUE )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* No room, the block time expires and nothing is written. */
+	xTimeBefore = xTaskGetTickCount();
+	if( xStreamBufferSend( xBuffer, ucTx, 1, sbSHORT_DELAY ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeBefore ) < sbSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xStreamBufferReceive( xBuffer, ucRx, sizeof( ucRx ), sbDONT_BLOCK ) != sbBUFFER_LENGTH ) || ( memcmp( ucTx, ucRx, sbBUFFER_LENGTH ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* A trigger level cannot exceed the buffer, and a reset empties it. */
+	if( xStreamBufferSetTriggerLevel( xBuffer, sbBUFFER_LENGTH + 1 ) != pdFAIL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	( void ) xStreamBufferSend( xBuffer, ucTx, sbTRIGGER_LEVEL, sbDONT_BLOCK );
+
+	if( ( xStreamBufferReset( xBuffer ) != pdPASS ) || ( xStreamBufferIsEmpty( xBuffer ) != pdTRUE ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	vStreamBufferDelete( xBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMessageBufferTests( void )
+{
+MessageBufferHandle_t xBuffer;
+uint8_t ucTx[ sbMESSAGE_LENGTH ], ucRx[ sbBUFFER_LENGTH ];
+const size_t xMessageSpace = sbMESSAGE_LENGTH + sizeof( size_t );
+size_t x;
+
+	for( x = 0; x < sizeof( ucTx ); x++ )
+	{
+		ucTx[ x ] = ( uint8_t ) ( x + ulControllerCycles );
+	}
+
+	/* Room for one message and a half. */
+	xBuffer = xMessageBufferCreate( xMessageSpace + ( xMessageSpace / 2 ) );
+	configASSERT( xBuffer );
+
+	if( xMessageBufferSend( xBuffer, ucTx, sbMESSAGE_LENGTH, sbDONT_BLOCK ) != sbMESSAGE_LENGTH )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The second message does not fit whole so is not written at all. */
+	if( xMessageBufferSend( xBuffer, ucTx, sbMESSAGE_LENGTH, sbDONT_BLOCK ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( xMessageBufferNextLengthBytes( xBuffer ) != sbMESSAGE_LENGTH )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* A message longer than the buffer it is read to is left in place. */
+	if( xMessageBufferReceive( xBuffer, ucRx, sbMESSAGE_LENGTH - 1, sbDONT_BLOCK ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	memset( ucRx, 0x00, sizeof( ucRx ) );
+	if( ( xMessageBufferReceive( xBuffer, ucRx, sizeof( ucRx ), sbDONT_BLOCK ) != sbMESSAGE_LENGTH ) || ( memcmp( ucTx, ucRx, sbMESSAGE_LENGTH ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* An empty message is still a message. */
+	if( xMessageBufferSend( xBuffer, ucTx, 0, sbDONT_BLOCK ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xMessageBufferIsEmpty( xBuffer ) != pdFALSE ) || ( xMessageBufferReceive( xBuffer, ucRx, sizeof( ucRx ), sbDONT_BLOCK ) != 0 ) || ( xMessageBufferIsEmpty( xBuffer ) != pdTRUE ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	vMessageBufferDelete( xBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTriggerLevelTests( void )
+{
+static uint8_t ucNext = 0;
+
+	/* The reader only runs once the trigger level is reached. */
+	prvWriteSequence( &ucNext, sbTRIGGER_LEVEL - 1, 0 );
+	prvWriteSequence( &ucNext, 1, sbTRIGGER_LEVEL );
+
+	/* With a trigger level of 1 each byte wakes the reader. */
+	( void ) xStreamBufferSetTriggerLevel( xTriggerBuffer, 1 );
+	prvWriteSequence( &ucNext, 1, 1 );
+	prvWriteSequence( &ucNext, 1, 1 );
+
+	/* With the trigger level at the size of the buffer, a write that blocks
+	for room wakes the reader whatever the number of bytes in the buffer.  The
+	reader then makes room and wakes the writer, whose bytes stay below the
+	trigger level. */
+	( void ) xStreamBufferSetTriggerLevel( xTriggerBuffer, sbBUFFER_LENGTH );
+	prvWriteSequence( &ucNext, sbBUFFER_LENGTH - sbTRIGGER_LEVEL, 0 );
+	prvWriteSequence( &ucNext, sbTRIGGER_LEVEL + 1, sbBUFFER_LENGTH - sbTRIGGER_LEVEL );
+
+	/* Lowering the trigger level below the bytes in the buffer does not wake
+	the reader, the next write does. */
+	( void ) xStreamBufferSetTriggerLevel( xTriggerBuffer, sbTRIGGER_LEVEL );
+	prvWriteSequence( &ucNext, 1, sbTRIGGER_LEVEL + 2 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteSequence( uint8_t *pucNext, size_t xCount, size_t xExpectedRead )
+{
+uint8_t ucTx[ sbBUFFER_LENGTH ];
+uint32_t ulReads = ulTriggerReads;
+size_t x;
+
+	configASSERT( xCount <= sizeof( ucTx ) );
+
+	for( x = 0; x < xCount; x++ )
+	{
+		ucTx[ x ] = *pucNext;
+		( *pucNext )++;
+	}
+
+	/* The reader has the higher priority, so has run by the time the write
+	returns if it was woken. */
+	if( xStreamBufferSend( xTriggerBuffer, ucTx, xCount, sbSHORT_DELAY ) != xCount )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( xExpectedRead == 0 )
+	{
+		if( ulTriggerReads != ulReads )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+	else if( ( ulTriggerReads != ( ulReads + 1UL ) ) || ( xTriggerReadLength != xExpectedRead ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTriggerReaderTask( void *pvParameters )
+{
+uint8_t ucRx[ sbBUFFER_LENGTH ], ucNext = 0;
+size_t x, xReceived;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		xReceived = xStreamBufferReceive( xTriggerBuffer, ucRx, sizeof( ucRx ), portMAX_DELAY );
+
+		for( x = 0; x < xReceived; x++ )
+		{
+			if( ucRx[ x ] != ucNext )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			ucNext++;
+		}
+
+		xTriggerReadLength = xReceived;
+		ulTriggerReads++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamSenderTask( void *pvParameters )
+{
+StreamPair_t * const pxPair = ( StreamPair_t * ) pvParameters;
+uint8_t ucTx[ sbBUFFER_LENGTH ], ucNext = 0;
+uint32_t ulSeed = ( uint32_t ) ( size_t ) pvParameters;
+size_t x, xLength, xSent;
+
+	for( ;; )
+	{
+		/* Up to twice the size of the buffer, a write longer than the buffer
+		waits for it to be empty and only writes what fits. */
+		xLength = ( size_t ) ( prvRand( &ulSeed ) % sbBUFFER_LENGTH ) + 1;
+
+		for( x = 0; x < xLength; x++ )
+		{
+			ucTx[ x ] = ucNext;
+			ucNext++;
+		}
+
+		for( xSent = 0; xSent < xLength; )
+		{
+			xSent += xStreamBufferSend( pxPair->xBuffer, &( ucTx[ xSent ] ), xLength - xSent, portMAX_DELAY );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamReceiverTask( void *pvParameters )
+{
+StreamPair_t * const pxPair = ( StreamPair_t * ) pvParameters;
+uint8_t ucRx[ sbBUFFER_LENGTH ], ucNext = 0;
+uint32_t ulSeed = ~( ( uint32_t ) ( size_t ) pvParameters );
+size_t x, xLength, xReceived;
+
+	for( ;; )
+	{
+		xLength = ( size_t ) ( prvRand( &ulSeed ) % sbBUFFER_LENGTH ) + 1;
+		xReceived = xStreamBufferReceive( pxPair->xBuffer, ucRx, xLength, portMAX_DELAY );
+
+		/* Without a block time limit the read only returns with data. */
+		if( ( xReceived == 0 ) || ( xReceived > xLength ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		for( x = 0; x < xReceived; x++ )
+		{
+			if( ucRx[ x ] != ucNext )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			ucNext++;
+		}
+
+		pxPair->ulReceiveCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvISRReceiverTask( void *pvParameters )
+{
+uint8_t ucRx[ sbBUFFER_LENGTH ], ucNext = 0;
+size_t x, xReceived;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* The tick hook writes on every tick, so the trigger level is reached
+		long before the block time expires. */
+		xReceived = xStreamBufferReceive( xISRToTaskBuffer, ucRx, sizeof( ucRx ), sbISR_RECEIVE_BLOCK );
+
+		if( xReceived == 0 )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		for( x = 0; x < xReceived; x++ )
+		{
+			if( ucRx[ x ] != ucNext )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			ucNext++;
+		}
+
+		ulISRReceiveCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvISRSenderTask( void *pvParameters )
+{
+uint8_t ucTx[ sbBUFFER_LENGTH ], ucNext = 0;
+uint32_t ulSeed = 0x5a5aUL;
+size_t x, xLength, xSent;
+
+	/* The parameter is not used. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* The tick hook reads sbISR_BYTES bytes per tick, so the task keeps
+		blocking for room until the tick hook wakes it. */
+		xLength = ( size_t ) ( prvRand( &ulSeed ) % sbBUFFER_LENGTH ) + 1;
+
+		for( x = 0; x < xLength; x++ )
+		{
+			ucTx[ x ] = ucNext;
+			ucNext++;
+		}
+
+		for( xSent = 0; xSent < xLength; )
+		{
+			xSent += xStreamBufferSend( xTaskToISRBuffer, &( ucTx[ xSent ] ), xLength - xSent, portMAX_DELAY );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPeriodicStreamBufferProcessing( void )
+{
+static uint8_t ucNextTx = 0, ucNextRx = 0;
+uint8_t ucBytes[ sbISR_BYTES ];
+size_t x, xCount;
+
+	/* This function should be called from an interrupt, such as the tick hook
+	function vApplicationTickHook().  The tasks woken run at the next context
+	switch, so the last parameter is not used. */
+	if( ( xISRToTaskBuffer == NULL ) || ( xTaskToISRBuffer == NULL ) )
+	{
+		return;
+	}
+
+	/* Write the next bytes of the sequence, as many as fit. */
+	for( x = 0; x < sbISR_BYTES; x++ )
+	{
+		ucBytes[ x ] = ( uint8_t ) ( ucNextTx + x );
+	}
+
+	xCount = xStreamBufferSendFromISR( xISRToTaskBuffer, ucBytes, sbISR_BYTES, NULL );
+	ucNextTx = ( uint8_t ) ( ucNextTx + xCount );
+
+	/* Read the bytes the sender task wrote, which must follow on from the
+	last ones read. */
+	xCount = xStreamBufferReceiveFromISR( xTaskToISRBuffer, ucBytes, sbISR_BYTES, NULL );
+
+	for( x = 0; x < xCount; x++ )
+	{
+		if( ucBytes[ x ] != ucNextRx )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		ucNextRx++;
+	}
+
+	ulISRBytesReceived += xCount;
+}
+/*-----------------------------------------------------------*/
+
+/* This is called to check the created tasks are still running and have not
+detected any errors. */
+BaseType_t xAreStreamBufferTasksStillRunning( void )
+{
+static uint32_t ulLastControllerCycles = 0UL, ulLastISRReceiveCycles = 0UL, ulLastISRBytesReceived = 0UL;
+static uint32_t ulLastReceiveCycles[ 2 ] = { 0UL, 0UL };
+BaseType_t x;
+
+	if( ulLastControllerCycles == ulControllerCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastControllerCycles = ulControllerCycles;
+	}
+
+	for( x = 0; x < 2; x++ )
+	{
+		if( ulLastReceiveCycles[ x ] == xStreamPairs[ x ].ulReceiveCycles )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			ulLastReceiveCycles[ x ] = xStreamPairs[ x ].ulReceiveCycles;
+		}
+	}
+
+	if( ulLastISRReceiveCycles == ulISRReceiveCycles )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastISRReceiveCycles = ulISRReceiveCycles;
+	}
+
+	if( ulLastISRBytesReceived == ulISRBytesReceived )
+	{
+		xErrorStatus = pdFAIL;
+	}
+	else
+	{
+		ulLastISRBytesReceived = ulISRBytesReceived;
+	}
+
+	return xErrorStatus;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRand( uint32_t *pulSeed )
+{
+const uint32_t ulMultiplier = 0x015a4e35UL, ulIncrement = 1UL;
+
+	/* Utility function to generate a pseudo random number. */
+	*pulSeed = ( ulMultiplier * *pulSeed ) + ulIncrement;
+	return ( *pulSeed >> 16UL ) & 0x7fffUL;
+}
+
@@ -85,6 +85,9 @@
 
 #define notifyTASK_PRIORITY		( tskIDLE_PRIORITY )
 
+/* Notification values are 32-bit, ULONG_MAX is wider on a 64-bit host. */
+#define notifyUINT32_MAX	( ( uint32_t ) 0xffffffffUL )
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -155,7 +158,7 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 	/* -------------------------------------------------------------------------
 	Check blocking when there are no notifications. */
 	xTimeOnEntering = xTaskGetTickCount();
-	xReturned = xTaskNotifyWait( ULONG_MAX, 0, &ulNotifiedValue, xTicksToWait );
+	xReturned = xTaskNotifyWait( notifyUINT32_MAX, 0, &ulNotifiedValue, xTicksToWait );
 
 	/* Should have blocked for the entire block time. */
 	if( ( xTaskGetTickCount() - xTimeOnEntering ) < xTicksToWait )
@@ -183,7 +186,7 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 
 	/* The task should now have a notification pending, and so not time out. */
 	xTimeOnEntering = xTaskGetTickCount();
-	xReturned = xTaskNotifyWait( ULONG_MAX, 0, &ulNotifiedValue, xTicksToWait );
+	xReturned = xTaskNotifyWait( notifyUINT32_MAX, 0, &ulNotifiedValue, xTicksToWait );
 
 	if( ( xTaskGetTickCount() - xTimeOnEntering ) >= xTicksToWait )
 	{
@@ -215,7 +218,7 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 
 	/* Waiting for the notification should now return immediately so a block
 	time of zero is used. */
-	xReturned = xTaskNotifyWait( ULONG_MAX, 0, &ulNotifiedValue, 0 );
+	xReturned = xTaskNotifyWait( notifyUINT32_MAX, 0, &ulNotifiedValue, 0 );
 
 	configASSERT( xReturned == pdPASS );
 	configASSERT( ulNotifiedValue == ulFirstNotifiedConst );
@@ -233,7 +236,7 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 	configASSERT( xReturned == pdPASS );
 	xReturned = xTaskNotify( xTaskToNotify, ulSecondNotifiedValueConst, eSetValueWithOverwrite );
 	configASSERT( xReturned == pdPASS );
-	xReturned = xTaskNotifyWait( ULONG_MAX, 0, &ulNotifiedValue, 0 );
+	xReturned = xTaskNotifyWait( notifyUINT32_MAX, 0, &ulNotifiedValue, 0 );
 	configASSERT( xReturned == pdPASS );
 	configASSERT( ulNotifiedValue == ulSecondNotifiedValueConst );
 
@@ -246,7 +249,7 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 	remain at ulSecondNotifiedConst. */
 	xReturned = xTaskNotify( xTaskToNotify, ulFirstNotifiedConst, eNoAction );
 	configASSERT( xReturned == pdPASS );
-	xReturned = xTaskNotifyWait( ULONG_MAX, 0, &ulNotifiedValue, 0 );
+	xReturned = xTaskNotifyWait( notifyUINT32_MAX, 0, &ulNotifiedValue, 0 );
 	configASSERT( ulNotifiedValue == ulSecondNotifiedValueConst );
 
 
@@ -262,7 +265,7 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 		configASSERT( xReturned == pdPASS );
 	}
 
-	xReturned = xTaskNotifyWait( ULONG_MAX, 0, &ulNotifiedValue, 0 );
+	xReturned = xTaskNotifyWait( notifyUINT32_MAX, 0, &ulNotifiedValue, 0 );
 	configASSERT( xReturned == pdPASS );
 	configASSERT( ulNotifiedValue == ( ulSecondNotifiedValueConst + ulMaxLoops ) );
 
@@ -282,7 +285,7 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 	ulLoop = 0;
 
 	/* Start with all bits clear. */
-	xTaskNotifyWait( ULONG_MAX, 0, &ulNotifiedValue, 0 );
+	xTaskNotifyWait( notifyUINT32_MAX, 0, &ulNotifiedValue, 0 );
 
 	do
 	{
@@ -300,7 +303,7 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 		/* Use the next bit on the next iteration around this loop. */
 		ulNotifyingValue <<= 1UL;
 
-	} while ( ulNotifiedValue != ULONG_MAX );
+	} while ( ulNotifiedValue != notifyUINT32_MAX );
 
 	/* As a 32-bit value was used the loop should have executed 32 times before
 	all the bits were set. */
@@ -320,15 +323,15 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 	configASSERT( xReturned == pdFAIL );
 
 	/* Notify the task with no action so as not to update the bits even though
-	ULONG_MAX is used as the notification value. */
-	xTaskNotify( xTaskToNotify, ULONG_MAX, eNoAction );
+	notifyUINT32_MAX is used as the notification value. */
+	xTaskNotify( xTaskToNotify, notifyUINT32_MAX, eNoAction );
 
 	/* Reading back the value should should find bit 0 is clear, as this was
 	cleared on entry, but bit 1 is not clear as it will not have been cleared on
 	exit as no notification was received. */
 	xReturned = xTaskNotifyWait( 0x00UL, 0x00UL, &ulNotifiedValue, 0 );
 	configASSERT( xReturned == pdPASS );
-	configASSERT( ulNotifiedValue == ( ULONG_MAX & ~ulBit0 ) );
+	configASSERT( ulNotifiedValue == ( notifyUINT32_MAX & ~ulBit0 ) );
 
 
 
@@ -343,14 +346,14 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 	/* However as the bit is cleared on exit, after the returned notification
 	value is set, the returned notification value should not have the bit
 	cleared... */
-	configASSERT( ulNotifiedValue == ( ULONG_MAX & ~ulBit0 ) );
+	configASSERT( ulNotifiedValue == ( notifyUINT32_MAX & ~ulBit0 ) );
 
 	/* ...but reading the value back again should find that the bit was indeed
 	cleared internally.  The returned value should be pdFAIL however as nothing
 	has notified the task in the mean time. */
 	xReturned = xTaskNotifyWait( 0x00, 0x00, &ulNotifiedValue, 0 );
 	configASSERT( xReturned == pdFAIL );
-	configASSERT( ulNotifiedValue == ( ULONG_MAX & ~( ulBit0 | ulBit1 ) ) );
+	configASSERT( ulNotifiedValue == ( notifyUINT32_MAX & ~( ulBit0 | ulBit1 ) ) );
 
 
 
@@ -358,10 +361,10 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 	/*--------------------------------------------------------------------------
 	Now try querying the previus value while notifying a task. */
 	xTaskNotifyAndQuery( xTaskToNotify, 0x00, eSetBits, &ulPreviousValue );
-	configASSERT( ulNotifiedValue == ( ULONG_MAX & ~( ulBit0 | ulBit1 ) ) );
+	configASSERT( ulNotifiedValue == ( notifyUINT32_MAX & ~( ulBit0 | ulBit1 ) ) );
 
 	/* Clear all bits. */
-	xTaskNotifyWait( 0x00, ULONG_MAX, &ulNotifiedValue, 0 );
+	xTaskNotifyWait( 0x00, notifyUINT32_MAX, &ulNotifiedValue, 0 );
 	xTaskNotifyAndQuery( xTaskToNotify, 0x00, eSetBits, &ulPreviousValue );
 	configASSERT( ulPreviousValue == 0 );
 
@@ -380,7 +383,7 @@ const uint32_t ulBit0 = 0x01UL, ulBit1 = 0x02UL;
 	ulNotifyCycleCount++;
 
 	/* Leave all bits cleared. */
-	xTaskNotifyWait( ULONG_MAX, 0, NULL, 0 );
+	xTaskNotifyWait( notifyUINT32_MAX, 0, NULL, 0 );
 }
 /*-----------------------------------------------------------*/
 
@@ -0,0 +1,483 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "buffer_pool.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* Sizes rounded up so the buffers that follow the pool structure, and the
+data that follows each buffer header, are aligned to portBYTE_ALIGNMENT. */
+#define bufALIGN_UP( x )		( ( ( x ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+#define bufPOOL_SIZE			bufALIGN_UP( sizeof( BufferPool_t ) )
+#define bufHEADER_SIZE			bufALIGN_UP( sizeof( BufferHeader_t ) )
+
+/* The pool structure is followed in the same allocation by uxBufferCount
+buffers, each of them preceded by a header referencing the pool, so a buffer
+can be released without knowing the pool it came from.  The free buffers are
+linked through their headers and taken and released in a critical section.
+
+A task that finds the pool empty registers itself in uxTasksWaiting and blocks
+on xHandOver.  A release that finds a task registered hands its buffer over
+through that queue, so the queue is only used when the pool runs dry. */
+typedef struct xBUFFER_HEADER
+{
+	struct xBUFFER_POOL *pxPool;	/*< The pool the buffer belongs to. */
+	struct xBUFFER_HEADER *pxNext;	/*< Next free buffer, while the buffer is free. */
+} BufferHeader_t;
+
+typedef struct xBUFFER_POOL
+{
+	BufferHeader_t *pxFreeList;			/*< Free buffers. */
+	volatile UBaseType_t uxFreeCount;	/*< Number of buffers in pxFreeList. */
+	UBaseType_t uxTasksWaiting;			/*< Tasks blocked, or about to block, on xHandOver. */
+	QueueHandle_t xHandOver;			/*< Buffers released to blocked tasks. */
+	size_t xBufferSize;					/*< Size of the buffers, as passed to xBufferPoolCreate(). */
+	UBaseType_t uxBufferCount;			/*< Number of buffers in the pool. */
+} BufferPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The header in front of a buffer, and the buffer following a header.
+ */
+static BufferHeader_t *prvGetHeader( void *pvBuffer );
+#define prvGetBuffer( pxHeader ) ( ( void * ) ( ( ( uint8_t * ) ( pxHeader ) ) + bufHEADER_SIZE ) )
+
+/*
+ * Take the first free buffer, NULL if there is none.  Called from a critical
+ * section.
+ */
+static void *prvTakeFreeBuffer( BufferPool_t * const pxPool );
+
+/*
+ * Put a buffer back in the free list, unless a task is waiting for one, in
+ * which case pdTRUE is returned and the buffer must be sent to xHandOver.
+ * Called from a critical section.
+ */
+static BaseType_t prvReleaseOrHandOver( BufferHeader_t * const pxHeader );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	BufferPoolHandle_t xBufferPoolCreate( UBaseType_t uxBufferCount, size_t xBufferSize )
+	{
+	BufferPool_t *pxPool;
+	BufferHeader_t *pxHeader;
+	uint8_t *pucBuffer;
+	size_t xStride;
+	UBaseType_t uxBuffer;
+
+		configASSERT( uxBufferCount > ( UBaseType_t ) 0 );
+		configASSERT( xBufferSize > ( size_t ) 0 );
+
+		xStride = bufHEADER_SIZE + bufALIGN_UP( xBufferSize );
+
+		pxPool = ( BufferPool_t * ) pvPortMalloc( bufPOOL_SIZE + ( ( size_t ) uxBufferCount * xStride ) );
+
+		if( pxPool != NULL )
+		{
+			/* Every buffer can be handed over at the same time, so sending to the
+			queue never fails. */
+			pxPool->xHandOver = xQueueCreate( uxBufferCount, ( UBaseType_t ) sizeof( void * ) );
+
+			if( pxPool->xHandOver != NULL )
+			{
+				pxPool->xBufferSize = xBufferSize;
+				pxPool->uxBufferCount = uxBufferCount;
+				pxPool->uxTasksWaiting = ( UBaseType_t ) 0;
+				pxPool->uxFreeCount = ( UBaseType_t ) 0;
+				pxPool->pxFreeList = NULL;
+
+				/* All the buffers start free, the first at the head of the list. */
+				pucBuffer = ( ( uint8_t * ) pxPool ) + bufPOOL_SIZE + ( ( size_t ) uxBufferCount * xStride );
+				for( uxBuffer = 0; uxBuffer < uxBufferCount; uxBuffer++ )
+				{
+					pucBuffer -= xStride;
+					pxHeader = ( BufferHeader_t * ) pucBuffer; /*lint !e826 The buffer area is large enough for the header. */
+					pxHeader->pxPool = pxPool;
+					pxHeader->pxNext = pxPool->pxFreeList;
+					pxPool->pxFreeList = pxHeader;
+					( pxPool->uxFreeCount )++;
+				}
+			}
+			else
+			{
+				vPortFree( pxPool );
+				pxPool = NULL;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( BufferPoolHandle_t ) pxPool;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void *pvBufferPoolTake( BufferPoolHandle_t xPool, TickType_t xTicksToWait )
+{
+BufferPool_t * const pxPool = ( BufferPool_t * ) xPool;
+void *pvBuffer;
+BaseType_t xBufferPending = pdFALSE;
+
+	configASSERT( pxPool );
+
+	taskENTER_CRITICAL();
+	{
+		pvBuffer = prvTakeFreeBuffer( pxPool );
+
+		if( ( pvBuffer == NULL ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+		{
+			( pxPool->uxTasksWaiting )++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	if( ( pvBuffer == NULL ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+	{
+		if( xQueueReceive( pxPool->xHandOver, &pvBuffer, xTicksToWait ) != pdPASS )
+		{
+			pvBuffer = NULL;
+
+			/* Timed out.  If no release has counted this task out of the
+			waiting tasks, do it now.  Otherwise a buffer is on its way to
+			xHandOver for one of the waiting tasks, and that buffer is this
+			task's as the other waiting tasks are all counted. */
+			taskENTER_CRITICAL();
+			{
+				if( pxPool->uxTasksWaiting > ( UBaseType_t ) 0 )
+				{
+					( pxPool->uxTasksWaiting )--;
+				}
+				else
+				{
+					xBufferPending = pdTRUE;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( xBufferPending != pdFALSE )
+			{
+				( void ) xQueueReceive( pxPool->xHandOver, &pvBuffer, portMAX_DELAY );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvBuffer;
+}
+/*-----------------------------------------------------------*/
+
+void *pvBufferPoolTakeFromISR( BufferPoolHandle_t xPool )
+{
+BufferPool_t * const pxPool = ( BufferPool_t * ) xPool;
+UBaseType_t uxSavedInterruptStatus;
+void *pvBuffer;
+
+	configASSERT( pxPool );
+
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pvBuffer = prvTakeFreeBuffer( pxPool );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return pvBuffer;
+}
+/*-----------------------------------------------------------*/
+
+void vBufferPoolRelease( void *pvBuffer )
+{
+BufferHeader_t * const pxHeader = prvGetHeader( pvBuffer );
+BaseType_t xHandOver, xResult;
+
+	taskENTER_CRITICAL();
+	{
+		xHandOver = prvReleaseOrHandOver( pxHeader );
+	}
+	taskEXIT_CRITICAL();
+
+	if( xHandOver != pdFALSE )
+	{
+		xResult = xQueueSendToBack( pxHeader->pxPool->xHandOver, &pvBuffer, ( TickType_t ) 0 );
+		configASSERT( xResult == pdPASS );
+		( void ) xResult;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vBufferPoolReleaseFromISR( void *pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BufferHeader_t * const pxHeader = prvGetHeader( pvBuffer );
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xHandOver, xResult;
+
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		xHandOver = prvReleaseOrHandOver( pxHeader );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	if( xHandOver != pdFALSE )
+	{
+		xResult = xQueueSendToBackFromISR( pxHeader->pxPool->xHandOver, &pvBuffer, pxHigherPriorityTaskWoken );
+		configASSERT( xResult == pdPASS );
+		( void ) xResult;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xBufferPoolGetBufferSize( BufferPoolHandle_t xPool )
+{
+BufferPool_t * const pxPool = ( BufferPool_t * ) xPool;
+
+	configASSERT( pxPool );
+	return pxPool->xBufferSize;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxBufferPoolGetFreeCount( BufferPoolHandle_t xPool )
+{
+BufferPool_t * const pxPool = ( BufferPool_t * ) xPool;
+
+	configASSERT( pxPool );
+	return pxPool->uxFreeCount;
+}
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	void vBufferPoolDelete( BufferPoolHandle_t xPool )
+	{
+	BufferPool_t * const pxPool = ( BufferPool_t * ) xPool;
+
+		configASSERT( pxPool );
+
+		/* A buffer still owned would be freed under its owner. */
+		configASSERT( pxPool->uxFreeCount == pxPool->uxBufferCount );
+		configASSERT( pxPool->uxTasksWaiting == ( UBaseType_t ) 0 );
+
+		vQueueDelete( pxPool->xHandOver );
+		vPortFree( pxPool );
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+BaseType_t xMessageQueueSend( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait )
+{
+	configASSERT( pvBuffer );
+	return xQueueSendToBack( xQueue, &pvBuffer, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMessageQueueSendFromISR( QueueHandle_t xQueue, void *pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+	configASSERT( pvBuffer );
+	return xQueueSendToBackFromISR( xQueue, &pvBuffer, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+void *pvMessageQueueReceive( QueueHandle_t xQueue, TickType_t xTicksToWait )
+{
+void *pvBuffer = NULL;
+
+	if( xQueueReceive( xQueue, &pvBuffer, xTicksToWait ) != pdPASS )
+	{
+		pvBuffer = NULL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvBuffer;
+}
+/*-----------------------------------------------------------*/
+
+void *pvMessageQueueReceiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+void *pvBuffer = NULL;
+
+	if( xQueueReceiveFromISR( xQueue, &pvBuffer, pxHigherPriorityTaskWoken ) != pdPASS )
+	{
+		pvBuffer = NULL;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvBuffer;
+}
+/*-----------------------------------------------------------*/
+
+static BufferHeader_t *prvGetHeader( void *pvBuffer )
+{
+BufferHeader_t *pxHeader;
+
+	configASSERT( pvBuffer );
+
+	pxHeader = ( BufferHeader_t * ) ( ( ( uint8_t * ) pvBuffer ) - bufHEADER_SIZE ); /*lint !e826 The header is in front of every buffer. */
+	configASSERT( pxHeader->pxPool );
+
+	return pxHeader;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvTakeFreeBuffer( BufferPool_t * const pxPool )
+{
+BufferHeader_t * const pxHeader = pxPool->pxFreeList;
+void *pvBuffer;
+
+	if( pxHeader != NULL )
+	{
+		pxPool->pxFreeList = pxHeader->pxNext;
+		( pxPool->uxFreeCount )--;
+		pvBuffer = prvGetBuffer( pxHeader );
+	}
+	else
+	{
+		pvBuffer = NULL;
+	}
+
+	return pvBuffer;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvReleaseOrHandOver( BufferHeader_t * const pxHeader )
+{
+BufferPool_t * const pxPool = pxHeader->pxPool;
+BaseType_t xHandOver;
+
+	if( pxPool->uxTasksWaiting > ( UBaseType_t ) 0 )
+	{
+		( pxPool->uxTasksWaiting )--;
+		xHandOver = pdTRUE;
+	}
+	else
+	{
+		configASSERT( pxPool->uxFreeCount < pxPool->uxBufferCount );
+
+		pxHeader->pxNext = pxPool->pxFreeList;
+		pxPool->pxFreeList = pxHeader;
+		( pxPool->uxFreeCount )++;
+		xHandOver = pdFALSE;
+	}
+
+	return xHandOver;
+}
+/*-----------------------------------------------------------*/
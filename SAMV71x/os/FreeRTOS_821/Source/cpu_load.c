@@ -0,0 +1,692 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "cpu_load.h"
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+	/* vCpuLoadGetStats() depends on sprintf(). */
+	#include <stdio.h>
+#endif
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include the CPU load module.  This #if is closed at the very bottom of this
+file. */
+#if ( configUSE_CPU_LOAD == 1 )
+
+/* The run time counters are sampled once a second. */
+#define cpuloadSAMPLE_PERIOD	( ( TickType_t ) configTICK_RATE_HZ )
+
+/* Loads are in hundredths of a percent. */
+#define cpuloadFULL_LOAD		( 10000UL )
+
+/* vCpuLoadGetStats() writes no line once fewer bytes than this are left in
+the buffer: a name of up to configMAX_TASK_NAME_LEN + 1 characters and two
+loads. */
+#define cpuloadLINE_LENGTH		( configMAX_TASK_NAME_LEN + 24 )
+
+/* The load of each task, over the samples of the window.  A record is
+allocated for each task found by a sample, and freed by the first sample that
+no longer finds the task. */
+typedef struct xCPU_LOAD_TASK
+{
+	TaskHandle_t xHandle;								/*< The task, NULL if the record is free. */
+	UBaseType_t uxTCBNumber;							/*< Tells the task from one created later at the same address. */
+	uint32_t ulLastRunTime;								/*< The run time counter of the task at the last sample. */
+	uint32_t ulTime[ configCPU_LOAD_WINDOW_SECONDS ];	/*< The time the task ran, per sample. */
+	char cName[ configMAX_TASK_NAME_LEN ];				/*< Copy of the name, the task may be deleted before the loads are printed. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	BaseType_t xFound;									/*< Set when the sample in progress finds the task. */
+} CpuLoadTask_t;
+
+/* The load of each registered interrupt. */
+typedef struct xCPU_LOAD_ISR
+{
+	const char *pcName;									/*< As passed to uxCpuLoadRegisterISR(). */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	volatile uint32_t ulRunTime;						/*< Accumulated by vCpuLoadISRExit(). */
+	uint32_t ulLastRunTime;								/*< ulRunTime at the last sample. */
+	uint32_t ulTime[ configCPU_LOAD_WINDOW_SECONDS ];	/*< The time the interrupt executed, per sample. */
+} CpuLoadISR_t;
+
+/*-----------------------------------------------------------*/
+
+/* The records are only accessed by the timer service task and by tasks, with
+the scheduler suspended. */
+PRIVILEGED_DATA static CpuLoadTask_t xTaskLoads[ configCPU_LOAD_MAX_TASKS ];
+PRIVILEGED_DATA static CpuLoadISR_t xISRLoads[ configCPU_LOAD_MAX_ISRS ];
+PRIVILEGED_DATA static UBaseType_t uxRegisteredISRs = ( UBaseType_t ) 0U;
+
+/* The counter time elapsed over each sample.  The window ends with the slot
+before uxNextSlot and holds uxSamples samples. */
+PRIVILEGED_DATA static uint32_t ulSampleTime[ configCPU_LOAD_WINDOW_SECONDS ];
+PRIVILEGED_DATA static uint32_t ulLastSampleCounter = 0UL;
+PRIVILEGED_DATA static UBaseType_t uxNextSlot = ( UBaseType_t ) 0U;
+PRIVILEGED_DATA static UBaseType_t uxSamples = ( UBaseType_t ) 0U;
+PRIVILEGED_DATA static BaseType_t xFirstSampleTaken = pdFALSE;
+
+/* Filled in by uxTaskGetSystemState() at each sample, too large for the stack
+of the timer service task. */
+PRIVILEGED_DATA static TaskStatus_t xTaskStatus[ configCPU_LOAD_MAX_TASKS ];
+
+PRIVILEGED_DATA static TimerHandle_t xSampleTimer = NULL;
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	PRIVILEGED_DATA static StaticTimer_t xSampleTimerBuffer;
+#endif
+
+/* Time spent in accounted interrupts, each nesting level only counting the
+time of its own interrupt, and the counter value and the time of the nested
+interrupts of each level in progress.  Updated with interrupts masked. */
+PRIVILEGED_DATA static volatile uint32_t ulISRTime = 0UL;
+PRIVILEGED_DATA static uint32_t ulISREntryCounter[ configCPU_LOAD_MAX_ISR_NESTING ];
+PRIVILEGED_DATA static uint32_t ulISRNestedTime[ configCPU_LOAD_MAX_ISR_NESTING ];
+PRIVILEGED_DATA static volatile UBaseType_t uxISRNesting = ( UBaseType_t ) 0U;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The callback of xSampleTimer: moves the time each task and interrupt ran
+ * since the previous sample into the next slot of the window.
+ */
+static void prvSample( TimerHandle_t xTimer );
+
+/*
+ * The record of a task, NULL if the task has none.  uxTCBNumber is only
+ * compared when not 0.  Called with the scheduler suspended.
+ */
+static CpuLoadTask_t *prvFindTask( TaskHandle_t xHandle, UBaseType_t uxTCBNumber );
+
+/*
+ * The load over the last uxSeconds samples, of the per sample times
+ * pulTime[].  Called with the scheduler suspended.
+ */
+static uint32_t prvGetLoad( const uint32_t * const pulTime, UBaseType_t uxSeconds );
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+	/*
+	 * Write one line of the vCpuLoadGetStats() table, if it fits.  Returns
+	 * the end of the text written.
+	 */
+	static char *prvWriteLine( char *pcBuffer, const char * const pcEnd, const char *pcName, uint32_t ulLoad, uint32_t ulWindowLoad ); /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+	/*
+	 * Copy a name, padded with spaces so the columns line up (without relying
+	 * on the field width support of sprintf(), as tasks.c).  Returns the end
+	 * of the name.
+	 */
+	static char *prvWriteName( char *pcBuffer, const char *pcName ); /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+#endif /* configUSE_STATS_FORMATTING_FUNCTIONS */
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xCpuLoadStart( void )
+{
+BaseType_t xReturn = pdFAIL;
+
+	/* Only one sample timer. */
+	configASSERT( xSampleTimer == NULL );
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+		xSampleTimer = xTimerCreateStatic( "CpuLoad", cpuloadSAMPLE_PERIOD, pdTRUE, NULL, prvSample, &xSampleTimerBuffer );
+	}
+	#else
+	{
+		xSampleTimer = xTimerCreate( "CpuLoad", cpuloadSAMPLE_PERIOD, pdTRUE, NULL, prvSample );
+	}
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+	if( xSampleTimer != NULL )
+	{
+		/* The block time only applies once the scheduler is running. */
+		xReturn = xTimerStart( xSampleTimer, cpuloadSAMPLE_PERIOD );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxCpuLoadRegisterISR( const char *pcName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+UBaseType_t uxISR;
+
+	configASSERT( pcName );
+
+	taskENTER_CRITICAL();
+	{
+		uxISR = uxRegisteredISRs;
+
+		/* configCPU_LOAD_MAX_ISRS is too small. */
+		configASSERT( uxISR < ( UBaseType_t ) configCPU_LOAD_MAX_ISRS );
+
+		xISRLoads[ uxISR ].pcName = pcName;
+		uxRegisteredISRs++;
+
+		traceISR_NAME( uxISR, pcName );
+	}
+	taskEXIT_CRITICAL();
+
+	return uxISR;
+}
+/*-----------------------------------------------------------*/
+
+void vCpuLoadISREnter( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* configCPU_LOAD_MAX_ISR_NESTING is too small. */
+		configASSERT( uxISRNesting < ( UBaseType_t ) configCPU_LOAD_MAX_ISR_NESTING );
+
+		ulISREntryCounter[ uxISRNesting ] = configCPU_LOAD_COUNTER();
+		ulISRNestedTime[ uxISRNesting ] = 0UL;
+		uxISRNesting++;
+
+		traceISR_ENTER();
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vCpuLoadISRExit( UBaseType_t uxISR )
+{
+UBaseType_t uxSavedInterruptStatus;
+uint32_t ulTime;
+
+	configASSERT( uxISR < uxRegisteredISRs );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Not paired with vCpuLoadISREnter(). */
+		configASSERT( uxISRNesting > ( UBaseType_t ) 0U );
+
+		uxISRNesting--;
+		ulTime = configCPU_LOAD_COUNTER() - ulISREntryCounter[ uxISRNesting ];
+
+		/* The interrupts that nested in this one are accounted already. */
+		xISRLoads[ uxISR ].ulRunTime += ulTime - ulISRNestedTime[ uxISRNesting ];
+
+		if( uxISRNesting > ( UBaseType_t ) 0U )
+		{
+			ulISRNestedTime[ uxISRNesting - ( UBaseType_t ) 1U ] += ulTime;
+		}
+		else
+		{
+			ulISRTime += ulTime;
+		}
+
+		traceISR_EXIT( uxISR );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulCpuLoadGetTaskTime( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+uint32_t ulTime;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* The time stands still from the entry of an accounted interrupt, so
+		it never goes back when the interrupt returns. */
+		if( uxISRNesting > ( UBaseType_t ) 0U )
+		{
+			ulTime = ulISREntryCounter[ 0 ];
+		}
+		else
+		{
+			ulTime = configCPU_LOAD_COUNTER();
+		}
+
+		ulTime -= ulISRTime;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return ulTime;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulCpuLoadGetTotal( UBaseType_t uxSeconds )
+{
+CpuLoadTask_t *pxIdle;
+uint32_t ulLoad = 0UL;
+
+	vTaskSuspendAll();
+	{
+		/* The time not spent in the idle task.  There is no record before the
+		first sample. */
+		pxIdle = prvFindTask( xTaskGetIdleTaskHandle(), ( UBaseType_t ) 0U );
+
+		if( ( pxIdle != NULL ) && ( uxSamples > ( UBaseType_t ) 0U ) )
+		{
+			ulLoad = cpuloadFULL_LOAD - prvGetLoad( pxIdle->ulTime, uxSeconds );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return ulLoad;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulCpuLoadGetTask( TaskHandle_t xTask, UBaseType_t uxSeconds )
+{
+CpuLoadTask_t *pxRecord;
+uint32_t ulLoad = 0UL;
+
+	configASSERT( xTask );
+
+	vTaskSuspendAll();
+	{
+		pxRecord = prvFindTask( xTask, ( UBaseType_t ) 0U );
+
+		if( pxRecord != NULL )
+		{
+			ulLoad = prvGetLoad( pxRecord->ulTime, uxSeconds );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return ulLoad;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulCpuLoadGetISR( UBaseType_t uxISR, UBaseType_t uxSeconds )
+{
+uint32_t ulLoad;
+
+	configASSERT( uxISR < uxRegisteredISRs );
+
+	vTaskSuspendAll();
+	{
+		ulLoad = prvGetLoad( xISRLoads[ uxISR ].ulTime, uxSeconds );
+	}
+	( void ) xTaskResumeAll();
+
+	return ulLoad;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+	void vCpuLoadGetStats( char *pcWriteBuffer, size_t xBufferLength ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	const char * const pcEnd = pcWriteBuffer + xBufferLength; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	char cName[ configMAX_TASK_NAME_LEN + 2 ]; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	UBaseType_t x;
+	size_t xLength;
+
+		configASSERT( pcWriteBuffer );
+		configASSERT( xBufferLength > 0 );
+
+		*pcWriteBuffer = 0x00;
+
+		vTaskSuspendAll();
+		{
+			/* Header. */
+			if( xBufferLength > cpuloadLINE_LENGTH )
+			{
+				pcWriteBuffer = prvWriteName( pcWriteBuffer, "Name" );
+				sprintf( pcWriteBuffer, "\t%6us\t%6us\r\n", 1U, ( unsigned int ) configCPU_LOAD_WINDOW_SECONDS );
+				pcWriteBuffer += strlen( pcWriteBuffer );
+			}
+
+			for( x = 0; x < ( UBaseType_t ) configCPU_LOAD_MAX_TASKS; x++ )
+			{
+				if( xTaskLoads[ x ].xHandle != NULL )
+				{
+					pcWriteBuffer = prvWriteLine( pcWriteBuffer, pcEnd, xTaskLoads[ x ].cName, prvGetLoad( xTaskLoads[ x ].ulTime, 1 ), prvGetLoad( xTaskLoads[ x ].ulTime, configCPU_LOAD_WINDOW_SECONDS ) );
+				}
+			}
+
+			/* The names of interrupts are written in brackets. */
+			for( x = 0; x < uxRegisteredISRs; x++ )
+			{
+				xLength = strlen( xISRLoads[ x ].pcName );
+				if( xLength > ( size_t ) ( configMAX_TASK_NAME_LEN - 1 ) )
+				{
+					xLength = ( size_t ) ( configMAX_TASK_NAME_LEN - 1 );
+				}
+
+				cName[ 0 ] = '[';
+				memcpy( &( cName[ 1 ] ), xISRLoads[ x ].pcName, xLength );
+				cName[ xLength + 1 ] = ']';
+				cName[ xLength + 2 ] = 0x00;
+
+				pcWriteBuffer = prvWriteLine( pcWriteBuffer, pcEnd, cName, prvGetLoad( xISRLoads[ x ].ulTime, 1 ), prvGetLoad( xISRLoads[ x ].ulTime, configCPU_LOAD_WINDOW_SECONDS ) );
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		( void ) prvWriteLine( pcWriteBuffer, pcEnd, "Total", ulCpuLoadGetTotal( 1 ), ulCpuLoadGetTotal( configCPU_LOAD_WINDOW_SECONDS ) );
+	}
+
+#endif /* configUSE_STATS_FORMATTING_FUNCTIONS */
+/*-----------------------------------------------------------*/
+
+static void prvSample( TimerHandle_t xTimer )
+{
+UBaseType_t uxTaskCount, x;
+CpuLoadTask_t *pxRecord;
+uint32_t ulCounter, ulRunTime;
+
+	( void ) xTimer;
+
+	vTaskSuspendAll();
+	{
+		uxTaskCount = uxTaskGetSystemState( xTaskStatus, ( UBaseType_t ) configCPU_LOAD_MAX_TASKS, NULL );
+
+		/* uxTaskGetSystemState() fails if there are more tasks than
+		configCPU_LOAD_MAX_TASKS. */
+		configASSERT( uxTaskCount > ( UBaseType_t ) 0U );
+
+		ulCounter = configCPU_LOAD_COUNTER();
+		ulSampleTime[ uxNextSlot ] = ulCounter - ulLastSampleCounter;
+		ulLastSampleCounter = ulCounter;
+
+		/* Update the records of the tasks known, so that records left are
+		those of deleted tasks.  The handle of a task is cleared from
+		xTaskStatus[] once accounted. */
+		for( x = 0; x < ( UBaseType_t ) configCPU_LOAD_MAX_TASKS; x++ )
+		{
+			xTaskLoads[ x ].xFound = pdFALSE;
+		}
+
+		for( x = 0; x < uxTaskCount; x++ )
+		{
+			pxRecord = prvFindTask( xTaskStatus[ x ].xHandle, xTaskStatus[ x ].xTaskNumber );
+
+			if( pxRecord != NULL )
+			{
+				pxRecord->ulTime[ uxNextSlot ] = xTaskStatus[ x ].ulRunTimeCounter - pxRecord->ulLastRunTime;
+				pxRecord->ulLastRunTime = xTaskStatus[ x ].ulRunTimeCounter;
+				pxRecord->xFound = pdTRUE;
+				xTaskStatus[ x ].xHandle = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		for( x = 0; x < ( UBaseType_t ) configCPU_LOAD_MAX_TASKS; x++ )
+		{
+			if( xTaskLoads[ x ].xFound == pdFALSE )
+			{
+				xTaskLoads[ x ].xHandle = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* There are as many records as xTaskStatus[] entries, so a free one
+		is left for each new task. */
+		for( x = 0; x < uxTaskCount; x++ )
+		{
+			if( xTaskStatus[ x ].xHandle != NULL )
+			{
+				pxRecord = prvFindTask( NULL, ( UBaseType_t ) 0U );
+				configASSERT( pxRecord );
+				if( pxRecord == NULL )
+				{
+					break;
+				}
+
+				memset( ( void * ) pxRecord->ulTime, 0x00, sizeof( pxRecord->ulTime ) );
+				pxRecord->xHandle = xTaskStatus[ x ].xHandle;
+				pxRecord->uxTCBNumber = xTaskStatus[ x ].xTaskNumber;
+				strncpy( pxRecord->cName, xTaskStatus[ x ].pcTaskName, ( size_t ) configMAX_TASK_NAME_LEN );
+				pxRecord->cName[ configMAX_TASK_NAME_LEN - 1 ] = 0x00;
+				pxRecord->xFound = pdTRUE;
+
+				/* A task created since the previous sample ran for the whole of
+				its run time counter in this sample.  The first sample only
+				sets the starting point. */
+				if( xFirstSampleTaken != pdFALSE )
+				{
+					pxRecord->ulTime[ uxNextSlot ] = xTaskStatus[ x ].ulRunTimeCounter;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				pxRecord->ulLastRunTime = xTaskStatus[ x ].ulRunTimeCounter;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		for( x = 0; x < uxRegisteredISRs; x++ )
+		{
+			ulRunTime = xISRLoads[ x ].ulRunTime;
+			xISRLoads[ x ].ulTime[ uxNextSlot ] = ulRunTime - xISRLoads[ x ].ulLastRunTime;
+			xISRLoads[ x ].ulLastRunTime = ulRunTime;
+		}
+
+		if( xFirstSampleTaken != pdFALSE )
+		{
+			uxNextSlot++;
+			if( uxNextSlot >= ( UBaseType_t ) configCPU_LOAD_WINDOW_SECONDS )
+			{
+				uxNextSlot = ( UBaseType_t ) 0U;
+			}
+
+			if( uxSamples < ( UBaseType_t ) configCPU_LOAD_WINDOW_SECONDS )
+			{
+				uxSamples++;
+			}
+		}
+		else
+		{
+			xFirstSampleTaken = pdTRUE;
+		}
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+static CpuLoadTask_t *prvFindTask( TaskHandle_t xHandle, UBaseType_t uxTCBNumber )
+{
+CpuLoadTask_t *pxRecord = NULL;
+UBaseType_t x;
+
+	for( x = 0; x < ( UBaseType_t ) configCPU_LOAD_MAX_TASKS; x++ )
+	{
+		if( ( xTaskLoads[ x ].xHandle == xHandle ) && ( ( uxTCBNumber == ( UBaseType_t ) 0U ) || ( xTaskLoads[ x ].uxTCBNumber == uxTCBNumber ) ) )
+		{
+			pxRecord = &( xTaskLoads[ x ] );
+			break;
+		}
+	}
+
+	return pxRecord;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvGetLoad( const uint32_t * const pulTime, UBaseType_t uxSeconds )
+{
+UBaseType_t uxSlot = uxNextSlot, x;
+uint64_t ullTime = 0ULL, ullElapsed = 0ULL;
+uint32_t ulLoad = 0UL;
+
+	configASSERT( ( uxSeconds > ( UBaseType_t ) 0U ) && ( uxSeconds <= ( UBaseType_t ) configCPU_LOAD_WINDOW_SECONDS ) );
+
+	if( uxSeconds > uxSamples )
+	{
+		uxSeconds = uxSamples;
+	}
+
+	/* Sums of up to configCPU_LOAD_WINDOW_SECONDS 32-bit samples. */
+	for( x = 0; x < uxSeconds; x++ )
+	{
+		if( uxSlot == ( UBaseType_t ) 0U )
+		{
+			uxSlot = ( UBaseType_t ) configCPU_LOAD_WINDOW_SECONDS;
+		}
+		uxSlot--;
+
+		ullTime += pulTime[ uxSlot ];
+		ullElapsed += ulSampleTime[ uxSlot ];
+	}
+
+	if( ullElapsed > 0ULL )
+	{
+		ullTime = ( ullTime * cpuloadFULL_LOAD ) / ullElapsed;
+
+		/* The running task is sampled before its current time slice is added
+		to its counter, which can move a little time to the next sample. */
+		ulLoad = ( ullTime > cpuloadFULL_LOAD ) ? cpuloadFULL_LOAD : ( uint32_t ) ullTime;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ulLoad;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+	static char *prvWriteLine( char *pcBuffer, const char * const pcEnd, const char *pcName, uint32_t ulLoad, uint32_t ulWindowLoad ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+		if( ( size_t ) ( pcEnd - pcBuffer ) > ( size_t ) cpuloadLINE_LENGTH )
+		{
+			pcBuffer = prvWriteName( pcBuffer, pcName );
+			sprintf( pcBuffer, "\t%3u.%02u%%\t%3u.%02u%%\r\n",
+					( unsigned int ) ( ulLoad / 100UL ), ( unsigned int ) ( ulLoad % 100UL ),
+					( unsigned int ) ( ulWindowLoad / 100UL ), ( unsigned int ) ( ulWindowLoad % 100UL ) );
+			pcBuffer += strlen( pcBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pcBuffer;
+	}
+	/*-----------------------------------------------------------*/
+
+	static char *prvWriteName( char *pcBuffer, const char *pcName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	size_t x;
+
+		strcpy( pcBuffer, pcName );
+
+		for( x = strlen( pcBuffer ); x < ( size_t ) ( configMAX_TASK_NAME_LEN - 1 ); x++ )
+		{
+			pcBuffer[ x ] = ' ';
+		}
+		pcBuffer[ x ] = 0x00;
+
+		return &( pcBuffer[ x ] );
+	}
+
+#endif /* configUSE_STATS_FORMATTING_FUNCTIONS */
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include the CPU load module. */
+#endif /* configUSE_CPU_LOAD == 1 */
@@ -0,0 +1,685 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "fast_semaphore.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if ( configUSE_MUTEXES != 1 )
+	#error configUSE_MUTEXES must be set to 1 to use fast semaphores, fast mutexes use the priority inheritance of tasks.c.
+#endif
+
+#if ( configUSE_PREEMPTION == 0 )
+	/* If the cooperative scheduler is being used then a yield should not be
+	performed just because a higher priority task has been woken. */
+	#define fsemYIELD_IF_USING_PREEMPTION()
+#else
+	#define fsemYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
+#endif
+
+/* The low bit of uxState is set while tasks may be blocked on the semaphore,
+which sends every give to the kernel path.  The rest of uxState holds the
+count of a semaphore in units of fsemCOUNT_ONE, or the handle of the task
+holding a mutex (0 when the mutex is available), task control blocks being at
+least word aligned. */
+#define fsemWAITING				( ( UBaseType_t ) 1 )
+#define fsemCOUNT_ONE			( ( UBaseType_t ) 2 )
+#define fsemGET_COUNT( uxState )	( ( uxState ) / fsemCOUNT_ONE )
+#define fsemGET_HOLDER( uxState )	( ( uxState ) & ~fsemWAITING )
+
+/* uxMaxCount of a mutex. */
+#define fsemMUTEX				( ( UBaseType_t ) 0 )
+
+/* The waiting flag is only set, and the event list only changed, with
+interrupts masked, so the kernel path is serialised with the other kernel
+paths while the fast paths only ever see a consistent state word. */
+typedef struct xFAST_SEMAPHORE
+{
+	volatile UBaseType_t uxState;	/*< Count or holder, and the waiting flag. */
+	List_t xTasksWaitingToTake;		/*< Tasks blocked taking, in priority order. */
+	UBaseType_t uxMaxCount;			/*< Largest count, fsemMUTEX for a mutex. */
+} FastSemaphore_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Compare and swap with interrupts masked, for ports that do not define
+ * portCOMPARE_AND_SWAP().
+ */
+#ifdef portCOMPARE_AND_SWAP
+	#define fsemCOMPARE_AND_SWAP( puxDestination, uxExpected, uxNew ) portCOMPARE_AND_SWAP( ( puxDestination ), ( uxExpected ), ( uxNew ) )
+#else
+	static BaseType_t prvCompareAndSwap( volatile UBaseType_t *puxDestination, UBaseType_t uxExpected, UBaseType_t uxNew );
+	#define fsemCOMPARE_AND_SWAP( puxDestination, uxExpected, uxNew ) prvCompareAndSwap( ( puxDestination ), ( uxExpected ), ( uxNew ) )
+#endif
+
+/*
+ * The kernel path of xFastSemaphoreTake(), taken when the semaphore is not
+ * available.  Blocks the calling task on the event list until a give wakes it
+ * or xTicksToWait expires.
+ */
+static BaseType_t prvTakeBlocking( FastSemaphore_t * const pxSemaphore, TickType_t xTicksToWait );
+
+/*
+ * The kernel path of the gives, taken when tasks may be waiting: gives the
+ * semaphore, or releases the mutex held by xGivingTask, and wakes the highest
+ * priority task waiting, if any.  *pxYieldRequired is set to pdTRUE if the
+ * woken task has a priority above the calling task, or the calling task gave
+ * back an inherited priority.  Called with interrupts masked.
+ */
+static BaseType_t prvGiveAndWake( FastSemaphore_t * const pxSemaphore, TaskHandle_t xGivingTask, BaseType_t * const pxYieldRequired );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	FastSemaphoreHandle_t xFastSemaphoreCreateCounting( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount )
+	{
+	FastSemaphore_t *pxSemaphore;
+
+		/* The count is held above the waiting flag. */
+		configASSERT( uxMaxCount != fsemMUTEX );
+		configASSERT( uxMaxCount <= fsemGET_COUNT( ~( UBaseType_t ) 0 ) );
+		configASSERT( uxInitialCount <= uxMaxCount );
+
+		pxSemaphore = ( FastSemaphore_t * ) pvPortMalloc( sizeof( FastSemaphore_t ) );
+
+		if( pxSemaphore != NULL )
+		{
+			pxSemaphore->uxState = uxInitialCount * fsemCOUNT_ONE;
+			pxSemaphore->uxMaxCount = uxMaxCount;
+			vListInitialise( &( pxSemaphore->xTasksWaitingToTake ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( FastSemaphoreHandle_t ) pxSemaphore;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	FastSemaphoreHandle_t xFastSemaphoreCreateMutex( void )
+	{
+	FastSemaphore_t *pxSemaphore;
+
+		/* The holder handle is stored in the state word. */
+		configASSERT( sizeof( UBaseType_t ) >= sizeof( TaskHandle_t ) );
+
+		pxSemaphore = ( FastSemaphore_t * ) pvPortMalloc( sizeof( FastSemaphore_t ) );
+
+		if( pxSemaphore != NULL )
+		{
+			pxSemaphore->uxState = ( UBaseType_t ) 0;
+			pxSemaphore->uxMaxCount = fsemMUTEX;
+			vListInitialise( &( pxSemaphore->xTasksWaitingToTake ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( FastSemaphoreHandle_t ) pxSemaphore;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	void vFastSemaphoreDelete( FastSemaphoreHandle_t xSemaphore )
+	{
+	FastSemaphore_t * const pxSemaphore = ( FastSemaphore_t * ) xSemaphore;
+
+		configASSERT( pxSemaphore );
+		configASSERT( listLIST_IS_EMPTY( &( pxSemaphore->xTasksWaitingToTake ) ) != pdFALSE );
+
+		vPortFree( ( void * ) pxSemaphore );
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+BaseType_t xFastSemaphoreTake( FastSemaphoreHandle_t xSemaphore, TickType_t xTicksToWait )
+{
+FastSemaphore_t * const pxSemaphore = ( FastSemaphore_t * ) xSemaphore;
+UBaseType_t uxState;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxSemaphore );
+
+	if( pxSemaphore->uxMaxCount == fsemMUTEX )
+	{
+		/* Only an available mutex with no task waiting is taken here, the
+		kernel path sorts out the others. */
+		if( fsemCOMPARE_AND_SWAP( &( pxSemaphore->uxState ), ( UBaseType_t ) 0, ( UBaseType_t ) xTaskGetCurrentTaskHandle() ) != pdFALSE )
+		{
+			( void ) pvTaskIncrementMutexHeldCount();
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		/* Retried for as long as a count is available, the swap only failing
+		if the state word changed since it was read. */
+		uxState = pxSemaphore->uxState;
+
+		while( fsemGET_COUNT( uxState ) != ( UBaseType_t ) 0 )
+		{
+			if( fsemCOMPARE_AND_SWAP( &( pxSemaphore->uxState ), uxState, uxState - fsemCOUNT_ONE ) != pdFALSE )
+			{
+				xReturn = pdPASS;
+				break;
+			}
+			else
+			{
+				uxState = pxSemaphore->uxState;
+			}
+		}
+	}
+
+	if( xReturn == pdFAIL )
+	{
+		xReturn = prvTakeBlocking( pxSemaphore, xTicksToWait );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xFastSemaphoreGive( FastSemaphoreHandle_t xSemaphore )
+{
+FastSemaphore_t * const pxSemaphore = ( FastSemaphore_t * ) xSemaphore;
+TaskHandle_t xGivingTask = NULL;
+UBaseType_t uxState;
+BaseType_t xReturn = pdFAIL, xDone = pdFALSE, xYieldRequired = pdFALSE;
+
+	configASSERT( pxSemaphore );
+
+	if( pxSemaphore->uxMaxCount == fsemMUTEX )
+	{
+		/* The swap fails if the calling task does not hold the mutex, or if
+		tasks may be waiting for it. */
+		xGivingTask = xTaskGetCurrentTaskHandle();
+
+		if( fsemCOMPARE_AND_SWAP( &( pxSemaphore->uxState ), ( UBaseType_t ) xGivingTask, ( UBaseType_t ) 0 ) != pdFALSE )
+		{
+			/* No task waits for this mutex, but the task may still have
+			inherited a priority through another mutex it holds. */
+			if( xTaskDecrementMutexHeldCount() == pdFALSE )
+			{
+				taskENTER_CRITICAL();
+				{
+					if( xTaskPriorityDisinherit( xGivingTask ) != pdFALSE )
+					{
+						fsemYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xReturn = pdPASS;
+			xDone = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		uxState = pxSemaphore->uxState;
+
+		while( ( uxState & fsemWAITING ) == ( UBaseType_t ) 0 )
+		{
+			if( fsemGET_COUNT( uxState ) >= pxSemaphore->uxMaxCount )
+			{
+				/* Already at its maximum. */
+				xDone = pdTRUE;
+				break;
+			}
+			else if( fsemCOMPARE_AND_SWAP( &( pxSemaphore->uxState ), uxState, uxState + fsemCOUNT_ONE ) != pdFALSE )
+			{
+				xReturn = pdPASS;
+				xDone = pdTRUE;
+				break;
+			}
+			else
+			{
+				uxState = pxSemaphore->uxState;
+			}
+		}
+	}
+
+	if( xDone == pdFALSE )
+	{
+		taskENTER_CRITICAL();
+		{
+			xReturn = prvGiveAndWake( pxSemaphore, xGivingTask, &xYieldRequired );
+
+			if( xYieldRequired != pdFALSE )
+			{
+				fsemYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xFastSemaphoreTakeFromISR( FastSemaphoreHandle_t xSemaphore )
+{
+FastSemaphore_t * const pxSemaphore = ( FastSemaphore_t * ) xSemaphore;
+UBaseType_t uxState;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxSemaphore );
+	configASSERT( pxSemaphore->uxMaxCount != fsemMUTEX );
+
+	uxState = pxSemaphore->uxState;
+
+	while( fsemGET_COUNT( uxState ) != ( UBaseType_t ) 0 )
+	{
+		if( fsemCOMPARE_AND_SWAP( &( pxSemaphore->uxState ), uxState, uxState - fsemCOUNT_ONE ) != pdFALSE )
+		{
+			xReturn = pdPASS;
+			break;
+		}
+		else
+		{
+			uxState = pxSemaphore->uxState;
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xFastSemaphoreGiveFromISR( FastSemaphoreHandle_t xSemaphore, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+FastSemaphore_t * const pxSemaphore = ( FastSemaphore_t * ) xSemaphore;
+UBaseType_t uxState, uxSavedInterruptStatus;
+BaseType_t xReturn = pdFAIL, xDone = pdFALSE, xYieldRequired = pdFALSE;
+
+	configASSERT( pxSemaphore );
+	configASSERT( pxSemaphore->uxMaxCount != fsemMUTEX );
+
+	uxState = pxSemaphore->uxState;
+
+	while( ( uxState & fsemWAITING ) == ( UBaseType_t ) 0 )
+	{
+		if( fsemGET_COUNT( uxState ) >= pxSemaphore->uxMaxCount )
+		{
+			xDone = pdTRUE;
+			break;
+		}
+		else if( fsemCOMPARE_AND_SWAP( &( pxSemaphore->uxState ), uxState, uxState + fsemCOUNT_ONE ) != pdFALSE )
+		{
+			xReturn = pdPASS;
+			xDone = pdTRUE;
+			break;
+		}
+		else
+		{
+			uxState = pxSemaphore->uxState;
+		}
+	}
+
+	if( xDone == pdFALSE )
+	{
+		/* See the comment in xQueueGenericSendFromISR() on the interrupt
+		priorities that can call interrupt safe API functions. */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xReturn = prvGiveAndWake( pxSemaphore, NULL, &xYieldRequired );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+		{
+			*pxHigherPriorityTaskWoken = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxFastSemaphoreGetCount( FastSemaphoreHandle_t xSemaphore )
+{
+FastSemaphore_t * const pxSemaphore = ( FastSemaphore_t * ) xSemaphore;
+UBaseType_t uxState, uxReturn;
+
+	configASSERT( pxSemaphore );
+
+	uxState = pxSemaphore->uxState;
+
+	if( pxSemaphore->uxMaxCount == fsemMUTEX )
+	{
+		uxReturn = ( fsemGET_HOLDER( uxState ) == ( UBaseType_t ) 0 ) ? ( UBaseType_t ) 1 : ( UBaseType_t ) 0;
+	}
+	else
+	{
+		uxReturn = fsemGET_COUNT( uxState );
+	}
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTakeBlocking( FastSemaphore_t * const pxSemaphore, TickType_t xTicksToWait )
+{
+TimeOut_t xTimeOut;
+UBaseType_t uxState;
+BaseType_t xReturn = pdFAIL, xBlocked = pdFALSE;
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	vTaskSetTimeOutState( &xTimeOut );
+
+	do
+	{
+		taskENTER_CRITICAL();
+		{
+			uxState = pxSemaphore->uxState;
+
+			if( pxSemaphore->uxMaxCount == fsemMUTEX )
+			{
+				if( fsemGET_HOLDER( uxState ) == ( UBaseType_t ) 0 )
+				{
+					/* Released, the waiting flag is kept for the tasks still
+					blocked. */
+					pxSemaphore->uxState = uxState | ( UBaseType_t ) pvTaskIncrementMutexHeldCount();
+					xReturn = pdPASS;
+				}
+				else
+				{
+					/* Fast mutexes are not recursive. */
+					configASSERT( fsemGET_HOLDER( uxState ) != ( UBaseType_t ) xTaskGetCurrentTaskHandle() );
+				}
+			}
+			else if( fsemGET_COUNT( uxState ) != ( UBaseType_t ) 0 )
+			{
+				pxSemaphore->uxState = uxState - fsemCOUNT_ONE;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* A task woken by a give finds the semaphore available, unless
+			another task took it first, so the remaining block time is only
+			worked out when the task has to block again. */
+			if( ( xReturn == pdFAIL ) && ( xBlocked != pdFALSE ) )
+			{
+				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+				{
+					xTicksToWait = ( TickType_t ) 0;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( ( xReturn == pdFAIL ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+			{
+				if( pxSemaphore->uxMaxCount == fsemMUTEX )
+				{
+					vTaskPriorityInherit( ( TaskHandle_t ) fsemGET_HOLDER( uxState ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* From now on the gives take the kernel path, which wakes this
+				task.  The task leaves the event list when it is woken or its
+				block time expires, the yield being performed once the critical
+				section is left. */
+				pxSemaphore->uxState = uxState | fsemWAITING;
+				vTaskPlaceOnEventList( &( pxSemaphore->xTasksWaitingToTake ), xTicksToWait );
+				portYIELD_WITHIN_API();
+				xBlocked = pdTRUE;
+			}
+			else
+			{
+				xBlocked = pdFALSE;
+			}
+		}
+		taskEXIT_CRITICAL();
+	} while( xBlocked != pdFALSE );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvGiveAndWake( FastSemaphore_t * const pxSemaphore, TaskHandle_t xGivingTask, BaseType_t * const pxYieldRequired )
+{
+UBaseType_t uxState;
+BaseType_t xReturn = pdFAIL;
+
+	uxState = pxSemaphore->uxState;
+
+	if( pxSemaphore->uxMaxCount == fsemMUTEX )
+	{
+		if( fsemGET_HOLDER( uxState ) == ( UBaseType_t ) xGivingTask )
+		{
+			/* Back to the base priority before the woken task is compared
+			with it. */
+			*pxYieldRequired = xTaskPriorityDisinherit( xGivingTask );
+			uxState &= fsemWAITING;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else if( fsemGET_COUNT( uxState ) < pxSemaphore->uxMaxCount )
+	{
+		uxState += fsemCOUNT_ONE;
+		xReturn = pdPASS;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xReturn != pdFAIL )
+	{
+		if( listLIST_IS_EMPTY( &( pxSemaphore->xTasksWaitingToTake ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxSemaphore->xTasksWaitingToTake ) ) != pdFALSE )
+			{
+				*pxYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Tasks whose block time expired left the list without clearing the
+		flag, it is cleared by the give that finds the list empty. */
+		if( listLIST_IS_EMPTY( &( pxSemaphore->xTasksWaitingToTake ) ) != pdFALSE )
+		{
+			uxState &= ~fsemWAITING;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxSemaphore->uxState = uxState;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#ifndef portCOMPARE_AND_SWAP
+
+	static BaseType_t prvCompareAndSwap( volatile UBaseType_t *puxDestination, UBaseType_t uxExpected, UBaseType_t uxNew )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+	BaseType_t xReturn = pdFALSE;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( *puxDestination == uxExpected )
+			{
+				*puxDestination = uxNew;
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* portCOMPARE_AND_SWAP */
+/*-----------------------------------------------------------*/
@@ -321,6 +321,37 @@ extern "C" {
 	#define portPOINTER_SIZE_TYPE uint32_t
 #endif
 
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER 0
+#endif
+
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+	#if ( configUSE_TRACE_FACILITY == 0 )
+		#error configUSE_TRACE_RECORDER requires configUSE_TRACE_FACILITY to be set to 1.
+	#endif
+
+	#if !defined( configTRACE_RECORDER_TIMESTAMP ) || !defined( configTRACE_RECORDER_TIMESTAMP_HZ )
+		#error If configUSE_TRACE_RECORDER is 1 then configTRACE_RECORDER_TIMESTAMP() and configTRACE_RECORDER_TIMESTAMP_HZ must be defined to read the free running counter events are time stamped with and give its frequency, see trace_recorder.h.
+	#endif
+
+	/* Defines the trace macros the application has not defined. */
+	#include "trace_recorder.h"
+
+#endif /* configUSE_TRACE_RECORDER */
+
+#ifndef configTRACE_RECORDER_EVENTS
+	#define configTRACE_RECORDER_EVENTS 1024
+#endif
+
+#ifndef configTRACE_RECORDER_NAMES
+	#define configTRACE_RECORDER_NAMES 32
+#endif
+
+#ifndef configTRACE_RECORDER_NAME_LENGTH
+	#define configTRACE_RECORDER_NAME_LENGTH 12
+#endif
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 	/* Used to perform any necessary initialisation - for example, open a file
@@ -617,6 +648,22 @@ extern "C" {
 	#define traceQUEUE_REGISTRY_ADD(xQueue, pcQueueName)
 #endif
 
+#ifndef traceISR_NAME
+	/* Called when cpu_load.c registers an interrupt. */
+	#define traceISR_NAME( uxISR, pcName )
+#endif
+
+#ifndef traceISR_ENTER
+	/* Called on entry to an interrupt accounted by cpu_load.c. */
+	#define traceISR_ENTER()
+#endif
+
+#ifndef traceISR_EXIT
+	/* Called on exit from an interrupt accounted by cpu_load.c, uxISR being the
+	number returned by uxCpuLoadRegisterISR(). */
+	#define traceISR_EXIT( uxISR )
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
 	#define configGENERATE_RUN_TIME_STATS 0
 #endif
@@ -695,6 +742,46 @@ extern "C" {
 	#define configUSE_TIME_SLICING 1
 #endif
 
+#ifndef configUSE_DELAYED_TASK_WHEEL
+	#define configUSE_DELAYED_TASK_WHEEL 0
+#endif
+
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configUSE_CPU_LOAD
+	#define configUSE_CPU_LOAD 0
+#endif
+
+#if ( configUSE_CPU_LOAD == 1 )
+
+	#if ( ( configGENERATE_RUN_TIME_STATS == 0 ) || ( configUSE_TRACE_FACILITY == 0 ) || ( configUSE_TIMERS == 0 ) || ( INCLUDE_xTaskGetIdleTaskHandle == 0 ) )
+		#error configUSE_CPU_LOAD requires configGENERATE_RUN_TIME_STATS, configUSE_TRACE_FACILITY, configUSE_TIMERS and INCLUDE_xTaskGetIdleTaskHandle to be set to 1.
+	#endif
+
+	#ifndef configCPU_LOAD_COUNTER
+		#error If configUSE_CPU_LOAD is 1 then configCPU_LOAD_COUNTER() must be defined to read the free running counter the loads are measured with, see cpu_load.h.
+	#endif
+
+#endif /* configUSE_CPU_LOAD */
+
+#ifndef configCPU_LOAD_MAX_TASKS
+	#define configCPU_LOAD_MAX_TASKS 16
+#endif
+
+#ifndef configCPU_LOAD_MAX_ISRS
+	#define configCPU_LOAD_MAX_ISRS 4
+#endif
+
+#ifndef configCPU_LOAD_MAX_ISR_NESTING
+	#define configCPU_LOAD_MAX_ISR_NESTING 4
+#endif
+
+#ifndef configCPU_LOAD_WINDOW_SECONDS
+	#define configCPU_LOAD_WINDOW_SECONDS 10
+#endif
+
 #ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
 	#define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS 0
 #endif
@@ -711,6 +798,10 @@ extern "C" {
 	#define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()
 #endif
 
+#ifndef portMEMORY_BARRIER
+	#define portMEMORY_BARRIER()
+#endif
+
 #ifndef configUSE_TRACE_FACILITY
 	#define configUSE_TRACE_FACILITY 0
 #endif
@@ -739,6 +830,20 @@ extern "C" {
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef configSUPPORT_STATIC_ALLOCATION
+	/* Defaults to 0 for backward compatibility. */
+	#define configSUPPORT_STATIC_ALLOCATION 0
+#endif
+
+#ifndef configSUPPORT_DYNAMIC_ALLOCATION
+	/* Defaults to 1 for backward compatibility. */
+	#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#endif
+
+#if( ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+	#error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, kernel objects could not be created.
+#endif
+
 #ifndef portTICK_TYPE_IS_ATOMIC
 	#define portTICK_TYPE_IS_ATOMIC 0
 #endif
@@ -0,0 +1,409 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include buffer_pool.h"
+#endif
+
+#include "queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A buffer pool holds a fixed number of buffers of the same size, allocated
+ * once when the pool is created.  Together with message queues, which hold
+ * pointers to buffers rather than copies of the data, they pass large messages
+ * (Ethernet or CAN frames for example) between tasks and interrupts without
+ * copying them.
+ *
+ * The producer takes a buffer from a pool, fills it, and sends it to a message
+ * queue, which transfers ownership of the buffer to the queue.  The consumer
+ * receives the buffer from the queue, and once it has finished with the data
+ * releases the buffer, which returns it to the pool it came from - the pool
+ * does not have to be known by the consumer.  If sending a buffer fails the
+ * sender still owns it, and must release it or try again.
+ *
+ * Taking and releasing a buffer is a few instructions in a critical section.
+ * Taking a buffer from an empty pool, sending to a full message queue and
+ * receiving from an empty message queue can block for a bounded time, and
+ * each has an interrupt safe version.  Message queues are standard queues of
+ * pointers, so only a pointer is copied in and out whatever the buffer size.
+ *
+ * \defgroup BufferPool
+ */
+
+/**
+ * buffer_pool.h
+ *
+ * Type by which buffer pools are referenced.  For example, a call to
+ * xBufferPoolCreate() returns a BufferPoolHandle_t variable that can then be
+ * used as a parameter to pvBufferPoolTake().
+ *
+ * \defgroup BufferPoolHandle_t BufferPoolHandle_t
+ * \ingroup BufferPool
+ */
+typedef void * BufferPoolHandle_t;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ BufferPoolHandle_t xBufferPoolCreate( UBaseType_t uxBufferCount, size_t xBufferSize );
+ </pre>
+ *
+ * Create a pool of uxBufferCount buffers of xBufferSize bytes each.  The pool
+ * and its buffers are allocated from the FreeRTOS heap in one block.  Each
+ * buffer is aligned to portBYTE_ALIGNMENT.  This function cannot be called
+ * from an interrupt.
+ *
+ * @param uxBufferCount The number of buffers in the pool.
+ *
+ * @param xBufferSize The size of each buffer, in bytes.
+ *
+ * @return A handle to the created pool, or NULL if there was insufficient
+ * FreeRTOS heap available to create it.
+ *
+ * Example usage:
+   <pre>
+	#define FRAME_SIZE	1536
+
+	BufferPoolHandle_t xFramePool;
+	QueueHandle_t xRxFrames;
+
+	void vSetup( void )
+	{
+		// Eight frame buffers, and a queue that can hold all of them.
+		xFramePool = xBufferPoolCreate( 8, FRAME_SIZE );
+		xRxFrames = xMessageQueueCreate( 8 );
+	}
+
+	void vEthernetISR( void )
+	{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	uint8_t *pucFrame;
+
+		pucFrame = ( uint8_t * ) pvBufferPoolTakeFromISR( xFramePool );
+		if( pucFrame != NULL )
+		{
+			// Copy the frame out of the DMA descriptor, then pass it on.
+			prvReadFrame( pucFrame, FRAME_SIZE );
+			xMessageQueueSendFromISR( xRxFrames, pucFrame, &xHigherPriorityTaskWoken );
+		}
+
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+
+	void vFrameTask( void *pvParameters )
+	{
+	uint8_t *pucFrame;
+
+		for( ;; )
+		{
+			pucFrame = ( uint8_t * ) pvMessageQueueReceive( xRxFrames, portMAX_DELAY );
+			prvProcessFrame( pucFrame );
+
+			// Return the buffer to xFramePool.
+			vBufferPoolRelease( pucFrame );
+		}
+	}
+   </pre>
+ * \defgroup xBufferPoolCreate xBufferPoolCreate
+ * \ingroup BufferPool
+ */
+BufferPoolHandle_t xBufferPoolCreate( UBaseType_t uxBufferCount, size_t xBufferSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ void *pvBufferPoolTake( BufferPoolHandle_t xPool, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Take a buffer from a pool, the calling task becoming its owner.  This
+ * function cannot be called from an interrupt, see pvBufferPoolTakeFromISR().
+ *
+ * @param xPool The pool the buffer is taken from.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a buffer to be released, should the pool be empty.
+ *
+ * @return A pointer to a buffer of the size given when the pool was created,
+ * or NULL if no buffer became available within xTicksToWait ticks.
+ *
+ * \defgroup pvBufferPoolTake pvBufferPoolTake
+ * \ingroup BufferPool
+ */
+void *pvBufferPoolTake( BufferPoolHandle_t xPool, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ void *pvBufferPoolTakeFromISR( BufferPoolHandle_t xPool );
+ </pre>
+ *
+ * A version of pvBufferPoolTake() that can be called from an interrupt
+ * service routine.  It does not block, and taking a buffer never unblocks a
+ * task.
+ *
+ * @param xPool The pool the buffer is taken from.
+ *
+ * @return A pointer to a buffer, or NULL if the pool is empty.
+ *
+ * \defgroup pvBufferPoolTakeFromISR pvBufferPoolTakeFromISR
+ * \ingroup BufferPool
+ */
+void *pvBufferPoolTakeFromISR( BufferPoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ void vBufferPoolRelease( void *pvBuffer );
+ </pre>
+ *
+ * Return a buffer to the pool it was taken from.  If a task is blocked in
+ * pvBufferPoolTake() on that pool the buffer is handed over to it.  Releasing a buffer never
+ * blocks.  This function cannot be called from an interrupt, see
+ * vBufferPoolReleaseFromISR().
+ *
+ * @param pvBuffer A buffer obtained from pvBufferPoolTake(),
+ * pvBufferPoolTakeFromISR() or a message queue.  The caller must not access it
+ * after the call.
+ *
+ * \defgroup vBufferPoolRelease vBufferPoolRelease
+ * \ingroup BufferPool
+ */
+void vBufferPoolRelease( void *pvBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ void vBufferPoolReleaseFromISR( void *pvBuffer, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of vBufferPoolRelease() that can be called from an interrupt
+ * service routine.
+ *
+ * @param pvBuffer The buffer returned to its pool.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if releasing the buffer
+ * unblocked a task that has a priority above the task that was interrupted,
+ * in which case a context switch should be requested before the interrupt
+ * exits.
+ *
+ * \defgroup vBufferPoolReleaseFromISR vBufferPoolReleaseFromISR
+ * \ingroup BufferPool
+ */
+void vBufferPoolReleaseFromISR( void *pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ size_t xBufferPoolGetBufferSize( BufferPoolHandle_t xPool );
+ </pre>
+ *
+ * @return The size, in bytes, of the buffers of xPool.
+ */
+size_t xBufferPoolGetBufferSize( BufferPoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ UBaseType_t uxBufferPoolGetFreeCount( BufferPoolHandle_t xPool );
+ </pre>
+ *
+ * @return The number of buffers of xPool that are not owned by a task, an
+ * interrupt or a message queue.
+ */
+UBaseType_t uxBufferPoolGetFreeCount( BufferPoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ void vBufferPoolDelete( BufferPoolHandle_t xPool );
+ </pre>
+ *
+ * Delete a pool, and free the memory of its buffers.  All the buffers must
+ * have been released first, and no task may be blocked on the pool.
+ *
+ * @param xPool The pool being deleted.
+ */
+void vBufferPoolDelete( BufferPoolHandle_t xPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ QueueHandle_t xMessageQueueCreate( UBaseType_t uxQueueLength );
+ </pre>
+ *
+ * Create a message queue that can hold uxQueueLength buffers.  A message
+ * queue is a standard queue of pointers, so can also be added to a queue set,
+ * and deleted with vQueueDelete().
+ *
+ * @param uxQueueLength The maximum number of buffers the queue can hold.
+ *
+ * @return A handle to the created queue, or NULL if there was insufficient
+ * FreeRTOS heap available to create it.
+ *
+ * \defgroup xMessageQueueCreate xMessageQueueCreate
+ * \ingroup BufferPool
+ */
+#define xMessageQueueCreate( uxQueueLength ) xQueueCreate( ( uxQueueLength ), ( UBaseType_t ) sizeof( void * ) )
+
+/**
+ * buffer_pool.h
+ *<pre>
+ BaseType_t xMessageQueueSend( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Post a buffer to the back of a message queue.  Only the pointer is copied,
+ * ownership of the buffer passes to the queue if the call succeeds.  This
+ * function cannot be called from an interrupt, see xMessageQueueSendFromISR().
+ *
+ * @param xQueue The message queue the buffer is posted to.
+ *
+ * @param pvBuffer The buffer being posted, normally obtained from a buffer
+ * pool.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.
+ *
+ * @return pdPASS if the buffer was posted, otherwise errQUEUE_FULL, in which
+ * case the caller still owns the buffer.
+ *
+ * \defgroup xMessageQueueSend xMessageQueueSend
+ * \ingroup BufferPool
+ */
+BaseType_t xMessageQueueSend( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ BaseType_t xMessageQueueSendFromISR( QueueHandle_t xQueue, void *pvBuffer, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of xMessageQueueSend() that can be called from an interrupt
+ * service routine.  It does not block.
+ *
+ * @return pdPASS if the buffer was posted, otherwise errQUEUE_FULL, in which
+ * case the caller still owns the buffer.
+ *
+ * \defgroup xMessageQueueSendFromISR xMessageQueueSendFromISR
+ * \ingroup BufferPool
+ */
+BaseType_t xMessageQueueSendFromISR( QueueHandle_t xQueue, void *pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ void *pvMessageQueueReceive( QueueHandle_t xQueue, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Receive a buffer from a message queue, the calling task becoming its owner.
+ * Once finished with, the buffer is normally returned to its pool with
+ * vBufferPoolRelease(), or posted to another message queue.  This function
+ * cannot be called from an interrupt, see pvMessageQueueReceiveFromISR().
+ *
+ * @param xQueue The message queue the buffer is received from.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for a buffer to be posted, should the queue be empty.
+ *
+ * @return The received buffer, or NULL if no buffer was posted within
+ * xTicksToWait ticks.
+ *
+ * \defgroup pvMessageQueueReceive pvMessageQueueReceive
+ * \ingroup BufferPool
+ */
+void *pvMessageQueueReceive( QueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * buffer_pool.h
+ *<pre>
+ void *pvMessageQueueReceiveFromISR( QueueHandle_t xQueue, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of pvMessageQueueReceive() that can be called from an interrupt
+ * service routine.  It does not block.
+ *
+ * @return The received buffer, or NULL if the queue is empty.
+ *
+ * \defgroup pvMessageQueueReceiveFromISR pvMessageQueueReceiveFromISR
+ * \ingroup BufferPool
+ */
+void *pvMessageQueueReceiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BUFFER_POOL_H */
+
@@ -0,0 +1,286 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef CPU_LOAD_H
+#define CPU_LOAD_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include cpu_load.h"
+#endif
+
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The CPU load module reports the share of the processor time taken by each
+ * task and by each accounted interrupt, over the last second and over the last
+ * configCPU_LOAD_WINDOW_SECONDS seconds (10 by default).
+ *
+ * It is built on the run time statistics of tasks.c, clocked by the free
+ * running counter configCPU_LOAD_COUNTER() - on Cortex-M7 the DWT cycle
+ * counter, so the times are in core cycles.  Interrupt service routines that
+ * call vCpuLoadISREnter() on entry and vCpuLoadISRExit() on exit are accounted
+ * separately, their time (nested interrupts excluded) being removed from the
+ * time of the task they interrupted.  For that the run time counter of
+ * tasks.c must be ulCpuLoadGetTaskTime(), which stands still while an
+ * accounted interrupt executes.  FreeRTOSConfig.h then contains, for example:
+ *
+ * <pre>
+   #define configGENERATE_RUN_TIME_STATS				1
+   #define configUSE_CPU_LOAD							1
+   #define configCPU_LOAD_COUNTER()						( DWT->CYCCNT )
+   #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()		vEnableCycleCounter()
+   uint32_t ulCpuLoadGetTaskTime( void );
+   #define portGET_RUN_TIME_COUNTER_VALUE()				ulCpuLoadGetTaskTime()
+   </pre>
+ *
+ * A software timer started by xCpuLoadStart() samples the counters of every
+ * task and interrupt once a second into a ring of configCPU_LOAD_WINDOW_SECONDS
+ * slots.  Loads are returned in hundredths of a percent (10000 is 100%), as a
+ * share of the counter time that elapsed over the window, so the sampling
+ * jitter of the timer task does not bias them.  The counter is 32 bits wide and
+ * sampled every second, it can wrap around freely as long as it does not wrap
+ * twice in one second.
+ *
+ * \defgroup CpuLoad
+ */
+
+/**
+ * cpu_load.h
+ *<pre>
+ BaseType_t xCpuLoadStart( void );
+ </pre>
+ *
+ * Create and start the software timer that samples the run time counters once
+ * a second.  Can be called before or after the scheduler is started, before it
+ * is started the timer command queue must have room for the start command, so
+ * call it before other software timers are started.  The first sample only
+ * sets the starting point, loads are available from the second one on.
+ *
+ * @return pdPASS if the timer was created and started, otherwise pdFAIL.
+ *
+ * \defgroup xCpuLoadStart xCpuLoadStart
+ * \ingroup CpuLoad
+ */
+BaseType_t xCpuLoadStart( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * cpu_load.h
+ *<pre>
+ UBaseType_t uxCpuLoadRegisterISR( const char *pcName );
+ </pre>
+ *
+ * Allocate the accounting record of an interrupt service routine.  Up to
+ * configCPU_LOAD_MAX_ISRS interrupts can be registered, before the interrupt
+ * is enabled.  This function cannot be called from an interrupt.
+ *
+ * @param pcName The name under which the interrupt is reported.  The string is
+ * not copied, it must remain valid.
+ *
+ * @return The number to pass to vCpuLoadISRExit() and ulCpuLoadGetISR().
+ *
+ * \defgroup uxCpuLoadRegisterISR uxCpuLoadRegisterISR
+ * \ingroup CpuLoad
+ */
+UBaseType_t uxCpuLoadRegisterISR( const char *pcName ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/**
+ * cpu_load.h
+ *<pre>
+ void vCpuLoadISREnter( void );
+ void vCpuLoadISRExit( UBaseType_t uxISR );
+ </pre>
+ *
+ * Called first and last in an accounted interrupt service routine.  The two
+ * calls must be paired, interrupts can nest up to
+ * configCPU_LOAD_MAX_ISR_NESTING deep.  The interrupt must not have a priority
+ * above configMAX_SYSCALL_INTERRUPT_PRIORITY, as for the FromISR API functions.
+ *
+ * @param uxISR The number returned by uxCpuLoadRegisterISR() for the
+ * interrupt.
+ *
+ * Example usage:
+   <pre>
+	static UBaseType_t uxTimerISR;
+
+	void vSetupTimer( void )
+	{
+		uxTimerISR = uxCpuLoadRegisterISR( "TC0" );
+		// Configure the timer and enable its interrupt.
+	}
+
+	void TC0_Handler( void )
+	{
+		vCpuLoadISREnter();
+		// Service the interrupt.
+		vCpuLoadISRExit( uxTimerISR );
+	}
+   </pre>
+ * \defgroup vCpuLoadISREnter vCpuLoadISREnter
+ * \ingroup CpuLoad
+ */
+void vCpuLoadISREnter( void ) PRIVILEGED_FUNCTION;
+void vCpuLoadISRExit( UBaseType_t uxISR ) PRIVILEGED_FUNCTION;
+
+/**
+ * cpu_load.h
+ *<pre>
+ uint32_t ulCpuLoadGetTaskTime( void );
+ </pre>
+ *
+ * configCPU_LOAD_COUNTER() less the time spent in accounted interrupts, the
+ * time base of the task run time counters (portGET_RUN_TIME_COUNTER_VALUE()).
+ *
+ * \defgroup ulCpuLoadGetTaskTime ulCpuLoadGetTaskTime
+ * \ingroup CpuLoad
+ */
+uint32_t ulCpuLoadGetTaskTime( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * cpu_load.h
+ *<pre>
+ uint32_t ulCpuLoadGetTotal( UBaseType_t uxSeconds );
+ uint32_t ulCpuLoadGetTask( TaskHandle_t xTask, UBaseType_t uxSeconds );
+ uint32_t ulCpuLoadGetISR( UBaseType_t uxISR, UBaseType_t uxSeconds );
+ </pre>
+ *
+ * The load of the processor (the time not spent in the idle task), of a task
+ * or of an accounted interrupt, over the last uxSeconds samples.  These
+ * functions cannot be called from an interrupt.
+ *
+ * @param xTask The task, NULL for the calling task.  A task created since the
+ * last sample has no load yet.
+ *
+ * @param uxISR The number returned by uxCpuLoadRegisterISR().
+ *
+ * @param uxSeconds The window, from 1 to configCPU_LOAD_WINDOW_SECONDS.  Until
+ * that many samples are taken the window covers the samples taken.
+ *
+ * @return The load in hundredths of a percent, from 0 to 10000.
+ *
+ * Example usage:
+   <pre>
+	uint32_t ulLoad = ulCpuLoadGetTotal( 10 );
+
+	printf( "CPU load over 10s: %u.%02u%%\r\n", ( unsigned ) ( ulLoad / 100 ), ( unsigned ) ( ulLoad % 100 ) );
+   </pre>
+ * \defgroup ulCpuLoadGetTotal ulCpuLoadGetTotal
+ * \ingroup CpuLoad
+ */
+uint32_t ulCpuLoadGetTotal( UBaseType_t uxSeconds ) PRIVILEGED_FUNCTION;
+uint32_t ulCpuLoadGetTask( TaskHandle_t xTask, UBaseType_t uxSeconds ) PRIVILEGED_FUNCTION;
+uint32_t ulCpuLoadGetISR( UBaseType_t uxISR, UBaseType_t uxSeconds ) PRIVILEGED_FUNCTION;
+
+/**
+ * cpu_load.h
+ *<pre>
+ void vCpuLoadGetStats( char *pcWriteBuffer, size_t xBufferLength );
+ </pre>
+ *
+ * Write a table of the load over the last second and over the whole window of
+ * every task and accounted interrupt, and of the processor, as seen by the
+ * last sample, one line each.  For example:
+ *
+ * <pre>
+   Name              1s     10s
+   IDLE          81.42%  80.97%
+   Check          0.03%   0.03%
+   ...
+   [Tick]         0.61%   0.60%
+   Total         18.58%  19.03%
+   </pre>
+ *
+ * The names of interrupts are written in brackets, the columns are separated
+ * by tabs.
+ *
+ * Only available when configUSE_STATS_FORMATTING_FUNCTIONS is greater than 0.
+ * Like vTaskGetRunTimeStats() it depends on sprintf(), and is meant to be
+ * called from a task to dump the loads on a console.  Lines that do not fit in
+ * the buffer are left out.
+ *
+ * @param pcWriteBuffer The buffer the table is written to, as ASCII text.
+ *
+ * @param xBufferLength The size of the buffer in bytes, about
+ * configMAX_TASK_NAME_LEN + 24 bytes are needed per line.
+ *
+ * \defgroup vCpuLoadGetStats vCpuLoadGetStats
+ * \ingroup CpuLoad
+ */
+void vCpuLoadGetStats( char *pcWriteBuffer, size_t xBufferLength ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_LOAD_H */
+
@@ -0,0 +1,326 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef FAST_SEMAPHORE_H
+#define FAST_SEMAPHORE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include fast_semaphore.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Fast semaphores and mutexes are a lighter alternative to the queue based
+ * semaphores of semphr.h.  Their state is a single word updated with an
+ * atomic compare and swap (portCOMPARE_AND_SWAP(), load and store exclusive
+ * on Cortex-M), so a take that finds the semaphore available, or a give that
+ * finds no task waiting, neither enters a critical section nor calls into the
+ * scheduler.  Only a take that has to block, and the give that has to wake a
+ * task, take the kernel path, which places the task on a priority ordered
+ * event list in the way the queues do.
+ *
+ * A fast mutex holds the handle of the task holding it.  A task blocking on a
+ * fast mutex raises the priority of the holder to its own, the holder going
+ * back to its base priority when it gives the mutex back, as with the mutexes
+ * of semphr.h.  Fast mutexes are not recursive and cannot be used from an
+ * interrupt.
+ *
+ * A task woken by a give takes the semaphore when it runs, so a task that
+ * calls xFastSemaphoreTake() in the meantime can take it first, in which case
+ * the woken task blocks again for the rest of its block time.
+ *
+ * Ports that do not define portCOMPARE_AND_SWAP() fall back to masking
+ * interrupts around the update of the state word.
+ *
+ * \defgroup FastSemaphore
+ */
+
+/**
+ * fast_semaphore.h
+ *
+ * Type by which fast semaphores and mutexes are referenced.  For example, a
+ * call to xFastSemaphoreCreateBinary() returns a FastSemaphoreHandle_t
+ * variable that can then be used as a parameter to xFastSemaphoreTake(),
+ * xFastSemaphoreGive(), etc.
+ *
+ * \defgroup FastSemaphoreHandle_t FastSemaphoreHandle_t
+ * \ingroup FastSemaphore
+ */
+typedef void * FastSemaphoreHandle_t;
+
+/**
+ * fast_semaphore.h
+ *<pre>
+ FastSemaphoreHandle_t xFastSemaphoreCreateCounting( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount );
+ </pre>
+ *
+ * Create a counting semaphore from the FreeRTOS heap.  This function cannot
+ * be called from an interrupt.
+ *
+ * @param uxMaxCount The count at which xFastSemaphoreGive() fails.
+ *
+ * @param uxInitialCount The count of the semaphore once created.
+ *
+ * @return A handle to the created semaphore, or NULL if there was
+ * insufficient FreeRTOS heap available to create it.
+ *
+ * \defgroup xFastSemaphoreCreateCounting xFastSemaphoreCreateCounting
+ * \ingroup FastSemaphore
+ */
+FastSemaphoreHandle_t xFastSemaphoreCreateCounting( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_semaphore.h
+ *<pre>
+ FastSemaphoreHandle_t xFastSemaphoreCreateBinary( void );
+ </pre>
+ *
+ * Create a binary semaphore from the FreeRTOS heap.  The semaphore is created
+ * empty, it must be given before it can be taken.
+ *
+ * Example usage:
+   <pre>
+	// The DMA complete interrupt signals the task waiting for the transfer.
+	FastSemaphoreHandle_t xDmaDone;
+
+	void vSetup( void )
+	{
+		xDmaDone = xFastSemaphoreCreateBinary();
+	}
+
+	void vDmaISR( void )
+	{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		prvClearDmaInterrupt();
+		xFastSemaphoreGiveFromISR( xDmaDone, &xHigherPriorityTaskWoken );
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+
+	void vTransfer( void )
+	{
+		prvStartDma();
+		if( xFastSemaphoreTake( xDmaDone, pdMS_TO_TICKS( 10 ) ) != pdPASS )
+		{
+			prvAbortDma();
+		}
+	}
+   </pre>
+ * \defgroup xFastSemaphoreCreateBinary xFastSemaphoreCreateBinary
+ * \ingroup FastSemaphore
+ */
+#define xFastSemaphoreCreateBinary() xFastSemaphoreCreateCounting( ( UBaseType_t ) 1, ( UBaseType_t ) 0 )
+
+/**
+ * fast_semaphore.h
+ *<pre>
+ FastSemaphoreHandle_t xFastSemaphoreCreateMutex( void );
+ </pre>
+ *
+ * Create a mutex with priority inheritance from the FreeRTOS heap.  The mutex
+ * is created available.
+ *
+ * Example usage:
+   <pre>
+	FastSemaphoreHandle_t xBusLock;
+
+	void vSetup( void )
+	{
+		xBusLock = xFastSemaphoreCreateMutex();
+	}
+
+	void vWriteRegister( uint8_t ucRegister, uint8_t ucValue )
+	{
+		xFastSemaphoreTake( xBusLock, portMAX_DELAY );
+		prvBusWrite( ucRegister, ucValue );
+		xFastSemaphoreGive( xBusLock );
+	}
+   </pre>
+ * \defgroup xFastSemaphoreCreateMutex xFastSemaphoreCreateMutex
+ * \ingroup FastSemaphore
+ */
+FastSemaphoreHandle_t xFastSemaphoreCreateMutex( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_semaphore.h
+ *<pre>
+ void vFastSemaphoreDelete( FastSemaphoreHandle_t xSemaphore );
+ </pre>
+ *
+ * Delete a fast semaphore or mutex.  No task may be blocked on it.
+ *
+ * \defgroup vFastSemaphoreDelete vFastSemaphoreDelete
+ * \ingroup FastSemaphore
+ */
+void vFastSemaphoreDelete( FastSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_semaphore.h
+ *<pre>
+ BaseType_t xFastSemaphoreTake( FastSemaphoreHandle_t xSemaphore, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Take a fast semaphore or mutex.  This function cannot be called from an
+ * interrupt, see xFastSemaphoreTakeFromISR().
+ *
+ * @param xSemaphore The semaphore or mutex taken.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for the semaphore to be given, or for the mutex to be released.
+ * Setting xTicksToWait to portMAX_DELAY blocks indefinitely (provided
+ * INCLUDE_vTaskSuspend is set to 1).
+ *
+ * @return pdPASS if the semaphore or mutex was taken, pdFAIL if the block
+ * time expired first.
+ *
+ * \defgroup xFastSemaphoreTake xFastSemaphoreTake
+ * \ingroup FastSemaphore
+ */
+BaseType_t xFastSemaphoreTake( FastSemaphoreHandle_t xSemaphore, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_semaphore.h
+ *<pre>
+ BaseType_t xFastSemaphoreGive( FastSemaphoreHandle_t xSemaphore );
+ </pre>
+ *
+ * Give a fast semaphore, or release a fast mutex held by the calling task.
+ * This function cannot be called from an interrupt, see
+ * xFastSemaphoreGiveFromISR().
+ *
+ * @return pdPASS if the semaphore was given, pdFAIL if its count was already
+ * at its maximum or the mutex is not held by the calling task.
+ *
+ * \defgroup xFastSemaphoreGive xFastSemaphoreGive
+ * \ingroup FastSemaphore
+ */
+BaseType_t xFastSemaphoreGive( FastSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_semaphore.h
+ *<pre>
+ BaseType_t xFastSemaphoreTakeFromISR( FastSemaphoreHandle_t xSemaphore );
+ </pre>
+ *
+ * A version of xFastSemaphoreTake() that can be called from an interrupt
+ * service routine.  It does not block, and never enters the kernel as taking
+ * a semaphore cannot wake a task.  It cannot be used on a mutex.
+ *
+ * @return pdPASS if the semaphore was taken, pdFAIL if its count was 0.
+ *
+ * \defgroup xFastSemaphoreTakeFromISR xFastSemaphoreTakeFromISR
+ * \ingroup FastSemaphore
+ */
+BaseType_t xFastSemaphoreTakeFromISR( FastSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_semaphore.h
+ *<pre>
+ BaseType_t xFastSemaphoreGiveFromISR( FastSemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of xFastSemaphoreGive() that can be called from an interrupt
+ * service routine.  It cannot be used on a mutex.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the give woke a task that
+ * has a priority above the task that was interrupted, in which case a context
+ * switch should be requested before the interrupt exits.
+ *
+ * @return pdPASS if the semaphore was given, pdFAIL if its count was already
+ * at its maximum.
+ *
+ * \defgroup xFastSemaphoreGiveFromISR xFastSemaphoreGiveFromISR
+ * \ingroup FastSemaphore
+ */
+BaseType_t xFastSemaphoreGiveFromISR( FastSemaphoreHandle_t xSemaphore, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * fast_semaphore.h
+ *<pre>
+ UBaseType_t uxFastSemaphoreGetCount( FastSemaphoreHandle_t xSemaphore );
+ </pre>
+ *
+ * @return The count of a semaphore, or 1 if a mutex is available and 0 if it
+ * is held.
+ *
+ * \defgroup uxFastSemaphoreGetCount uxFastSemaphoreGetCount
+ * \ingroup FastSemaphore
+ */
+UBaseType_t uxFastSemaphoreGetCount( FastSemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAST_SEMAPHORE_H */
+
@@ -0,0 +1,240 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef MESSAGE_BUFFER_H
+#define MESSAGE_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include message_buffer.h"
+#endif
+
+/* Message buffers are built on stream buffers. */
+#include "stream_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A message buffer passes variable length messages from a single writer (a
+ * task or an interrupt) to a single reader (a task or an interrupt).  Each
+ * message is stored in a stream buffer behind its length (a size_t), and is
+ * always written and read whole: a message that does not fit is not written,
+ * and a read into a buffer too small for the next message reads nothing.
+ *
+ * The same restrictions as stream buffers apply: one writer and one reader at
+ * a time, and a task blocked on a message buffer is woken through its direct
+ * to task notification.  A task blocked reading is woken by each message
+ * written.  See stream_buffer.h.
+ *
+ * \defgroup MessageBuffer
+ */
+
+/**
+ * message_buffer.h
+ *
+ * Type by which message buffers are referenced.
+ *
+ * \defgroup MessageBufferHandle_t MessageBufferHandle_t
+ * \ingroup MessageBuffer
+ */
+typedef void * MessageBufferHandle_t;
+
+/**
+ * message_buffer.h
+ *<pre>
+ MessageBufferHandle_t xMessageBufferCreate( size_t xBufferSizeBytes );
+ </pre>
+ *
+ * Create a message buffer of xBufferSizeBytes bytes.  Each message takes its
+ * length plus sizeof( size_t ) bytes of the buffer.  This function cannot be
+ * called from an interrupt.
+ *
+ * @return A handle to the created message buffer, or NULL if there was
+ * insufficient FreeRTOS heap available to create it.
+ *
+ * Example usage:
+   <pre>
+	MessageBufferHandle_t xCanFrames;
+
+	void vSetup( void )
+	{
+		xCanFrames = xMessageBufferCreate( 512 );
+	}
+
+	void vCanISR( void )
+	{
+	CanFrame_t xFrame;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		prvReadMailbox( &xFrame );
+
+		// Only the bytes of the frame in use are stored.
+		xMessageBufferSendFromISR( xCanFrames, &xFrame, offsetof( CanFrame_t, ucData ) + xFrame.ucLength, &xHigherPriorityTaskWoken );
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+
+	void vCanTask( void *pvParameters )
+	{
+	CanFrame_t xFrame;
+
+		for( ;; )
+		{
+			if( xMessageBufferReceive( xCanFrames, &xFrame, sizeof( xFrame ), portMAX_DELAY ) != 0 )
+			{
+				prvProcessFrame( &xFrame );
+			}
+		}
+	}
+   </pre>
+ * \defgroup xMessageBufferCreate xMessageBufferCreate
+ * \ingroup MessageBuffer
+ */
+#define xMessageBufferCreate( xBufferSizeBytes ) ( MessageBufferHandle_t ) xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( size_t ) 0, pdTRUE )
+
+/**
+ * message_buffer.h
+ *<pre>
+ size_t xMessageBufferSend( MessageBufferHandle_t xMessageBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait );
+ size_t xMessageBufferSendFromISR( MessageBufferHandle_t xMessageBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Write one message.  The task version blocks for up to xTicksToWait ticks
+ * waiting for room for the whole message, the interrupt version does not
+ * block.
+ *
+ * @return xDataLengthBytes if the message was written, 0 if it did not fit.
+ *
+ * \defgroup xMessageBufferSend xMessageBufferSend
+ * \ingroup MessageBuffer
+ */
+#define xMessageBufferSend( xMessageBuffer, pvTxData, xDataLengthBytes, xTicksToWait ) xStreamBufferSend( ( StreamBufferHandle_t ) ( xMessageBuffer ), ( pvTxData ), ( xDataLengthBytes ), ( xTicksToWait ) )
+#define xMessageBufferSendFromISR( xMessageBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferSendFromISR( ( StreamBufferHandle_t ) ( xMessageBuffer ), ( pvTxData ), ( xDataLengthBytes ), ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * message_buffer.h
+ *<pre>
+ size_t xMessageBufferReceive( MessageBufferHandle_t xMessageBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait );
+ size_t xMessageBufferReceiveFromISR( MessageBufferHandle_t xMessageBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Read the next message.  The task version blocks for up to xTicksToWait
+ * ticks waiting for a message, the interrupt version does not block.
+ *
+ * @return The length of the message read, 0 if there was no message or if
+ * the next message is longer than xBufferLengthBytes, in which case it stays
+ * in the buffer (see xMessageBufferNextLengthBytes()).
+ *
+ * \defgroup xMessageBufferReceive xMessageBufferReceive
+ * \ingroup MessageBuffer
+ */
+#define xMessageBufferReceive( xMessageBuffer, pvRxData, xBufferLengthBytes, xTicksToWait ) xStreamBufferReceive( ( StreamBufferHandle_t ) ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( xTicksToWait ) )
+#define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferReceiveFromISR( ( StreamBufferHandle_t ) ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * message_buffer.h
+ *<pre>
+ size_t xMessageBufferNextLengthBytes( MessageBufferHandle_t xMessageBuffer );
+ </pre>
+ *
+ * @return The length of the next message, 0 if the buffer is empty.
+ *
+ * \defgroup xMessageBufferNextLengthBytes xMessageBufferNextLengthBytes
+ * \ingroup MessageBuffer
+ */
+#define xMessageBufferNextLengthBytes( xMessageBuffer ) xStreamBufferNextMessageLength( ( StreamBufferHandle_t ) ( xMessageBuffer ) )
+
+/**
+ * message_buffer.h
+ *<pre>
+ void vMessageBufferDelete( MessageBufferHandle_t xMessageBuffer );
+ BaseType_t xMessageBufferReset( MessageBufferHandle_t xMessageBuffer );
+ size_t xMessageBufferSpaceAvailable( MessageBufferHandle_t xMessageBuffer );
+ BaseType_t xMessageBufferIsEmpty( MessageBufferHandle_t xMessageBuffer );
+ BaseType_t xMessageBufferIsFull( MessageBufferHandle_t xMessageBuffer );
+ </pre>
+ *
+ * As the stream buffer functions of the same name.  The space available
+ * includes the sizeof( size_t ) bytes the length of the next message takes.
+ *
+ * \defgroup vMessageBufferDelete vMessageBufferDelete
+ * \ingroup MessageBuffer
+ */
+#define vMessageBufferDelete( xMessageBuffer ) vStreamBufferDelete( ( StreamBufferHandle_t ) ( xMessageBuffer ) )
+#define xMessageBufferReset( xMessageBuffer ) xStreamBufferReset( ( StreamBufferHandle_t ) ( xMessageBuffer ) )
+#define xMessageBufferSpaceAvailable( xMessageBuffer ) xStreamBufferSpacesAvailable( ( StreamBufferHandle_t ) ( xMessageBuffer ) )
+#define xMessageBufferIsEmpty( xMessageBuffer ) xStreamBufferIsEmpty( ( StreamBufferHandle_t ) ( xMessageBuffer ) )
+#define xMessageBufferIsFull( xMessageBuffer ) xStreamBufferIsFull( ( StreamBufferHandle_t ) ( xMessageBuffer ) )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MESSAGE_BUFFER_H */
+
@@ -166,6 +166,70 @@ void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+/* Number of allocation size classes counted by vPortGetHeapStats().  Class 0
+counts requests below 32 bytes, each following class requests up to twice the
+size of the previous one, and the last class every larger request. */
+#define portHEAP_HISTOGRAM_BINS		( 10 )
+
+/* Used by vPortGetHeapStats(). */
+typedef struct xHEAP_STATS
+{
+	size_t xAvailableHeapSpaceInBytes;		/*< Total free bytes, as xPortGetFreeHeapSize(). */
+	size_t xSizeOfLargestFreeBlockInBytes;	/*< Largest allocation that can succeed, block header included. */
+	size_t xSizeOfSmallestFreeBlockInBytes;
+	size_t xNumberOfFreeBlocks;
+	size_t xMinimumEverFreeBytesRemaining;	/*< As xPortGetMinimumEverFreeHeapSize(). */
+	size_t xNumberOfSuccessfulAllocations;
+	size_t xNumberOfSuccessfulFrees;
+	UBaseType_t uxFragmentationPercent;		/*< Share of the free bytes outside the largest free block. */
+	size_t xAllocationHistogram[ portHEAP_HISTOGRAM_BINS ];	/*< Successful allocations per requested size class. */
+} HeapStats_t;
+
+/*
+ * Fills *pxHeapStats with the state of the heap, including how fragmented the
+ * free space is.  Provided by heap_4.c, heap_5.c and heap_tlsf.c.  The free
+ * blocks are walked with the scheduler suspended, so this is not meant to be
+ * called from time critical code.
+ */
+void vPortGetHeapStats( HeapStats_t *pxHeapStats ) PRIVILEGED_FUNCTION;
+
+/* Memory regions of heap_tlsf.c, as passed to pvPortMallocRegion().  The
+default region is the ucHeap array used by pvPortMalloc(), the others are what
+the application adds with vPortAddHeapRegion(). */
+#define portHEAP_REGION_DEFAULT		( 0 )	/*< Internal SRAM, cacheable. */
+#define portHEAP_REGION_FAST		( 1 )	/*< Tightly coupled memory (DTCM), for stacks and hot data. */
+#define portHEAP_REGION_DMA			( 2 )	/*< Non cacheable memory a DMA can access. */
+#define portHEAP_REGION_BULK		( 3 )	/*< External memory (SDRAM), for large buffers. */
+#define portHEAP_REGION_COUNT		( 4 )
+
+/*
+ * Hands the xSizeInBytes bytes at pucStartAddress to heap_tlsf.c as region
+ * uxRegion, one of the portHEAP_REGION_xxx values.  Each region can be added
+ * once, at any time - external memory once its controller is set up.  The
+ * default region can only be added before the first allocation, else it is
+ * the ucHeap array.
+ */
+void vPortAddHeapRegion( UBaseType_t uxRegion, uint8_t *pucStartAddress, size_t xSizeInBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * As pvPortMalloc(), from the region uxRegionHint.  An allocation that does
+ * not fit in the fast or the bulk region, or in a region not added, is taken
+ * from the default region.  portHEAP_REGION_DMA allocations never are, as the
+ * default region is cached.  vPortFree() frees blocks of any region.  Task
+ * stacks are placed by defining pvPortMallocAligned() in FreeRTOSConfig.h, for
+ * example:
+ *
+ * #define pvPortMallocAligned( x, puxStackBuffer ) ( ( ( puxStackBuffer ) == NULL ) ? ( pvPortMallocRegion( ( x ), portHEAP_REGION_FAST ) ) : ( puxStackBuffer ) )
+ */
+void *pvPortMallocRegion( size_t xSize, UBaseType_t uxRegionHint ) PRIVILEGED_FUNCTION;
+
+/*
+ * As vPortGetHeapStats(), for the region uxRegion.  xPortGetFreeHeapSize(),
+ * xPortGetMinimumEverFreeHeapSize() and vPortGetHeapStats() report the default
+ * region.
+ */
+void vPortGetHeapRegionStats( UBaseType_t uxRegion, HeapStats_t *pxHeapStats ) PRIVILEGED_FUNCTION;
+
 /*
  * Setup the hardware ready for the scheduler to take control.  This generally
  * sets up a tick interrupt and sets timers for the correct tick frequency.
@@ -0,0 +1,327 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include priority_queue.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Priority queues hold items by copy, like the queues of queue.h, but each
+ * item is posted with a priority, and a receive always returns the item of
+ * the highest priority held, items of the same priority being received in
+ * the order they were posted.  An urgent command posted behind bulk traffic is
+ * received next, rather than after everything queued before it.
+ *
+ * The items are kept in a binary heap bounded by the queue length, so posting
+ * and receiving an item both take O(log n) steps, n being the number of items
+ * held, plus the copy of the item in or out.  Both are performed in a critical
+ * section, as with the queues.
+ *
+ * Tasks blocked posting to a full queue, or receiving from an empty queue, are
+ * woken in priority order.  Each function has an interrupt safe version.
+ *
+ * \defgroup PriorityQueue
+ */
+
+/**
+ * priority_queue.h
+ *
+ * Type by which priority queues are referenced.  For example, a call to
+ * xPriorityQueueCreate() returns a PriorityQueueHandle_t variable that can
+ * then be used as a parameter to xPriorityQueueSend(), xPriorityQueueReceive(),
+ * etc.
+ *
+ * \defgroup PriorityQueueHandle_t PriorityQueueHandle_t
+ * \ingroup PriorityQueue
+ */
+typedef void * PriorityQueueHandle_t;
+
+/**
+ * priority_queue.h
+ *<pre>
+ PriorityQueueHandle_t xPriorityQueueCreate( UBaseType_t uxQueueLength, UBaseType_t uxItemSize );
+ </pre>
+ *
+ * Create a priority queue from the FreeRTOS heap.  This function cannot be
+ * called from an interrupt.
+ *
+ * @param uxQueueLength The maximum number of items the queue can hold.
+ *
+ * @param uxItemSize The size, in bytes, of each item.
+ *
+ * @return A handle to the created queue, or NULL if there was insufficient
+ * FreeRTOS heap available to create it.
+ *
+ * Example usage:
+   <pre>
+ typedef struct
+ {
+	uint8_t ucCommand;
+	uint8_t ucParameters[ 7 ];
+ } Command_t;
+
+ #define URGENT		( 2 )
+ #define NORMAL		( 1 )
+ #define BULK		( 0 )
+
+ PriorityQueueHandle_t xCommands;
+
+ void vAFunction( void )
+ {
+	// Hold up to 16 commands.
+	xCommands = xPriorityQueueCreate( 16, sizeof( Command_t ) );
+	configASSERT( xCommands );
+ }
+
+ void vHostLinkTask( void *pvParameters )
+ {
+ Command_t xCommand;
+
+	for( ;; )
+	{
+		vReadCommand( &xCommand );
+
+		// A stop command goes before any transfer already queued.
+		xPriorityQueueSend( xCommands, &xCommand, ( xCommand.ucCommand == STOP ) ? URGENT : BULK, portMAX_DELAY );
+	}
+ }
+
+ void vCommandTask( void *pvParameters )
+ {
+ Command_t xCommand;
+
+	for( ;; )
+	{
+		if( xPriorityQueueReceive( xCommands, &xCommand, NULL, portMAX_DELAY ) == pdPASS )
+		{
+			vExecuteCommand( &xCommand );
+		}
+	}
+ }
+ </pre>
+ * \defgroup xPriorityQueueCreate xPriorityQueueCreate
+ * \ingroup PriorityQueue
+ */
+PriorityQueueHandle_t xPriorityQueueCreate( UBaseType_t uxQueueLength, UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * priority_queue.h
+ *<pre>
+ void vPriorityQueueDelete( PriorityQueueHandle_t xQueue );
+ </pre>
+ *
+ * Delete a priority queue created by xPriorityQueueCreate(), freeing its
+ * memory.  No task must be blocked on the queue.
+ *
+ * @param xQueue The handle of the queue to delete.
+ *
+ * \defgroup vPriorityQueueDelete vPriorityQueueDelete
+ * \ingroup PriorityQueue
+ */
+void vPriorityQueueDelete( PriorityQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * priority_queue.h
+ *<pre>
+ BaseType_t xPriorityQueueSend( PriorityQueueHandle_t xQueue, const void *pvItemToQueue, UBaseType_t uxPriority, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Post an item to a priority queue.  The item is copied into the queue.  This
+ * function cannot be called from an interrupt, see
+ * xPriorityQueueSendFromISR().
+ *
+ * @param xQueue The handle of the queue on which the item is to be posted.
+ *
+ * @param pvItemToQueue A pointer to the item to post.
+ *
+ * @param uxPriority The priority of the item, higher values being received
+ * first.  Any value of a UBaseType_t can be used.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.  The
+ * call will return immediately if this is set to 0.
+ *
+ * @return pdPASS if the item was posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xPriorityQueueSend xPriorityQueueSend
+ * \ingroup PriorityQueue
+ */
+BaseType_t xPriorityQueueSend( PriorityQueueHandle_t xQueue, const void * const pvItemToQueue, UBaseType_t uxPriority, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * priority_queue.h
+ *<pre>
+ BaseType_t xPriorityQueueSendFromISR( PriorityQueueHandle_t xQueue, const void *pvItemToQueue, UBaseType_t uxPriority, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of xPriorityQueueSend() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xQueue The handle of the queue on which the item is to be posted.
+ *
+ * @param pvItemToQueue A pointer to the item to post.
+ *
+ * @param uxPriority The priority of the item.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if posting the item woke a
+ * task of a higher priority than the task that was interrupted, in which case
+ * a context switch should be requested before the interrupt is exited.
+ *
+ * @return pdPASS if the item was posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xPriorityQueueSendFromISR xPriorityQueueSendFromISR
+ * \ingroup PriorityQueue
+ */
+BaseType_t xPriorityQueueSendFromISR( PriorityQueueHandle_t xQueue, const void * const pvItemToQueue, UBaseType_t uxPriority, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * priority_queue.h
+ *<pre>
+ BaseType_t xPriorityQueueReceive( PriorityQueueHandle_t xQueue, void *pvBuffer, UBaseType_t *puxPriority, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Receive the item of the highest priority from a priority queue, the oldest
+ * one if several have that priority.  This function cannot be called from an
+ * interrupt, see xPriorityQueueReceiveFromISR().
+ *
+ * @param xQueue The handle of the queue from which the item is to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the item is copied.
+ *
+ * @param puxPriority Set to the priority the item was posted with, unless
+ * NULL.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive, should the queue be empty.  The call will
+ * return immediately if this is set to 0.
+ *
+ * @return pdPASS if an item was received, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xPriorityQueueReceive xPriorityQueueReceive
+ * \ingroup PriorityQueue
+ */
+BaseType_t xPriorityQueueReceive( PriorityQueueHandle_t xQueue, void * const pvBuffer, UBaseType_t * const puxPriority, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * priority_queue.h
+ *<pre>
+ BaseType_t xPriorityQueueReceiveFromISR( PriorityQueueHandle_t xQueue, void *pvBuffer, UBaseType_t *puxPriority, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of xPriorityQueueReceive() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xQueue The handle of the queue from which the item is to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the item is copied.
+ *
+ * @param puxPriority Set to the priority the item was posted with, unless
+ * NULL.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if receiving the item woke a
+ * task of a higher priority than the task that was interrupted.
+ *
+ * @return pdPASS if an item was received, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xPriorityQueueReceiveFromISR xPriorityQueueReceiveFromISR
+ * \ingroup PriorityQueue
+ */
+BaseType_t xPriorityQueueReceiveFromISR( PriorityQueueHandle_t xQueue, void * const pvBuffer, UBaseType_t * const puxPriority, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * priority_queue.h
+ *<pre>
+ UBaseType_t uxPriorityQueueMessagesWaiting( PriorityQueueHandle_t xQueue );
+ </pre>
+ *
+ * @param xQueue The handle of the queue being queried.
+ *
+ * @return The number of items held by the queue.
+ *
+ * \defgroup uxPriorityQueueMessagesWaiting uxPriorityQueueMessagesWaiting
+ * \ingroup PriorityQueue
+ */
+UBaseType_t uxPriorityQueueMessagesWaiting( PriorityQueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIORITY_QUEUE_H */
+
@@ -75,6 +75,9 @@
 	#error "include FreeRTOS.h" must appear in source files before "include queue.h"
 #endif
 
+/* List_t is needed by StaticQueue_t. */
+#include "list.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -101,6 +104,41 @@ typedef void * QueueSetHandle_t;
  */
 typedef void * QueueSetMemberHandle_t;
 
+/*
+ * The memory of a queue, semaphore or mutex created by one of the ...Static()
+ * functions.  The members mirror the queue structure kept in queue.c, which is
+ * not visible outside of it, so the application can reserve one without
+ * knowing its content.  They are not meant to be accessed.
+ */
+typedef struct xSTATIC_QUEUE
+{
+	void *pvDummy1[ 3 ];
+
+	union
+	{
+		void *pvDummy2;
+		UBaseType_t uxDummy2;
+	} u;
+
+	List_t xDummy3[ 2 ];
+	UBaseType_t uxDummy4[ 3 ];
+	BaseType_t xDummy5[ 2 ];
+
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t uxDummy6;
+		uint8_t ucDummy7;
+	#endif
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+		void *pvDummy8;
+	#endif
+
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		uint8_t ucDummy9;
+	#endif
+
+} StaticQueue_t;
+
 /* For internal use only. */
 #define	queueSEND_TO_BACK		( ( BaseType_t ) 0 )
 #define	queueSEND_TO_FRONT		( ( BaseType_t ) 1 )
@@ -172,6 +210,59 @@ typedef void * QueueSetMemberHandle_t;
  */
 #define xQueueCreate( uxQueueLength, uxItemSize ) xQueueGenericCreate( uxQueueLength, uxItemSize, queueQUEUE_TYPE_BASE )
 
+/**
+ * queue. h
+ * <pre>
+ QueueHandle_t xQueueCreateStatic(
+							  UBaseType_t uxQueueLength,
+							  UBaseType_t uxItemSize,
+							  uint8_t *pucQueueStorageBuffer,
+							  StaticQueue_t *pxQueueBuffer
+						  );
+ * </pre>
+ *
+ * As xQueueCreate(), but nothing is allocated: the queue structure is held in
+ * pxQueueBuffer and the items in pucQueueStorageBuffer, both provided by the
+ * application and left to it when the queue is deleted.
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * this macro to be available.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ *
+ * @param pucQueueStorageBuffer At least ( uxQueueLength * uxItemSize ) bytes
+ * to hold the items, or NULL if uxItemSize is 0.
+ *
+ * @param pxQueueBuffer The StaticQueue_t that will hold the queue structure.
+ *
+ * @return The handle of the queue, or NULL if pxQueueBuffer is NULL.
+ *
+ * Example usage:
+   <pre>
+ #define QUEUE_LENGTH	10
+ #define ITEM_SIZE		sizeof( uint32_t )
+
+ static StaticQueue_t xQueueBuffer;
+ static uint8_t ucQueueStorage[ QUEUE_LENGTH * ITEM_SIZE ];
+
+ void vATask( void *pvParameters )
+ {
+ QueueHandle_t xQueue;
+
+	// Create a queue capable of containing 10 uint32_t values.
+	xQueue = xQueueCreateStatic( QUEUE_LENGTH, ITEM_SIZE, ucQueueStorage, &xQueueBuffer );
+
+	// ... Rest of task code.
+ }
+ </pre>
+ * \defgroup xQueueCreateStatic xQueueCreateStatic
+ * \ingroup QueueManagement
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer ) xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), queueQUEUE_TYPE_BASE )
+#endif
+
 /**
  * queue. h
  * <pre>
@@ -1429,6 +1520,222 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherP
  */
 BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue, void * const pvBuffer, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueSendMultiple(
+								 QueueHandle_t xQueue,
+								 const void *pvItemsToQueue,
+								 UBaseType_t uxItemCount,
+								 TickType_t xTicksToWait
+							 );
+ * </pre>
+ *
+ * Post up to uxItemCount items to the back of a queue, in a single critical
+ * section.  The items are copied in the order they are stored at
+ * pvItemsToQueue, as many as there is space for.  The calling task only blocks
+ * if there is no space at all, after which it posts as many items as there is
+ * then space for.  A task waiting to receive is unblocked for each item
+ * posted, but the calling task yields at most once.
+ *
+ * This function must not be called from an interrupt service routine, nor
+ * used with a semaphore.  See xQueueSendMultipleFromISR() for an alternative
+ * which may be used in an ISR.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to uxItemCount items stored one after the
+ * other, each of the item size defined when the queue was created.
+ *
+ * @param uxItemCount The number of items to post.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for space to become available on the queue, should it be full.  The
+ * call will return immediately if this is set to 0.
+ *
+ * @return The number of items posted, from 0 (the block time expired with the
+ * queue still full) to uxItemCount.
+ *
+ * Example usage:
+   <pre>
+ #define SAMPLES_PER_CONVERSION 8
+
+ void vADCTask( void *pvParameters )
+ {
+ uint16_t usSamples[ SAMPLES_PER_CONVERSION ];
+ UBaseType_t uxSent, uxPosted;
+
+	for( ;; )
+	{
+		vReadConversion( usSamples, SAMPLES_PER_CONVERSION );
+
+		// Post the samples of the conversion, blocking while the queue is
+		// full.  Each call posts as many samples as there is space for.
+		for( uxPosted = 0; uxPosted < SAMPLES_PER_CONVERSION; uxPosted += uxSent )
+		{
+			uxSent = xQueueSendMultiple( xSampleQueue, &( usSamples[ uxPosted ] ), SAMPLES_PER_CONVERSION - uxPosted, portMAX_DELAY );
+		}
+	}
+ }
+ </pre>
+ * \defgroup xQueueSendMultiple xQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueSendMultiple( QueueHandle_t xQueue, const void * const pvItemsToQueue, UBaseType_t uxItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueSendMultipleFromISR(
+										QueueHandle_t xQueue,
+										const void *pvItemsToQueue,
+										UBaseType_t uxItemCount,
+										BaseType_t *pxHigherPriorityTaskWoken
+									);
+ * </pre>
+ *
+ * A version of xQueueSendMultiple() that can be used from an interrupt service
+ * routine.  As many of the items as there is space for are posted, with
+ * interrupts masked once rather than once per item.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to uxItemCount items stored one after the
+ * other.
+ *
+ * @param uxItemCount The number of items to post.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueSendMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if posting the items caused a task to
+ * unblock, and the unblocked task has a priority higher than the currently
+ * running task.  A context switch should then be requested before the
+ * interrupt is exited.
+ *
+ * @return The number of items posted, 0 if the queue was full.
+ *
+ * Example usage:
+   <pre>
+ void vCANRxISR( void )
+ {
+ CANFrame_t xFrames[ CAN_RX_FIFO_DEPTH ];
+ UBaseType_t uxFrames;
+ BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	// Empty the receive FIFO of the controller, then post all the frames
+	// read to the queue at once.
+	uxFrames = uxReadCANFifo( xFrames, CAN_RX_FIFO_DEPTH );
+
+	if( xQueueSendMultipleFromISR( xCANRxQueue, xFrames, uxFrames, &xHigherPriorityTaskWoken ) != uxFrames )
+	{
+		// The queue was too full to hold all the frames.
+		ulFramesDropped++;
+	}
+
+	portEND_SWITCHING_ISR( xHigherPriorityTaskWoken );
+ }
+ </pre>
+ * \defgroup xQueueSendMultipleFromISR xQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueSendMultipleFromISR( QueueHandle_t xQueue, const void * const pvItemsToQueue, UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueReceiveMultiple(
+									QueueHandle_t xQueue,
+									void *pvBuffer,
+									UBaseType_t uxItemCount,
+									TickType_t xTicksToWait
+								);
+ * </pre>
+ *
+ * Receive up to uxItemCount items from a queue, in a single critical section.
+ * The items are copied to pvBuffer one after the other, oldest first, as many
+ * as the queue contains.  The calling task only blocks if the queue is empty,
+ * after which it receives as many items as the queue then contains.  A task
+ * waiting to send is unblocked for each item received, but the calling task
+ * yields at most once.
+ *
+ * This function must not be called from an interrupt service routine, nor
+ * used with a semaphore.  See xQueueReceiveMultipleFromISR() for an
+ * alternative which may be used in an ISR.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items are
+ * copied, large enough to hold uxItemCount items.
+ *
+ * @param uxItemCount The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for an item to receive, should the queue be empty.  The call will
+ * return immediately if this is set to 0.
+ *
+ * @return The number of items received, from 0 (the block time expired with
+ * the queue still empty) to uxItemCount.
+ *
+ * Example usage:
+   <pre>
+ void vCANTask( void *pvParameters )
+ {
+ CANFrame_t xFrames[ 16 ];
+ UBaseType_t uxFrame, uxFrames;
+
+	for( ;; )
+	{
+		// Wait for frames, then process all those received since the last
+		// time, up to 16 at a time.
+		uxFrames = xQueueReceiveMultiple( xCANRxQueue, xFrames, 16, portMAX_DELAY );
+
+		for( uxFrame = 0; uxFrame < uxFrames; uxFrame++ )
+		{
+			vProcessFrame( &( xFrames[ uxFrame ] ) );
+		}
+	}
+ }
+ </pre>
+ * \defgroup xQueueReceiveMultiple xQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueReceiveMultiple( QueueHandle_t xQueue, void * const pvBuffer, UBaseType_t uxItemCount, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ UBaseType_t xQueueReceiveMultipleFromISR(
+										   QueueHandle_t xQueue,
+										   void *pvBuffer,
+										   UBaseType_t uxItemCount,
+										   BaseType_t *pxHigherPriorityTaskWoken
+									   );
+ * </pre>
+ *
+ * A version of xQueueReceiveMultiple() that can be used from an interrupt
+ * service routine.  Up to uxItemCount items are received, with interrupts
+ * masked once rather than once per item.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received items are
+ * copied, large enough to hold uxItemCount items.
+ *
+ * @param uxItemCount The maximum number of items to receive.
+ *
+ * @param pxHigherPriorityTaskWoken xQueueReceiveMultipleFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if receiving the items caused a task to
+ * unblock, and the unblocked task has a priority higher than the currently
+ * running task.
+ *
+ * @return The number of items received, 0 if the queue was empty.
+ *
+ * \defgroup xQueueReceiveMultipleFromISR xQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+UBaseType_t xQueueReceiveMultipleFromISR( QueueHandle_t xQueue, void * const pvBuffer, UBaseType_t uxItemCount, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from witin an ISR, or within a critical section.
@@ -1479,7 +1786,9 @@ BaseType_t xQueueCRReceive( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTi
  * these functions directly.
  */
 QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 void* xQueueGetMutexHolder( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
 
 /*
@@ -1541,6 +1850,11 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t pxMutex ) PRIVILEGED_FUNCTION
  */
 QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
 
+/*
+ * As xQueueGenericCreate(), in memory provided by the application.
+ */
+QueueHandle_t xQueueGenericCreateStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticQueue_t *pxStaticQueue, const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+
 /*
  * Queue sets provide a mechanism to allow a task to block (pend) on a read
  * operation from multiple queues or semaphores simultaneously.
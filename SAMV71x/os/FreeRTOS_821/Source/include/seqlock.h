@@ -0,0 +1,293 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include seqlock.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A sequence lock protects data that is written by one writer (a task or an
+ * interrupt) and read by any number of tasks and interrupts, such as the last
+ * sample of a sensor, without a critical section or a mutex.
+ *
+ * The writer increments the sequence count of the lock before it starts
+ * updating the data, leaving it odd, and again once it is done.  A reader
+ * notes the count, copies the data, then checks the count: if it was odd, or
+ * changed during the copy, the copy may be torn and is made again.  Neither
+ * side masks interrupts or blocks for the duration of the copy, so a large
+ * structure can be shared with an interrupt without adding its copy time to
+ * the interrupt latency of the system.  The writer never waits for the
+ * readers; a reader only repeats its copy when a write overlapped it.
+ *
+ * Writes must be serialised by the application if there is more than one
+ * writer, for example by writing from a single task or a single interrupt.
+ * A reader that interrupts, or preempts, a writer part way through a write
+ * cannot get a consistent copy until the writer runs again: xSeqLockRead()
+ * then blocks a tick at a time up to its block time, and
+ * xSeqLockReadFromISR() fails.  Readers that also write the data, or data
+ * holding pointers followed by the reader, need a mutex instead.
+ *
+ * \defgroup SeqLock
+ */
+
+/**
+ * seqlock.h
+ *
+ * The sequence lock itself, normally declared next to the data it protects.
+ * It must be initialised with vSeqLockInitialise() before it is used.
+ *
+ * \defgroup SeqLock_t SeqLock_t
+ * \ingroup SeqLock
+ */
+typedef struct xSEQLOCK
+{
+	volatile UBaseType_t uxSequence;	/*< Odd while a write is in progress. */
+} SeqLock_t;
+
+/**
+ * seqlock.h
+ *<pre>
+ void vSeqLockInitialise( SeqLock_t * const pxSeqLock );
+ </pre>
+ *
+ * Initialise a sequence lock, with no write in progress.
+ *
+ * \defgroup vSeqLockInitialise vSeqLockInitialise
+ * \ingroup SeqLock
+ */
+void vSeqLockInitialise( SeqLock_t * const pxSeqLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * seqlock.h
+ *<pre>
+ void vSeqLockWriteBegin( SeqLock_t * const pxSeqLock );
+ void vSeqLockWriteEnd( SeqLock_t * const pxSeqLock );
+ </pre>
+ *
+ * Bracket an update of the data protected by the lock, made in place by the
+ * writer.  Both can be called from a task or an interrupt.  Readers retry
+ * until vSeqLockWriteEnd() is called, so the update should be kept short
+ * and must not block.
+ *
+ * Example usage:
+   <pre>
+	typedef struct
+	{
+		int32_t lPosition[ 3 ];
+		int32_t lVelocity[ 3 ];
+		uint32_t ulTimestamp;
+	} Navigation_t;
+
+	static Navigation_t xNavigation;
+	static SeqLock_t xNavigationLock;
+
+	void vSetup( void )
+	{
+		vSeqLockInitialise( &xNavigationLock );
+	}
+
+	// The IMU interrupt updates the structure in place.
+	void vImuISR( void )
+	{
+		vSeqLockWriteBegin( &xNavigationLock );
+		prvIntegrate( &xNavigation, prvReadImu() );
+		vSeqLockWriteEnd( &xNavigationLock );
+	}
+
+	// Any task takes a consistent copy.
+	void vControlTask( void *pvParameters )
+	{
+	Navigation_t xNow;
+
+		for( ;; )
+		{
+			xSeqLockRead( &xNavigationLock, &xNow, &xNavigation, sizeof( xNow ), portMAX_DELAY );
+			prvControl( &xNow );
+			vTaskDelay( pdMS_TO_TICKS( 10 ) );
+		}
+	}
+   </pre>
+ * \defgroup vSeqLockWriteBegin vSeqLockWriteBegin
+ * \ingroup SeqLock
+ */
+void vSeqLockWriteBegin( SeqLock_t * const pxSeqLock ) PRIVILEGED_FUNCTION;
+void vSeqLockWriteEnd( SeqLock_t * const pxSeqLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * seqlock.h
+ *<pre>
+ void vSeqLockWrite( SeqLock_t * const pxSeqLock, void *pvData, const void *pvNewData, size_t xLengthBytes );
+ </pre>
+ *
+ * Copy xLengthBytes bytes from pvNewData to the data protected by the lock,
+ * pvData, between vSeqLockWriteBegin() and vSeqLockWriteEnd().  Can be called
+ * from a task or an interrupt.
+ *
+ * \defgroup vSeqLockWrite vSeqLockWrite
+ * \ingroup SeqLock
+ */
+void vSeqLockWrite( SeqLock_t * const pxSeqLock, void *pvData, const void *pvNewData, size_t xLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * seqlock.h
+ *<pre>
+ UBaseType_t uxSeqLockReadBegin( const SeqLock_t * const pxSeqLock );
+ BaseType_t xSeqLockReadRetry( const SeqLock_t * const pxSeqLock, UBaseType_t uxSequence );
+ </pre>
+ *
+ * Bracket a read of the data protected by the lock, for readers that do not
+ * copy the data in one block.  uxSeqLockReadBegin() returns the sequence
+ * count to pass to xSeqLockReadRetry() once the data was read, which returns
+ * pdTRUE if a write was in progress or took place in the meantime, in which
+ * case what was read must be discarded and read again.  Values read between
+ * the two calls can be inconsistent with each other, so must not be used
+ * before xSeqLockReadRetry() returned pdFALSE, for example as an index or a
+ * divisor.
+ *
+ * Example usage:
+   <pre>
+	int32_t lGetAltitude( void )
+	{
+	UBaseType_t uxSequence;
+	int32_t lAltitude;
+
+		do
+		{
+			uxSequence = uxSeqLockReadBegin( &xNavigationLock );
+			lAltitude = xNavigation.lPosition[ 2 ];
+		} while( xSeqLockReadRetry( &xNavigationLock, uxSequence ) != pdFALSE );
+
+		return lAltitude;
+	}
+   </pre>
+ * A loop such as this one spins for as long as a write is in progress, so it
+ * must only be used where the writer cannot be interrupted or preempted by
+ * the reader, for example with an interrupt as the writer and tasks as the
+ * readers.
+ *
+ * \defgroup uxSeqLockReadBegin uxSeqLockReadBegin
+ * \ingroup SeqLock
+ */
+UBaseType_t uxSeqLockReadBegin( const SeqLock_t * const pxSeqLock ) PRIVILEGED_FUNCTION;
+BaseType_t xSeqLockReadRetry( const SeqLock_t * const pxSeqLock, UBaseType_t uxSequence ) PRIVILEGED_FUNCTION;
+
+/**
+ * seqlock.h
+ *<pre>
+ BaseType_t xSeqLockRead( const SeqLock_t * const pxSeqLock, void *pvBuffer, const void *pvData, size_t xLengthBytes, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Copy xLengthBytes bytes of the data protected by the lock, pvData, to
+ * pvBuffer, the copy being repeated until no write overlapped it.  This
+ * function cannot be called from an interrupt, see xSeqLockReadFromISR().
+ *
+ * @param xTicksToWait A write found in progress means the writer was
+ * preempted by the reading task.  The task then blocks for one tick at a
+ * time, for at most xTicksToWait ticks in total, to let the writer finish.
+ *
+ * @return pdPASS if pvBuffer holds a consistent copy, pdFAIL if a write was
+ * still in progress once the block time expired.
+ *
+ * \defgroup xSeqLockRead xSeqLockRead
+ * \ingroup SeqLock
+ */
+BaseType_t xSeqLockRead( const SeqLock_t * const pxSeqLock, void *pvBuffer, const void *pvData, size_t xLengthBytes, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * seqlock.h
+ *<pre>
+ BaseType_t xSeqLockReadFromISR( const SeqLock_t * const pxSeqLock, void *pvBuffer, const void *pvData, size_t xLengthBytes );
+ </pre>
+ *
+ * A version of xSeqLockRead() that can be called from an interrupt service
+ * routine.  The copy is repeated if a higher priority interrupt wrote the
+ * data during it.
+ *
+ * @return pdPASS if pvBuffer holds a consistent copy, pdFAIL if the
+ * interrupt was taken part way through a write.
+ *
+ * \defgroup xSeqLockReadFromISR xSeqLockReadFromISR
+ * \ingroup SeqLock
+ */
+BaseType_t xSeqLockReadFromISR( const SeqLock_t * const pxSeqLock, void *pvBuffer, const void *pvData, size_t xLengthBytes ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SEQLOCK_H */
+
@@ -0,0 +1,352 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include stream_buffer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A stream buffer passes a stream of bytes from a single writer (a task or an
+ * interrupt) to a single reader (a task or an interrupt).  Any number of bytes
+ * can be written or read in one call, they are copied with memcpy() into and
+ * out of a circular buffer.
+ *
+ * There is no critical section on the path that neither blocks nor wakes a
+ * task: the writer only updates the head index and the reader only updates
+ * the tail index.  This relies on there being only one writer and one reader.
+ * If several tasks or interrupts write to (or read from) the same stream
+ * buffer, the writes (or reads) must be serialised by the application, for
+ * example within a critical section or by holding a mutex.
+ *
+ * A task blocked in xStreamBufferReceive() is woken when the number of bytes
+ * in the buffer reaches the trigger level, when the writer blocks for room
+ * (no more bytes can arrive), or when its block time expires.  A task blocked
+ * in xStreamBufferSend() is woken when a read makes room.  The
+ * blocked task is woken with a direct to task notification (eNoAction), so a
+ * task must not use its notification for another purpose while it is blocked
+ * on a stream buffer.
+ *
+ * See message_buffer.h for the variant that passes discrete, length prefixed,
+ * messages.
+ *
+ * \defgroup StreamBuffer
+ */
+
+/**
+ * stream_buffer.h
+ *
+ * Type by which stream buffers are referenced.  For example, a call to
+ * xStreamBufferCreate() returns a StreamBufferHandle_t variable that can then
+ * be used as a parameter to xStreamBufferSend(), xStreamBufferReceive(), etc.
+ *
+ * \defgroup StreamBufferHandle_t StreamBufferHandle_t
+ * \ingroup StreamBuffer
+ */
+typedef void * StreamBufferHandle_t;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ StreamBufferHandle_t xStreamBufferCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes );
+ </pre>
+ *
+ * Create a stream buffer.  The buffer and its control structure are allocated
+ * from the FreeRTOS heap in one block.  This function cannot be called from
+ * an interrupt.
+ *
+ * @param xBufferSizeBytes The number of bytes the buffer can hold.
+ *
+ * @param xTriggerLevelBytes The number of bytes that must be in the buffer
+ * before a task blocked in xStreamBufferReceive() is woken.  A trigger level
+ * of 1 wakes the task on each write, a trigger level of 0 is taken as 1.  The
+ * trigger level cannot be larger than the buffer.
+ *
+ * @return A handle to the created stream buffer, or NULL if there was
+ * insufficient FreeRTOS heap available to create it.
+ *
+ * Example usage:
+   <pre>
+	// The UART receive interrupt writes the bytes it reads to a stream
+	// buffer, the task is only woken once 16 bytes have arrived.
+	StreamBufferHandle_t xUartRx;
+
+	void vSetup( void )
+	{
+		xUartRx = xStreamBufferCreate( 256, 16 );
+	}
+
+	void vUartISR( void )
+	{
+	uint8_t ucBytes[ 8 ];
+	size_t xCount;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		xCount = prvReadRxFifo( ucBytes, sizeof( ucBytes ) );
+		xStreamBufferSendFromISR( xUartRx, ucBytes, xCount, &xHigherPriorityTaskWoken );
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+
+	void vUartTask( void *pvParameters )
+	{
+	uint8_t ucLine[ 64 ];
+	size_t xReceived;
+
+		for( ;; )
+		{
+			// Returns with the bytes available once the trigger level is
+			// reached, or whatever arrived within 100ms.
+			xReceived = xStreamBufferReceive( xUartRx, ucLine, sizeof( ucLine ), pdMS_TO_TICKS( 100 ) );
+			prvProcess( ucLine, xReceived );
+		}
+	}
+   </pre>
+ * \defgroup xStreamBufferCreate xStreamBufferCreate
+ * \ingroup StreamBuffer
+ */
+#define xStreamBufferCreate( xBufferSizeBytes, xTriggerLevelBytes ) xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), pdFALSE )
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Write bytes to a stream buffer.  This function cannot be called from an
+ * interrupt, see xStreamBufferSendFromISR().
+ *
+ * @param xStreamBuffer The stream buffer written to.
+ *
+ * @param pvTxData The bytes to write.
+ *
+ * @param xDataLengthBytes The number of bytes to write.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for room for all xDataLengthBytes bytes, should there not be enough
+ * space.  Once the block time expires as many bytes as fit are written.
+ *
+ * @return The number of bytes written, which can be less than
+ * xDataLengthBytes.
+ *
+ * \defgroup xStreamBufferSend xStreamBufferSend
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of xStreamBufferSend() that can be called from an interrupt
+ * service routine.  It does not block, as many bytes as fit are written.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the write woke a task that
+ * has a priority above the task that was interrupted, in which case a context
+ * switch should be requested before the interrupt exits.
+ *
+ * @return The number of bytes written.
+ *
+ * \defgroup xStreamBufferSendFromISR xStreamBufferSendFromISR
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Read bytes from a stream buffer.  This function cannot be called from an
+ * interrupt, see xStreamBufferReceiveFromISR().
+ *
+ * @param xStreamBuffer The stream buffer read from.
+ *
+ * @param pvRxData Where the bytes are copied to.
+ *
+ * @param xBufferLengthBytes The largest number of bytes to read.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block
+ * waiting for data, should the buffer be empty.  The task is woken when the
+ * trigger level is reached.
+ *
+ * @return The number of bytes read, 0 if the block time expired with the
+ * buffer still empty.
+ *
+ * \defgroup xStreamBufferReceive xStreamBufferReceive
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of xStreamBufferReceive() that can be called from an interrupt
+ * service routine.  It does not block.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the read woke a task
+ * blocked writing that has a priority above the task that was interrupted,
+ * in which case a context switch should be requested before the interrupt
+ * exits.
+ *
+ * @return The number of bytes read.
+ *
+ * \defgroup xStreamBufferReceiveFromISR xStreamBufferReceiveFromISR
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Delete a stream buffer.  No task may be blocked on it.
+ *
+ * \defgroup vStreamBufferDelete vStreamBufferDelete
+ * \ingroup StreamBuffer
+ */
+void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Empty a stream buffer.  A stream buffer can only be reset while no task is
+ * blocked on it.
+ *
+ * @return pdPASS if the buffer was reset, pdFAIL if a task was blocked on it.
+ *
+ * \defgroup xStreamBufferReset xStreamBufferReset
+ * \ingroup StreamBuffer
+ */
+BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel );
+ </pre>
+ *
+ * Change the trigger level of a stream buffer, see xStreamBufferCreate().
+ *
+ * @return pdPASS if the trigger level was changed, pdFAIL if it is larger
+ * than the buffer.
+ *
+ * \defgroup xStreamBufferSetTriggerLevel xStreamBufferSetTriggerLevel
+ * \ingroup StreamBuffer
+ */
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer );
+ size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer );
+ BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer );
+ BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Query the number of bytes that can be read from, and written to, a stream
+ * buffer.  The values can be out of date by the time they are used if the
+ * other side of the buffer runs in the meantime.
+ *
+ * \defgroup xStreamBufferBytesAvailable xStreamBufferBytesAvailable
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/* For internal use only, see xStreamBufferCreate() and
+xMessageBufferCreate(). */
+StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferNextMessageLength( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STREAM_BUFFER_H */
+
@@ -183,6 +183,56 @@ typedef enum
 	eNoTasksWaitingTimeout	/* No tasks are waiting for a timeout so it is safe to enter a sleep mode that can only be exited by an external interrupt. */
 } eSleepModeStatus;
 
+/*
+ * The memory of a task created by xTaskCreateStatic().  The members mirror
+ * the task control block kept in tasks.c, which is not visible outside of it,
+ * so the application can reserve one without knowing its content.  They are
+ * not meant to be accessed.
+ */
+typedef struct xSTATIC_TCB
+{
+	void				*pxDummy1;
+	#if ( portUSING_MPU_WRAPPERS == 1 )
+		xMPU_SETTINGS	xDummy2;
+		BaseType_t		xDummy3;
+	#endif
+	ListItem_t			xDummy4[ 2 ];
+	UBaseType_t			uxDummy5;
+	void				*pxDummy6;
+	uint8_t				ucDummy7[ configMAX_TASK_NAME_LEN ];
+	#if ( portSTACK_GROWTH > 0 )
+		void			*pxDummy8;
+	#endif
+	#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+		UBaseType_t		uxDummy9;
+	#endif
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t		uxDummy10[ 2 ];
+	#endif
+	#if ( configUSE_MUTEXES == 1 )
+		UBaseType_t		uxDummy11[ 2 ];
+	#endif
+	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+		void			*pxDummy12;
+	#endif
+	#if( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+		void			*pvDummy13[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+	#endif
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		uint32_t		ulDummy14;
+	#endif
+	#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		struct	_reent	xDummy15;
+	#endif
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+		uint32_t		ulDummy16;
+		eNotifyAction	eDummy17;
+	#endif
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		uint8_t			ucDummy18;
+	#endif
+} StaticTask_t;
+
 
 /**
  * Defines the priority used by the idle task.  This must not be modified.
@@ -344,6 +394,68 @@ is used in assert() statements. */
  */
 #define xTaskCreate( pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask ) xTaskGenericCreate( ( pvTaskCode ), ( pcName ), ( usStackDepth ), ( pvParameters ), ( uxPriority ), ( pxCreatedTask ), ( NULL ), ( NULL ) )
 
+/**
+ * task. h
+ *<pre>
+ TaskHandle_t xTaskCreateStatic(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  uint16_t usStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  StackType_t * const puxStackBuffer,
+							  StaticTask_t * const pxTaskBuffer
+						  );</pre>
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.
+ *
+ * Create a new task in memory provided by the application and add it to the
+ * list of tasks that are ready to run.  Nothing is allocated from the FreeRTOS
+ * heap, so the function cannot fail for lack of memory, and deleting the task
+ * frees nothing - the memory can be reused once the idle task has removed the
+ * deleted task.
+ *
+ * @param pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority See
+ * xTaskCreate().
+ *
+ * @param puxStackBuffer An array of at least usStackDepth StackType_t, used as
+ * the stack of the task.
+ *
+ * @param pxTaskBuffer Holds the task control block.
+ *
+ * @return The handle of the task, or NULL if puxStackBuffer or pxTaskBuffer
+ * is NULL.
+ *
+ * Example usage:
+   <pre>
+ #define STACK_SIZE 200
+
+ static StackType_t xStack[ STACK_SIZE ];
+ static StaticTask_t xTaskBuffer;
+
+ void vOtherFunction( void )
+ {
+ TaskHandle_t xHandle;
+
+	 xHandle = xTaskCreateStatic( vTaskCode, "NAME", STACK_SIZE, NULL, tskIDLE_PRIORITY, xStack, &xTaskBuffer );
+ }
+   </pre>
+ * \defgroup xTaskCreateStatic xTaskCreateStatic
+ * \ingroup Tasks
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, StackType_t * const puxStackBuffer, StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+	/*
+	 * When configSUPPORT_STATIC_ALLOCATION is 1 the idle task is created by
+	 * vTaskStartScheduler() in memory provided by the application, which must
+	 * implement this function.  *pusIdleTaskStackSize is the number of
+	 * StackType_t in *ppxIdleTaskStackBuffer, at least configMINIMAL_STACK_SIZE.
+	 */
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize );
+#endif
+
 /**
  * task. h
  *<pre>
@@ -2010,6 +2122,14 @@ eSleepModeStatus eTaskConfirmSleepModeStatus( void ) PRIVILEGED_FUNCTION;
  */
 void *pvTaskIncrementMutexHeldCount( void );
 
+/*
+ * For internal use only.  Decrement the mutex held count of the running task
+ * when a mutex nobody waited for is given back.  Returns pdFALSE, leaving the
+ * count unchanged, if the task has an inherited priority, in which case
+ * xTaskPriorityDisinherit() must be called from a critical section instead.
+ */
+BaseType_t xTaskDecrementMutexHeldCount( void );
+
 #ifdef __cplusplus
 }
 #endif
@@ -128,6 +128,31 @@ typedef void (*TimerCallbackFunction_t)( TimerHandle_t xTimer );
  */
 typedef void (*PendedFunction_t)( void *, uint32_t );
 
+/*
+ * The memory of a timer created by xTimerCreateStatic().  The members mirror
+ * the timer structure kept in timers.c, which is not visible outside of it, so
+ * the application can reserve one without knowing its content.  They are not
+ * meant to be accessed.
+ */
+typedef struct xSTATIC_TIMER
+{
+	void					*pvDummy1;
+	ListItem_t				xDummy2;
+	TickType_t				xDummy3;
+	UBaseType_t				uxDummy4;
+	void					*pvDummy5;
+	TimerCallbackFunction_t	pvDummy6;
+	#if( configUSE_TIMER_WHEEL == 1 )
+		UBaseType_t			uxDummy7;
+	#endif
+	#if( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t			uxDummy8;
+	#endif
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		uint8_t				ucDummy9;
+	#endif
+} StaticTimer_t;
+
 /**
  * TimerHandle_t xTimerCreate( 	const char * const pcTimerName,
  * 								TickType_t xTimerPeriodInTicks,
@@ -259,6 +284,37 @@ typedef void (*PendedFunction_t)( void *, uint32_t );
  */
 TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/**
+ * TimerHandle_t xTimerCreateStatic( const char * const pcTimerName,
+ * 									 TickType_t xTimerPeriodInTicks,
+ * 									 UBaseType_t uxAutoReload,
+ * 									 void * pvTimerID,
+ * 									 TimerCallbackFunction_t pxCallbackFunction,
+ * 									 StaticTimer_t *pxTimerBuffer );
+ *
+ * As xTimerCreate(), but the timer is held in *pxTimerBuffer, provided by the
+ * application, instead of being allocated.  Deleting the timer leaves
+ * *pxTimerBuffer to the application once the timer service task has processed
+ * the delete command.  configSUPPORT_STATIC_ALLOCATION must be set to 1 in
+ * FreeRTOSConfig.h for this function to be available.
+ *
+ * Example usage:
+ * @verbatim
+ * static StaticTimer_t xTimerBuffer;
+ *
+ * void vAFunction( void )
+ * {
+ * TimerHandle_t xTimer;
+ *
+ *     xTimer = xTimerCreateStatic( "Timer", 100, pdTRUE, NULL, vTimerCallback, &xTimerBuffer );
+ *     xTimerStart( xTimer, 0 );
+ * }
+ * @endverbatim
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	TimerHandle_t xTimerCreateStatic( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t *pxTimerBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif
+
 /**
  * void *pvTimerGetTimerID( TimerHandle_t xTimer );
  *
@@ -1130,13 +1186,57 @@ BaseType_t xTimerPendFunctionCall( PendedFunction_t xFunctionToPend, void *pvPar
  */
 const char * pcTimerGetTimerName( TimerHandle_t xTimer ); /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+/**
+ * void vTimerSetCallbackFromTick( TimerHandle_t xTimer, const UBaseType_t uxFromTick );
+ *
+ * Only available when configUSE_TIMER_WHEEL is set to 1 in FreeRTOSConfig.h.
+ *
+ * By default the callback of an expired timer is called from the timer
+ * service/daemon task.  When uxFromTick is pdTRUE the callback of xTimer is
+ * instead called straight from the RTOS tick interrupt, in the tick in which
+ * the timer expires, without the latency of a context switch to the timer
+ * service task.
+ *
+ * Such a callback runs in an interrupt, with interrupts up to
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY masked.  It must be short, must not
+ * block, and must only use API functions that end in "FromISR" (for example
+ * xTimerStartFromISR() or xTimerStopFromISR()).  A context switch requested
+ * through their pxHigherPriorityTaskWoken parameter is performed by the tick
+ * interrupt.
+ *
+ * @param xTimer The handle of the timer being configured.
+ *
+ * @param uxFromTick pdTRUE to call the timer callback from the tick interrupt,
+ * pdFALSE to call it from the timer service task.
+ */
+void vTimerSetCallbackFromTick( TimerHandle_t xTimer, const UBaseType_t uxFromTick );
+
+#endif /* configUSE_TIMER_WHEEL */
+
 /*
  * Functions beyond this part are not part of the public API and are intended
  * for use by the kernel only.
  */
 BaseType_t xTimerCreateTimerTask( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * With configSUPPORT_STATIC_ALLOCATION set to 1 the timer service task is
+ * created by xTaskCreateStatic(), in memory the application provides by
+ * implementing this function (as vApplicationGetIdleTaskMemory() for the idle
+ * task).  The stack must hold *pusTimerTaskStackSize words, normally
+ * configTIMER_TASK_STACK_DEPTH.
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize );
+#endif
 BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+	BaseType_t xTimerProcessTick( const TickType_t xTickCount ) PRIVILEGED_FUNCTION;
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,433 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include trace_recorder.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The trace recorder writes the kernel events - context switches, tasks made
+ * ready, blocking on and accessing queues, semaphores and mutexes, interrupt
+ * entry and exit - as compact binary records into a ring buffer in RAM, by
+ * implementing the trace macros of FreeRTOS.h.  It is enabled by setting
+ * configUSE_TRACE_RECORDER to 1 in FreeRTOSConfig.h, FreeRTOS.h then includes
+ * this header, which defines the trace macros the application has not defined
+ * itself.  configUSE_TRACE_FACILITY must also be 1.
+ *
+ * Each event is 8 bytes: a 32-bit time stamp read from
+ * configTRACE_RECORDER_TIMESTAMP(), an event code, an 8-bit parameter and the
+ * 16-bit number of the object concerned.  Tasks are numbered by their TCB
+ * number (see TaskStatus_t), queues, semaphores and mutexes by a number the
+ * recorder assigns when they are created (see uxQueueGetQueueNumber()), and
+ * interrupts by the numbers the application gives them.  Recording an event
+ * takes one function call, the time stamp read and a few stores with
+ * interrupts masked, a few dozen cycles on Cortex-M7.  Once the buffer is full
+ * the oldest events are overwritten, so the buffer holds the last
+ * configTRACE_RECORDER_EVENTS events (1024 by default, a power of two).
+ *
+ * The names of tasks, of queues added to the queue registry and of interrupts
+ * are copied into a table of configTRACE_RECORDER_NAMES entries that is part
+ * of the recording.  When the table is full the entries of deleted objects are
+ * reused.
+ *
+ * The recording is a single structure that starts with a header describing
+ * its layout.  It can be saved by a debugger from the RAM of a halted target,
+ * or written to a file or a link by the application using
+ * pvTraceRecorderGetBuffer().  The host decoder converts it into a trace that
+ * the Perfetto UI (ui.perfetto.dev) or chrome://tracing opens, with a track per
+ * task showing when it ran, was ready and was blocked, and on what, and a
+ * track per interrupt.  Layout of the recording, all fields little endian on a
+ * little endian target:
+ *
+ * <pre>
+   uint32_t  magic             0x52545246 ("FRTR")
+   uint32_t  version           1
+   uint32_t  timestamp_hz      configTRACE_RECORDER_TIMESTAMP_HZ
+   uint32_t  event_capacity    configTRACE_RECORDER_EVENTS
+   uint32_t  name_capacity     configTRACE_RECORDER_NAMES
+   uint32_t  name_length       configTRACE_RECORDER_NAME_LENGTH
+   uint32_t  events_written    total, the next event goes at events_written % event_capacity
+   uint32_t  running           non zero while recording
+   names[ name_capacity ]      uint16_t object, uint8_t kind (0 free), uint8_t deleted, char name[ name_length ]
+   events[ event_capacity ]    uint32_t timestamp, uint8_t event, uint8_t parameter, uint16_t object
+   </pre>
+ *
+ * The time stamps are 32 bits wide and are unwrapped by the decoder, which
+ * expects an event at least once per counter period.  For that a time
+ * reference event is recorded every second from traceTASK_INCREMENT_TICK(),
+ * unless the application defines that macro itself.  Events are only recorded
+ * from code that may use the interrupt safe API, interrupts above
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY must not record events.
+ *
+ * FreeRTOSConfig.h contains, for example:
+ *
+ * <pre>
+   #define configUSE_TRACE_RECORDER				1
+   #define configTRACE_RECORDER_TIMESTAMP()		( DWT->CYCCNT )
+   #define configTRACE_RECORDER_TIMESTAMP_HZ	configCPU_CLOCK_HZ
+   </pre>
+ *
+ * \defgroup TraceRecorder
+ */
+
+/* Event codes, as recorded.  tracerecEVENT_FROM_ISR is added to the events of
+the interrupt safe API functions. */
+#define tracerecEVENT_TASK_SWITCHED_IN			( ( uint8_t ) 0x01U )	/*< Object: task.  Parameter: priority. */
+#define tracerecEVENT_TASK_READY				( ( uint8_t ) 0x02U )	/*< Object: task.  Parameter: priority. */
+#define tracerecEVENT_TASK_CREATE				( ( uint8_t ) 0x03U )	/*< Object: task.  Parameter: priority. */
+#define tracerecEVENT_TASK_DELETE				( ( uint8_t ) 0x04U )	/*< Object: task. */
+#define tracerecEVENT_TASK_DELAY				( ( uint8_t ) 0x05U )	/*< Object: the calling task. */
+#define tracerecEVENT_TASK_DELAY_UNTIL			( ( uint8_t ) 0x06U )	/*< Object: the calling task. */
+#define tracerecEVENT_TASK_SUSPEND				( ( uint8_t ) 0x07U )	/*< Object: task. */
+#define tracerecEVENT_TASK_RESUME				( ( uint8_t ) 0x08U )	/*< Object: task. */
+#define tracerecEVENT_TASK_PRIORITY_SET			( ( uint8_t ) 0x09U )	/*< Object: task.  Parameter: new priority. */
+#define tracerecEVENT_TASK_PRIORITY_INHERIT		( ( uint8_t ) 0x0AU )	/*< Object: mutex holder.  Parameter: inherited priority. */
+#define tracerecEVENT_TASK_PRIORITY_DISINHERIT	( ( uint8_t ) 0x0BU )	/*< Object: mutex holder.  Parameter: base priority. */
+#define tracerecEVENT_QUEUE_CREATE				( ( uint8_t ) 0x10U )	/*< Object: queue.  Parameter: queueQUEUE_TYPE_xxx. */
+#define tracerecEVENT_QUEUE_DELETE				( ( uint8_t ) 0x11U )	/*< Object: queue. */
+#define tracerecEVENT_QUEUE_SEND				( ( uint8_t ) 0x12U )	/*< Object: queue.  Parameter: items in the queue before the call, 255 at most. */
+#define tracerecEVENT_QUEUE_SEND_FAILED			( ( uint8_t ) 0x13U )	/*< As tracerecEVENT_QUEUE_SEND. */
+#define tracerecEVENT_QUEUE_RECEIVE				( ( uint8_t ) 0x14U )	/*< As tracerecEVENT_QUEUE_SEND. */
+#define tracerecEVENT_QUEUE_RECEIVE_FAILED		( ( uint8_t ) 0x15U )	/*< As tracerecEVENT_QUEUE_SEND. */
+#define tracerecEVENT_QUEUE_PEEK				( ( uint8_t ) 0x16U )	/*< As tracerecEVENT_QUEUE_SEND. */
+#define tracerecEVENT_QUEUE_PEEK_FAILED			( ( uint8_t ) 0x17U )	/*< As tracerecEVENT_QUEUE_SEND. */
+#define tracerecEVENT_QUEUE_BLOCK_SEND			( ( uint8_t ) 0x18U )	/*< The calling task blocks.  As tracerecEVENT_QUEUE_SEND. */
+#define tracerecEVENT_QUEUE_BLOCK_RECEIVE		( ( uint8_t ) 0x19U )	/*< The calling task blocks.  As tracerecEVENT_QUEUE_SEND. */
+#define tracerecEVENT_ISR_ENTER					( ( uint8_t ) 0x20U )	/*< No object, the number is given on exit. */
+#define tracerecEVENT_ISR_EXIT					( ( uint8_t ) 0x21U )	/*< Object: interrupt. */
+#define tracerecEVENT_TICK						( ( uint8_t ) 0x30U )	/*< Object: the tick count divided by configTICK_RATE_HZ. */
+#define tracerecEVENT_MARK						( ( uint8_t ) 0x31U )	/*< Object and parameter: as passed to vTraceRecorderMark(). */
+#define tracerecEVENT_FROM_ISR					( ( uint8_t ) 0x80U )
+
+/* Kinds of the entries of the name table. */
+#define tracerecNAME_FREE						( ( uint8_t ) 0U )
+#define tracerecNAME_TASK						( ( uint8_t ) 1U )
+#define tracerecNAME_QUEUE						( ( uint8_t ) 2U )
+#define tracerecNAME_ISR						( ( uint8_t ) 3U )
+
+/* Identifies the recording and its layout. */
+#define tracerecMAGIC							( 0x52545246UL )
+#define tracerecVERSION							( 1UL )
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderStart( void );
+ void vTraceRecorderStop( void );
+ </pre>
+ *
+ * Start and stop recording events.  Call vTraceRecorderStart() before the
+ * scheduler is started and before creating the objects to be traced, once the
+ * time stamp counter runs.  After vTraceRecorderStop() the buffer keeps the
+ * events that led to the stop, for example when an error is detected, until
+ * recording is started again.  Names are recorded whether or not events are.
+ * Both functions can be called from an interrupt.
+ *
+ * \defgroup vTraceRecorderStart vTraceRecorderStart
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderStart( void ) PRIVILEGED_FUNCTION;
+void vTraceRecorderStop( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ const void *pvTraceRecorderGetBuffer( size_t *pxSize );
+ </pre>
+ *
+ * The recording, for the application to save it.  Stop recording first, or
+ * the events can change while they are copied.
+ *
+ * @param pxSize Set to the size of the recording in bytes.
+ *
+ * @return The start of the recording.
+ *
+ * Example usage:
+   <pre>
+	size_t xSize;
+	const void *pvTrace;
+
+	vTraceRecorderStop();
+	pvTrace = pvTraceRecorderGetBuffer( &xSize );
+	fwrite( pvTrace, 1, xSize, pxFile );
+   </pre>
+ * \defgroup pvTraceRecorderGetBuffer pvTraceRecorderGetBuffer
+ * \ingroup TraceRecorder
+ */
+const void *pvTraceRecorderGetBuffer( size_t *pxSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderISRName( UBaseType_t uxISR, const char *pcName );
+ void vTraceRecorderISREnter( void );
+ void vTraceRecorderISRExit( UBaseType_t uxISR );
+ </pre>
+ *
+ * Record the entry and the exit of an interrupt service routine, numbered
+ * uxISR by the application, and its name.  The interrupts accounted by
+ * cpu_load.c are recorded without these calls, through the traceISR_ENTER(),
+ * traceISR_EXIT() and traceISR_NAME() macros, under the numbers returned by
+ * uxCpuLoadRegisterISR().
+ *
+ * @param uxISR The number of the interrupt, below 65536.
+ *
+ * @param pcName The name of the interrupt, truncated to
+ * configTRACE_RECORDER_NAME_LENGTH - 1 characters.
+ *
+ * \defgroup vTraceRecorderISREnter vTraceRecorderISREnter
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderISRName( UBaseType_t uxISR, const char *pcName ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+void vTraceRecorderISREnter( void ) PRIVILEGED_FUNCTION;
+void vTraceRecorderISRExit( UBaseType_t uxISR ) PRIVILEGED_FUNCTION;
+
+/**
+ * trace_recorder.h
+ *<pre>
+ void vTraceRecorderMark( uint16_t usMark, uint8_t ucValue );
+ </pre>
+ *
+ * Record an application event, shown as an instant on the track of the task
+ * or interrupt that recorded it.  Can be called from an interrupt.
+ *
+ * @param usMark The number of the event, chosen by the application.
+ *
+ * @param ucValue A value recorded with it.
+ *
+ * \defgroup vTraceRecorderMark vTraceRecorderMark
+ * \ingroup TraceRecorder
+ */
+void vTraceRecorderMark( uint16_t usMark, uint8_t ucValue ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------
+ * Functions used by the trace macros below, not part of the API.
+ *----------------------------------------------------------*/
+
+void vTraceRecorderEvent( uint8_t ucEvent, uint8_t ucParameter, uint16_t usObject ) PRIVILEGED_FUNCTION;
+void vTraceRecorderTaskCreate( UBaseType_t uxTask, const char *pcName, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+void vTraceRecorderTaskDelete( UBaseType_t uxTask ) PRIVILEGED_FUNCTION;
+UBaseType_t uxTraceRecorderQueueCreate( uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+void vTraceRecorderQueueDelete( UBaseType_t uxQueue ) PRIVILEGED_FUNCTION;
+void vTraceRecorderQueueName( UBaseType_t uxQueue, const char *pcName ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+void vTraceRecorderTick( TickType_t xTickCount ) PRIVILEGED_FUNCTION;
+
+/* The number of a task or queue as recorded, and the items in a queue, in the
+width of the event fields.  Only used within tasks.c and queue.c. */
+#define tracerecTASK( pxTCB )		( ( uint16_t ) ( pxTCB )->uxTCBNumber )
+#define tracerecPRIORITY( uxPriority )	( ( uint8_t ) ( uxPriority ) )
+#define tracerecQUEUE( pxQueue )	( ( uint16_t ) ( pxQueue )->uxQueueNumber )
+#define tracerecITEMS( pxQueue )	( ( uint8_t ) ( ( ( pxQueue )->uxMessagesWaiting > ( UBaseType_t ) 255U ) ? ( UBaseType_t ) 255U : ( pxQueue )->uxMessagesWaiting ) )
+
+/*-----------------------------------------------------------
+ * The trace macros, see FreeRTOS.h for where each one is called.
+ *----------------------------------------------------------*/
+
+#ifndef traceTASK_SWITCHED_IN
+	#define traceTASK_SWITCHED_IN() vTraceRecorderEvent( tracerecEVENT_TASK_SWITCHED_IN, tracerecPRIORITY( pxCurrentTCB->uxPriority ), tracerecTASK( pxCurrentTCB ) )
+#endif
+
+#ifndef traceMOVED_TASK_TO_READY_STATE
+	#define traceMOVED_TASK_TO_READY_STATE( pxTCB ) vTraceRecorderEvent( tracerecEVENT_TASK_READY, tracerecPRIORITY( ( pxTCB )->uxPriority ), tracerecTASK( pxTCB ) )
+#endif
+
+#ifndef traceTASK_CREATE
+	#define traceTASK_CREATE( pxNewTCB ) vTraceRecorderTaskCreate( ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName, ( pxNewTCB )->uxPriority )
+#endif
+
+#ifndef traceTASK_DELETE
+	#define traceTASK_DELETE( pxTCB ) vTraceRecorderTaskDelete( ( pxTCB )->uxTCBNumber )
+#endif
+
+#ifndef traceTASK_DELAY
+	#define traceTASK_DELAY() vTraceRecorderEvent( tracerecEVENT_TASK_DELAY, 0U, tracerecTASK( pxCurrentTCB ) )
+#endif
+
+#ifndef traceTASK_DELAY_UNTIL
+	#define traceTASK_DELAY_UNTIL() vTraceRecorderEvent( tracerecEVENT_TASK_DELAY_UNTIL, 0U, tracerecTASK( pxCurrentTCB ) )
+#endif
+
+#ifndef traceTASK_SUSPEND
+	#define traceTASK_SUSPEND( pxTCB ) vTraceRecorderEvent( tracerecEVENT_TASK_SUSPEND, 0U, tracerecTASK( pxTCB ) )
+#endif
+
+#ifndef traceTASK_RESUME
+	#define traceTASK_RESUME( pxTCB ) vTraceRecorderEvent( tracerecEVENT_TASK_RESUME, 0U, tracerecTASK( pxTCB ) )
+#endif
+
+#ifndef traceTASK_RESUME_FROM_ISR
+	#define traceTASK_RESUME_FROM_ISR( pxTCB ) vTraceRecorderEvent( tracerecEVENT_TASK_RESUME | tracerecEVENT_FROM_ISR, 0U, tracerecTASK( pxTCB ) )
+#endif
+
+#ifndef traceTASK_PRIORITY_SET
+	#define traceTASK_PRIORITY_SET( pxTCB, uxNewPriority ) vTraceRecorderEvent( tracerecEVENT_TASK_PRIORITY_SET, tracerecPRIORITY( uxNewPriority ), tracerecTASK( pxTCB ) )
+#endif
+
+#ifndef traceTASK_PRIORITY_INHERIT
+	#define traceTASK_PRIORITY_INHERIT( pxTCBOfMutexHolder, uxInheritedPriority ) vTraceRecorderEvent( tracerecEVENT_TASK_PRIORITY_INHERIT, tracerecPRIORITY( uxInheritedPriority ), tracerecTASK( pxTCBOfMutexHolder ) )
+#endif
+
+#ifndef traceTASK_PRIORITY_DISINHERIT
+	#define traceTASK_PRIORITY_DISINHERIT( pxTCBOfMutexHolder, uxOriginalPriority ) vTraceRecorderEvent( tracerecEVENT_TASK_PRIORITY_DISINHERIT, tracerecPRIORITY( uxOriginalPriority ), tracerecTASK( pxTCBOfMutexHolder ) )
+#endif
+
+#ifndef traceTASK_INCREMENT_TICK
+	#define traceTASK_INCREMENT_TICK( xTickCount ) vTraceRecorderTick( xTickCount )
+#endif
+
+#ifndef traceQUEUE_CREATE
+	#define traceQUEUE_CREATE( pxNewQueue ) ( pxNewQueue )->uxQueueNumber = uxTraceRecorderQueueCreate( ( pxNewQueue )->ucQueueType )
+#endif
+
+#ifndef traceQUEUE_DELETE
+	#define traceQUEUE_DELETE( pxQueue ) vTraceRecorderQueueDelete( ( pxQueue )->uxQueueNumber )
+#endif
+
+#ifndef traceQUEUE_REGISTRY_ADD
+	#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName ) vTraceRecorderQueueName( ( ( Queue_t * ) ( xQueue ) )->uxQueueNumber, ( pcQueueName ) )
+#endif
+
+#ifndef traceQUEUE_SEND
+	#define traceQUEUE_SEND( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_SEND, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_SEND_FAILED
+	#define traceQUEUE_SEND_FAILED( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_SEND_FAILED, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_RECEIVE
+	#define traceQUEUE_RECEIVE( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_RECEIVE, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FAILED
+	#define traceQUEUE_RECEIVE_FAILED( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_RECEIVE_FAILED, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_PEEK
+	#define traceQUEUE_PEEK( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_PEEK, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_SEND
+	#define traceBLOCKING_ON_QUEUE_SEND( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_BLOCK_SEND, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceBLOCKING_ON_QUEUE_RECEIVE
+	#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_BLOCK_RECEIVE, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_SEND_FROM_ISR
+	#define traceQUEUE_SEND_FROM_ISR( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_SEND | tracerecEVENT_FROM_ISR, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_SEND_FROM_ISR_FAILED
+	#define traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_SEND_FAILED | tracerecEVENT_FROM_ISR, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FROM_ISR
+	#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_RECEIVE | tracerecEVENT_FROM_ISR, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_RECEIVE_FROM_ISR_FAILED
+	#define traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_RECEIVE_FAILED | tracerecEVENT_FROM_ISR, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_PEEK_FROM_ISR
+	#define traceQUEUE_PEEK_FROM_ISR( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_PEEK | tracerecEVENT_FROM_ISR, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceQUEUE_PEEK_FROM_ISR_FAILED
+	#define traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue ) vTraceRecorderEvent( tracerecEVENT_QUEUE_PEEK_FAILED | tracerecEVENT_FROM_ISR, tracerecITEMS( pxQueue ), tracerecQUEUE( pxQueue ) )
+#endif
+
+#ifndef traceISR_NAME
+	#define traceISR_NAME( uxISR, pcName ) vTraceRecorderISRName( ( uxISR ), ( pcName ) )
+#endif
+
+#ifndef traceISR_ENTER
+	#define traceISR_ENTER() vTraceRecorderISREnter()
+#endif
+
+#ifndef traceISR_EXIT
+	#define traceISR_EXIT( uxISR ) vTraceRecorderISRExit( uxISR )
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_RECORDER_H */
+
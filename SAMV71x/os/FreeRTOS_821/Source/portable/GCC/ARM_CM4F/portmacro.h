@@ -202,6 +202,10 @@ not necessary for to use this port.  They are defined so the common demo files
 /* portNOP() is not required by this port. */
 #define portNOP()
 
+/* Single core, interrupts see memory accesses in program order, only the
+compiler must be kept from reordering them. */
+#define portMEMORY_BARRIER()	__asm volatile( "" ::: "memory" )
+
 #ifndef portFORCE_INLINE
 	#define portFORCE_INLINE inline __attribute__(( always_inline))
 #endif
@@ -253,6 +257,37 @@ portFORCE_INLINE static void vPortSetBASEPRI( uint32_t ulNewMaskValue )
 }
 /*-----------------------------------------------------------*/
 
+/* Atomic compare and swap, used by the fast path of fast_semaphore.c.  The
+store exclusive fails if the reservation taken by the load exclusive was lost,
+which happens on any exception entry or return, so code preempted between the
+two instructions tries again with the new value.  Returns pdTRUE if
+*puxDestination held uxExpected and was replaced with uxNew. */
+portFORCE_INLINE static BaseType_t xPortCompareAndSwap( volatile UBaseType_t *puxDestination, UBaseType_t uxExpected, UBaseType_t uxNew )
+{
+UBaseType_t uxValue;
+uint32_t ulFailed;
+BaseType_t xReturn = pdFALSE;
+
+	do
+	{
+		__asm volatile ( "ldrex %0, [%1]" : "=r" ( uxValue ) : "r" ( puxDestination ) : "memory" );
+
+		if( uxValue != uxExpected )
+		{
+			__asm volatile ( "clrex" ::: "memory" );
+			break;
+		}
+
+		__asm volatile ( "strex %0, %2, [%1]" : "=&r" ( ulFailed ) : "r" ( puxDestination ), "r" ( uxNew ) : "memory" );
+		xReturn = ( ulFailed == 0UL ) ? pdTRUE : pdFALSE;
+	} while( xReturn == pdFALSE );
+
+	return xReturn;
+}
+
+#define portCOMPARE_AND_SWAP( puxDestination, uxExpected, uxNew ) xPortCompareAndSwap( ( puxDestination ), ( uxExpected ), ( uxNew ) )
+/*-----------------------------------------------------------*/
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,591 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX (Linux host)
+ * port.
+ *
+ * Each task runs on its own host thread, created when the task is created.
+ * Only the thread of the task selected by the kernel is allowed to execute,
+ * every other task thread waits on its own event: a context switch signals the
+ * event of the task being resumed then waits on the event of the task being
+ * suspended.  The tick interrupt is the SIGALRM signal of an interval timer.
+ * Interrupts are disabled by masking the port signals in the calling thread,
+ * so a thread that is not running a task never takes an interrupt.
+ *
+ * C library calls that take internal locks (printf(), malloc(), ...) must be
+ * made from within a critical section or with the scheduler suspended, as a
+ * task may otherwise be switched out while holding the lock.
+ *----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Signal used as the tick interrupt, and signal used to wake the thread that
+started the scheduler once vTaskEndScheduler() is called. */
+#define portSIG_TICK				SIGALRM
+#define portSIG_RESUME				SIGUSR1
+
+/* Tick period of the interval timer. */
+#define portTICK_PERIOD_US			( 1000000UL / configTICK_RATE_HZ )
+
+/* Critical nesting value used before the scheduler is started, so critical
+sections left before the first task runs keep interrupts disabled, as on the
+hardware ports. */
+#define portINITIAL_CRITICAL_NESTING	( ( UBaseType_t ) 0xaaaaaaaa )
+
+/*-----------------------------------------------------------*/
+
+/* Event a suspended task thread waits on until it is selected again. */
+typedef struct xTHREAD_EVENT
+{
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCond;
+	BaseType_t xTriggered;
+} ThreadEvent_t;
+
+/* Port data of a task, kept at the top of the stack allocated by the kernel.
+The stack pointer saved in the TCB points just below it. */
+typedef struct xTHREAD
+{
+	pthread_t xThread;
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	volatile BaseType_t xDying;
+	ThreadEvent_t xEvent;
+} Thread_t;
+
+/*-----------------------------------------------------------*/
+
+/* The TCB of the running task, the first member of a TCB is its stack
+pointer. */
+extern void * volatile pxCurrentTCB;
+
+/* Signals treated as interrupts. */
+static sigset_t xInterruptSignals;
+
+/* Signal mask of the thread that started the scheduler, restored when the
+scheduler ends. */
+static sigset_t xSchedulerOriginalSignalMask;
+static pthread_t xSchedulerThread;
+static pthread_once_t xSignalsInitialised = PTHREAD_ONCE_INIT;
+static volatile BaseType_t xSchedulerEnd = pdFALSE;
+
+/* Critical nesting of the running task, saved by each thread across a context
+switch. */
+static volatile UBaseType_t uxCriticalNesting = portINITIAL_CRITICAL_NESTING;
+
+/* Set while the tick interrupt executes, a yield requested from an interrupt
+safe API function is then performed once the tick processing completes. */
+static volatile BaseType_t xInsideInterrupt = pdFALSE;
+static volatile BaseType_t xPendingYieldFromISR = pdFALSE;
+
+/* Time the scheduler was started, in microseconds of the monotonic clock. */
+static unsigned long long ullStartTimeUs = 0ULL;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Signal masks and handlers used by the port, installed once.
+ */
+static void prvSetupSignals( void );
+
+/*
+ * Start the interval timer that generates the tick interrupt.
+ */
+static void prvSetupTimerInterrupt( void );
+
+/*
+ * The tick interrupt.
+ */
+static void prvTickHandler( int iSignal );
+
+/*
+ * Entry point of every task thread, waits to be selected before calling the
+ * task function.
+ */
+static void *prvWaitForStart( void *pvParameters );
+
+/*
+ * Context switch from the thread of one task to the thread of another.
+ */
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend );
+static void prvSuspendSelf( Thread_t *pxThread );
+static void prvResumeThread( Thread_t *pxThread );
+static void prvEventUnlock( void *pvMutex );
+
+/*
+ * Select the next task and switch to its thread.
+ */
+static void prvYield( void );
+
+static void prvFatalError( const char *pcCall, int iErrno );
+static unsigned long long prvGetTimeUs( void );
+
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvGetThreadFromTask( void *pvTask )
+{
+StackType_t *pxTopOfStack = *( StackType_t ** ) pvTask;
+
+	return ( Thread_t * ) ( pxTopOfStack + 1 );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+pthread_attr_t xAttributes;
+sigset_t xSignalMask;
+int iReturn;
+
+	( void ) pthread_once( &xSignalsInitialised, prvSetupSignals );
+
+	/* The port data takes the top of the stack. */
+	pxThread = ( Thread_t * ) ( pxTopOfStack + 1 ) - 1;
+	pxTopOfStack = ( StackType_t * ) pxThread - 1;
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xDying = pdFALSE;
+	pxThread->xEvent.xTriggered = pdFALSE;
+	( void ) pthread_mutex_init( &( pxThread->xEvent.xMutex ), NULL );
+	( void ) pthread_cond_init( &( pxThread->xEvent.xCond ), NULL );
+
+	( void ) pthread_attr_init( &xAttributes );
+	( void ) pthread_attr_setstacksize( &xAttributes, configPOSIX_THREAD_STACK_SIZE );
+
+	/* The new thread inherits the signal mask of its creator, interrupts are
+	masked so it only takes one once its task runs.  This also keeps the
+	creating task from being switched out while the C library holds its
+	thread list lock. */
+	( void ) pthread_sigmask( SIG_BLOCK, &xInterruptSignals, &xSignalMask );
+	iReturn = pthread_create( &( pxThread->xThread ), &xAttributes, prvWaitForStart, pxThread );
+	( void ) pthread_sigmask( SIG_SETMASK, &xSignalMask, NULL );
+	( void ) pthread_attr_destroy( &xAttributes );
+
+	if( iReturn != 0 )
+	{
+		prvFatalError( "pthread_create", iReturn );
+	}
+
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+sigset_t xSignals;
+int iSignal;
+
+	( void ) pthread_once( &xSignalsInitialised, prvSetupSignals );
+	xSchedulerThread = pthread_self();
+
+	/* Start the timer that generates the tick interrupt. */
+	prvSetupTimerInterrupt();
+
+	/* Start the first task. */
+	prvResumeThread( prvGetThreadFromTask( pxCurrentTCB ) );
+
+	/* This thread does not run any task, it waits for vTaskEndScheduler(). */
+	( void ) sigemptyset( &xSignals );
+	( void ) sigaddset( &xSignals, portSIG_RESUME );
+	while( xSchedulerEnd == pdFALSE )
+	{
+		( void ) sigwait( &xSignals, &iSignal );
+	}
+
+	( void ) pthread_sigmask( SIG_SETMASK, &xSchedulerOriginalSignalMask, NULL );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+struct sigaction xAction;
+
+	/* Stop the tick, any tick already pending is ignored. */
+	memset( &xTimer, 0, sizeof( xTimer ) );
+	( void ) setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = SIG_IGN;
+	( void ) sigemptyset( &xAction.sa_mask );
+	( void ) sigaction( portSIG_TICK, &xAction, NULL );
+
+	/* Return from xPortStartScheduler() in the thread that called it, then
+	stop the calling task for good. */
+	xSchedulerEnd = pdTRUE;
+	( void ) pthread_kill( xSchedulerThread, portSIG_RESUME );
+
+	prvSuspendSelf( prvGetThreadFromTask( pxCurrentTCB ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	vPortDisableInterrupts();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	uxCriticalNesting--;
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_BLOCK, &xInterruptSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	( void ) pthread_sigmask( SIG_UNBLOCK, &xInterruptSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortSetInterruptMask( void )
+{
+sigset_t xSignalMask;
+
+	/* Returns pdTRUE if interrupts were already masked, which is always the
+	case from within the tick interrupt. */
+	( void ) pthread_sigmask( SIG_BLOCK, &xInterruptSignals, &xSignalMask );
+	return ( sigismember( &xSignalMask, portSIG_TICK ) == 1 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( BaseType_t xMask )
+{
+	if( xMask == pdFALSE )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	vPortEnterCritical();
+	prvYield();
+	vPortExitCritical();
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+	if( xInsideInterrupt != pdFALSE )
+	{
+		/* Performed by the tick interrupt on exit. */
+		xPendingYieldFromISR = pdTRUE;
+	}
+	else
+	{
+		/* Interrupt safe function called from a task. */
+		vPortYield();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortThreadDying( void *pxTaskToDelete, volatile BaseType_t *pxPendYield )
+{
+	( void ) pxPendYield;
+
+	/* The task deletes itself, its thread ends when it is switched out. */
+	prvGetThreadFromTask( pxTaskToDelete )->xDying = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pxTaskToDelete )
+{
+Thread_t *pxThread = prvGetThreadFromTask( pxTaskToDelete );
+BaseType_t xMask;
+
+	/* The thread is either ended or waiting on its event, it is reclaimed
+	before the kernel frees the stack holding the port data.  The tick is
+	masked while the C library updates its thread list. */
+	xMask = xPortSetInterruptMask();
+	if( pxThread->xDying == pdFALSE )
+	{
+		( void ) pthread_cancel( pxThread->xThread );
+	}
+	( void ) pthread_join( pxThread->xThread, NULL );
+	( void ) pthread_cond_destroy( &( pxThread->xEvent.xCond ) );
+	( void ) pthread_mutex_destroy( &( pxThread->xEvent.xMutex ) );
+	vPortClearInterruptMask( xMask );
+}
+/*-----------------------------------------------------------*/
+
+unsigned long ulPortGetRunTime( void )
+{
+	return ( unsigned long ) ( prvGetTimeUs() - ullStartTimeUs );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupSignals( void )
+{
+struct sigaction xAction;
+sigset_t xSignalMask;
+
+	( void ) sigemptyset( &xInterruptSignals );
+	( void ) sigaddset( &xInterruptSignals, portSIG_TICK );
+
+	/* Interrupts and the resume signal are blocked in this thread, and so in
+	every task thread created from now on.  Interrupts are unblocked in a task
+	thread when it runs for the first time. */
+	xSignalMask = xInterruptSignals;
+	( void ) sigaddset( &xSignalMask, portSIG_RESUME );
+	( void ) pthread_sigmask( SIG_BLOCK, &xSignalMask, &xSchedulerOriginalSignalMask );
+
+	/* Every signal is masked while the tick interrupt executes.  Interrupted
+	system calls are restarted, the task making them may have been switched
+	out meanwhile. */
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = prvTickHandler;
+	xAction.sa_flags = SA_RESTART;
+	( void ) sigfillset( &xAction.sa_mask );
+	if( sigaction( portSIG_TICK, &xAction, NULL ) != 0 )
+	{
+		prvFatalError( "sigaction", errno );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupTimerInterrupt( void )
+{
+struct itimerval xTimer;
+
+	xTimer.it_interval.tv_sec = 0;
+	xTimer.it_interval.tv_usec = portTICK_PERIOD_US;
+	xTimer.it_value = xTimer.it_interval;
+
+	ullStartTimeUs = prvGetTimeUs();
+	if( setitimer( ITIMER_REAL, &xTimer, NULL ) != 0 )
+	{
+		prvFatalError( "setitimer", errno );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickHandler( int iSignal )
+{
+Thread_t *pxThreadToSuspend;
+Thread_t *pxThreadToResume;
+
+	( void ) iSignal;
+
+	/* All signals are masked in the handler. */
+	uxCriticalNesting++;
+	xInsideInterrupt = pdTRUE;
+
+	pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCB );
+	if( ( xTaskIncrementTick() != pdFALSE ) || ( xPendingYieldFromISR != pdFALSE ) )
+	{
+		xPendingYieldFromISR = pdFALSE;
+		vTaskSwitchContext();
+		pxThreadToResume = prvGetThreadFromTask( pxCurrentTCB );
+
+		/* The interrupt is complete once the other thread runs. */
+		xInsideInterrupt = pdFALSE;
+		prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+	}
+
+	xInsideInterrupt = pdFALSE;
+	uxCriticalNesting--;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvWaitForStart( void *pvParameters )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParameters;
+
+	prvSuspendSelf( pxThread );
+
+	/* First run of the task: no critical section is held. */
+	uxCriticalNesting = 0;
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParameters );
+
+	/* A task function must not return, delete the task as other ports would
+	have trapped here. */
+	vTaskDelete( NULL );
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvYield( void )
+{
+Thread_t *pxThreadToSuspend;
+Thread_t *pxThreadToResume;
+
+	pxThreadToSuspend = prvGetThreadFromTask( pxCurrentTCB );
+	vTaskSwitchContext();
+	pxThreadToResume = prvGetThreadFromTask( pxCurrentTCB );
+
+	prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchThread( Thread_t *pxThreadToResume, Thread_t *pxThreadToSuspend )
+{
+UBaseType_t uxSavedCriticalNesting;
+
+	if( pxThreadToSuspend != pxThreadToResume )
+	{
+		/* The critical nesting belongs to the task, it is saved on the stack
+		of the thread being suspended and restored when it runs again. */
+		uxSavedCriticalNesting = uxCriticalNesting;
+
+		prvResumeThread( pxThreadToResume );
+		if( pxThreadToSuspend->xDying != pdFALSE )
+		{
+			/* Joined by vPortCancelThread() from the idle task. */
+			pthread_exit( NULL );
+		}
+		prvSuspendSelf( pxThreadToSuspend );
+
+		uxCriticalNesting = uxSavedCriticalNesting;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendSelf( Thread_t *pxThread )
+{
+	( void ) pthread_mutex_lock( &( pxThread->xEvent.xMutex ) );
+
+	/* A thread deleted while suspended is cancelled from within the wait. */
+	pthread_cleanup_push( prvEventUnlock, &( pxThread->xEvent.xMutex ) );
+	while( pxThread->xEvent.xTriggered == pdFALSE )
+	{
+		( void ) pthread_cond_wait( &( pxThread->xEvent.xCond ), &( pxThread->xEvent.xMutex ) );
+	}
+	pxThread->xEvent.xTriggered = pdFALSE;
+	pthread_cleanup_pop( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvResumeThread( Thread_t *pxThread )
+{
+	( void ) pthread_mutex_lock( &( pxThread->xEvent.xMutex ) );
+	pxThread->xEvent.xTriggered = pdTRUE;
+	( void ) pthread_cond_signal( &( pxThread->xEvent.xCond ) );
+	( void ) pthread_mutex_unlock( &( pxThread->xEvent.xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventUnlock( void *pvMutex )
+{
+	( void ) pthread_mutex_unlock( ( pthread_mutex_t * ) pvMutex );
+}
+/*-----------------------------------------------------------*/
+
+static void prvFatalError( const char *pcCall, int iErrno )
+{
+	fprintf( stderr, "FreeRTOS POSIX port: %s failed: %s\n", pcCall, strerror( iErrno ) );
+	abort();
+}
+/*-----------------------------------------------------------*/
+
+static unsigned long long prvGetTimeUs( void )
+{
+struct timespec xNow;
+
+	( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( ( unsigned long long ) xNow.tv_sec * 1000000ULL ) + ( ( unsigned long long ) xNow.tv_nsec / 1000ULL );
+}
+/*-----------------------------------------------------------*/
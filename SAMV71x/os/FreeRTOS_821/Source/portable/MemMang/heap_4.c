@@ -120,6 +120,11 @@ typedef struct A_BLOCK_LINK
  */
 static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert );
 
+/*
+ * Returns the vPortGetHeapStats() histogram class of an allocation request.
+ */
+static UBaseType_t prvHistogramBin( size_t xRequestedSize );
+
 /*
  * Called automatically to setup the required heap structures the first time
  * pvPortMalloc() is called.
@@ -140,6 +145,11 @@ fragmentation. */
 static size_t xFreeBytesRemaining = 0U;
 static size_t xMinimumEverFreeBytesRemaining = 0U;
 
+/* Counters reported by vPortGetHeapStats(). */
+static size_t xNumberOfSuccessfulAllocations = 0;
+static size_t xNumberOfSuccessfulFrees = 0;
+static size_t xAllocationHistogram[ portHEAP_HISTOGRAM_BINS ] = { 0 };
+
 /* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
 member of an BlockLink_t structure is set then the block belongs to the
 application.  When the bit is free the block is still part of the free heap
@@ -152,6 +162,7 @@ void *pvPortMalloc( size_t xWantedSize )
 {
 BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
 void *pvReturn = NULL;
+const size_t xRequestedSize = xWantedSize;
 
 	vTaskSuspendAll();
 	{
@@ -229,7 +240,7 @@ void *pvReturn = NULL;
 						cast is used to prevent byte alignment warnings from the
 						compiler. */
 						pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
-						configASSERT( ( ( ( uint32_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+						configASSERT( ( ( ( size_t ) pxNewBlockLink ) & portBYTE_ALIGNMENT_MASK ) == 0 );
 
 						/* Calculate the sizes of two blocks split from the
 						single block. */
@@ -259,6 +270,9 @@ void *pvReturn = NULL;
 					by the application and has no "next" block. */
 					pxBlock->xBlockSize |= xBlockAllocatedBit;
 					pxBlock->pxNextFreeBlock = NULL;
+
+					xNumberOfSuccessfulAllocations++;
+					xAllocationHistogram[ prvHistogramBin( xRequestedSize ) ]++;
 				}
 				else
 				{
@@ -293,7 +307,7 @@ void *pvReturn = NULL;
 	}
 	#endif
 
-	configASSERT( ( ( ( uint32_t ) pvReturn ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+	configASSERT( ( ( ( size_t ) pvReturn ) & portBYTE_ALIGNMENT_MASK ) == 0 );
 	return pvReturn;
 }
 /*-----------------------------------------------------------*/
@@ -328,6 +342,7 @@ BlockLink_t *pxLink;
 				{
 					/* Add this block to the list of free blocks. */
 					xFreeBytesRemaining += pxLink->xBlockSize;
+					xNumberOfSuccessfulFrees++;
 					traceFREE( pv, pxLink->xBlockSize );
 					prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
 				}
@@ -358,6 +373,82 @@ size_t xPortGetMinimumEverFreeHeapSize( void )
 }
 /*-----------------------------------------------------------*/
 
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+BlockLink_t *pxBlock;
+size_t xBlocks = 0, xMaxSize = 0, xMinSize = 0;
+UBaseType_t uxBin;
+
+	configASSERT( pxHeapStats );
+
+	vTaskSuspendAll();
+	{
+		/* The free list is walked, its length grows with fragmentation. */
+		if( pxEnd != NULL )
+		{
+			for( pxBlock = xStart.pxNextFreeBlock; pxBlock != pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+			{
+				xBlocks++;
+
+				if( pxBlock->xBlockSize > xMaxSize )
+				{
+					xMaxSize = pxBlock->xBlockSize;
+				}
+
+				if( ( xMinSize == 0 ) || ( pxBlock->xBlockSize < xMinSize ) )
+				{
+					xMinSize = pxBlock->xBlockSize;
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+		pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+		pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+
+		for( uxBin = 0; uxBin < ( UBaseType_t ) portHEAP_HISTOGRAM_BINS; uxBin++ )
+		{
+			pxHeapStats->xAllocationHistogram[ uxBin ] = xAllocationHistogram[ uxBin ];
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( xFreeBytesRemaining > 0 )
+	{
+		pxHeapStats->uxFragmentationPercent = ( UBaseType_t ) ( ( ( uint64_t ) ( xFreeBytesRemaining - xMaxSize ) * 100U ) / xFreeBytesRemaining );
+	}
+	else
+	{
+		pxHeapStats->uxFragmentationPercent = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvHistogramBin( size_t xRequestedSize )
+{
+UBaseType_t uxBin = 0;
+
+	/* Class 0 is below 32 bytes, then one class per power of two. */
+	xRequestedSize >>= 5;
+
+	while( ( xRequestedSize != 0 ) && ( uxBin < ( ( UBaseType_t ) portHEAP_HISTOGRAM_BINS - 1 ) ) )
+	{
+		xRequestedSize >>= 1;
+		uxBin++;
+	}
+
+	return uxBin;
+}
+/*-----------------------------------------------------------*/
+
 void vPortInitialiseBlocks( void )
 {
 	/* This just exists to keep the linker quiet. */
@@ -368,17 +459,17 @@ static void prvHeapInit( void )
 {
 BlockLink_t *pxFirstFreeBlock;
 uint8_t *pucAlignedHeap;
-uint32_t ulAddress;
+size_t ulAddress;
 size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
 
 	/* Ensure the heap starts on a correctly aligned boundary. */
-	ulAddress = ( uint32_t ) ucHeap;
+	ulAddress = ( size_t ) ucHeap;
 
 	if( ( ulAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
 	{
 		ulAddress += ( portBYTE_ALIGNMENT - 1 );
-		ulAddress &= ~( ( uint32_t ) portBYTE_ALIGNMENT_MASK );
-		xTotalHeapSize -= ulAddress - ( uint32_t ) ucHeap;
+		ulAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+		xTotalHeapSize -= ulAddress - ( size_t ) ucHeap;
 	}
 
 	pucAlignedHeap = ( uint8_t * ) ulAddress;
@@ -390,9 +481,9 @@ size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
 
 	/* pxEnd is used to mark the end of the list of free blocks and is inserted
 	at the end of the heap space. */
-	ulAddress = ( ( uint32_t ) pucAlignedHeap ) + xTotalHeapSize;
+	ulAddress = ( ( size_t ) pucAlignedHeap ) + xTotalHeapSize;
 	ulAddress -= xHeapStructSize;
-	ulAddress &= ~( ( uint32_t ) portBYTE_ALIGNMENT_MASK );
+	ulAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
 	pxEnd = ( void * ) ulAddress;
 	pxEnd->xBlockSize = 0;
 	pxEnd->pxNextFreeBlock = NULL;
@@ -400,7 +491,7 @@ size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
 	/* To start with there is a single free block that is sized to take up the
 	entire heap space, minus the space taken by pxEnd. */
 	pxFirstFreeBlock = ( void * ) pucAlignedHeap;
-	pxFirstFreeBlock->xBlockSize = ulAddress - ( uint32_t ) pxFirstFreeBlock;
+	pxFirstFreeBlock->xBlockSize = ulAddress - ( size_t ) pxFirstFreeBlock;
 	pxFirstFreeBlock->pxNextFreeBlock = pxEnd;
 
 	/* Only one block exists - and it covers the entire usable heap space. */
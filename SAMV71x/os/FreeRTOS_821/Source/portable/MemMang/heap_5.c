@@ -145,6 +145,11 @@ typedef struct A_BLOCK_LINK
  */
 static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert );
 
+/*
+ * Returns the vPortGetHeapStats() histogram class of an allocation request.
+ */
+static UBaseType_t prvHistogramBin( size_t xRequestedSize );
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -159,6 +164,11 @@ fragmentation. */
 static size_t xFreeBytesRemaining = 0;
 static size_t xMinimumEverFreeBytesRemaining = 0;
 
+/* Counters reported by vPortGetHeapStats(). */
+static size_t xNumberOfSuccessfulAllocations = 0;
+static size_t xNumberOfSuccessfulFrees = 0;
+static size_t xAllocationHistogram[ portHEAP_HISTOGRAM_BINS ] = { 0 };
+
 /* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
 member of an BlockLink_t structure is set then the block belongs to the
 application.  When the bit is free the block is still part of the free heap
@@ -171,6 +181,7 @@ void *pvPortMalloc( size_t xWantedSize )
 {
 BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
 void *pvReturn = NULL;
+const size_t xRequestedSize = xWantedSize;
 
 	/* The heap must be initialised before the first call to
 	prvPortMalloc(). */
@@ -269,6 +280,9 @@ void *pvReturn = NULL;
 					by the application and has no "next" block. */
 					pxBlock->xBlockSize |= xBlockAllocatedBit;
 					pxBlock->pxNextFreeBlock = NULL;
+
+					xNumberOfSuccessfulAllocations++;
+					xAllocationHistogram[ prvHistogramBin( xRequestedSize ) ]++;
 				}
 				else
 				{
@@ -337,6 +351,7 @@ BlockLink_t *pxLink;
 				{
 					/* Add this block to the list of free blocks. */
 					xFreeBytesRemaining += pxLink->xBlockSize;
+					xNumberOfSuccessfulFrees++;
 					traceFREE( pv, pxLink->xBlockSize );
 					prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
 				}
@@ -367,6 +382,87 @@ size_t xPortGetMinimumEverFreeHeapSize( void )
 }
 /*-----------------------------------------------------------*/
 
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+BlockLink_t *pxBlock;
+size_t xBlocks = 0, xMaxSize = 0, xMinSize = 0;
+UBaseType_t uxBin;
+
+	configASSERT( pxHeapStats );
+
+	vTaskSuspendAll();
+	{
+		/* The free list is walked, its length grows with fragmentation.  The
+		end markers of all but the last region are in the list, with a size of
+		zero. */
+		if( pxEnd != NULL )
+		{
+			for( pxBlock = xStart.pxNextFreeBlock; pxBlock != pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+			{
+				if( pxBlock->xBlockSize != 0 )
+				{
+					xBlocks++;
+
+					if( pxBlock->xBlockSize > xMaxSize )
+					{
+						xMaxSize = pxBlock->xBlockSize;
+					}
+
+					if( ( xMinSize == 0 ) || ( pxBlock->xBlockSize < xMinSize ) )
+					{
+						xMinSize = pxBlock->xBlockSize;
+					}
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+		pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+		pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+		pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+
+		for( uxBin = 0; uxBin < ( UBaseType_t ) portHEAP_HISTOGRAM_BINS; uxBin++ )
+		{
+			pxHeapStats->xAllocationHistogram[ uxBin ] = xAllocationHistogram[ uxBin ];
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( xFreeBytesRemaining > 0 )
+	{
+		pxHeapStats->uxFragmentationPercent = ( UBaseType_t ) ( ( ( uint64_t ) ( xFreeBytesRemaining - xMaxSize ) * 100U ) / xFreeBytesRemaining );
+	}
+	else
+	{
+		pxHeapStats->uxFragmentationPercent = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvHistogramBin( size_t xRequestedSize )
+{
+UBaseType_t uxBin = 0;
+
+	/* Class 0 is below 32 bytes, then one class per power of two. */
+	xRequestedSize >>= 5;
+
+	while( ( xRequestedSize != 0 ) && ( uxBin < ( ( UBaseType_t ) portHEAP_HISTOGRAM_BINS - 1 ) ) )
+	{
+		xRequestedSize >>= 1;
+		uxBin++;
+	}
+
+	return uxBin;
+}
+/*-----------------------------------------------------------*/
+
 static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert )
 {
 BlockLink_t *pxIterator;
@@ -434,7 +530,7 @@ BlockLink_t *pxFirstFreeBlockInRegion = NULL, *pxPreviousFreeBlock;
 uint8_t *pucAlignedHeap;
 size_t xTotalRegionSize, xTotalHeapSize = 0;
 BaseType_t xDefinedRegions = 0;
-uint32_t ulAddress;
+size_t ulAddress;
 const HeapRegion_t *pxHeapRegion;
 
 	/* Can only call once! */
@@ -447,14 +543,14 @@ const HeapRegion_t *pxHeapRegion;
 		xTotalRegionSize = pxHeapRegion->xSizeInBytes;
 
 		/* Ensure the heap region starts on a correctly aligned boundary. */
-		ulAddress = ( uint32_t ) pxHeapRegion->pucStartAddress;
+		ulAddress = ( size_t ) pxHeapRegion->pucStartAddress;
 		if( ( ulAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
 		{
 			ulAddress += ( portBYTE_ALIGNMENT - 1 );
 			ulAddress &= ~portBYTE_ALIGNMENT_MASK;
 
 			/* Adjust the size for the bytes lost to alignment. */
-			xTotalRegionSize -= ulAddress - ( uint32_t ) pxHeapRegion->pucStartAddress;
+			xTotalRegionSize -= ulAddress - ( size_t ) pxHeapRegion->pucStartAddress;
 		}
 
 		pucAlignedHeap = ( uint8_t * ) ulAddress;
@@ -474,7 +570,7 @@ const HeapRegion_t *pxHeapRegion;
 			configASSERT( pxEnd != NULL );
 
 			/* Check blocks are passed in with increasing start addresses. */
-			configASSERT( ulAddress > ( uint32_t ) pxEnd );
+			configASSERT( ulAddress > ( size_t ) pxEnd );
 		}
 
 		/* Remember the location of the end marker in the previous region, if
@@ -483,7 +579,7 @@ const HeapRegion_t *pxHeapRegion;
 
 		/* pxEnd is used to mark the end of the list of free blocks and is
 		inserted at the end of the region space. */
-		ulAddress = ( ( uint32_t ) pucAlignedHeap ) + xTotalRegionSize;
+		ulAddress = ( ( size_t ) pucAlignedHeap ) + xTotalRegionSize;
 		ulAddress -= uxHeapStructSize;
 		ulAddress &= ~portBYTE_ALIGNMENT_MASK;
 		pxEnd = ( BlockLink_t * ) ulAddress;
@@ -494,7 +590,7 @@ const HeapRegion_t *pxHeapRegion;
 		sized to take up the entire heap region minus the space taken by the
 		free block structure. */
 		pxFirstFreeBlockInRegion = ( BlockLink_t * ) pucAlignedHeap;
-		pxFirstFreeBlockInRegion->xBlockSize = ulAddress - ( uint32_t ) pxFirstFreeBlockInRegion;
+		pxFirstFreeBlockInRegion->xBlockSize = ulAddress - ( size_t ) pxFirstFreeBlockInRegion;
 		pxFirstFreeBlockInRegion->pxNextFreeBlock = pxEnd;
 
 		/* If this is not the first region that makes up the entire heap space
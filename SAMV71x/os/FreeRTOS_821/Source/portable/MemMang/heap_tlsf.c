@@ -0,0 +1,875 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * An implementation of pvPortMalloc() and vPortFree() using the two level
+ * segregated fit (TLSF) method, so both run in constant time whatever the
+ * number and the size of the free blocks.  heap_4.c searches an address
+ * ordered list of free blocks, so its worst case time grows with
+ * fragmentation.
+ *
+ * Free blocks are kept in one list per size class.  The first level splits
+ * sizes by powers of two, the second level splits each power of two into
+ * heapSL_INDEX_COUNT linear classes.  A bitmap per level records the non
+ * empty lists, so the smallest class able to satisfy a request is found with
+ * two find-first-set operations.  Like heap_4.c, freed blocks are merged with
+ * the free blocks next to them in memory, each block header recording the
+ * block before it.  The request is rounded up to the next class boundary, so
+ * up to 1 / heapSL_INDEX_COUNT of a block can be left unused (the good fit
+ * trade off of TLSF).
+ *
+ * The default heap is the ucHeap array of configTOTAL_HEAP_SIZE bytes, as
+ * heap_4.c, and the largest block is below 2 ^ heapFL_INDEX_MAX bytes.
+ * vPortGetHeapStats() reports fragmentation and the sizes allocated.
+ *
+ * Up to portHEAP_REGION_COUNT - 1 more regions, each with its own free lists
+ * and statistics, can be added by vPortAddHeapRegion() and allocated from by
+ * pvPortMallocRegion().  On the SAMV71 that places:
+ *  - portHEAP_REGION_FAST in DTCM (ENABLE_TCM), zero wait state and never
+ *    cached, for task stacks and the buffers of hot queues.
+ *  - portHEAP_REGION_DMA in the non cacheable SRAM (MPU_HAS_NOCACHE_REGION),
+ *    for buffers shared with the XDMAC or a peripheral DMA.
+ *  - portHEAP_REGION_BULK in the SDRAM at SDRAM_START_ADDRESS, added once
+ *    BOARD_ConfigureSdram() has run, for frame buffers and other large
+ *    buffers.
+ * vPortFree() finds the region of a block from its address.  Task stacks go
+ * to a region by defining pvPortMallocAligned() in FreeRTOSConfig.h, see
+ * portable.h.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* Second level classes per power of two, as a power of two. */
+#define heapSL_INDEX_COUNT_LOG2	( 4 )
+#define heapSL_INDEX_COUNT		( 1 << heapSL_INDEX_COUNT_LOG2 )
+
+/* Blocks of 2 ^ heapFL_INDEX_MAX bytes or more cannot be managed. */
+#define heapFL_INDEX_MAX		( 24 )
+
+/* Blocks below heapSMALL_BLOCK_SIZE are all in the first list of the first
+level, split in classes of portBYTE_ALIGNMENT bytes. */
+#if portBYTE_ALIGNMENT == 16
+	#define heapALIGNMENT_LOG2	( 4 )
+#elif portBYTE_ALIGNMENT == 8
+	#define heapALIGNMENT_LOG2	( 3 )
+#elif portBYTE_ALIGNMENT == 4
+	#define heapALIGNMENT_LOG2	( 2 )
+#else
+	#error heap_tlsf.c needs portBYTE_ALIGNMENT to be 4, 8 or 16, the low bits of the block sizes hold flags.
+#endif
+
+#define heapFL_INDEX_SHIFT		( heapSL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapFL_INDEX_COUNT		( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 1 )
+#define heapSMALL_BLOCK_SIZE	( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+/* Set in xBlockSize while the block is free. */
+#define heapBLOCK_FREE_BIT		( ( size_t ) 1 )
+#define heapBLOCK_SIZE( pxBlock ) ( ( pxBlock )->xBlockSize & ~heapBLOCK_FREE_BIT )
+
+/* Find last set and find first set on a non zero 32-bit map. */
+#if defined( __GNUC__ )
+	#define heapFLS( ulMap )	( 31 - __builtin_clz( ( unsigned int ) ( ulMap ) ) )
+	#define heapFFS( ulMap )	( __builtin_ctz( ( unsigned int ) ( ulMap ) ) )
+#else
+	#define heapFLS( ulMap )	prvFindLastSet( ulMap )
+	#define heapFFS( ulMap )	prvFindLastSet( ( ulMap ) & ( ~( ulMap ) + 1UL ) )
+#endif
+
+/* Allocate the memory for the heap. */
+#if( configAPPLICATION_ALLOCATED_HEAP == 1 )
+	/* The application writer has already defined the array used for the RTOS
+	heap - probably so it can be placed in a special segment or address. */
+	extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+	static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Every block starts with the first two members.  The free list links are
+only valid while the block is free, they are the first bytes handed to the
+application once it is allocated. */
+typedef struct A_BLOCK_HEADER
+{
+	struct A_BLOCK_HEADER *pxPrevPhysBlock;		/*<< The block before this one in memory, NULL for the first. */
+	size_t xBlockSize;							/*<< Header included, heapBLOCK_FREE_BIT set while free. */
+	struct A_BLOCK_HEADER *pxNextFreeBlock;		/*<< The next free block of the same class. */
+	struct A_BLOCK_HEADER *pxPrevFreeBlock;		/*<< The previous free block of the same class. */
+} BlockHeader_t;
+
+/* A region: its free lists, the bitmaps of the non empty ones and its
+statistics. */
+typedef struct A_HEAP_CONTROL
+{
+	uint32_t ulFLBitmap;
+	uint32_t ulSLBitmap[ heapFL_INDEX_COUNT ];
+	BlockHeader_t *pxFreeBlocks[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+	BlockHeader_t *pxStart;						/*<< The first block of the region. */
+	BlockHeader_t *pxEnd;						/*<< The zero sized allocated block ending the region, NULL until the region is defined. */
+	size_t xFreeBytesRemaining;
+	size_t xMinimumEverFreeBytesRemaining;
+	size_t xNumberOfSuccessfulAllocations;
+	size_t xNumberOfSuccessfulFrees;
+	size_t xAllocationHistogram[ portHEAP_HISTOGRAM_BINS ];
+} HeapControl_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Turns the xSizeInBytes bytes at pucStartAddress into a region holding a
+ * single free block.
+ */
+static void prvRegionInit( HeapControl_t *pxHeap, uint8_t *pucStartAddress, size_t xSizeInBytes );
+
+/*
+ * Allocates from one region, NULL if no free block of the region is large
+ * enough.  Called with the scheduler suspended.
+ */
+static void *prvAllocate( HeapControl_t *pxHeap, size_t xWantedSize );
+
+/*
+ * The region holding pxBlock, NULL if pxBlock is in none of them.
+ */
+static HeapControl_t *prvRegionOfBlock( const BlockHeader_t *pxBlock );
+
+/*
+ * The class holding free blocks of xSize bytes, and the smallest class whose
+ * blocks are all at least xSize bytes.
+ */
+static void prvMappingInsert( size_t xSize, UBaseType_t *puxFL, UBaseType_t *puxSL );
+static BaseType_t prvMappingSearch( size_t xSize, UBaseType_t *puxFL, UBaseType_t *puxSL );
+
+/*
+ * Take the first block of the smallest non empty class at or above
+ * *puxFL / *puxSL, NULL if there is none.
+ */
+static BlockHeader_t *prvSearchSuitableBlock( HeapControl_t *pxHeap, UBaseType_t *puxFL, UBaseType_t *puxSL );
+
+/*
+ * Add a free block to the list of its class, remove a free block from it.
+ */
+static void prvInsertFreeBlock( HeapControl_t *pxHeap, BlockHeader_t *pxBlock );
+static void prvRemoveFreeBlock( HeapControl_t *pxHeap, BlockHeader_t *pxBlock );
+
+/*
+ * Returns the vPortGetHeapStats() histogram class of an allocation request.
+ */
+static UBaseType_t prvHistogramBin( size_t xRequestedSize );
+
+#if !defined( __GNUC__ )
+	static UBaseType_t prvFindLastSet( uint32_t ulMap );
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* The part of the header kept in allocated blocks, and the smallest block,
+able to hold the free list links once freed.  Both keep blocks aligned. */
+static const size_t xHeapStructSize	= ( ( ( sizeof( BlockHeader_t * ) + sizeof( size_t ) ) + ( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) );
+static const size_t xMinimumBlockSize = ( ( sizeof( BlockHeader_t ) + ( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) );
+
+/* One control structure per region, indexed by the portHEAP_REGION_xxx
+values.  The default region is set up on ucHeap by the first allocation if
+vPortAddHeapRegion() did not define it before. */
+static HeapControl_t xHeapControls[ portHEAP_REGION_COUNT ];
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMallocRegion( size_t xWantedSize, UBaseType_t uxRegionHint )
+{
+void *pvReturn;
+
+	configASSERT( uxRegionHint < ( UBaseType_t ) portHEAP_REGION_COUNT );
+
+	if( uxRegionHint >= ( UBaseType_t ) portHEAP_REGION_COUNT )
+	{
+		uxRegionHint = portHEAP_REGION_DEFAULT;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	vTaskSuspendAll();
+	{
+		/* If this is the first call to malloc then the default region will
+		require initialisation to setup the free lists. */
+		if( xHeapControls[ portHEAP_REGION_DEFAULT ].pxEnd == NULL )
+		{
+			prvRegionInit( &( xHeapControls[ portHEAP_REGION_DEFAULT ] ), ucHeap, configTOTAL_HEAP_SIZE );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pvReturn = prvAllocate( &( xHeapControls[ uxRegionHint ] ), xWantedSize );
+
+		/* The fast and bulk regions are a preference, an allocation that does
+		not fit there comes from the default region.  DMA buffers must not end
+		up in cacheable memory, so they never do. */
+		if( ( pvReturn == NULL ) && ( uxRegionHint != portHEAP_REGION_DEFAULT ) && ( uxRegionHint != portHEAP_REGION_DMA ) )
+		{
+			pvReturn = prvAllocate( &( xHeapControls[ portHEAP_REGION_DEFAULT ] ), xWantedSize );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+	}
+	( void ) xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	configASSERT( ( ( ( size_t ) pvReturn ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+	return pvPortMallocRegion( xWantedSize, portHEAP_REGION_DEFAULT );
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+BlockHeader_t *pxBlock, *pxNeighbour;
+HeapControl_t *pxHeap;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a header immediately before it. */
+		pxBlock = ( BlockHeader_t * ) ( ( ( uint8_t * ) pv ) - xHeapStructSize );
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) == 0 );
+		configASSERT( pxBlock->xBlockSize >= xMinimumBlockSize );
+
+		if( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) == 0 )
+		{
+			vTaskSuspendAll();
+			{
+				pxHeap = prvRegionOfBlock( pxBlock );
+				configASSERT( pxHeap );
+
+				if( pxHeap != NULL )
+				{
+					pxHeap->xFreeBytesRemaining += pxBlock->xBlockSize;
+					pxHeap->xNumberOfSuccessfulFrees++;
+					traceFREE( pv, pxBlock->xBlockSize );
+
+					/* Merge with the block before, if free. */
+					pxNeighbour = pxBlock->pxPrevPhysBlock;
+
+					if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0 ) )
+					{
+						prvRemoveFreeBlock( pxHeap, pxNeighbour );
+						pxNeighbour->xBlockSize = heapBLOCK_SIZE( pxNeighbour ) + pxBlock->xBlockSize;
+						pxBlock = pxNeighbour;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* Merge with the block after, if free.  The end marker is
+					never free. */
+					pxNeighbour = ( BlockHeader_t * ) ( ( ( uint8_t * ) pxBlock ) + pxBlock->xBlockSize );
+
+					if( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0 )
+					{
+						prvRemoveFreeBlock( pxHeap, pxNeighbour );
+						pxBlock->xBlockSize += heapBLOCK_SIZE( pxNeighbour );
+						pxNeighbour = ( BlockHeader_t * ) ( ( ( uint8_t * ) pxBlock ) + pxBlock->xBlockSize );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					pxNeighbour->pxPrevPhysBlock = pxBlock;
+					prvInsertFreeBlock( pxHeap, pxBlock );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			( void ) xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortAddHeapRegion( UBaseType_t uxRegion, uint8_t *pucStartAddress, size_t xSizeInBytes )
+{
+	configASSERT( uxRegion < ( UBaseType_t ) portHEAP_REGION_COUNT );
+	configASSERT( pucStartAddress );
+
+	if( ( uxRegion < ( UBaseType_t ) portHEAP_REGION_COUNT ) && ( pucStartAddress != NULL ) )
+	{
+		vTaskSuspendAll();
+		{
+			/* A region is defined once, and the default region only before it
+			has been set up on ucHeap. */
+			configASSERT( xHeapControls[ uxRegion ].pxEnd == NULL );
+
+			if( xHeapControls[ uxRegion ].pxEnd == NULL )
+			{
+				prvRegionInit( &( xHeapControls[ uxRegion ] ), pucStartAddress, xSizeInBytes );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xHeapControls[ portHEAP_REGION_DEFAULT ].xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xHeapControls[ portHEAP_REGION_DEFAULT ].xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t *pxHeapStats )
+{
+	vPortGetHeapRegionStats( portHEAP_REGION_DEFAULT, pxHeapStats );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapRegionStats( UBaseType_t uxRegion, HeapStats_t *pxHeapStats )
+{
+const HeapControl_t *pxHeap;
+BlockHeader_t *pxBlock;
+size_t xBlocks = 0, xMaxSize = 0, xMinSize = 0, xSize, xFree;
+UBaseType_t uxFL, uxSL, uxBin;
+
+	configASSERT( pxHeapStats );
+	configASSERT( uxRegion < ( UBaseType_t ) portHEAP_REGION_COUNT );
+
+	pxHeap = &( xHeapControls[ uxRegion ] );
+
+	vTaskSuspendAll();
+	{
+		/* Unlike allocations, the statistics walk every free list. */
+		for( uxFL = 0; uxFL < ( UBaseType_t ) heapFL_INDEX_COUNT; uxFL++ )
+		{
+			for( uxSL = 0; uxSL < ( UBaseType_t ) heapSL_INDEX_COUNT; uxSL++ )
+			{
+				for( pxBlock = pxHeap->pxFreeBlocks[ uxFL ][ uxSL ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+				{
+					xSize = heapBLOCK_SIZE( pxBlock );
+					xBlocks++;
+
+					if( xSize > xMaxSize )
+					{
+						xMaxSize = xSize;
+					}
+
+					if( ( xMinSize == 0 ) || ( xSize < xMinSize ) )
+					{
+						xMinSize = xSize;
+					}
+				}
+			}
+		}
+
+		xFree = pxHeap->xFreeBytesRemaining;
+		pxHeapStats->xAvailableHeapSpaceInBytes = xFree;
+		pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+		pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+		pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+		pxHeapStats->xMinimumEverFreeBytesRemaining = pxHeap->xMinimumEverFreeBytesRemaining;
+		pxHeapStats->xNumberOfSuccessfulAllocations = pxHeap->xNumberOfSuccessfulAllocations;
+		pxHeapStats->xNumberOfSuccessfulFrees = pxHeap->xNumberOfSuccessfulFrees;
+
+		for( uxBin = 0; uxBin < ( UBaseType_t ) portHEAP_HISTOGRAM_BINS; uxBin++ )
+		{
+			pxHeapStats->xAllocationHistogram[ uxBin ] = pxHeap->xAllocationHistogram[ uxBin ];
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( xFree > 0 )
+	{
+		pxHeapStats->uxFragmentationPercent = ( UBaseType_t ) ( ( ( uint64_t ) ( xFree - xMaxSize ) * 100U ) / xFree );
+	}
+	else
+	{
+		pxHeapStats->uxFragmentationPercent = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void *prvAllocate( HeapControl_t *pxHeap, size_t xWantedSize )
+{
+BlockHeader_t *pxBlock, *pxNewBlock, *pxNextBlock;
+UBaseType_t uxFL, uxSL;
+void *pvReturn = NULL;
+const size_t xRequestedSize = xWantedSize;
+
+	/* Requests that would overflow once the header is added, or that no class
+	can hold, fail.  A region not defined has no free bytes. */
+	if( ( xWantedSize > 0 ) && ( xWantedSize < ( ( ( size_t ) 1 ) << heapFL_INDEX_MAX ) ) )
+	{
+		/* The wanted size is increased so it can contain the header, then
+		aligned, and made large enough to be freed. */
+		xWantedSize += xHeapStructSize;
+		xWantedSize = ( xWantedSize + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+		if( xWantedSize < xMinimumBlockSize )
+		{
+			xWantedSize = xMinimumBlockSize;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( xWantedSize <= pxHeap->xFreeBytesRemaining ) && ( prvMappingSearch( xWantedSize, &uxFL, &uxSL ) != pdFALSE ) )
+		{
+			pxBlock = prvSearchSuitableBlock( pxHeap, &uxFL, &uxSL );
+
+			if( pxBlock != NULL )
+			{
+				prvRemoveFreeBlock( pxHeap, pxBlock );
+				pxBlock->xBlockSize &= ~heapBLOCK_FREE_BIT;
+
+				/* If the block is larger than required the end of it is
+				returned to the free lists. */
+				if( ( pxBlock->xBlockSize - xWantedSize ) >= xMinimumBlockSize )
+				{
+					pxNewBlock = ( BlockHeader_t * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+					configASSERT( ( ( ( size_t ) pxNewBlock ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+					pxNewBlock->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+					pxNewBlock->pxPrevPhysBlock = pxBlock;
+					pxBlock->xBlockSize = xWantedSize;
+
+					pxNextBlock = ( BlockHeader_t * ) ( ( ( uint8_t * ) pxNewBlock ) + pxNewBlock->xBlockSize );
+					pxNextBlock->pxPrevPhysBlock = pxNewBlock;
+
+					prvInsertFreeBlock( pxHeap, pxNewBlock );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxHeap->xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+				if( pxHeap->xFreeBytesRemaining < pxHeap->xMinimumEverFreeBytesRemaining )
+				{
+					pxHeap->xMinimumEverFreeBytesRemaining = pxHeap->xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxHeap->xNumberOfSuccessfulAllocations++;
+				pxHeap->xAllocationHistogram[ prvHistogramBin( xRequestedSize ) ]++;
+
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static HeapControl_t *prvRegionOfBlock( const BlockHeader_t *pxBlock )
+{
+HeapControl_t *pxHeap = NULL;
+UBaseType_t uxRegion;
+
+	/* A handful of address compares, whatever the number of blocks. */
+	for( uxRegion = 0; uxRegion < ( UBaseType_t ) portHEAP_REGION_COUNT; uxRegion++ )
+	{
+		if( ( xHeapControls[ uxRegion ].pxEnd != NULL ) &&
+			( ( size_t ) pxBlock >= ( size_t ) xHeapControls[ uxRegion ].pxStart ) &&
+			( ( size_t ) pxBlock < ( size_t ) xHeapControls[ uxRegion ].pxEnd ) )
+		{
+			pxHeap = &( xHeapControls[ uxRegion ] );
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return pxHeap;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRegionInit( HeapControl_t *pxHeap, uint8_t *pucStartAddress, size_t xSizeInBytes )
+{
+BlockHeader_t *pxFirstFreeBlock;
+size_t ulAddress;
+size_t xTotalHeapSize = xSizeInBytes;
+
+	/* Ensure the region starts on a correctly aligned boundary. */
+	ulAddress = ( size_t ) pucStartAddress;
+
+	if( ( ulAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+	{
+		ulAddress += ( portBYTE_ALIGNMENT - 1 );
+		ulAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+		xTotalHeapSize -= ulAddress - ( size_t ) pucStartAddress;
+	}
+
+	/* The single free block must fit the largest class, the end of a larger
+	region is left unused. */
+	if( xTotalHeapSize >= ( ( ( size_t ) 1 ) << heapFL_INDEX_MAX ) )
+	{
+		xTotalHeapSize = ( ( ( size_t ) 1 ) << heapFL_INDEX_MAX ) - portBYTE_ALIGNMENT;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The region must hold its end marker and a block. */
+	configASSERT( xTotalHeapSize >= ( xHeapStructSize + xMinimumBlockSize ) );
+
+	pxFirstFreeBlock = ( BlockHeader_t * ) ulAddress;
+	pxHeap->pxStart = pxFirstFreeBlock;
+
+	/* pxEnd marks the end of the region, as an allocated block of size zero so
+	the block before it is never merged past the end. */
+	ulAddress += xTotalHeapSize;
+	ulAddress -= xHeapStructSize;
+	ulAddress &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+	pxHeap->pxEnd = ( BlockHeader_t * ) ulAddress;
+	pxHeap->pxEnd->xBlockSize = 0;
+	pxHeap->pxEnd->pxPrevPhysBlock = pxFirstFreeBlock;
+
+	/* To start with there is a single free block that is sized to take up the
+	entire region, minus the space taken by pxEnd. */
+	pxFirstFreeBlock->pxPrevPhysBlock = NULL;
+	pxFirstFreeBlock->xBlockSize = ulAddress - ( size_t ) pxFirstFreeBlock;
+	prvInsertFreeBlock( pxHeap, pxFirstFreeBlock );
+
+	pxHeap->xMinimumEverFreeBytesRemaining = heapBLOCK_SIZE( pxFirstFreeBlock );
+	pxHeap->xFreeBytesRemaining = pxHeap->xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xSize, UBaseType_t *puxFL, UBaseType_t *puxSL )
+{
+UBaseType_t uxFL;
+
+	if( xSize < heapSMALL_BLOCK_SIZE )
+	{
+		/* Small blocks are split linearly in the first list. */
+		*puxFL = 0;
+		*puxSL = ( UBaseType_t ) ( xSize >> heapALIGNMENT_LOG2 );
+	}
+	else
+	{
+		/* The first level is the power of two, the second level the next
+		heapSL_INDEX_COUNT_LOG2 bits. */
+		uxFL = ( UBaseType_t ) heapFLS( xSize );
+		*puxSL = ( UBaseType_t ) ( ( xSize >> ( uxFL - heapSL_INDEX_COUNT_LOG2 ) ) ^ ( ( size_t ) 1 << heapSL_INDEX_COUNT_LOG2 ) );
+		*puxFL = uxFL - ( heapFL_INDEX_SHIFT - 1 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvMappingSearch( size_t xSize, UBaseType_t *puxFL, UBaseType_t *puxSL )
+{
+	/* Round up to the next class boundary, so every block of the class found
+	is large enough. */
+	if( xSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xSize += ( ( ( size_t ) 1 ) << ( heapFLS( xSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMappingInsert( xSize, puxFL, puxSL );
+
+	return ( *puxFL < ( UBaseType_t ) heapFL_INDEX_COUNT ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static BlockHeader_t *prvSearchSuitableBlock( HeapControl_t *pxHeap, UBaseType_t *puxFL, UBaseType_t *puxSL )
+{
+uint32_t ulSLMap, ulFLMap;
+BlockHeader_t *pxBlock = NULL;
+
+	/* A class of the same power of two, at or above the one asked for... */
+	ulSLMap = pxHeap->ulSLBitmap[ *puxFL ] & ( ~( uint32_t ) 0 << *puxSL );
+
+	if( ulSLMap == 0 )
+	{
+		/* ...else the smallest class of a larger power of two. */
+		ulFLMap = ( *puxFL + 1 < 32 ) ? ( pxHeap->ulFLBitmap & ( ~( uint32_t ) 0 << ( *puxFL + 1 ) ) ) : 0;
+
+		if( ulFLMap != 0 )
+		{
+			*puxFL = ( UBaseType_t ) heapFFS( ulFLMap );
+			ulSLMap = pxHeap->ulSLBitmap[ *puxFL ];
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( ulSLMap != 0 )
+	{
+		*puxSL = ( UBaseType_t ) heapFFS( ulSLMap );
+		pxBlock = pxHeap->pxFreeBlocks[ *puxFL ][ *puxSL ];
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( HeapControl_t *pxHeap, BlockHeader_t *pxBlock )
+{
+UBaseType_t uxFL, uxSL;
+BlockHeader_t *pxHead;
+
+	prvMappingInsert( heapBLOCK_SIZE( pxBlock ), &uxFL, &uxSL );
+
+	pxHead = pxHeap->pxFreeBlocks[ uxFL ][ uxSL ];
+	pxBlock->pxNextFreeBlock = pxHead;
+	pxBlock->pxPrevFreeBlock = NULL;
+
+	if( pxHead != NULL )
+	{
+		pxHead->pxPrevFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxHeap->pxFreeBlocks[ uxFL ][ uxSL ] = pxBlock;
+	pxHeap->ulFLBitmap |= ( uint32_t ) 1 << uxFL;
+	pxHeap->ulSLBitmap[ uxFL ] |= ( uint32_t ) 1 << uxSL;
+
+	pxBlock->xBlockSize |= heapBLOCK_FREE_BIT;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( HeapControl_t *pxHeap, BlockHeader_t *pxBlock )
+{
+UBaseType_t uxFL, uxSL;
+
+	prvMappingInsert( heapBLOCK_SIZE( pxBlock ), &uxFL, &uxSL );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPrevFreeBlock != NULL )
+	{
+		pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was the head of its list, the bitmaps are cleared when
+		the list empties. */
+		pxHeap->pxFreeBlocks[ uxFL ][ uxSL ] = pxBlock->pxNextFreeBlock;
+
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			pxHeap->ulSLBitmap[ uxFL ] &= ~( ( uint32_t ) 1 << uxSL );
+
+			if( pxHeap->ulSLBitmap[ uxFL ] == 0 )
+			{
+				pxHeap->ulFLBitmap &= ~( ( uint32_t ) 1 << uxFL );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+static UBaseType_t prvHistogramBin( size_t xRequestedSize )
+{
+UBaseType_t uxBin = 0;
+
+	/* Class 0 is below 32 bytes, then one class per power of two. */
+	xRequestedSize >>= 5;
+
+	while( ( xRequestedSize != 0 ) && ( uxBin < ( ( UBaseType_t ) portHEAP_HISTOGRAM_BINS - 1 ) ) )
+	{
+		xRequestedSize >>= 1;
+		uxBin++;
+	}
+
+	return uxBin;
+}
+/*-----------------------------------------------------------*/
+
+#if !defined( __GNUC__ )
+
+	static UBaseType_t prvFindLastSet( uint32_t ulMap )
+	{
+	UBaseType_t uxBit = 0;
+
+		while( ulMap > 1UL )
+		{
+			ulMap >>= 1;
+			uxBit++;
+		}
+
+		return uxBit;
+	}
+
+#endif /* __GNUC__ */
+/*-----------------------------------------------------------*/
+
@@ -0,0 +1,609 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "priority_queue.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if ( configUSE_PREEMPTION == 0 )
+	/* If the cooperative scheduler is being used then a yield should not be
+	performed just because a higher priority task has been woken. */
+	#define prioqYIELD_IF_USING_PREEMPTION()
+#else
+	#define prioqYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
+#endif
+
+/* An entry of the heap.  Items of the same priority are kept in the order of
+their sequence numbers, which are compared modulo the range of a UBaseType_t,
+so the order holds as long as an item is received before half that range of
+items are posted after it. */
+typedef struct xPRIORITY_QUEUE_ENTRY
+{
+	UBaseType_t uxPriority;		/*< Priority the item was posted with. */
+	UBaseType_t uxSequence;		/*< Order in which the item was posted. */
+	uint8_t *pucItem;			/*< The slot of the storage area holding the item. */
+} PriorityQueueEntry_t;
+
+/* The entries are a binary heap of the uxMessagesWaiting items held, the
+entry of the highest priority first.  An item does not move once copied into
+its slot, only the entries move as the heap is rearranged.  The entries past
+the end of the heap hold the slots that are free, so a free slot is found
+without a search. */
+typedef struct xPRIORITY_QUEUE
+{
+	PriorityQueueEntry_t *pxEntries;	/*< uxLength entries, of which the first uxMessagesWaiting are the heap. */
+	volatile UBaseType_t uxMessagesWaiting;
+	UBaseType_t uxLength;
+	UBaseType_t uxItemSize;
+	UBaseType_t uxNextSequence;
+	List_t xTasksWaitingToSend;		/*< Tasks blocked posting, in priority order. */
+	List_t xTasksWaitingToReceive;	/*< Tasks blocked receiving, in priority order. */
+} PriorityQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copies an item into a free slot and adds its entry to the heap.  The queue
+ * must not be full.  Called with interrupts masked.
+ */
+static void prvInsertItem( PriorityQueue_t * const pxQueue, const void *pvItemToQueue, UBaseType_t uxPriority );
+
+/*
+ * Copies the item of the highest priority out and removes its entry from the
+ * heap.  The queue must not be empty.  Called with interrupts masked.
+ */
+static void prvRemoveItem( PriorityQueue_t * const pxQueue, void * const pvBuffer, UBaseType_t * const puxPriority );
+
+/*
+ * Returns pdTRUE if the item of pxEntry is to be received before the item of
+ * pxOther.
+ */
+static BaseType_t prvIsReceivedFirst( const PriorityQueueEntry_t * const pxEntry, const PriorityQueueEntry_t * const pxOther );
+
+/*
+ * Removes the highest priority task from pxEventList, if any, and returns
+ * pdTRUE if it has a priority above the calling task.  Called with interrupts
+ * masked.
+ */
+static BaseType_t prvWakeWaitingTask( List_t * const pxEventList );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	PriorityQueueHandle_t xPriorityQueueCreate( UBaseType_t uxQueueLength, UBaseType_t uxItemSize )
+	{
+	PriorityQueue_t *pxQueue;
+	uint8_t *pucStorage;
+	UBaseType_t uxEntry;
+
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+		/* The structure, the entries and the storage area of the items are
+		allocated in one block. */
+		pxQueue = ( PriorityQueue_t * ) pvPortMalloc( sizeof( PriorityQueue_t ) + ( ( size_t ) uxQueueLength * ( sizeof( PriorityQueueEntry_t ) + ( size_t ) uxItemSize ) ) );
+
+		if( pxQueue != NULL )
+		{
+			pxQueue->pxEntries = ( PriorityQueueEntry_t * ) &( pxQueue[ 1 ] );
+			pucStorage = ( uint8_t * ) &( pxQueue->pxEntries[ uxQueueLength ] );
+
+			/* All the slots are free. */
+			for( uxEntry = 0; uxEntry < uxQueueLength; uxEntry++ )
+			{
+				pxQueue->pxEntries[ uxEntry ].pucItem = pucStorage + ( uxEntry * uxItemSize );
+			}
+
+			pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0;
+			pxQueue->uxLength = uxQueueLength;
+			pxQueue->uxItemSize = uxItemSize;
+			pxQueue->uxNextSequence = ( UBaseType_t ) 0;
+			vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
+			vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( PriorityQueueHandle_t ) pxQueue;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	void vPriorityQueueDelete( PriorityQueueHandle_t xQueue )
+	{
+	PriorityQueue_t * const pxQueue = ( PriorityQueue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE );
+		configASSERT( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE );
+
+		vPortFree( ( void * ) pxQueue );
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+BaseType_t xPriorityQueueSend( PriorityQueueHandle_t xQueue, const void * const pvItemToQueue, UBaseType_t uxPriority, TickType_t xTicksToWait )
+{
+PriorityQueue_t * const pxQueue = ( PriorityQueue_t * ) xQueue;
+TimeOut_t xTimeOut;
+BaseType_t xReturn = errQUEUE_FULL, xEntryTimeSet = pdFALSE, xBlocked;
+
+	configASSERT( pxQueue );
+	configASSERT( pvItemToQueue );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	do
+	{
+		taskENTER_CRITICAL();
+		{
+			if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+			{
+				prvInsertItem( pxQueue, pvItemToQueue, uxPriority );
+
+				if( prvWakeWaitingTask( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+				{
+					/* Yes it is ok to yield from within the critical section,
+					the yield is performed once the critical section is left. */
+					prioqYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdPASS;
+				xBlocked = pdFALSE;
+			}
+			else
+			{
+				/* The block time starts when the queue is first found full,
+				and is worked out again each time the task is woken without
+				finding space. */
+				if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+					{
+						xTicksToWait = ( TickType_t ) 0;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					/* The task leaves the event list when it is woken or its
+					block time expires. */
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+					portYIELD_WITHIN_API();
+					xBlocked = pdTRUE;
+				}
+				else
+				{
+					xBlocked = pdFALSE;
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+	} while( xBlocked != pdFALSE );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPriorityQueueSendFromISR( PriorityQueueHandle_t xQueue, const void * const pvItemToQueue, UBaseType_t uxPriority, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+PriorityQueue_t * const pxQueue = ( PriorityQueue_t * ) xQueue;
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xReturn = errQUEUE_FULL;
+
+	configASSERT( pxQueue );
+	configASSERT( pvItemToQueue );
+
+	/* See the comment in xQueueGenericSendFromISR() on the interrupt
+	priorities that can call interrupt safe API functions. */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( pxQueue->uxMessagesWaiting < pxQueue->uxLength )
+		{
+			prvInsertItem( pxQueue, pvItemToQueue, uxPriority );
+
+			if( ( prvWakeWaitingTask( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+			{
+				*pxHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPriorityQueueReceive( PriorityQueueHandle_t xQueue, void * const pvBuffer, UBaseType_t * const puxPriority, TickType_t xTicksToWait )
+{
+PriorityQueue_t * const pxQueue = ( PriorityQueue_t * ) xQueue;
+TimeOut_t xTimeOut;
+BaseType_t xReturn = errQUEUE_EMPTY, xEntryTimeSet = pdFALSE, xBlocked;
+
+	configASSERT( pxQueue );
+	configASSERT( pvBuffer );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	do
+	{
+		taskENTER_CRITICAL();
+		{
+			if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+			{
+				prvRemoveItem( pxQueue, pvBuffer, puxPriority );
+
+				if( prvWakeWaitingTask( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+				{
+					prioqYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdPASS;
+				xBlocked = pdFALSE;
+			}
+			else
+			{
+				/* As in xPriorityQueueSend(). */
+				if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					if( xEntryTimeSet == pdFALSE )
+					{
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+					{
+						xTicksToWait = ( TickType_t ) 0;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xTicksToWait != ( TickType_t ) 0 )
+				{
+					vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+					portYIELD_WITHIN_API();
+					xBlocked = pdTRUE;
+				}
+				else
+				{
+					xBlocked = pdFALSE;
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+	} while( xBlocked != pdFALSE );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPriorityQueueReceiveFromISR( PriorityQueueHandle_t xQueue, void * const pvBuffer, UBaseType_t * const puxPriority, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+PriorityQueue_t * const pxQueue = ( PriorityQueue_t * ) xQueue;
+UBaseType_t uxSavedInterruptStatus;
+BaseType_t xReturn = errQUEUE_EMPTY;
+
+	configASSERT( pxQueue );
+	configASSERT( pvBuffer );
+
+	/* See the comment in xQueueGenericSendFromISR() on the interrupt
+	priorities that can call interrupt safe API functions. */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+		{
+			prvRemoveItem( pxQueue, pvBuffer, puxPriority );
+
+			if( ( prvWakeWaitingTask( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+			{
+				*pxHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPriorityQueueMessagesWaiting( PriorityQueueHandle_t xQueue )
+{
+PriorityQueue_t * const pxQueue = ( PriorityQueue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+
+	return pxQueue->uxMessagesWaiting;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertItem( PriorityQueue_t * const pxQueue, const void *pvItemToQueue, UBaseType_t uxPriority )
+{
+PriorityQueueEntry_t * const pxEntries = pxQueue->pxEntries;
+PriorityQueueEntry_t xNewEntry;
+UBaseType_t uxIndex, uxParent;
+
+	/* The entry just past the end of the heap holds a free slot. */
+	uxIndex = pxQueue->uxMessagesWaiting;
+	xNewEntry.uxPriority = uxPriority;
+	xNewEntry.uxSequence = pxQueue->uxNextSequence;
+	xNewEntry.pucItem = pxEntries[ uxIndex ].pucItem;
+	( void ) memcpy( ( void * ) xNewEntry.pucItem, pvItemToQueue, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+	/* Move the entry up past the entries it is received before. */
+	while( uxIndex > ( UBaseType_t ) 0 )
+	{
+		uxParent = ( uxIndex - ( UBaseType_t ) 1 ) / ( UBaseType_t ) 2;
+
+		if( prvIsReceivedFirst( &xNewEntry, &( pxEntries[ uxParent ] ) ) != pdFALSE )
+		{
+			pxEntries[ uxIndex ] = pxEntries[ uxParent ];
+			uxIndex = uxParent;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	pxEntries[ uxIndex ] = xNewEntry;
+	( pxQueue->uxNextSequence )++;
+	( pxQueue->uxMessagesWaiting )++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveItem( PriorityQueue_t * const pxQueue, void * const pvBuffer, UBaseType_t * const puxPriority )
+{
+PriorityQueueEntry_t * const pxEntries = pxQueue->pxEntries;
+PriorityQueueEntry_t xLastEntry;
+uint8_t *pucFreedItem;
+UBaseType_t uxIndex, uxChild, uxCount;
+
+	pucFreedItem = pxEntries[ 0 ].pucItem;
+	( void ) memcpy( pvBuffer, ( void * ) pucFreedItem, ( size_t ) pxQueue->uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+	if( puxPriority != NULL )
+	{
+		*puxPriority = pxEntries[ 0 ].uxPriority;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* The last entry of the heap fills the hole left at the top, and its
+	place, now past the end of the heap, takes the slot just freed. */
+	uxCount = pxQueue->uxMessagesWaiting - ( UBaseType_t ) 1;
+	xLastEntry = pxEntries[ uxCount ];
+	pxEntries[ uxCount ].pucItem = pucFreedItem;
+
+	/* Move the entry down below the entries received before it. */
+	uxIndex = ( UBaseType_t ) 0;
+
+	for( ;; )
+	{
+		uxChild = ( uxIndex * ( UBaseType_t ) 2 ) + ( UBaseType_t ) 1;
+
+		if( uxChild >= uxCount )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( ( uxChild + ( UBaseType_t ) 1 ) < uxCount ) && ( prvIsReceivedFirst( &( pxEntries[ uxChild + ( UBaseType_t ) 1 ] ), &( pxEntries[ uxChild ] ) ) != pdFALSE ) )
+		{
+			uxChild++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( prvIsReceivedFirst( &( pxEntries[ uxChild ] ), &xLastEntry ) != pdFALSE )
+		{
+			pxEntries[ uxIndex ] = pxEntries[ uxChild ];
+			uxIndex = uxChild;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	if( uxCount > ( UBaseType_t ) 0 )
+	{
+		pxEntries[ uxIndex ] = xLastEntry;
+	}
+	else
+	{
+		/* The entry removed was the only one. */
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxQueue->uxMessagesWaiting = uxCount;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIsReceivedFirst( const PriorityQueueEntry_t * const pxEntry, const PriorityQueueEntry_t * const pxOther )
+{
+BaseType_t xReturn;
+
+	if( pxEntry->uxPriority != pxOther->uxPriority )
+	{
+		xReturn = ( pxEntry->uxPriority > pxOther->uxPriority ) ? pdTRUE : pdFALSE;
+	}
+	else
+	{
+		/* Posted first, modulo the wrap of the sequence numbers. */
+		xReturn = ( ( BaseType_t ) ( pxEntry->uxSequence - pxOther->uxSequence ) < ( BaseType_t ) 0 ) ? pdTRUE : pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWakeWaitingTask( List_t * const pxEventList )
+{
+BaseType_t xReturn = pdFALSE;
+
+	if( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+	{
+		xReturn = xTaskRemoveFromEventList( pxEventList );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
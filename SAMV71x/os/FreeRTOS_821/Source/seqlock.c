@@ -0,0 +1,268 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "seqlock.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if ( INCLUDE_vTaskDelay != 1 )
+	#error INCLUDE_vTaskDelay must be set to 1 to use sequence locks, a reader waits for a preempted writer with vTaskDelay().
+#endif
+
+/* The low bit of the sequence count is set while a write is in progress. */
+#define seqlockWRITING		( ( UBaseType_t ) 1 )
+
+/* A reader that finds a write in progress blocks for this long before it
+tries again. */
+#define seqlockRETRY_DELAY	( ( TickType_t ) 1 )
+
+/* The data is only ever accessed between two accesses to the sequence count,
+each side of a memory barrier.  The ports this is used with run on a single
+core, where portMEMORY_BARRIER() only needs to stop the compiler from moving
+the data accesses across the accesses to the count. */
+
+/*-----------------------------------------------------------*/
+
+void vSeqLockInitialise( SeqLock_t * const pxSeqLock )
+{
+	configASSERT( pxSeqLock );
+
+	pxSeqLock->uxSequence = ( UBaseType_t ) 0;
+}
+/*-----------------------------------------------------------*/
+
+void vSeqLockWriteBegin( SeqLock_t * const pxSeqLock )
+{
+	/* There is a single writer, so the count is incremented without an
+	atomic read-modify-write, the readers only ever read it. */
+	configASSERT( ( pxSeqLock->uxSequence & seqlockWRITING ) == ( UBaseType_t ) 0 );
+	pxSeqLock->uxSequence++;
+	portMEMORY_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
+void vSeqLockWriteEnd( SeqLock_t * const pxSeqLock )
+{
+	portMEMORY_BARRIER();
+	configASSERT( ( pxSeqLock->uxSequence & seqlockWRITING ) != ( UBaseType_t ) 0 );
+	pxSeqLock->uxSequence++;
+}
+/*-----------------------------------------------------------*/
+
+void vSeqLockWrite( SeqLock_t * const pxSeqLock, void *pvData, const void *pvNewData, size_t xLengthBytes )
+{
+	vSeqLockWriteBegin( pxSeqLock );
+	( void ) memcpy( pvData, pvNewData, xLengthBytes );
+	vSeqLockWriteEnd( pxSeqLock );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxSeqLockReadBegin( const SeqLock_t * const pxSeqLock )
+{
+UBaseType_t uxSequence;
+
+	uxSequence = pxSeqLock->uxSequence;
+	portMEMORY_BARRIER();
+
+	return uxSequence;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSeqLockReadRetry( const SeqLock_t * const pxSeqLock, UBaseType_t uxSequence )
+{
+BaseType_t xReturn;
+
+	portMEMORY_BARRIER();
+
+	if( ( ( uxSequence & seqlockWRITING ) != ( UBaseType_t ) 0 ) || ( pxSeqLock->uxSequence != uxSequence ) )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSeqLockRead( const SeqLock_t * const pxSeqLock, void *pvBuffer, const void *pvData, size_t xLengthBytes, TickType_t xTicksToWait )
+{
+TimeOut_t xTimeOut;
+UBaseType_t uxSequence;
+BaseType_t xReturn = pdFAIL, xTimeOutSet = pdFALSE;
+
+	configASSERT( pxSeqLock );
+
+	for( ;; )
+	{
+		uxSequence = uxSeqLockReadBegin( pxSeqLock );
+
+		if( ( uxSequence & seqlockWRITING ) == ( UBaseType_t ) 0 )
+		{
+			( void ) memcpy( pvBuffer, pvData, xLengthBytes );
+
+			if( xSeqLockReadRetry( pxSeqLock, uxSequence ) == pdFALSE )
+			{
+				xReturn = pdPASS;
+				break;
+			}
+			else
+			{
+				/* An interrupt, or a higher priority task, wrote the data
+				during the copy, which is made again straight away. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* The writer was preempted by this task part way through the
+			write, and may have a lower priority, so it is given time to
+			finish rather than just the processor.  The block time only
+			starts counting the first time this happens. */
+			if( xTimeOutSet == pdFALSE )
+			{
+				vTaskSetTimeOutState( &xTimeOut );
+				xTimeOutSet = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( ( xTicksToWait == ( TickType_t ) 0 ) || ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE ) )
+			{
+				break;
+			}
+			else
+			{
+				vTaskDelay( seqlockRETRY_DELAY );
+			}
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSeqLockReadFromISR( const SeqLock_t * const pxSeqLock, void *pvBuffer, const void *pvData, size_t xLengthBytes )
+{
+UBaseType_t uxSequence;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxSeqLock );
+
+	for( ;; )
+	{
+		uxSequence = uxSeqLockReadBegin( pxSeqLock );
+
+		if( ( uxSequence & seqlockWRITING ) == ( UBaseType_t ) 0 )
+		{
+			( void ) memcpy( pvBuffer, pvData, xLengthBytes );
+
+			if( xSeqLockReadRetry( pxSeqLock, uxSequence ) == pdFALSE )
+			{
+				xReturn = pdPASS;
+				break;
+			}
+			else
+			{
+				/* A higher priority interrupt wrote the data during the
+				copy. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* The writer cannot finish before this interrupt returns. */
+			break;
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
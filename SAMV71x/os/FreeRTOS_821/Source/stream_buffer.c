@@ -0,0 +1,862 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to use stream buffers, blocked tasks are woken by a notification.
+#endif
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 )
+	#error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to use stream buffers.
+#endif
+
+/* Bits of ucFlags. */
+#define sbFLAGS_IS_MESSAGE_BUFFER		( ( uint8_t ) 1 )
+
+/* Bytes taken by the length of each message in a message buffer. */
+#define sbBYTES_TO_STORE_MESSAGE_LENGTH	( sizeof( size_t ) )
+
+/* The storage area is one byte longer than the buffer size so a full buffer
+(xHead one behind xTail) can be told from an empty one (xHead == xTail).  The
+writer only ever updates xHead, the reader only ever updates xTail, each after
+the data has been copied, which is what allows both to run without a critical
+section.  The task handles record the task blocked on each side, if any. */
+typedef struct xSTREAM_BUFFER
+{
+	volatile size_t xTail;							/*< Index of the next byte to read. */
+	volatile size_t xHead;							/*< Index of the next byte to write. */
+	size_t xLength;									/*< Size of the storage area. */
+	volatile size_t xTriggerLevelBytes;				/*< Bytes needed in the buffer to wake a blocked reader. */
+	volatile TaskHandle_t xTaskWaitingToReceive;	/*< Task blocked reading, NULL if none. */
+	volatile TaskHandle_t xTaskWaitingToSend;		/*< Task blocked writing, NULL if none. */
+	uint8_t *pucBuffer;								/*< The storage area, following the structure. */
+	uint8_t ucFlags;
+} StreamBuffer_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Number of bytes in the buffer, and number of bytes that can be written.
+ */
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer );
+static size_t prvSpacesInBuffer( const StreamBuffer_t * const pxStreamBuffer );
+
+/*
+ * Copy xCount bytes into the storage area from index xHead, or out of it
+ * from index xTail, wrapping as needed.  The index following the last byte
+ * copied is returned, the indexes held in the structure are not updated.
+ */
+static size_t prvWriteBytes( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xHead );
+static size_t prvReadBytes( const StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount, size_t xTail );
+
+/*
+ * Write as much of the data as fits (stream buffer) or the whole message if it
+ * fits (message buffer), given xSpace bytes are free.  Returns the number of
+ * data bytes written.
+ */
+static size_t prvWriteMessageOrBytes( StreamBuffer_t * const pxStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, size_t xSpace );
+
+/*
+ * Read up to xBufferLengthBytes bytes (stream buffer) or the next message if
+ * it fits (message buffer), given xAvailable bytes are in the buffer.  Returns
+ * the number of data bytes read.
+ */
+static size_t prvReadMessageOrBytes( StreamBuffer_t * const pxStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, size_t xAvailable );
+
+/*
+ * Block the calling task until at least xBytes bytes can be written (xSending
+ * set) or read (xSending clear), the other side of the buffer notifying the
+ * task once they can, or until the block time expires.
+ */
+static void prvWaitFor( StreamBuffer_t * const pxStreamBuffer, BaseType_t xSending, size_t xBytes, TickType_t xTicksToWait );
+
+/*
+ * Wake the task recorded in *pxWaitingTask, if any.  The handle is read
+ * without a critical section first so nothing is locked when no task waits.
+ */
+static void prvNotifyWaitingTask( volatile TaskHandle_t * const pxWaitingTask );
+static void prvNotifyWaitingTaskFromISR( volatile TaskHandle_t * const pxWaitingTask, BaseType_t * const pxHigherPriorityTaskWoken );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer )
+	{
+	StreamBuffer_t *pxStreamBuffer;
+
+		if( xIsMessageBuffer != pdFALSE )
+		{
+			/* A blocked reader is woken by every message. */
+			configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+			xTriggerLevelBytes = ( size_t ) 1;
+		}
+		else
+		{
+			configASSERT( xBufferSizeBytes > ( size_t ) 0 );
+		}
+
+		configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
+
+		if( xTriggerLevelBytes == ( size_t ) 0 )
+		{
+			xTriggerLevelBytes = ( size_t ) 1;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxStreamBuffer = ( StreamBuffer_t * ) pvPortMalloc( sizeof( StreamBuffer_t ) + xBufferSizeBytes + ( size_t ) 1 );
+
+		if( pxStreamBuffer != NULL )
+		{
+			memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) );
+			pxStreamBuffer->pucBuffer = ( ( uint8_t * ) pxStreamBuffer ) + sizeof( StreamBuffer_t );
+			pxStreamBuffer->xLength = xBufferSizeBytes + ( size_t ) 1;
+			pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
+
+			if( xIsMessageBuffer != pdFALSE )
+			{
+				pxStreamBuffer->ucFlags |= sbFLAGS_IS_MESSAGE_BUFFER;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return ( StreamBufferHandle_t ) pxStreamBuffer;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
+	{
+	StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+		configASSERT( pxStreamBuffer );
+		configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+		configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+
+		vPortFree( ( void * ) pxStreamBuffer );
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxStreamBuffer );
+
+	taskENTER_CRITICAL();
+	{
+		if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+		{
+			pxStreamBuffer->xHead = ( size_t ) 0;
+			pxStreamBuffer->xTail = ( size_t ) 0;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	if( xTriggerLevel == ( size_t ) 0 )
+	{
+		xTriggerLevel = ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xTriggerLevel < pxStreamBuffer->xLength )
+	{
+		pxStreamBuffer->xTriggerLevelBytes = xTriggerLevel;
+		xReturn = pdPASS;
+	}
+	else
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xRequiredSpace = xDataLengthBytes, xReturn;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvTxData );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* A message that can never fit would block forever. */
+		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+		configASSERT( xRequiredSpace < pxStreamBuffer->xLength );
+	}
+	else if( xRequiredSpace >= pxStreamBuffer->xLength )
+	{
+		/* Wait for the buffer to be empty at most, then write what fits. */
+		xRequiredSpace = pxStreamBuffer->xLength - ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( ( xTicksToWait != ( TickType_t ) 0 ) && ( prvSpacesInBuffer( pxStreamBuffer ) < xRequiredSpace ) )
+	{
+		prvWaitFor( pxStreamBuffer, pdTRUE, xRequiredSpace, xTicksToWait );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xReturn = prvWriteMessageOrBytes( pxStreamBuffer, pvTxData, xDataLengthBytes, prvSpacesInBuffer( pxStreamBuffer ) );
+
+	if( ( xReturn > ( size_t ) 0 ) && ( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes ) )
+	{
+		prvNotifyWaitingTask( &( pxStreamBuffer->xTaskWaitingToReceive ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvTxData );
+
+	xReturn = prvWriteMessageOrBytes( pxStreamBuffer, pvTxData, xDataLengthBytes, prvSpacesInBuffer( pxStreamBuffer ) );
+
+	if( ( xReturn > ( size_t ) 0 ) && ( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes ) )
+	{
+		prvNotifyWaitingTaskFromISR( &( pxStreamBuffer->xTaskWaitingToReceive ), pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvRxData );
+
+	/* Messages are written whole, so any byte in a message buffer means a
+	complete message. */
+	if( ( xTicksToWait != ( TickType_t ) 0 ) && ( prvBytesInBuffer( pxStreamBuffer ) == ( size_t ) 0 ) )
+	{
+		prvWaitFor( pxStreamBuffer, pdFALSE, ( size_t ) 1, xTicksToWait );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xReturn = prvReadMessageOrBytes( pxStreamBuffer, pvRxData, xBufferLengthBytes, prvBytesInBuffer( pxStreamBuffer ) );
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		prvNotifyWaitingTask( &( pxStreamBuffer->xTaskWaitingToSend ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pvRxData );
+
+	xReturn = prvReadMessageOrBytes( pxStreamBuffer, pvRxData, xBufferLengthBytes, prvBytesInBuffer( pxStreamBuffer ) );
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		prvNotifyWaitingTaskFromISR( &( pxStreamBuffer->xTaskWaitingToSend ), pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferNextMessageLength( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xLength = ( size_t ) 0;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
+
+	if( prvBytesInBuffer( pxStreamBuffer ) >= sbBYTES_TO_STORE_MESSAGE_LENGTH )
+	{
+		( void ) prvReadBytes( pxStreamBuffer, ( uint8_t * ) &xLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+	configASSERT( xStreamBuffer );
+	return prvBytesInBuffer( ( StreamBuffer_t * ) xStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+	configASSERT( xStreamBuffer );
+	return prvSpacesInBuffer( ( StreamBuffer_t * ) xStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+{
+BaseType_t xReturn;
+
+	if( xStreamBufferBytesAvailable( xStreamBuffer ) == ( size_t ) 0 )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xMinimumSpace = ( size_t ) 0;
+BaseType_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	/* A message buffer is full once even an empty message does not fit. */
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xMinimumSpace = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( prvSpacesInBuffer( pxStreamBuffer ) <= xMinimumSpace )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+{
+size_t xCount;
+
+	xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
+	xCount -= pxStreamBuffer->xTail;
+
+	if( xCount >= pxStreamBuffer->xLength )
+	{
+		xCount -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvSpacesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+{
+	return ( pxStreamBuffer->xLength - ( size_t ) 1 ) - prvBytesInBuffer( pxStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteBytes( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xHead )
+{
+size_t xFirstLength;
+
+	/* Up to the end of the storage area, then from its start. */
+	xFirstLength = pxStreamBuffer->xLength - xHead;
+	if( xFirstLength > xCount )
+	{
+		xFirstLength = xCount;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	memcpy( ( void * ) &( pxStreamBuffer->pucBuffer[ xHead ] ), ( const void * ) pucData, xFirstLength );
+
+	if( xCount > xFirstLength )
+	{
+		memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xHead += xCount;
+	if( xHead >= pxStreamBuffer->xLength )
+	{
+		xHead -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadBytes( const StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount, size_t xTail )
+{
+size_t xFirstLength;
+
+	xFirstLength = pxStreamBuffer->xLength - xTail;
+	if( xFirstLength > xCount )
+	{
+		xFirstLength = xCount;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength );
+
+	if( xCount > xFirstLength )
+	{
+		memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( const void * ) pxStreamBuffer->pucBuffer, xCount - xFirstLength );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xTail += xCount;
+	if( xTail >= pxStreamBuffer->xLength )
+	{
+		xTail -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xTail;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteMessageOrBytes( StreamBuffer_t * const pxStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, size_t xSpace )
+{
+size_t xHead = pxStreamBuffer->xHead;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		if( xSpace >= ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) )
+		{
+			xHead = prvWriteBytes( pxStreamBuffer, ( const uint8_t * ) &xDataLengthBytes, sbBYTES_TO_STORE_MESSAGE_LENGTH, xHead );
+		}
+		else
+		{
+			xDataLengthBytes = ( size_t ) 0;
+		}
+	}
+	else if( xDataLengthBytes > xSpace )
+	{
+		xDataLengthBytes = xSpace;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xHead = prvWriteBytes( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes, xHead );
+
+	if( xHead != pxStreamBuffer->xHead )
+	{
+		/* The reader must not see the new head before the data. */
+		portMEMORY_BARRIER();
+		pxStreamBuffer->xHead = xHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadMessageOrBytes( StreamBuffer_t * const pxStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, size_t xAvailable )
+{
+size_t xTail = pxStreamBuffer->xTail, xCount = xAvailable;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		if( xAvailable >= sbBYTES_TO_STORE_MESSAGE_LENGTH )
+		{
+			xTail = prvReadBytes( pxStreamBuffer, ( uint8_t * ) &xCount, sbBYTES_TO_STORE_MESSAGE_LENGTH, xTail );
+
+			/* A message too long for the caller's buffer is left in place. */
+			if( xCount > xBufferLengthBytes )
+			{
+				xTail = pxStreamBuffer->xTail;
+				xCount = ( size_t ) 0;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			xCount = ( size_t ) 0;
+		}
+	}
+	else if( xCount > xBufferLengthBytes )
+	{
+		xCount = xBufferLengthBytes;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xTail = prvReadBytes( pxStreamBuffer, ( uint8_t * ) pvRxData, xCount, xTail );
+
+	if( xTail != pxStreamBuffer->xTail )
+	{
+		/* The writer must not see the space freed before the data has been
+		copied out. */
+		portMEMORY_BARRIER();
+		pxStreamBuffer->xTail = xTail;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitFor( StreamBuffer_t * const pxStreamBuffer, BaseType_t xSending, size_t xBytes, TickType_t xTicksToWait )
+{
+TimeOut_t xTimeOut;
+volatile TaskHandle_t *pxWaitingTask, *pxOtherTask;
+TaskHandle_t xTaskToNotify;
+size_t xCount;
+
+	if( xSending != pdFALSE )
+	{
+		pxWaitingTask = &( pxStreamBuffer->xTaskWaitingToSend );
+		pxOtherTask = &( pxStreamBuffer->xTaskWaitingToReceive );
+	}
+	else
+	{
+		pxWaitingTask = &( pxStreamBuffer->xTaskWaitingToReceive );
+		pxOtherTask = &( pxStreamBuffer->xTaskWaitingToSend );
+	}
+
+	vTaskSetTimeOutState( &xTimeOut );
+
+	for( ;; )
+	{
+		/* The other side updates the buffer without a critical section, but
+		reads the waiting task after each update.  Testing the buffer and
+		recording the task in the same critical section means either the
+		update is seen here or the task is seen there. */
+		taskENTER_CRITICAL();
+		{
+			if( xSending != pdFALSE )
+			{
+				xCount = prvSpacesInBuffer( pxStreamBuffer );
+			}
+			else
+			{
+				xCount = prvBytesInBuffer( pxStreamBuffer );
+			}
+
+			if( xCount < xBytes )
+			{
+				/* Only one task may block on each side. */
+				configASSERT( *pxWaitingTask == NULL );
+				*pxWaitingTask = xTaskGetCurrentTaskHandle();
+
+				/* A writer waiting for room while the reader waits for the
+				trigger level would wait forever, so the task blocked on the
+				other side is woken whatever the trigger level. */
+				xTaskToNotify = *pxOtherTask;
+
+				if( xTaskToNotify != NULL )
+				{
+					*pxOtherTask = NULL;
+					( void ) xTaskNotify( xTaskToNotify, ( uint32_t ) 0, eNoAction );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xCount >= xBytes )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* A notification left over from an earlier wake up only causes one
+		more pass through the loop. */
+		( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+
+		taskENTER_CRITICAL();
+		{
+			*pxWaitingTask = NULL;
+		}
+		taskEXIT_CRITICAL();
+
+		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyWaitingTask( volatile TaskHandle_t * const pxWaitingTask )
+{
+TaskHandle_t xTaskToNotify;
+
+	if( *pxWaitingTask != NULL )
+	{
+		taskENTER_CRITICAL();
+		{
+			xTaskToNotify = *pxWaitingTask;
+
+			if( xTaskToNotify != NULL )
+			{
+				/* Cleared first as some ports switch to the notified task
+				before the critical section is left. */
+				*pxWaitingTask = NULL;
+				( void ) xTaskNotify( xTaskToNotify, ( uint32_t ) 0, eNoAction );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyWaitingTaskFromISR( volatile TaskHandle_t * const pxWaitingTask, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxSavedInterruptStatus;
+TaskHandle_t xTaskToNotify;
+
+	if( *pxWaitingTask != NULL )
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xTaskToNotify = *pxWaitingTask;
+
+			if( xTaskToNotify != NULL )
+			{
+				*pxWaitingTask = NULL;
+				( void ) xTaskNotifyFromISR( xTaskToNotify, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
@@ -105,6 +105,31 @@ functions but without including stdio.h here. */
 	#endif /* INCLUDE_vTaskSuspend */
 #endif /* configUSE_TICKLESS_IDLE */
 
+/*
+ * When configUSE_DELAYED_TASK_WHEEL is 1 the two sorted delayed lists are
+ * replaced by a hierarchical wheel of unsorted lists, so blocking a task is
+ * O(1) whatever the number of delayed tasks.  Level 0 has one slot per tick for
+ * the next 32 ticks, each slot of level n covers 32 slots of level n - 1.  A
+ * task goes to the lowest level whose range holds its wake time, and the tasks
+ * of a slot of level n are moved down a level when the tick count reaches the
+ * start of that slot.  The tick therefore only walks the tasks due on it, plus
+ * the slot moved down every 32 ticks, and a task is moved at most once per
+ * level.  The list item value holds the full wake time.  Wake times beyond the
+ * range of the wheel (2^20 ticks) wait in the last slot of the top level and
+ * are placed again each time it is reached.  One bit per slot is kept in a 32
+ * bit word per level, which fixes the number of slots.
+ */
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+	#define taskDELAYED_WHEEL_BITS		( 5U )
+	#define taskDELAYED_WHEEL_SLOTS		( 1U << taskDELAYED_WHEEL_BITS )
+	#define taskDELAYED_WHEEL_MASK		( ( TickType_t ) ( taskDELAYED_WHEEL_SLOTS - 1U ) )
+	#define taskDELAYED_WHEEL_LEVELS	( 4U )
+	#define taskDELAYED_WHEEL_RANGE		( 1UL << ( taskDELAYED_WHEEL_BITS * taskDELAYED_WHEEL_LEVELS ) )
+
+	/* Slot uxSlot of level uxLevel. */
+	#define taskDELAYED_WHEEL_SLOT( uxLevel, uxSlot )	( &( xDelayedTaskWheel[ ( ( uxLevel ) * taskDELAYED_WHEEL_SLOTS ) + ( uxSlot ) ] ) )
+#endif
+
 /*
  * Defines the size, in words, of the stack allocated to the idle task.
  */
@@ -192,6 +217,10 @@ typedef struct tskTaskControlBlock
 		volatile eNotifyValue eNotifyState;
 	#endif
 
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		uint8_t			ucStaticallyAllocated; /*< Set to pdTRUE if the TCB and the stack were provided to xTaskCreateStatic(), so they are not freed when the task is deleted. */
+	#endif
+
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -213,10 +242,21 @@ PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
 
 /* Lists for ready and blocked tasks. --------------------*/
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	PRIVILEGED_DATA static List_t xDelayedTaskWheel[ taskDELAYED_WHEEL_LEVELS * taskDELAYED_WHEEL_SLOTS ];	/*< Delayed tasks, level by level.  The slots are not sorted. */
+	PRIVILEGED_DATA static uint32_t ulDelayedWheelSlotsInUse[ taskDELAYED_WHEEL_LEVELS ];	/*< Bit n of word l is set when slot n of level l may hold a delayed task. */
+
+#else
+
+	PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
+	PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+	PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
+	PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -364,21 +404,44 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 /*-----------------------------------------------------------*/
 
-/* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
-count overflows. */
-#define taskSWITCH_DELAYED_LISTS()																	\
-{																									\
-	List_t *pxTemp;																					\
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/* The wheel holds wake times from both sides of the overflow, so there is
+	nothing to switch.  Wake times past the overflow were not allowed to lower
+	xNextTaskUnblockTime, so it is recomputed - including the slot of tick 0
+	itself. */
+	#define taskSWITCH_DELAYED_LISTS()																\
+	{																								\
+		xNumOfOverflows++;																			\
+		prvSetNextTaskUnblockTimeFrom( xTickCount );												\
+	}
+
+	/* Is pxList one of the slots of the delayed task wheel? */
+	#define taskIS_DELAYED_LIST( pxList )															\
+		( ( ( pxList ) >= &( xDelayedTaskWheel[ 0 ] ) ) && ( ( pxList ) <= &( xDelayedTaskWheel[ ( taskDELAYED_WHEEL_LEVELS * taskDELAYED_WHEEL_SLOTS ) - 1U ] ) ) )
+
+#else
+
+	/* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
+	count overflows. */
+	#define taskSWITCH_DELAYED_LISTS()																\
+	{																								\
+		List_t *pxTemp;																				\
 																									\
-	/* The delayed tasks list should be empty when the lists are switched. */						\
-	configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );										\
+		/* The delayed tasks list should be empty when the lists are switched. */					\
+		configASSERT( ( listLIST_IS_EMPTY( pxDelayedTaskList ) ) );									\
 																									\
-	pxTemp = pxDelayedTaskList;																		\
-	pxDelayedTaskList = pxOverflowDelayedTaskList;													\
-	pxOverflowDelayedTaskList = pxTemp;																\
-	xNumOfOverflows++;																				\
-	prvResetNextTaskUnblockTime();																	\
-}
+		pxTemp = pxDelayedTaskList;																	\
+		pxDelayedTaskList = pxOverflowDelayedTaskList;												\
+		pxOverflowDelayedTaskList = pxTemp;															\
+		xNumOfOverflows++;																			\
+		prvResetNextTaskUnblockTime();																\
+	}
+
+	#define taskIS_DELAYED_LIST( pxList )															\
+		( ( ( pxList ) == pxDelayedTaskList ) || ( ( pxList ) == pxOverflowDelayedTaskList ) )
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 /*-----------------------------------------------------------*/
 
@@ -472,6 +535,15 @@ static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters );
 
 #endif
 
+/*
+ * Frees the TCB and the stack allocated by xTaskGenericCreate().
+ */
+#if( ( INCLUDE_vTaskDelete == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	static void prvFreeTCBAndStack( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Used only by the idle task.  This checks to see if anything has been placed
  * in the list of tasks waiting to be deleted.  If so the task is cleaned up
@@ -489,7 +561,18 @@ static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake ) PRIVI
  * Allocates memory from the heap for a TCB and associated stack.  Checks the
  * allocation was successful.
  */
-static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer ) PRIVILEGED_FUNCTION;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Sets up the stack and the TCB of a task whose memory is already in place,
+ * then adds the task to the ready list.  Called by xTaskGenericCreate() and
+ * xTaskCreateStatic().
+ */
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, TCB_t *pxNewTCB, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
 /*
  * Fills an TaskStatus_t structure with information on each task that is
@@ -537,7 +620,34 @@ static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t *
  */
 static void prvResetNextTaskUnblockTime( void );
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/*
+	 * Set xNextTaskUnblockTime to the first tick, from xFromTime onwards, at
+	 * which the tick handler has to look at a wheel slot that may hold delayed
+	 * tasks: a level 0 slot is walked on its tick, a slot of a higher level is
+	 * moved down on its first tick.  This is a lower bound of the next wake
+	 * time, the tick handler sets the next bound.
+	 */
+	static void prvSetNextTaskUnblockTimeFrom( const TickType_t xFromTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Place the list item of a delayed task, whose value is its wake time, in
+	 * the wheel as seen from tick xNextTick, the first tick not processed yet.
+	 * Returns the tick at which the slot it went to is next looked at.
+	 */
+	static TickType_t prvAddToDelayedWheel( ListItem_t * const pxItem, const TickType_t xNextTick ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called on the ticks that start a revolution of level 0: move the tasks of
+	 * the slot of level 1 starting now down to level 0, and so on up the levels
+	 * for as long as the lower level starts a revolution too.
+	 */
+	static void prvCascadeDelayedWheel( const TickType_t xTick ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	/*
 	 * Helper function used to pad task names with spaces when printing out
@@ -548,194 +658,256 @@ static void prvResetNextTaskUnblockTime( void );
 #endif
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-BaseType_t xReturn;
-TCB_t * pxNewTCB;
-StackType_t *pxTopOfStack;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	BaseType_t xReturn;
+	TCB_t * pxNewTCB;
 
-	configASSERT( pxTaskCode );
-	configASSERT( ( ( uxPriority & ( UBaseType_t ) ( ~portPRIVILEGE_BIT ) ) < ( UBaseType_t ) configMAX_PRIORITIES ) );
+		configASSERT( pxTaskCode );
+		configASSERT( ( ( uxPriority & ( UBaseType_t ) ( ~portPRIVILEGE_BIT ) ) < ( UBaseType_t ) configMAX_PRIORITIES ) );
 
-	/* Allocate the memory required by the TCB and stack for the new task,
-	checking that the allocation was successful. */
-	pxNewTCB = prvAllocateTCBAndStack( usStackDepth, puxStackBuffer );
+		/* Allocate the memory required by the TCB and stack for the new task,
+		checking that the allocation was successful. */
+		pxNewTCB = prvAllocateTCBAndStack( usStackDepth, puxStackBuffer );
 
-	if( pxNewTCB != NULL )
-	{
-		#if( portUSING_MPU_WRAPPERS == 1 )
-			/* Should the task be created in privileged mode? */
-			BaseType_t xRunPrivileged;
-			if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
-			{
-				xRunPrivileged = pdTRUE;
-			}
-			else
+		if( pxNewTCB != NULL )
+		{
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
-				xRunPrivileged = pdFALSE;
+				/* The TCB and the stack are freed if the task is deleted. */
+				pxNewTCB->ucStaticallyAllocated = pdFALSE;
 			}
-			uxPriority &= ~portPRIVILEGE_BIT;
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
 
-			if( puxStackBuffer != NULL )
-			{
-				/* The application provided its own stack.  Note this so no
-				attempt is made to delete the stack should that task be
-				deleted. */
-				pxNewTCB->xUsingStaticallyAllocatedStack = pdTRUE;
-			}
-			else
-			{
-				/* The stack was allocated dynamically.  Note this so it can be
-				deleted again if the task is deleted. */
-				pxNewTCB->xUsingStaticallyAllocatedStack = pdFALSE;
-			}
-		#endif /* portUSING_MPU_WRAPPERS == 1 */
+			prvInitialiseNewTask( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, puxStackBuffer, xRegions );
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+			traceTASK_CREATE_FAILED();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, StackType_t * const puxStackBuffer, StaticTask_t * const pxTaskBuffer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	TCB_t *pxNewTCB;
+	TaskHandle_t xReturn = NULL;
+
+		configASSERT( pxTaskCode );
+		configASSERT( ( ( uxPriority & ( UBaseType_t ) ( ~portPRIVILEGE_BIT ) ) < ( UBaseType_t ) configMAX_PRIORITIES ) );
+		configASSERT( puxStackBuffer != NULL );
+		configASSERT( pxTaskBuffer != NULL );
 
-		/* Calculate the top of stack address.  This depends on whether the
-		stack grows from high memory to low (as per the 80x86) or vice versa.
-		portSTACK_GROWTH is used to make the result positive or negative as
-		required by the port. */
-		#if( portSTACK_GROWTH < 0 )
+		/* StaticTask_t must have the size of the TCB it stands for, see
+		task.h. */
+		configASSERT( sizeof( StaticTask_t ) == sizeof( TCB_t ) );
+
+		if( ( puxStackBuffer != NULL ) && ( pxTaskBuffer != NULL ) )
 		{
-			pxTopOfStack = pxNewTCB->pxStack + ( usStackDepth - ( uint16_t ) 1 );
-			pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
+			/* The TCB and the stack belong to the application. */
+			pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+			pxNewTCB->pxStack = puxStackBuffer;
+			pxNewTCB->ucStaticallyAllocated = pdTRUE;
 
-			/* Check the alignment of the calculated top of stack is correct. */
-			configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+			prvInitialiseNewTask( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, puxStackBuffer, NULL );
 		}
-		#else /* portSTACK_GROWTH */
+		else
 		{
-			pxTopOfStack = pxNewTCB->pxStack;
+			traceTASK_CREATE_FAILED();
+		}
 
-			/* Check the alignment of the stack buffer is correct. */
-			configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+		return xReturn;
+	}
 
-			/* If we want to use stack checking on architectures that use
-			a positive stack growth direction then we also need to store the
-			other extreme of the stack space. */
-			pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( usStackDepth - 1 );
-		}
-		#endif /* portSTACK_GROWTH */
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
 
-		/* Setup the newly allocated TCB with the initial state of the task. */
-		prvInitialiseTCBVariables( pxNewTCB, pcName, uxPriority, xRegions, usStackDepth );
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, TCB_t *pxNewTCB, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+StackType_t *pxTopOfStack;
 
-		/* Initialize the TCB stack to look as if the task was already running,
-		but had been interrupted by the scheduler.  The return address is set
-		to the start of the task function. Once the stack has been initialised
-		the	top of stack variable is updated. */
-		#if( portUSING_MPU_WRAPPERS == 1 )
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		/* Should the task be created in privileged mode? */
+		BaseType_t xRunPrivileged;
+		if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
 		{
-			pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+			xRunPrivileged = pdTRUE;
 		}
-		#else /* portUSING_MPU_WRAPPERS */
+		else
 		{
-			pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+			xRunPrivileged = pdFALSE;
 		}
-		#endif /* portUSING_MPU_WRAPPERS */
+		uxPriority &= ~portPRIVILEGE_BIT;
 
-		if( ( void * ) pxCreatedTask != NULL )
+		if( puxStackBuffer != NULL )
 		{
-			/* Pass the TCB out - in an anonymous way.  The calling function/
-			task can use this as a handle to delete the task later if
-			required.*/
-			*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
+			/* The application provided its own stack.  Note this so no
+			attempt is made to delete the stack should that task be
+			deleted. */
+			pxNewTCB->xUsingStaticallyAllocatedStack = pdTRUE;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			/* The stack was allocated dynamically.  Note this so it can be
+			deleted again if the task is deleted. */
+			pxNewTCB->xUsingStaticallyAllocatedStack = pdFALSE;
 		}
+	#else /* portUSING_MPU_WRAPPERS */
+		/* Only the MPU port records where the stack came from. */
+		( void ) puxStackBuffer;
+	#endif /* portUSING_MPU_WRAPPERS == 1 */
 
-		/* Ensure interrupts don't access the task lists while they are being
-		updated. */
-		taskENTER_CRITICAL();
+	/* Avoid dependency on memset() if it is not required. */
+	#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
+	{
+		/* Just to help debugging. */
+		( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) usStackDepth * sizeof( StackType_t ) );
+	}
+	#endif /* ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) ) */
+
+	/* Calculate the top of stack address.  This depends on whether the
+	stack grows from high memory to low (as per the 80x86) or vice versa.
+	portSTACK_GROWTH is used to make the result positive or negative as
+	required by the port. */
+	#if( portSTACK_GROWTH < 0 )
+	{
+		pxTopOfStack = pxNewTCB->pxStack + ( usStackDepth - ( uint16_t ) 1 );
+		pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
+
+		/* Check the alignment of the calculated top of stack is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+	}
+	#else /* portSTACK_GROWTH */
+	{
+		pxTopOfStack = pxNewTCB->pxStack;
+
+		/* Check the alignment of the stack buffer is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+
+		/* If we want to use stack checking on architectures that use
+		a positive stack growth direction then we also need to store the
+		other extreme of the stack space. */
+		pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( usStackDepth - 1 );
+	}
+	#endif /* portSTACK_GROWTH */
+
+	/* Setup the newly allocated TCB with the initial state of the task. */
+	prvInitialiseTCBVariables( pxNewTCB, pcName, uxPriority, xRegions, usStackDepth );
+
+	/* Initialize the TCB stack to look as if the task was already running,
+	but had been interrupted by the scheduler.  The return address is set
+	to the start of the task function. Once the stack has been initialised
+	the	top of stack variable is updated. */
+	#if( portUSING_MPU_WRAPPERS == 1 )
+	{
+		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+	}
+	#else /* portUSING_MPU_WRAPPERS */
+	{
+		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+	}
+	#endif /* portUSING_MPU_WRAPPERS */
+
+	if( ( void * ) pxCreatedTask != NULL )
+	{
+		/* Pass the TCB out - in an anonymous way.  The calling function/
+		task can use this as a handle to delete the task later if
+		required.*/
+		*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Ensure interrupts don't access the task lists while they are being
+	updated. */
+	taskENTER_CRITICAL();
+	{
+		uxCurrentNumberOfTasks++;
+		if( pxCurrentTCB == NULL )
 		{
-			uxCurrentNumberOfTasks++;
-			if( pxCurrentTCB == NULL )
-			{
-				/* There are no other tasks, or all the other tasks are in
-				the suspended state - make this the current task. */
-				pxCurrentTCB =  pxNewTCB;
+			/* There are no other tasks, or all the other tasks are in
+			the suspended state - make this the current task. */
+			pxCurrentTCB =  pxNewTCB;
 
-				if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
-				{
-					/* This is the first task to be created so do the preliminary
-					initialisation required.  We will not recover if this call
-					fails, but we will report the failure. */
-					prvInitialiseTaskLists();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+			if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
+			{
+				/* This is the first task to be created so do the preliminary
+				initialisation required.  We will not recover if this call
+				fails, but we will report the failure. */
+				prvInitialiseTaskLists();
 			}
 			else
 			{
-				/* If the scheduler is not already running, make this task the
-				current task if it is the highest priority task to be created
-				so far. */
-				if( xSchedulerRunning == pdFALSE )
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* If the scheduler is not already running, make this task the
+			current task if it is the highest priority task to be created
+			so far. */
+			if( xSchedulerRunning == pdFALSE )
+			{
+				if( pxCurrentTCB->uxPriority <= uxPriority )
 				{
-					if( pxCurrentTCB->uxPriority <= uxPriority )
-					{
-						pxCurrentTCB = pxNewTCB;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+					pxCurrentTCB = pxNewTCB;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-
-			uxTaskNumber++;
-
-			#if ( configUSE_TRACE_FACILITY == 1 )
+			else
 			{
-				/* Add a counter into the TCB for tracing only. */
-				pxNewTCB->uxTCBNumber = uxTaskNumber;
+				mtCOVERAGE_TEST_MARKER();
 			}
-			#endif /* configUSE_TRACE_FACILITY */
-			traceTASK_CREATE( pxNewTCB );
+		}
 
-			prvAddTaskToReadyList( pxNewTCB );
+		uxTaskNumber++;
 
-			xReturn = pdPASS;
-			portSETUP_TCB( pxNewTCB );
+		#if ( configUSE_TRACE_FACILITY == 1 )
+		{
+			/* Add a counter into the TCB for tracing only. */
+			pxNewTCB->uxTCBNumber = uxTaskNumber;
 		}
-		taskEXIT_CRITICAL();
-	}
-	else
-	{
-		xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
-		traceTASK_CREATE_FAILED();
+		#endif /* configUSE_TRACE_FACILITY */
+		traceTASK_CREATE( pxNewTCB );
+
+		prvAddTaskToReadyList( pxNewTCB );
+
+		portSETUP_TCB( pxNewTCB );
 	}
+	taskEXIT_CRITICAL();
 
-	if( xReturn == pdPASS )
+	if( xSchedulerRunning != pdFALSE )
 	{
-		if( xSchedulerRunning != pdFALSE )
+		/* If the created task is of a higher priority than the current task
+		then it should run now. */
+		if( pxCurrentTCB->uxPriority < uxPriority )
 		{
-			/* If the created task is of a higher priority than the current task
-			then it should run now. */
-			if( pxCurrentTCB->uxPriority < uxPriority )
-			{
-				taskYIELD_IF_USING_PREEMPTION();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			taskYIELD_IF_USING_PREEMPTION();
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
-
-	return xReturn;
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 }
 /*-----------------------------------------------------------*/
 
@@ -1006,7 +1178,7 @@ StackType_t *pxTopOfStack;
 			}
 			taskEXIT_CRITICAL();
 
-			if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
+			if( taskIS_DELAYED_LIST( pxStateList ) )
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -1545,7 +1717,34 @@ void vTaskStartScheduler( void )
 BaseType_t xReturn;
 
 	/* Add the idle task at the lowest priority. */
-	#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+	StaticTask_t *pxIdleTaskTCBBuffer = NULL;
+	StackType_t *pxIdleTaskStackBuffer = NULL;
+	uint16_t usIdleTaskStackSize = tskIDLE_STACK_SIZE;
+	TaskHandle_t xIdleHandle;
+
+		/* The memory of the idle task is provided by the application, so the
+		kernel can be built without a heap. */
+		vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &usIdleTaskStackSize );
+		xIdleHandle = xTaskCreateStatic( prvIdleTask, "IDLE", usIdleTaskStackSize, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), pxIdleTaskStackBuffer, pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+		if( xIdleHandle != NULL )
+		{
+			#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+			{
+				xIdleTaskHandle = xIdleHandle;
+			}
+			#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	#elif ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 	{
 		/* Create the idle task, storing its handle in xIdleTaskHandle so it can
 		be returned by the xTaskGetIdleTaskHandle() function. */
@@ -1556,7 +1755,7 @@ BaseType_t xReturn;
 		/* Create the idle task without storing its handle. */
 		xReturn = xTaskCreate( prvIdleTask, "IDLE", tskIDLE_STACK_SIZE, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), NULL );  /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
 	}
-	#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
 
 	#if ( configUSE_TIMERS == 1 )
 	{
@@ -1851,8 +2050,19 @@ UBaseType_t uxTaskGetNumberOfTasks( void )
 
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
-				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+				{
+					for( uxQueue = ( UBaseType_t ) 0U; uxQueue < ( UBaseType_t ) ( taskDELAYED_WHEEL_LEVELS * taskDELAYED_WHEEL_SLOTS ); uxQueue++ )
+					{
+						uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxQueue ] ), eBlocked );
+					}
+				}
+				#else
+				{
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				}
+				#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -1940,6 +2150,9 @@ BaseType_t xTaskIncrementTick( void )
 TCB_t * pxTCB;
 TickType_t xItemValue;
 BaseType_t xSwitchRequired = pdFALSE;
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+	List_t *pxSlot;
+#endif
 
 	/* Called by the portable layer each time a tick interrupt occurs.
 	Increments the tick then checks to see if the new tick value will cause any
@@ -1971,47 +2184,34 @@ BaseType_t xSwitchRequired = pdFALSE;
 			look any further down the list. */
 			if( xConstTickCount >= xNextTaskUnblockTime )
 			{
-				for( ;; )
+				#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
 				{
-					if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+					/* A new revolution of level 0 brings the tasks due on it
+					down from the higher levels. */
+					if( ( xConstTickCount & taskDELAYED_WHEEL_MASK ) == ( TickType_t ) 0U )
 					{
-						/* The delayed list is empty.  Set xNextTaskUnblockTime
-						to the maximum possible value so it is extremely
-						unlikely that the
-						if( xTickCount >= xNextTaskUnblockTime ) test will pass
-						next time through. */
-						xNextTaskUnblockTime = portMAX_DELAY;
-						break;
+						prvCascadeDelayedWheel( xConstTickCount );
 					}
 					else
 					{
-						/* The delayed list is not empty, get the value of the
-						item at the head of the delayed list.  This is the time
-						at which the task at the head of the delayed list must
-						be removed from the Blocked state. */
-						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-						if( xConstTickCount < xItemValue )
-						{
-							/* It is not time to unblock this item yet, but the
-							item value is the time at which the task at the head
-							of the blocked list must be removed from the Blocked
-							state -	so record the item value in
-							xNextTaskUnblockTime. */
-							xNextTaskUnblockTime = xItemValue;
-							break;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+					/* A level 0 slot only holds tasks due within the current
+					revolution, every task in the slot of this tick wakes now. */
+					pxSlot = taskDELAYED_WHEEL_SLOT( 0U, xConstTickCount & taskDELAYED_WHEEL_MASK );
 
-						/* It is time to remove the item from the Blocked state. */
+					while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+					{
+						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
+						configASSERT( xItemValue == xConstTickCount );
+						( void ) xItemValue;
+
+						/* It is time to remove the item from the Blocked state,
+						and from the event list it is waiting on if any. */
 						( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
 
-						/* Is the task waiting on an event also?  If so remove
-						it from the event list. */
 						if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
 						{
 							( void ) uxListRemove( &( pxTCB->xEventListItem ) );
@@ -2021,18 +2221,10 @@ BaseType_t xSwitchRequired = pdFALSE;
 							mtCOVERAGE_TEST_MARKER();
 						}
 
-						/* Place the unblocked task into the appropriate ready
-						list. */
 						prvAddTaskToReadyList( pxTCB );
 
-						/* A task being unblocked cannot cause an immediate
-						context switch if preemption is turned off. */
 						#if (  configUSE_PREEMPTION == 1 )
 						{
-							/* Preemption is on, but a context switch should
-							only be performed if the unblocked task has a
-							priority that is equal to or higher than the
-							currently executing task. */
 							if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
 							{
 								xSwitchRequired = pdTRUE;
@@ -2044,8 +2236,105 @@ BaseType_t xSwitchRequired = pdFALSE;
 						}
 						#endif /* configUSE_PREEMPTION */
 					}
+
+					ulDelayedWheelSlotsInUse[ 0 ] &= ~( 1UL << ( xConstTickCount & taskDELAYED_WHEEL_MASK ) );
+
+					prvSetNextTaskUnblockTimeFrom( xConstTickCount + 1 );
+				}
+				#else
+				{
+					for( ;; )
+					{
+						if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+						{
+							/* The delayed list is empty.  Set xNextTaskUnblockTime
+							to the maximum possible value so it is extremely
+							unlikely that the
+							if( xTickCount >= xNextTaskUnblockTime ) test will pass
+							next time through. */
+							xNextTaskUnblockTime = portMAX_DELAY;
+							break;
+						}
+						else
+						{
+							/* The delayed list is not empty, get the value of the
+							item at the head of the delayed list.  This is the time
+							at which the task at the head of the delayed list must
+							be removed from the Blocked state. */
+							pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+							xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
+
+							if( xConstTickCount < xItemValue )
+							{
+								/* It is not time to unblock this item yet, but the
+								item value is the time at which the task at the head
+								of the blocked list must be removed from the Blocked
+								state -	so record the item value in
+								xNextTaskUnblockTime. */
+								xNextTaskUnblockTime = xItemValue;
+								break;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+
+							/* It is time to remove the item from the Blocked state. */
+							( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+
+							/* Is the task waiting on an event also?  If so remove
+							it from the event list. */
+							if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+							{
+								( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+
+							/* Place the unblocked task into the appropriate ready
+							list. */
+							prvAddTaskToReadyList( pxTCB );
+
+							/* A task being unblocked cannot cause an immediate
+							context switch if preemption is turned off. */
+							#if (  configUSE_PREEMPTION == 1 )
+							{
+								/* Preemption is on, but a context switch should
+								only be performed if the unblocked task has a
+								priority that is equal to or higher than the
+								currently executing task. */
+								if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+								{
+									xSwitchRequired = pdTRUE;
+								}
+								else
+								{
+									mtCOVERAGE_TEST_MARKER();
+								}
+							}
+							#endif /* configUSE_PREEMPTION */
+						}
+					}
+
 				}
+				#endif /* configUSE_DELAYED_TASK_WHEEL */
 			}
+
+			/* Expire the software timers due on this tick. */
+			#if ( ( configUSE_TIMERS == 1 ) && ( configUSE_TIMER_WHEEL == 1 ) )
+			{
+				if( xTimerProcessTick( xConstTickCount ) != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 		}
 
 		/* Tasks of equal priority to the currently running task will share
@@ -2222,19 +2511,13 @@ void vTaskSwitchContext( void )
 
 				/* Add the amount of time the task has been running to the
 				accumulated	time so far.  The time the task started running was
-				stored in ulTaskSwitchedInTime.  Note that there is no overflow
-				protection here	so count values are only valid until the timer
-				overflows.  The guard against negative values is to protect
-				against suspect run time stat counter implementations - which
-				are provided by the application, not the kernel. */
-				if( ulTotalRunTime > ulTaskSwitchedInTime )
-				{
-					pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				stored in ulTaskSwitchedInTime.  The difference is unsigned, so
+				a 32-bit counter that wraps around, such as a cycle counter, is
+				accounted correctly provided a task does not run for a whole
+				counter period at once.  The accumulated counts themselves are
+				only valid until ulRunTimeCounter overflows, differences between
+				two readings of them remain valid. */
+				pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
 				ulTaskSwitchedInTime = ulTotalRunTime;
 		}
 		#endif /* configGENERATE_RUN_TIME_STATS */
@@ -2975,8 +3258,20 @@ UBaseType_t uxPriority;
 		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
 	}
 
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
+	#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+	{
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) ( taskDELAYED_WHEEL_LEVELS * taskDELAYED_WHEEL_SLOTS ); uxPriority++ )
+		{
+			vListInitialise( &( xDelayedTaskWheel[ uxPriority ] ) );
+		}
+	}
+	#else
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		vListInitialise( &xDelayedTaskList2 );
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -2991,10 +3286,14 @@ UBaseType_t uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	#if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+	{
+		/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
+		using list2. */
+		pxDelayedTaskList = &xDelayedTaskList1;
+		pxOverflowDelayedTaskList = &xDelayedTaskList2;
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
@@ -3039,6 +3338,111 @@ static void prvCheckTasksWaitingTermination( void )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+static void prvAddCurrentTaskToDelayedList( TickType_t xTimeToWake )
+{
+TickType_t xVisitTime;
+
+	/* The current tick has been processed already.  A zero block time (the
+	timer task can ask for one) expires on the next tick, as it does with the
+	sorted delayed lists. */
+	if( xTimeToWake == xTickCount )
+	{
+		xTimeToWake++;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xGenericListItem ), xTimeToWake );
+	xVisitTime = prvAddToDelayedWheel( &( pxCurrentTCB->xGenericListItem ), xTickCount + 1 );
+
+	/* A slot only reached once the tick count has overflowed is picked up
+	then, as with the overflow delayed list. */
+	if( ( xVisitTime > xTickCount ) && ( xVisitTime < xNextTaskUnblockTime ) )
+	{
+		xNextTaskUnblockTime = xVisitTime;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvAddToDelayedWheel( ListItem_t * const pxItem, const TickType_t xNextTick )
+{
+TickType_t xSlotTime = listGET_LIST_ITEM_VALUE( pxItem );
+uint32_t ulDelta = ( uint32_t ) ( TickType_t ) ( xSlotTime - xNextTick );
+UBaseType_t uxLevel, uxShift, uxSlot;
+
+	/* The lowest level whose range, from xNextTick, holds the wake time. */
+	uxLevel = ( UBaseType_t ) 0U;
+	while( ( uxLevel < ( UBaseType_t ) ( taskDELAYED_WHEEL_LEVELS - 1U ) ) && ( ulDelta >= ( 1UL << ( taskDELAYED_WHEEL_BITS * ( uxLevel + 1U ) ) ) ) )
+	{
+		uxLevel++;
+	}
+
+	if( ulDelta >= taskDELAYED_WHEEL_RANGE )
+	{
+		/* Beyond the wheel: the task waits in the last slot of the top level
+		and is placed again when that slot is reached. */
+		xSlotTime = ( TickType_t ) ( xNextTick + ( TickType_t ) ( taskDELAYED_WHEEL_RANGE - 1UL ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	uxShift = ( UBaseType_t ) ( taskDELAYED_WHEEL_BITS * uxLevel );
+	uxSlot = ( UBaseType_t ) ( ( xSlotTime >> uxShift ) & taskDELAYED_WHEEL_MASK );
+	vListInsertEnd( taskDELAYED_WHEEL_SLOT( uxLevel, uxSlot ), pxItem );
+	ulDelayedWheelSlotsInUse[ uxLevel ] |= ( 1UL << uxSlot );
+
+	/* Level 0 slots are walked on their tick, higher level slots are moved
+	down on their first tick. */
+	return ( TickType_t ) ( ( xSlotTime >> uxShift ) << uxShift );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCascadeDelayedWheel( const TickType_t xTick )
+{
+List_t *pxSlot;
+ListItem_t *pxItem;
+UBaseType_t uxLevel, uxSlot;
+
+	for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) taskDELAYED_WHEEL_LEVELS; uxLevel++ )
+	{
+		uxSlot = ( UBaseType_t ) ( ( xTick >> ( taskDELAYED_WHEEL_BITS * uxLevel ) ) & taskDELAYED_WHEEL_MASK );
+		pxSlot = taskDELAYED_WHEEL_SLOT( uxLevel, uxSlot );
+
+		/* Every task of the slot is due within the slot, so goes to a lower
+		level - or back to the top level when beyond the wheel. */
+		ulDelayedWheelSlotsInUse[ uxLevel ] &= ~( 1UL << uxSlot );
+
+		while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+		{
+			pxItem = listGET_HEAD_ENTRY( pxSlot );
+			( void ) uxListRemove( pxItem );
+			( void ) prvAddToDelayedWheel( pxItem, xTick );
+		}
+
+		/* Only a level starting a revolution starts a slot of the next. */
+		if( uxSlot != ( UBaseType_t ) 0U )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
 static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake )
 {
 	/* The list item will be inserted in wake time order. */
@@ -3067,81 +3471,76 @@ static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake )
 		}
 	}
 }
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 /*-----------------------------------------------------------*/
 
-static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer )
-{
-TCB_t *pxNewTCB;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	/* If the stack grows down then allocate the stack then the TCB so the stack
-	does not grow into the TCB.  Likewise if the stack grows up then allocate
-	the TCB then the stack. */
-	#if( portSTACK_GROWTH > 0 )
+	static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer )
 	{
-		/* Allocate space for the TCB.  Where the memory comes from depends on
-		the implementation of the port malloc function. */
-		pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+	TCB_t *pxNewTCB;
 
-		if( pxNewTCB != NULL )
+		/* If the stack grows down then allocate the stack then the TCB so the stack
+		does not grow into the TCB.  Likewise if the stack grows up then allocate
+		the TCB then the stack. */
+		#if( portSTACK_GROWTH > 0 )
 		{
-			/* Allocate space for the stack used by the task being created.
-			The base of the stack memory stored in the TCB so the task can
-			be deleted later if required. */
-			pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocAligned( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ), puxStackBuffer ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			/* Allocate space for the TCB.  Where the memory comes from depends on
+			the implementation of the port malloc function. */
+			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
 
-			if( pxNewTCB->pxStack == NULL )
+			if( pxNewTCB != NULL )
 			{
-				/* Could not allocate the stack.  Delete the allocated TCB. */
-				vPortFree( pxNewTCB );
-				pxNewTCB = NULL;
+				/* Allocate space for the stack used by the task being created.
+				The base of the stack memory stored in the TCB so the task can
+				be deleted later if required. */
+				pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocAligned( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ), puxStackBuffer ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+				if( pxNewTCB->pxStack == NULL )
+				{
+					/* Could not allocate the stack.  Delete the allocated TCB. */
+					vPortFree( pxNewTCB );
+					pxNewTCB = NULL;
+				}
 			}
 		}
-	}
-	#else /* portSTACK_GROWTH */
-	{
-	StackType_t *pxStack;
-
-		/* Allocate space for the stack used by the task being created. */
-		pxStack = ( StackType_t * ) pvPortMallocAligned( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ), puxStackBuffer ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-		if( pxStack != NULL )
+		#else /* portSTACK_GROWTH */
 		{
-			/* Allocate space for the TCB.  Where the memory comes from depends
-			on the implementation of the port malloc function. */
-			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+		StackType_t *pxStack;
 
-			if( pxNewTCB != NULL )
+			/* Allocate space for the stack used by the task being created. */
+			pxStack = ( StackType_t * ) pvPortMallocAligned( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ), puxStackBuffer ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+			if( pxStack != NULL )
 			{
-				/* Store the stack location in the TCB. */
-				pxNewTCB->pxStack = pxStack;
+				/* Allocate space for the TCB.  Where the memory comes from depends
+				on the implementation of the port malloc function. */
+				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+				if( pxNewTCB != NULL )
+				{
+					/* Store the stack location in the TCB. */
+					pxNewTCB->pxStack = pxStack;
+				}
+				else
+				{
+					/* The stack cannot be used as the TCB was not created.  Free it
+					again. */
+					vPortFree( pxStack );
+				}
 			}
 			else
 			{
-				/* The stack cannot be used as the TCB was not created.  Free it
-				again. */
-				vPortFree( pxStack );
+				pxNewTCB = NULL;
 			}
 		}
-		else
-		{
-			pxNewTCB = NULL;
-		}
-	}
-	#endif /* portSTACK_GROWTH */
+		#endif /* portSTACK_GROWTH */
 
-	if( pxNewTCB != NULL )
-	{
-		/* Avoid dependency on memset() if it is not required. */
-		#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
-		{
-			/* Just to help debugging. */
-			( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) usStackDepth * sizeof( StackType_t ) );
-		}
-		#endif /* ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) ) */
+		return pxNewTCB;
 	}
 
-	return pxNewTCB;
-}
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TRACE_FACILITY == 1 )
@@ -3294,6 +3693,33 @@ TCB_t *pxNewTCB;
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
+		#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		{
+			/* A task created by xTaskCreateStatic() owns neither its TCB nor
+			its stack. */
+			if( pxTCB->ucStaticallyAllocated == pdFALSE )
+			{
+				prvFreeTCBAndStack( pxTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#elif( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+		{
+			prvFreeTCBAndStack( pxTCB );
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	}
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_vTaskDelete == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	static void prvFreeTCBAndStack( TCB_t *pxTCB )
+	{
 		#if( portUSING_MPU_WRAPPERS == 1 )
 		{
 			/* Only free the stack if it was allocated dynamically in the first
@@ -3315,6 +3741,75 @@ TCB_t *pxNewTCB;
 #endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+static void prvSetNextTaskUnblockTimeFrom( const TickType_t xFromTime )
+{
+uint32_t ulSlots;
+UBaseType_t uxLevel, uxShift, uxRotate, uxDistance;
+TickType_t xStart, xNextTime;
+
+	xNextTaskUnblockTime = portMAX_DELAY;
+
+	for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) taskDELAYED_WHEEL_LEVELS; uxLevel++ )
+	{
+		ulSlots = ulDelayedWheelSlotsInUse[ uxLevel ];
+
+		if( ulSlots != 0UL )
+		{
+			/* The first slot start of this level from xFromTime on. */
+			uxShift = ( UBaseType_t ) ( taskDELAYED_WHEEL_BITS * uxLevel );
+			xStart = ( TickType_t ) ( xFromTime + ( TickType_t ) ( ( ( TickType_t ) 1U << uxShift ) - 1U ) );
+			xStart = ( TickType_t ) ( ( xStart >> uxShift ) << uxShift );
+
+			/* Rotate the slot bits so bit 0 stands for the slot starting at
+			xStart, the lowest set bit is then the distance to the next slot in
+			use. */
+			uxRotate = ( UBaseType_t ) ( ( xStart >> uxShift ) & taskDELAYED_WHEEL_MASK );
+			if( uxRotate != ( UBaseType_t ) 0U )
+			{
+				ulSlots = ( ulSlots >> uxRotate ) | ( ulSlots << ( taskDELAYED_WHEEL_SLOTS - uxRotate ) );
+			}
+
+			#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+			{
+				/* Isolate the lowest set bit and let the port find its index. */
+				portGET_HIGHEST_PRIORITY( uxDistance, ( ulSlots & ( ~ulSlots + 1UL ) ) );
+			}
+			#else
+			{
+				for( uxDistance = ( UBaseType_t ) 0U; ( ulSlots & 1UL ) == 0UL; uxDistance++ )
+				{
+					ulSlots >>= 1UL;
+				}
+			}
+			#endif
+
+			xNextTime = ( TickType_t ) ( xStart + ( TickType_t ) ( ( TickType_t ) uxDistance << uxShift ) );
+
+			/* A slot only reached after the tick count overflows is left to
+			the recomputation made then. */
+			if( ( xNextTime >= xTickCount ) && ( xStart >= xTickCount ) && ( xNextTime < xNextTaskUnblockTime ) )
+			{
+				xNextTaskUnblockTime = xNextTime;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvResetNextTaskUnblockTime( void )
+{
+	/* The slot of the current tick has been walked already. */
+	prvSetNextTaskUnblockTimeFrom( xTickCount + 1 );
+}
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
 static void prvResetNextTaskUnblockTime( void )
 {
 TCB_t *pxTCB;
@@ -3337,6 +3832,8 @@ TCB_t *pxTCB;
 		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xGenericListItem ) );
 	}
 }
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
@@ -3595,7 +4092,7 @@ TCB_t *pxTCB;
 #endif /* portCRITICAL_NESTING_IN_TCB */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	static char *prvWriteNameToBuffer( char *pcBuffer, const char *pcTaskName )
 	{
@@ -3618,10 +4115,10 @@ TCB_t *pxTCB;
 		return &( pcBuffer[ x ] );
 	}
 
-#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
+#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	void vTaskList( char * pcWriteBuffer )
 	{
@@ -3710,10 +4207,10 @@ TCB_t *pxTCB;
 		}
 	}
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*----------------------------------------------------------*/
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	void vTaskGetRunTimeStats( char *pcWriteBuffer )
 	{
@@ -3834,7 +4331,7 @@ TCB_t *pxTCB;
 		}
 	}
 
-#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
 TickType_t uxTaskResetEventItemValue( void )
@@ -3868,6 +4365,33 @@ TickType_t uxReturn;
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEXES == 1 )
+
+	BaseType_t xTaskDecrementMutexHeldCount( void )
+	{
+	BaseType_t xReturn;
+
+		/* Only the running task changes its own count, so no critical section
+		is needed.  A task that inherited a priority has to go through
+		xTaskPriorityDisinherit() instead, which moves it between the ready
+		lists. */
+		if( pxCurrentTCB->uxPriority == pxCurrentTCB->uxBasePriority )
+		{
+			configASSERT( pxCurrentTCB->uxMutexesHeld );
+			( pxCurrentTCB->uxMutexesHeld )--;
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if( configUSE_TASK_NOTIFICATIONS == 1 )
 
 	uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
@@ -84,6 +84,12 @@ task.h is included from an application file. */
 	#error configUSE_TIMERS must be set to 1 to make the xTimerPendFunctionCall() function available.
 #endif
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+	#if ( configUSE_TICKLESS_IDLE != 0 )
+		#error configUSE_TIMER_WHEEL cannot be used with configUSE_TICKLESS_IDLE as the timer expiry times are not visible to the idle task.
+	#endif
+#endif
+
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
 header files above, but not in this file, in order to generate the correct
@@ -100,6 +106,30 @@ configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
 
+/* With configUSE_TIMER_WHEEL set to 1 active timers are kept in a
+hierarchical wheel of unsorted lists, as the delayed tasks are in tasks.c.
+Level 0 has one list per tick for the next 32 ticks, each list of level n
+covers 32 lists of level n - 1, and a timer is in the lowest level whose range
+holds its expiry time.  The list item value holds the full expiry time.
+Starting, resetting, stopping and changing the period of a timer is then done
+straight from the calling task or interrupt, in a critical section, instead of
+through the timer queue.  On each tick the kernel expires the timers of the
+level 0 list of that tick and, every 32 ticks, moves the timers of the next
+list of level 1 (and so on up) down a level (xTimerProcessTick()).  Timers
+whose callback runs from the tick (see vTimerSetCallbackFromTick()) are
+processed there, the others are moved to xExpiredTimerList for the timer
+service task to call. */
+#if ( configUSE_TIMER_WHEEL == 1 )
+	#define tmrWHEEL_BITS		( 5U )
+	#define tmrWHEEL_SLOTS		( 1U << tmrWHEEL_BITS )
+	#define tmrWHEEL_MASK		( ( TickType_t ) ( tmrWHEEL_SLOTS - 1U ) )
+	#define tmrWHEEL_LEVELS		( 4U )
+	#define tmrWHEEL_RANGE		( 1UL << ( tmrWHEEL_BITS * tmrWHEEL_LEVELS ) )
+
+	/* List uxSlot of level uxLevel. */
+	#define tmrWHEEL_SLOT( uxLevel, uxSlot )	( &( xTimerWheel[ ( ( uxLevel ) * tmrWHEEL_SLOTS ) + ( uxSlot ) ] ) )
+#endif
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -109,9 +139,15 @@ typedef struct tmrTimerControl
 	UBaseType_t				uxAutoReload;		/*<< Set to pdTRUE if the timer should be automatically restarted once expired.  Set to pdFALSE if the timer is, in effect, a one-shot timer. */
 	void 					*pvTimerID;			/*<< An ID to identify the timer.  This allows the timer to be identified when the same callback is used for multiple timers. */
 	TimerCallbackFunction_t	pxCallbackFunction;	/*<< The function that will be called when the timer expires. */
+	#if( configUSE_TIMER_WHEEL == 1 )
+		UBaseType_t			uxCallbackFromTick;	/*<< Set to pdTRUE if the callback is called from the tick interrupt rather than from the timer service task. */
+	#endif
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t			uxTimerNumber;		/*<< An ID assigned by trace tools such as FreeRTOS+Trace */
 	#endif
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		uint8_t				ucStaticallyAllocated;	/*<< Set to pdTRUE if the timer was created from a StaticTimer_t, so it is not freed when it is deleted. */
+	#endif
 } xTIMER;
 
 /* The old xTIMER name is maintained above then typedefed to the new Timer_t
@@ -147,8 +183,9 @@ typedef struct tmrTimerQueueMessage
 		TimerParameter_t xTimerParameters;
 
 		/* Don't include xCallbackParameters if it is not going to be used as
-		it makes the structure (and therefore the timer queue) larger. */
-		#if ( INCLUDE_xTimerPendFunctionCall == 1 )
+		it makes the structure (and therefore the timer queue) larger.  The
+		timer wheel uses it to wake the timer service task. */
+		#if ( ( INCLUDE_xTimerPendFunctionCall == 1 ) || ( configUSE_TIMER_WHEEL == 1 ) )
 			CallbackParameters_t xCallbackParameters;
 		#endif /* INCLUDE_xTimerPendFunctionCall */
 	} u;
@@ -157,17 +194,43 @@ typedef struct tmrTimerQueueMessage
 /*lint -e956 A manual analysis and inspection has been used to determine which
 static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
-time order, with the nearest expiry time at the front of the list.  Only the
-timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+	/* The lists in which active timers are stored, and the lists expired
+	timers are moved to until their callback is called by the timer service
+	task or, for xTickExpiredTimerList, from the tick.  These lists are
+	accessed from interrupts, so only from critical sections. */
+	PRIVILEGED_DATA static List_t xTimerWheel[ tmrWHEEL_LEVELS * tmrWHEEL_SLOTS ];
+	PRIVILEGED_DATA static List_t xExpiredTimerList;
+	PRIVILEGED_DATA static List_t xTickExpiredTimerList;
+
+	/* Set while a request to process xExpiredTimerList is in the timer
+	queue, so the tick does not post one on every expiry. */
+	PRIVILEGED_DATA static volatile BaseType_t xExpiredTimersPosted = pdFALSE;
+
+#else
+
+	/* The list in which active timers are stored.  Timers are referenced in expire
+	time order, with the nearest expiry time at the front of the list.  Only the
+	timer service task is allowed to access these lists. */
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
 
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	/* The timer queue is not allocated when static allocation is used. */
+	PRIVILEGED_DATA static StaticQueue_t xStaticTimerQueue;
+	PRIVILEGED_DATA static uint8_t ucStaticTimerQueueStorage[ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ];
+
+#endif
+
 #if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
 
 	PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
@@ -197,6 +260,47 @@ static void prvTimerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
  */
 static void	prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Called by xTimerCreate() and xTimerCreateStatic() to set a newly allocated
+ * timer up.
+ */
+static void prvInitialiseNewTimer( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, Timer_t *pxNewTimer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/*
+ * Called by the timer service task to release the memory of a deleted timer,
+ * unless it was provided to xTimerCreateStatic().
+ */
+static void prvFreeTimer( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+/*
+ * Insert the timer in the wheel to expire one period after xCommandTime, or on
+ * the next tick if that time has already passed.  Called from a critical
+ * section.
+ */
+static void prvInsertTimerInWheel( Timer_t * const pxTimer, const TickType_t xCommandTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Place a timer whose list item value is set to its expiry time in the wheel,
+ * as seen from xNextTick, the first tick not processed yet.
+ */
+static void prvPlaceTimerInWheel( ListItem_t * const pxItem, const TickType_t xNextTick ) PRIVILEGED_FUNCTION;
+
+/*
+ * Apply a start, reset, stop or change period command straight away, from the
+ * task or interrupt that issued it.
+ */
+static void prvApplyTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Call the callbacks of the timers in xExpiredTimerList, reloading the auto
+ * reload timers.  Run by the timer service task, the parameters are unused.
+ */
+static void prvProcessExpiredTimers( void *pvParameter1, uint32_t ulParameter2 ) PRIVILEGED_FUNCTION;
+
+#else
+
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
  * depending on if the expire time causes a timer counter overflow.
@@ -235,6 +339,8 @@ static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIV
  */
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, const BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
 
+#endif /* configUSE_TIMER_WHEEL */
+
 /*-----------------------------------------------------------*/
 
 BaseType_t xTimerCreateTimerTask( void )
@@ -249,7 +355,33 @@ BaseType_t xReturn = pdFAIL;
 
 	if( xTimerQueue != NULL )
 	{
-		#if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
+		#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		{
+		StaticTask_t *pxTimerTaskTCBBuffer = NULL;
+		StackType_t *pxTimerTaskStackBuffer = NULL;
+		uint16_t usTimerTaskStackSize = ( uint16_t ) configTIMER_TASK_STACK_DEPTH;
+		TaskHandle_t xHandle;
+
+			/* The memory of the timer task is provided by the application. */
+			vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &usTimerTaskStackSize );
+			xHandle = xTaskCreateStatic( prvTimerTask, "Tmr Svc", usTimerTaskStackSize, NULL, ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT, pxTimerTaskStackBuffer, pxTimerTaskTCBBuffer );
+
+			if( xHandle != NULL )
+			{
+				#if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
+				{
+					xTimerTaskHandle = xHandle;
+				}
+				#endif
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#elif ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
 		{
 			/* Create the timer task, storing its handle in xTimerTaskHandle so
 			it can be returned by the xTimerGetTimerDaemonTaskHandle() function. */
@@ -272,44 +404,99 @@ BaseType_t xReturn = pdFAIL;
 }
 /*-----------------------------------------------------------*/
 
-TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-Timer_t *pxNewTimer;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	/* Allocate the timer structure. */
-	if( xTimerPeriodInTicks == ( TickType_t ) 0U )
+	TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-		pxNewTimer = NULL;
+	Timer_t *pxNewTimer;
+
+		/* Allocate the timer structure. */
+		if( xTimerPeriodInTicks == ( TickType_t ) 0U )
+		{
+			pxNewTimer = NULL;
+		}
+		else
+		{
+			pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
+			if( pxNewTimer != NULL )
+			{
+				#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+				{
+					/* The timer is freed if it is deleted. */
+					pxNewTimer->ucStaticallyAllocated = pdFALSE;
+				}
+				#endif
+
+				prvInitialiseNewTimer( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxNewTimer );
+			}
+			else
+			{
+				traceTIMER_CREATE_FAILED();
+			}
+		}
+
+		/* 0 is not a valid value for xTimerPeriodInTicks. */
+		configASSERT( ( xTimerPeriodInTicks > 0 ) );
+
+		return ( TimerHandle_t ) pxNewTimer;
 	}
-	else
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	TimerHandle_t xTimerCreateStatic( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t *pxTimerBuffer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-		pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
-		if( pxNewTimer != NULL )
-		{
-			/* Ensure the infrastructure used by the timer service task has been
-			created/initialised. */
-			prvCheckForValidListAndQueue();
+	Timer_t *pxNewTimer = NULL;
+
+		/* 0 is not a valid value for xTimerPeriodInTicks. */
+		configASSERT( ( xTimerPeriodInTicks > 0 ) );
+		configASSERT( pxTimerBuffer != NULL );
 
-			/* Initialise the timer structure members using the function parameters. */
-			pxNewTimer->pcTimerName = pcTimerName;
-			pxNewTimer->xTimerPeriodInTicks = xTimerPeriodInTicks;
-			pxNewTimer->uxAutoReload = uxAutoReload;
-			pxNewTimer->pvTimerID = pvTimerID;
-			pxNewTimer->pxCallbackFunction = pxCallbackFunction;
-			vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
+		/* StaticTimer_t must have the size of the timer it stands for, see
+		timers.h. */
+		configASSERT( sizeof( StaticTimer_t ) == sizeof( Timer_t ) );
 
-			traceTIMER_CREATE( pxNewTimer );
+		if( ( xTimerPeriodInTicks != ( TickType_t ) 0U ) && ( pxTimerBuffer != NULL ) )
+		{
+			pxNewTimer = ( Timer_t * ) pxTimerBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+			pxNewTimer->ucStaticallyAllocated = pdTRUE;
+
+			prvInitialiseNewTimer( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxNewTimer );
 		}
 		else
 		{
 			traceTIMER_CREATE_FAILED();
 		}
+
+		return ( TimerHandle_t ) pxNewTimer;
 	}
 
-	/* 0 is not a valid value for xTimerPeriodInTicks. */
-	configASSERT( ( xTimerPeriodInTicks > 0 ) );
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewTimer( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, Timer_t *pxNewTimer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+	/* Ensure the infrastructure used by the timer service task has been
+	created/initialised. */
+	prvCheckForValidListAndQueue();
+
+	/* Initialise the timer structure members using the function parameters. */
+	pxNewTimer->pcTimerName = pcTimerName;
+	pxNewTimer->xTimerPeriodInTicks = xTimerPeriodInTicks;
+	pxNewTimer->uxAutoReload = uxAutoReload;
+	pxNewTimer->pvTimerID = pvTimerID;
+	pxNewTimer->pxCallbackFunction = pxCallbackFunction;
+	vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
 
-	return ( TimerHandle_t ) pxNewTimer;
+	#if( configUSE_TIMER_WHEEL == 1 )
+	{
+		pxNewTimer->uxCallbackFromTick = ( UBaseType_t ) pdFALSE;
+	}
+	#endif
+
+	traceTIMER_CREATE( pxNewTimer );
 }
 /*-----------------------------------------------------------*/
 
@@ -320,6 +507,20 @@ DaemonTaskMessage_t xMessage;
 
 	/* Send a message to the timer service task to perform a particular action
 	on a particular timer definition. */
+	#if ( configUSE_TIMER_WHEEL == 1 )
+	if( ( xTimerQueue != NULL ) && ( xCommandID != tmrCOMMAND_DELETE ) )
+	{
+		/* The wheel is updated straight away, only deleting a timer goes
+		through the timer service task, which frees it. */
+		( void ) pxHigherPriorityTaskWoken;
+		( void ) xTicksToWait;
+		prvApplyTimerCommand( ( Timer_t * ) xTimer, xCommandID, xOptionalValue );
+		xReturn = pdPASS;
+
+		traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+	}
+	else
+	#endif /* configUSE_TIMER_WHEEL */
 	if( xTimerQueue != NULL )
 	{
 		/* Send a command to the timer service task to start the xTimer timer. */
@@ -375,6 +576,8 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
@@ -415,23 +618,54 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 }
 /*-----------------------------------------------------------*/
 
+#endif /* configUSE_TIMER_WHEEL */
+
 static void prvTimerTask( void *pvParameters )
 {
-TickType_t xNextExpireTime;
-BaseType_t xListWasEmpty;
+#if ( configUSE_TIMER_WHEEL == 0 )
+	TickType_t xNextExpireTime;
+	BaseType_t xListWasEmpty;
+#endif
 
 	/* Just to avoid compiler warnings. */
 	( void ) pvParameters;
 
 	for( ;; )
 	{
-		/* Query the timers list to see if it contains any timers, and if so,
-		obtain the time at which the next timer will expire. */
-		xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
+		#if ( configUSE_TIMER_WHEEL == 1 )
+		{
+			/* Expired timers are normally handed over through the timer
+			queue, but the tick does not post a request when the queue is
+			full, so look before blocking. */
+			prvProcessExpiredTimers( NULL, 0 );
+
+			/* Block until a command, or a request to process expired timers,
+			is received.  The timer expiry times are tracked by the tick, not
+			by the block time of this task. */
+			vTaskSuspendAll();
+			{
+				vQueueWaitForMessageRestricted( xTimerQueue, portMAX_DELAY );
+			}
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			/* Query the timers list to see if it contains any timers, and if so,
+			obtain the time at which the next timer will expire. */
+			xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
 
-		/* If a timer has expired, process it.  Otherwise, block this task
-		until either a timer does expire, or a command is received. */
-		prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+			/* If a timer has expired, process it.  Otherwise, block this task
+			until either a timer does expire, or a command is received. */
+			prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+		}
+		#endif /* configUSE_TIMER_WHEEL */
 
 		/* Empty the command queue. */
 		prvProcessReceivedCommands();
@@ -439,6 +673,8 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, const BaseType_t xListWasEmpty )
 {
 TickType_t xTimeNow;
@@ -582,16 +818,325 @@ BaseType_t xProcessTimerNow = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
+#else /* configUSE_TIMER_WHEEL */
+
+static void prvInsertTimerInWheel( Timer_t * const pxTimer, const TickType_t xCommandTime, const TickType_t xTimeNow )
+{
+TickType_t xExpiryTime;
+
+	if( ( xTimeNow - xCommandTime ) < pxTimer->xTimerPeriodInTicks )
+	{
+		xExpiryTime = xCommandTime + pxTimer->xTimerPeriodInTicks;
+	}
+	else
+	{
+		/* The expiry time passed before the command was applied.  The list
+		of the current tick has already been walked. */
+		xExpiryTime = xTimeNow + ( TickType_t ) 1U;
+	}
+
+	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xExpiryTime );
+	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+	prvPlaceTimerInWheel( &( pxTimer->xTimerListItem ), xTimeNow + ( TickType_t ) 1U );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPlaceTimerInWheel( ListItem_t * const pxItem, const TickType_t xNextTick )
+{
+TickType_t xSlotTime = listGET_LIST_ITEM_VALUE( pxItem );
+uint32_t ulDelta = ( uint32_t ) ( TickType_t ) ( xSlotTime - xNextTick );
+UBaseType_t uxLevel;
+
+	/* The lowest level whose range, from xNextTick, holds the expiry time. */
+	uxLevel = ( UBaseType_t ) 0U;
+	while( ( uxLevel < ( UBaseType_t ) ( tmrWHEEL_LEVELS - 1U ) ) && ( ulDelta >= ( 1UL << ( tmrWHEEL_BITS * ( uxLevel + 1U ) ) ) ) )
+	{
+		uxLevel++;
+	}
+
+	if( ulDelta >= tmrWHEEL_RANGE )
+	{
+		/* Beyond the wheel: the timer waits in the last list of the top
+		level and is placed again when that list is reached. */
+		xSlotTime = ( TickType_t ) ( xNextTick + ( TickType_t ) ( tmrWHEEL_RANGE - 1UL ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	vListInsertEnd( tmrWHEEL_SLOT( uxLevel, ( xSlotTime >> ( tmrWHEEL_BITS * uxLevel ) ) & tmrWHEEL_MASK ), pxItem );
+}
+/*-----------------------------------------------------------*/
+
+static void prvApplyTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue )
+{
+UBaseType_t uxSavedInterruptStatus = 0;
+TickType_t xTimeNow;
+
+	if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+	{
+		taskENTER_CRITICAL();
+		xTimeNow = xTaskGetTickCount();
+	}
+	else
+	{
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		xTimeNow = xTaskGetTickCountFromISR();
+	}
+	{
+		/* Whatever the command, the timer leaves the list it is in, possibly
+		an expired list if its callback has not been called yet. */
+		if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+		{
+			( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		switch( xCommandID )
+		{
+			case tmrCOMMAND_START :
+			case tmrCOMMAND_START_FROM_ISR :
+			case tmrCOMMAND_RESET :
+			case tmrCOMMAND_RESET_FROM_ISR :
+			case tmrCOMMAND_START_DONT_TRACE :
+				prvInsertTimerInWheel( pxTimer, xOptionalValue, xTimeNow );
+				break;
+
+			case tmrCOMMAND_CHANGE_PERIOD :
+			case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+				pxTimer->xTimerPeriodInTicks = xOptionalValue;
+				configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+				prvInsertTimerInWheel( pxTimer, xTimeNow, xTimeNow );
+				break;
+
+			default :
+				/* Stopped, the timer has been removed above. */
+				break;
+		}
+	}
+	if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+	{
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+	traceTIMER_COMMAND_RECEIVED( pxTimer, xCommandID, xOptionalValue );
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessExpiredTimers( void *pvParameter1, uint32_t ulParameter2 )
+{
+Timer_t *pxTimer;
+TickType_t xExpiryTime;
+
+	( void ) pvParameter1;
+	( void ) ulParameter2;
+
+	taskENTER_CRITICAL();
+	{
+		xExpiredTimersPosted = pdFALSE;
+	}
+	taskEXIT_CRITICAL();
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( listLIST_IS_EMPTY( &xExpiredTimerList ) == pdFALSE )
+			{
+				pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( &xExpiredTimerList );
+				xExpiryTime = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+
+				if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+				{
+					if( ( xTaskGetTickCount() - xExpiryTime ) < pxTimer->xTimerPeriodInTicks )
+					{
+						prvInsertTimerInWheel( pxTimer, xExpiryTime, xTaskGetTickCount() );
+					}
+					else
+					{
+						/* This task ran too late for the next expiry time,
+						which has also passed.  Queue the timer again so its
+						callback is called as many times as it expired. */
+						listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xExpiryTime + pxTimer->xTimerPeriodInTicks );
+						vListInsertEnd( &xExpiredTimerList, &( pxTimer->xTimerListItem ) );
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				pxTimer = NULL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( pxTimer == NULL )
+		{
+			break;
+		}
+
+		traceTIMER_EXPIRED( pxTimer );
+		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTimerProcessTick( const TickType_t xTickCount )
+{
+List_t *pxSlot;
+ListItem_t *pxItem;
+Timer_t *pxTimer;
+DaemonTaskMessage_t xMessage;
+UBaseType_t uxLevel, uxSlot;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* Called by the kernel on each tick, with interrupts masked.  Nothing to
+	do until the timer infrastructure exists. */
+	if( xTimerQueue == NULL )
+	{
+		return pdFALSE;
+	}
+
+	/* A new revolution of level 0 brings the timers expiring in it down from
+	level 1, and so on up the levels for as long as the lower level starts a
+	revolution too. */
+	if( ( xTickCount & tmrWHEEL_MASK ) == ( TickType_t ) 0U )
+	{
+		for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) tmrWHEEL_LEVELS; uxLevel++ )
+		{
+			uxSlot = ( UBaseType_t ) ( ( xTickCount >> ( tmrWHEEL_BITS * uxLevel ) ) & tmrWHEEL_MASK );
+			pxSlot = tmrWHEEL_SLOT( uxLevel, uxSlot );
+
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxItem = listGET_HEAD_ENTRY( pxSlot );
+				( void ) uxListRemove( pxItem );
+				prvPlaceTimerInWheel( pxItem, xTickCount );
+			}
+
+			if( uxSlot != ( UBaseType_t ) 0U )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* A level 0 list only holds timers expiring within the current
+	revolution, every timer in the list of this tick expires now. */
+	pxSlot = tmrWHEEL_SLOT( 0U, xTickCount & tmrWHEEL_MASK );
+	while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+	{
+		pxItem = listGET_HEAD_ENTRY( pxSlot );
+		pxTimer = ( Timer_t * ) listGET_LIST_ITEM_OWNER( pxItem );
+		configASSERT( listGET_LIST_ITEM_VALUE( pxItem ) == xTickCount );
+		( void ) uxListRemove( pxItem );
+
+		if( pxTimer->uxCallbackFromTick != ( UBaseType_t ) pdFALSE )
+		{
+			vListInsertEnd( &xTickExpiredTimerList, pxItem );
+		}
+		else
+		{
+			vListInsertEnd( &xExpiredTimerList, pxItem );
+		}
+	}
+
+	/* The callbacks are only called once the list has been walked, as they
+	can start and stop timers. */
+	while( listLIST_IS_EMPTY( &xTickExpiredTimerList ) == pdFALSE )
+	{
+		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( &xTickExpiredTimerList );
+		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+
+		if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+		{
+			prvInsertTimerInWheel( pxTimer, xTickCount, xTickCount );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceTIMER_EXPIRED( pxTimer );
+		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+	}
+
+	/* Wake the timer service task for the other timers. */
+	if( ( listLIST_IS_EMPTY( &xExpiredTimerList ) == pdFALSE ) && ( xExpiredTimersPosted == pdFALSE ) )
+	{
+		xMessage.xMessageID = tmrCOMMAND_EXECUTE_CALLBACK_FROM_ISR;
+		xMessage.u.xCallbackParameters.pxCallbackFunction = prvProcessExpiredTimers;
+		xMessage.u.xCallbackParameters.pvParameter1 = NULL;
+		xMessage.u.xCallbackParameters.ulParameter2 = 0UL;
+
+		if( xQueueSendFromISR( xTimerQueue, &xMessage, &xHigherPriorityTaskWoken ) == pdPASS )
+		{
+			xExpiredTimersPosted = pdTRUE;
+		}
+		else
+		{
+			/* The queue is full, so the timer service task is due to run
+			and looks at the expired timers before it blocks again. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xHigherPriorityTaskWoken;
+}
+/*-----------------------------------------------------------*/
+
+void vTimerSetCallbackFromTick( TimerHandle_t xTimer, const UBaseType_t uxFromTick )
+{
+Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+	configASSERT( xTimer );
+
+	taskENTER_CRITICAL();
+	{
+		pxTimer->uxCallbackFromTick = uxFromTick;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TIMER_WHEEL */
+
 static void	prvProcessReceivedCommands( void )
 {
 DaemonTaskMessage_t xMessage;
 Timer_t *pxTimer;
-BaseType_t xTimerListsWereSwitched, xResult;
-TickType_t xTimeNow;
+#if ( configUSE_TIMER_WHEEL == 0 )
+	BaseType_t xTimerListsWereSwitched, xResult;
+	TickType_t xTimeNow;
+#endif
 
 	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
 	{
-		#if ( INCLUDE_xTimerPendFunctionCall == 1 )
+		#if ( ( INCLUDE_xTimerPendFunctionCall == 1 ) || ( configUSE_TIMER_WHEEL == 1 ) )
 		{
 			/* Negative commands are pended function calls rather than timer
 			commands. */
@@ -621,93 +1166,121 @@ TickType_t xTimeNow;
 			software timer. */
 			pxTimer = xMessage.u.xTimerParameters.pxTimer;
 
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+			#if ( configUSE_TIMER_WHEEL == 1 )
 			{
-				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				/* Only deletes are queued when the wheel is used, the timer
+				lists are shared with the tick. */
+				configASSERT( xMessage.xMessageID == tmrCOMMAND_DELETE );
+				traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+
+				taskENTER_CRITICAL();
+				{
+					if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+					{
+						( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+
+				prvFreeTimer( pxTimer );
 			}
-			else
+			#else
 			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-
-			traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+				if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+				{
+					/* The timer is in a list, remove it. */
+					( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-			/* In this case the xTimerListsWereSwitched parameter is not used, but
-			it must be present in the function call.  prvSampleTimeNow() must be
-			called after the message is received from xTimerQueue so there is no
-			possibility of a higher priority task adding a message to the message
-			queue with a time that is ahead of the timer daemon task (because it
-			pre-empted the timer daemon task after the xTimeNow value was set). */
-			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+				traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
 
-			switch( xMessage.xMessageID )
-			{
-				case tmrCOMMAND_START :
-			    case tmrCOMMAND_START_FROM_ISR :
-			    case tmrCOMMAND_RESET :
-			    case tmrCOMMAND_RESET_FROM_ISR :
-				case tmrCOMMAND_START_DONT_TRACE :
-					/* Start or restart a timer. */
-					if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) == pdTRUE )
-					{
-						/* The timer expired before it was added to the active
-						timer list.  Process it now. */
-						pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-						traceTIMER_EXPIRED( pxTimer );
+				/* In this case the xTimerListsWereSwitched parameter is not used, but
+				it must be present in the function call.  prvSampleTimeNow() must be
+				called after the message is received from xTimerQueue so there is no
+				possibility of a higher priority task adding a message to the message
+				queue with a time that is ahead of the timer daemon task (because it
+				pre-empted the timer daemon task after the xTimeNow value was set). */
+				xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
 
-						if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+				switch( xMessage.xMessageID )
+				{
+					case tmrCOMMAND_START :
+				    case tmrCOMMAND_START_FROM_ISR :
+				    case tmrCOMMAND_RESET :
+				    case tmrCOMMAND_RESET_FROM_ISR :
+					case tmrCOMMAND_START_DONT_TRACE :
+						/* Start or restart a timer. */
+						if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) == pdTRUE )
 						{
-							xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
-							configASSERT( xResult );
-							( void ) xResult;
+							/* The timer expired before it was added to the active
+							timer list.  Process it now. */
+							pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+							traceTIMER_EXPIRED( pxTimer );
+
+							if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+							{
+								xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
+								configASSERT( xResult );
+								( void ) xResult;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
 						}
 						else
 						{
 							mtCOVERAGE_TEST_MARKER();
 						}
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-					break;
-
-				case tmrCOMMAND_STOP :
-				case tmrCOMMAND_STOP_FROM_ISR :
-					/* The timer has already been removed from the active list.
-					There is nothing to do here. */
-					break;
-
-				case tmrCOMMAND_CHANGE_PERIOD :
-				case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
-					pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
-					configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
-
-					/* The new period does not really have a reference, and can be
-					longer or shorter than the old one.  The command time is
-					therefore set to the current time, and as the period cannot be
-					zero the next expiry time can only be in the future, meaning
-					(unlike for the xTimerStart() case above) there is no fail case
-					that needs to be handled here. */
-					( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
-					break;
-
-				case tmrCOMMAND_DELETE :
-					/* The timer has already been removed from the active list,
-					just free up the memory. */
-					vPortFree( pxTimer );
-					break;
-
-				default	:
-					/* Don't expect to get here. */
-					break;
+						break;
+
+					case tmrCOMMAND_STOP :
+					case tmrCOMMAND_STOP_FROM_ISR :
+						/* The timer has already been removed from the active list.
+						There is nothing to do here. */
+						break;
+
+					case tmrCOMMAND_CHANGE_PERIOD :
+					case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+						pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
+						configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+						/* The new period does not really have a reference, and can be
+						longer or shorter than the old one.  The command time is
+						therefore set to the current time, and as the period cannot be
+						zero the next expiry time can only be in the future, meaning
+						(unlike for the xTimerStart() case above) there is no fail case
+						that needs to be handled here. */
+						( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+						break;
+
+					case tmrCOMMAND_DELETE :
+						/* The timer has already been removed from the active list,
+						just free up the memory. */
+						prvFreeTimer( pxTimer );
+						break;
+
+					default	:
+						/* Don't expect to get here. */
+						break;
+				}
 			}
+			#endif /* configUSE_TIMER_WHEEL */
 		}
 	}
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -767,6 +1340,34 @@ BaseType_t xResult;
 }
 /*-----------------------------------------------------------*/
 
+#endif /* configUSE_TIMER_WHEEL */
+
+static void prvFreeTimer( Timer_t * const pxTimer )
+{
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	{
+		if( pxTimer->ucStaticallyAllocated == pdFALSE )
+		{
+			vPortFree( pxTimer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#elif( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		vPortFree( pxTimer );
+	}
+	#else
+	{
+		/* Every timer is created by xTimerCreateStatic(). */
+		( void ) pxTimer;
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
 static void prvCheckForValidListAndQueue( void )
 {
 	/* Check that the list from which active timers are referenced, and the
@@ -776,11 +1377,34 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
-			xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+			#if ( configUSE_TIMER_WHEEL == 1 )
+			{
+			UBaseType_t uxSlot;
+
+				for( uxSlot = ( UBaseType_t ) 0U; uxSlot < ( UBaseType_t ) ( tmrWHEEL_LEVELS * tmrWHEEL_SLOTS ); uxSlot++ )
+				{
+					vListInitialise( &( xTimerWheel[ uxSlot ] ) );
+				}
+				vListInitialise( &xExpiredTimerList );
+				vListInitialise( &xTickExpiredTimerList );
+			}
+			#else
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#endif /* configUSE_TIMER_WHEEL */
+			#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ), ucStaticTimerQueueStorage, &xStaticTimerQueue );
+			}
+			#else
+			{
+				xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
 			configASSERT( xTimerQueue );
 
 			#if ( configQUEUE_REGISTRY_SIZE > 0 )
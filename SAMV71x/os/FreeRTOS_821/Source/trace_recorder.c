@@ -0,0 +1,404 @@
+/*
+    FreeRTOS V8.2.1 - Copyright (C) 2015 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    ***************************************************************************
+    >>!   NOTE: The modification to the GPL is included to allow you to     !<<
+    >>!   distribute a combined work that includes FreeRTOS without being   !<<
+    >>!   obliged to provide the source code for proprietary components     !<<
+    >>!   outside of the FreeRTOS kernel.                                   !<<
+    ***************************************************************************
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available on the following
+    link: http://www.freertos.org/a00114.html
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that is more than just the market leader, it     *
+     *    is the industry's de facto standard.                               *
+     *                                                                       *
+     *    Help yourself get started quickly while simultaneously helping     *
+     *    to support the FreeRTOS project by purchasing a FreeRTOS           *
+     *    tutorial book, reference manual, or both:                          *
+     *    http://www.FreeRTOS.org/Documentation                              *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org/FAQHelp.html - Having a problem?  Start by reading
+    the FAQ page "My application does not run, what could be wrong?".  Have you
+    defined configASSERT()?
+
+    http://www.FreeRTOS.org/support - In return for receiving this top quality
+    embedded software for free we request you assist our global community by
+    participating in the support forum.
+
+    http://www.FreeRTOS.org/training - Investing in training allows your team to
+    be as productive as possible as early as possible.  Now you can receive
+    FreeRTOS training directly from Richard Barry, CEO of Real Time Engineers
+    Ltd, and the world's leading authority on the world's leading RTOS.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.FreeRTOS.org/labs - Where new FreeRTOS products go to incubate.
+    Come and try FreeRTOS+TCP, our new open source TCP/IP stack for FreeRTOS.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd. license FreeRTOS to High
+    Integrity Systems ltd. to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and commercial middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes, FreeRTOS.h includes trace_recorder.h. */
+#include "FreeRTOS.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include the trace recorder.  This #if is closed at the very bottom of this
+file. */
+#if ( configUSE_TRACE_RECORDER == 1 )
+
+#if ( ( configTRACE_RECORDER_EVENTS & ( configTRACE_RECORDER_EVENTS - 1 ) ) != 0 )
+	#error configTRACE_RECORDER_EVENTS must be a power of two.
+#endif
+
+#if ( ( configTRACE_RECORDER_NAME_LENGTH & 3 ) != 0 )
+	#error configTRACE_RECORDER_NAME_LENGTH must be a multiple of four.
+#endif
+
+/* The position of the next event in the ring buffer is the number of events
+written, masked. */
+#define tracerecEVENT_INDEX_MASK	( ( uint32_t ) configTRACE_RECORDER_EVENTS - 1UL )
+
+/* One event, see trace_recorder.h. */
+typedef struct xTRACE_EVENT
+{
+	uint32_t ulTimestamp;
+	uint8_t ucEvent;
+	uint8_t ucParameter;
+	uint16_t usObject;
+} TraceEvent_t;
+
+/* One entry of the name table. */
+typedef struct xTRACE_NAME
+{
+	uint16_t usObject;
+	uint8_t ucKind;										/*< tracerecNAME_FREE when the entry is free. */
+	uint8_t ucDeleted;									/*< Set once the object is deleted, the entry is then reused when the table is full. */
+	char cName[ configTRACE_RECORDER_NAME_LENGTH ];		/*< Always terminated. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+} TraceName_t;
+
+/* The recording, laid out as described in trace_recorder.h.  The header is
+written by vTraceRecorderStart(), before that the structure is all zeros - it
+is not initialised statically so it does not take room in the flash. */
+typedef struct xTRACE_RECORDER
+{
+	uint32_t ulMagic;
+	uint32_t ulVersion;
+	uint32_t ulTimestampHz;
+	uint32_t ulEventCapacity;
+	uint32_t ulNameCapacity;
+	uint32_t ulNameLength;
+	volatile uint32_t ulEventsWritten;
+	volatile uint32_t ulRunning;
+	TraceName_t xNames[ configTRACE_RECORDER_NAMES ];
+	TraceEvent_t xEvents[ configTRACE_RECORDER_EVENTS ];
+} TraceRecorder_t;
+
+/*-----------------------------------------------------------*/
+
+/* Updated with interrupts masked. */
+PRIVILEGED_DATA static TraceRecorder_t xTraceRecorder;
+
+/* The number given to the last queue created, 0 is never used. */
+PRIVILEGED_DATA static UBaseType_t uxLastQueueNumber = ( UBaseType_t ) 0U;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Enter the name of an object in the name table, replacing its previous name
+ * if it has one.  When the table is full the entry of a deleted object is
+ * reused, if there is none the name is lost.
+ */
+static void prvSetName( uint8_t ucKind, UBaseType_t uxObject, const char *pcName ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/*
+ * Mark the entry of a deleted object for reuse, its name is kept until then
+ * for the events still in the buffer.
+ */
+static void prvSetDeleted( uint8_t ucKind, UBaseType_t uxObject ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStart( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		xTraceRecorder.ulMagic = tracerecMAGIC;
+		xTraceRecorder.ulVersion = tracerecVERSION;
+		xTraceRecorder.ulTimestampHz = ( uint32_t ) configTRACE_RECORDER_TIMESTAMP_HZ;
+		xTraceRecorder.ulEventCapacity = ( uint32_t ) configTRACE_RECORDER_EVENTS;
+		xTraceRecorder.ulNameCapacity = ( uint32_t ) configTRACE_RECORDER_NAMES;
+		xTraceRecorder.ulNameLength = ( uint32_t ) configTRACE_RECORDER_NAME_LENGTH;
+		xTraceRecorder.ulRunning = 1UL;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+	xTraceRecorder.ulRunning = 0UL;
+}
+/*-----------------------------------------------------------*/
+
+const void *pvTraceRecorderGetBuffer( size_t *pxSize )
+{
+	configASSERT( pxSize );
+
+	*pxSize = sizeof( xTraceRecorder );
+	return &xTraceRecorder;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderEvent( uint8_t ucEvent, uint8_t ucParameter, uint16_t usObject )
+{
+UBaseType_t uxSavedInterruptStatus;
+TraceEvent_t *pxEvent;
+
+	if( xTraceRecorder.ulRunning != 0UL )
+	{
+		/* The time stamp is read with interrupts masked too, so the events are
+		in time order in the buffer. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			pxEvent = &( xTraceRecorder.xEvents[ xTraceRecorder.ulEventsWritten & tracerecEVENT_INDEX_MASK ] );
+			xTraceRecorder.ulEventsWritten++;
+
+			pxEvent->ulTimestamp = configTRACE_RECORDER_TIMESTAMP();
+			pxEvent->ucEvent = ucEvent;
+			pxEvent->ucParameter = ucParameter;
+			pxEvent->usObject = usObject;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderTaskCreate( UBaseType_t uxTask, const char *pcName, UBaseType_t uxPriority ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+	prvSetName( tracerecNAME_TASK, uxTask, pcName );
+	vTraceRecorderEvent( tracerecEVENT_TASK_CREATE, ( uint8_t ) uxPriority, ( uint16_t ) uxTask );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderTaskDelete( UBaseType_t uxTask )
+{
+	prvSetDeleted( tracerecNAME_TASK, uxTask );
+	vTraceRecorderEvent( tracerecEVENT_TASK_DELETE, 0U, ( uint16_t ) uxTask );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTraceRecorderQueueCreate( uint8_t ucQueueType )
+{
+UBaseType_t uxSavedInterruptStatus, uxQueue;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Numbers are recorded on 16 bits, once they wrap around a number can
+		be given to two queues that exist at the same time. */
+		uxLastQueueNumber++;
+		if( ( uint16_t ) uxLastQueueNumber == 0U )
+		{
+			uxLastQueueNumber++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxQueue = uxLastQueueNumber;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	vTraceRecorderEvent( tracerecEVENT_QUEUE_CREATE, ucQueueType, ( uint16_t ) uxQueue );
+
+	return uxQueue;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderQueueDelete( UBaseType_t uxQueue )
+{
+	prvSetDeleted( tracerecNAME_QUEUE, uxQueue );
+	vTraceRecorderEvent( tracerecEVENT_QUEUE_DELETE, 0U, ( uint16_t ) uxQueue );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderQueueName( UBaseType_t uxQueue, const char *pcName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+	prvSetName( tracerecNAME_QUEUE, uxQueue, pcName );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderTick( TickType_t xTickCount )
+{
+	/* The time reference the decoder unwraps the time stamps with. */
+	if( ( xTickCount % ( TickType_t ) configTICK_RATE_HZ ) == ( TickType_t ) 0 )
+	{
+		vTraceRecorderEvent( tracerecEVENT_TICK, 0U, ( uint16_t ) ( xTickCount / ( TickType_t ) configTICK_RATE_HZ ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderISRName( UBaseType_t uxISR, const char *pcName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+	prvSetName( tracerecNAME_ISR, uxISR, pcName );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderISREnter( void )
+{
+	vTraceRecorderEvent( tracerecEVENT_ISR_ENTER, 0U, 0U );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderISRExit( UBaseType_t uxISR )
+{
+	vTraceRecorderEvent( tracerecEVENT_ISR_EXIT, 0U, ( uint16_t ) uxISR );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderMark( uint16_t usMark, uint8_t ucValue )
+{
+	vTraceRecorderEvent( tracerecEVENT_MARK, ucValue, usMark );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetName( uint8_t ucKind, UBaseType_t uxObject, const char *pcName ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+UBaseType_t uxSavedInterruptStatus, ux;
+TraceName_t *pxEntry = NULL, *pxFree = NULL, *pxDeleted = NULL;
+
+	configASSERT( pcName );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configTRACE_RECORDER_NAMES; ux++ )
+		{
+			if( xTraceRecorder.xNames[ ux ].ucKind == tracerecNAME_FREE )
+			{
+				if( pxFree == NULL )
+				{
+					pxFree = &( xTraceRecorder.xNames[ ux ] );
+				}
+			}
+			else if( xTraceRecorder.xNames[ ux ].ucDeleted != 0U )
+			{
+				if( pxDeleted == NULL )
+				{
+					pxDeleted = &( xTraceRecorder.xNames[ ux ] );
+				}
+			}
+			else if( ( xTraceRecorder.xNames[ ux ].ucKind == ucKind ) && ( xTraceRecorder.xNames[ ux ].usObject == ( uint16_t ) uxObject ) )
+			{
+				pxEntry = &( xTraceRecorder.xNames[ ux ] );
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( pxEntry == NULL )
+		{
+			pxEntry = ( pxFree != NULL ) ? pxFree : pxDeleted;
+		}
+
+		if( pxEntry != NULL )
+		{
+			pxEntry->usObject = ( uint16_t ) uxObject;
+			pxEntry->ucKind = ucKind;
+			pxEntry->ucDeleted = 0U;
+			strncpy( pxEntry->cName, pcName, sizeof( pxEntry->cName ) - 1U );
+			pxEntry->cName[ sizeof( pxEntry->cName ) - 1U ] = ( char ) 0x00;
+		}
+		else
+		{
+			/* configTRACE_RECORDER_NAMES is too small, the decoder names the
+			object after its number. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetDeleted( uint8_t ucKind, UBaseType_t uxObject )
+{
+UBaseType_t uxSavedInterruptStatus, ux;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		for( ux = ( UBaseType_t ) 0U; ux < ( UBaseType_t ) configTRACE_RECORDER_NAMES; ux++ )
+		{
+			if( ( xTraceRecorder.xNames[ ux ].ucKind == ucKind ) && ( xTraceRecorder.xNames[ ux ].usObject == ( uint16_t ) uxObject ) )
+			{
+				xTraceRecorder.xNames[ ux ].ucDeleted = 1U;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include the trace recorder. */
+#endif /* configUSE_TRACE_RECORDER == 1 */
+